@@ -0,0 +1,111 @@
+#include <filesystem>
+#include <memory>
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/buffer/buffer_manager.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto PAGE_SIZE_TYPE = PageSizeType::KiB64;
+constexpr auto DRAM_BUFFER_POOL_SIZE = uint64_t{1} << 30;  // 1 GiB
+
+// All threads of a benchmark share one buffer manager that is created by the first thread.
+std::unique_ptr<BufferManager> buffer_manager;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void create_buffer_manager() {
+  auto config = BufferManager::Config{};
+  config.dram_buffer_pool_size = DRAM_BUFFER_POOL_SIZE;
+  config.reserved_virtual_memory_per_size_type = 16 * DRAM_BUFFER_POOL_SIZE;
+  config.ssd_path = std::filesystem::temp_directory_path() / "hyrise_buffer_manager_benchmark";
+  buffer_manager = std::make_unique<BufferManager>(config);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+/**
+ * Measures the pin/unpin throughput for pages that are resident in main memory, i.e., the latching overhead of the
+ * buffer manager. Each thread randomly pins pages of a working set that fits into the buffer pool. The argument
+ * determines whether the pages are pinned in shared (0) or exclusive (1) mode.
+ */
+static void BM_BufferManagerPinUnpin(benchmark::State& state) {
+  const auto exclusive = state.range(0) == 1;
+  const auto page_count = DRAM_BUFFER_POOL_SIZE / bytes_for_size_type(PAGE_SIZE_TYPE) / 2;
+
+  if (state.thread_index() == 0) {
+    create_buffer_manager();
+    // Make the working set resident before the measurement starts.
+    for (auto index = uint64_t{0}; index < page_count; ++index) {
+      buffer_manager->pin_exclusive(PageID{PAGE_SIZE_TYPE, index});
+      buffer_manager->unpin_exclusive(PageID{PAGE_SIZE_TYPE, index});
+    }
+  }
+
+  auto random_engine = std::minstd_rand(state.thread_index());
+  auto distribution = std::uniform_int_distribution<uint64_t>(0, page_count - 1);
+
+  for (auto _ : state) {
+    const auto page_id = PageID{PAGE_SIZE_TYPE, distribution(random_engine)};
+    if (exclusive) {
+      buffer_manager->pin_exclusive(page_id);
+      benchmark::DoNotOptimize(*buffer_manager->get_page(page_id));
+      buffer_manager->unpin_exclusive(page_id);
+    } else {
+      buffer_manager->pin_shared(page_id);
+      benchmark::DoNotOptimize(*buffer_manager->get_page(page_id));
+      buffer_manager->unpin_shared(page_id);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+  if (state.thread_index() == 0) {
+    buffer_manager = nullptr;
+  }
+}
+
+/**
+ * Measures the eviction bandwidth. Each thread writes to its own range of pages, and the total working set is four
+ * times larger than the buffer pool. Thus, nearly every pin has to evict a dirty page (i.e., write it to the SSD and
+ * release its memory) and fault in a page from the SSD.
+ */
+static void BM_BufferManagerEviction(benchmark::State& state) {
+  const auto page_size = bytes_for_size_type(PAGE_SIZE_TYPE);
+  const auto pages_per_thread = 4 * DRAM_BUFFER_POOL_SIZE / page_size / static_cast<uint64_t>(state.threads());
+
+  if (state.thread_index() == 0) {
+    create_buffer_manager();
+  }
+
+  const auto first_page_index = pages_per_thread * static_cast<uint64_t>(state.thread_index());
+  auto offset = uint64_t{0};
+
+  for (auto _ : state) {
+    const auto page_id = PageID{PAGE_SIZE_TYPE, first_page_index + offset};
+    buffer_manager->pin_exclusive(page_id);
+    *buffer_manager->get_page(page_id) = std::byte{1};
+    buffer_manager->set_dirty(page_id);
+    buffer_manager->unpin_exclusive(page_id);
+    offset = (offset + 1) % pages_per_thread;
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * page_size));
+
+  if (state.thread_index() == 0) {
+    const auto metrics = buffer_manager->metrics();
+    state.counters["evicted_bytes"] = static_cast<double>(metrics.total_bytes_evicted);
+    state.counters["ssd_written_bytes"] = static_cast<double>(metrics.total_bytes_written_to_ssd);
+    state.counters["ssd_read_bytes"] = static_cast<double>(metrics.total_bytes_read_from_ssd);
+    buffer_manager = nullptr;
+  }
+}
+
+BENCHMARK(BM_BufferManagerPinUnpin)->Arg(0)->Arg(1)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(BM_BufferManagerEviction)->ThreadRange(1, 128)->UseRealTime();
+
+}  // namespace hyrise
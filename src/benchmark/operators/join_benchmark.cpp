@@ -1,4 +1,6 @@
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -102,6 +104,26 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// Sweeps the number of radix bits of JoinHash for inputs whose hash tables exceed the private CPU caches. The
+// number of radix bits chosen by JoinHash::calculate_radix_bits() is benchmarked with the argument -1. Values above
+// JoinHash::MAX_RADIX_BITS_PER_PASS use two partitioning passes.
+void BM_JoinHash_RadixBits(benchmark::State& state) {  // NOLINT 10,000,000 x 10,000,000
+  auto table_wrapper_left = generate_table(TABLE_SIZE_BIG);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_BIG);
+  const auto radix_bits =
+      state.range(0) < 0 ? std::optional<size_t>{} : std::optional<size_t>{static_cast<size_t>(state.range(0))};
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  clear_cache();
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Inner, primary_predicate,
+                                           std::vector<OperatorJoinPredicate>{}, radix_bits);
+    join->execute();
+  }
+
+  Hyrise::reset();
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -111,6 +133,7 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK(BM_JoinHash_RadixBits)->Arg(-1)->DenseRange(0, 12, 2);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
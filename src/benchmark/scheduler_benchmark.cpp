@@ -0,0 +1,57 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace hyrise {
+
+/**
+ * Measures the task throughput of the NodeQueueScheduler for fine-grained tasks. In each iteration, a root task
+ * (executed by a worker) spawns many tiny jobs via schedule_and_wait_for_tasks, similar to an operator that spawns one
+ * job per chunk. The jobs are pushed to the worker's deque, from which the other workers steal them. The first argument
+ * is the number of workers, the second one the number of workers per (fake) NUMA node.
+ */
+static void BM_SchedulerTaskThroughput(benchmark::State& state) {
+  constexpr auto JOB_COUNT = size_t{10'000};
+
+  const auto worker_count = static_cast<uint32_t>(state.range(0));
+  const auto workers_per_node = static_cast<uint32_t>(state.range(1));
+  Hyrise::get().topology.use_fake_numa_topology(worker_count, workers_per_node);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto counter = std::atomic_uint64_t{0};
+  for (auto _ : state) {
+    const auto root_task = std::make_shared<JobTask>([&]() {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(JOB_COUNT);
+      for (auto job_id = size_t{0}; job_id < JOB_COUNT; ++job_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          counter.fetch_add(1, std::memory_order_relaxed);
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    });
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({root_task});
+  }
+
+  benchmark::DoNotOptimize(counter.load());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * JOB_COUNT));
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+BENCHMARK(BM_SchedulerTaskThroughput)
+    ->ArgsProduct({{8, 16, 32, 64, 128}, {8, 128}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace hyrise
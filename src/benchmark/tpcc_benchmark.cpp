@@ -1,7 +1,14 @@
 #include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "magic_enum.hpp"
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -18,7 +25,9 @@ using namespace hyrise;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Data is only persisted if the write-ahead log is enabled (--wal). As there are no checkpoints, the durability
+ *    tests are not executed. With the log enabled, the reported transaction latencies and throughput include the
+ *    commit logging, and the achieved group commit sizes are printed after the benchmark.
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -40,7 +49,9 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("10"))
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false"));  // NOLINT(whitespace/line_length)
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("wal", "Path of the write-ahead log. If empty, commits are not logged", cxxopts::value<std::string>()->default_value(""))  // NOLINT(whitespace/line_length)
+    ("wal_sync_mode", "Sync mode of the write-ahead log (GroupCommit, Asynchronous, NoSync)", cxxopts::value<std::string>()->default_value("GroupCommit"));  // NOLINT(whitespace/line_length)
   // clang-format on
 
   auto config = std::shared_ptr<BenchmarkConfig>{};
@@ -70,12 +81,34 @@ int main(int argc, char* argv[]) {
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
 
+  const auto wal_path = cli_parse_result["wal"].as<std::string>();
+  if (!wal_path.empty()) {
+    const auto sync_mode = magic_enum::enum_cast<LogSyncMode>(cli_parse_result["wal_sync_mode"].as<std::string>());
+    Assert(sync_mode, "Unknown sync mode for the write-ahead log.");
+    std::cout << "- Logging commits to " << wal_path << " (" << magic_enum::enum_name(*sync_mode) << ")\n";
+    context.emplace("wal_sync_mode", magic_enum::enum_name(*sync_mode));
+
+    // The log is continued if it already exists. Start from a fresh log as the tables are generated anew.
+    std::filesystem::remove(wal_path);
+    auto wal_config = WriteAheadLog::Config{};
+    wal_config.path = wal_path;
+    wal_config.sync_mode = *sync_mode;
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(wal_config);
+  }
+
   // Run the benchmark
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
   BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
                   context)
       .run();
 
+  if (const auto& write_ahead_log = Hyrise::get().write_ahead_log) {
+    const auto metrics = write_ahead_log->metrics();
+    std::cout << "- Write-ahead log: " << metrics.record_count << " commit records, " << metrics.flush_count
+              << " flushes (" << static_cast<double>(metrics.record_count) / static_cast<double>(metrics.flush_count)
+              << " commits per flush), " << metrics.bytes_written / 1'000'000 << " MB written\n";
+  }
+
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark\n";
     check_consistency(num_warehouses);
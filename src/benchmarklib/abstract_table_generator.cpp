@@ -41,6 +41,7 @@ void to_json(nlohmann::json& json, const TableGenerationMetrics& metrics) {
   json = {{"generation_duration", metrics.generation_duration.count()},
           {"encoding_duration", metrics.encoding_duration.count()},
           {"binary_caching_duration", metrics.binary_caching_duration.count()},
+          {"numa_placement_duration", metrics.numa_placement_duration.count()},
           {"sort_duration", metrics.sort_duration.count()},
           {"store_duration", metrics.store_duration.count()},
           {"chunk_index_duration", metrics.chunk_index_duration.count()},
@@ -293,6 +294,33 @@ void AbstractTableGenerator::generate_and_store() {
               << std::flush;
   }
 
+  /**
+   * Distribute the chunks of all tables round-robin across the NUMA nodes. Each chunk is copied by a job on its target
+   * node, and operators later schedule their per-chunk jobs on that node (see Chunk::numa_node_id).
+   */
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  if (node_count > 1) {
+    std::cout << "- Placing chunks on " << node_count << " NUMA nodes\n" << std::flush;
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto& [table_name, table_info] : table_info_by_name) {
+      const auto& table = table_info.table;
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto node_id = NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)};
+        const auto job = std::make_shared<JobTask>([&table, chunk_id, node_id]() {
+          table->get_chunk(chunk_id)->migrate(Hyrise::get().topology.memory_resource(node_id));
+        });
+        job->set_preferred_node_id(node_id);
+        jobs.emplace_back(job);
+      }
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    metrics.numa_placement_duration = timer.lap();
+    std::cout << "- Placing chunks done (" << format_duration(metrics.numa_placement_duration) << ")\n" << std::flush;
+  }
+
   /**
    * Add the Tables to the StorageManager
    */
@@ -0,0 +1,480 @@
+#include "checkpointer.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "resolve_type.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+enum class CheckpointChunkState : uint8_t { Complete, Incomplete, Removed };
+
+/**
+ * Layout of the manifest (all integers in host byte order, strings as uint32_t length followed by the characters):
+ *
+ *   uint64_t checkpoint number | CommitID snapshot commit ID | uint32_t table count | tables
+ *   Tables:  name | ChunkOffset target chunk size | ColumnCount | per column: name, DataType, nullable flag |
+ *            ChunkID chunk count | chunks
+ *   Chunks:  CheckpointChunkState | file name | ChunkOffset row count | uint32_t deleted row count | deleted offsets |
+ *            uint32_t pending row count | pending offsets
+ */
+template <typename T>
+void write_value(std::ofstream& stream, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly.");
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ofstream& stream, const std::string& string) {
+  write_value(stream, static_cast<uint32_t>(string.size()));
+  stream.write(string.data(), static_cast<std::streamsize>(string.size()));
+}
+
+void write_offsets(std::ofstream& stream, const std::vector<ChunkOffset>& offsets) {
+  write_value(stream, static_cast<uint32_t>(offsets.size()));
+  stream.write(reinterpret_cast<const char*>(offsets.data()),
+               static_cast<std::streamsize>(offsets.size() * sizeof(ChunkOffset)));
+}
+
+template <typename T>
+T read_value(std::ifstream& stream) {
+  auto value = T{};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string read_string(std::ifstream& stream) {
+  auto string = std::string(read_value<uint32_t>(stream), '\0');
+  stream.read(string.data(), static_cast<std::streamsize>(string.size()));
+  return string;
+}
+
+std::vector<ChunkOffset> read_offsets(std::ifstream& stream) {
+  auto offsets = std::vector<ChunkOffset>(read_value<uint32_t>(stream));
+  stream.read(reinterpret_cast<char*>(offsets.data()),
+              static_cast<std::streamsize>(offsets.size() * sizeof(ChunkOffset)));
+  return offsets;
+}
+
+// std::ofstream does not sync the written data. For files and directories, fsync also works on read-only descriptors.
+void sync_path(const std::filesystem::path& path) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Failed to open '" + path.string() + "': " + std::string{std::strerror(errno)});
+  Assert(fsync(file_descriptor) == 0, "Failed to sync '" + path.string() + "': " + std::string{std::strerror(errno)});
+  close(file_descriptor);
+}
+
+Segments chunk_segments(const Chunk& chunk) {
+  auto segments = Segments{};
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(chunk.get_segment(column_id));
+  }
+  return segments;
+}
+
+// Writes the segments as a single-chunk table in the format of the BinaryWriter.
+uint64_t write_chunk_file(const Table& table, const Segments& segments,
+                          const std::vector<SortColumnDefinition>& sorted_by, const std::filesystem::path& path) {
+  const auto chunk = std::make_shared<Chunk>(segments);
+  if (!sorted_by.empty()) {
+    chunk->set_individually_sorted_by(sorted_by);
+  }
+  const auto chunks = std::vector<std::shared_ptr<Chunk>>{chunk};
+  const auto chunk_table = Table{table.column_definitions(), TableType::Data, chunks};
+  BinaryWriter::write(chunk_table, path.string());
+  sync_path(path);
+  return std::filesystem::file_size(path);
+}
+
+// Copies the first row_count rows of the chunk into ValueSegments. Mutable chunks can be appended to concurrently, but
+// values of rows that are visible to the checkpoint have been written before the checkpoint started.
+Segments materialize_chunk(const Table& table, const Chunk& chunk, const ChunkOffset row_count) {
+  auto segments = Segments{};
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto is_nullable = table.column_is_nullable(column_id);
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(is_nullable ? row_count : 0);
+
+      const auto& segment = chunk.get_segment(column_id);
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        // The values are copied directly. Thus, the segment's pages have to be pinned.
+        const auto pin_guard = SharedPagePinGuard{value_segment->buffer_pages()};
+        const auto& segment_values = value_segment->values();
+        std::copy(segment_values.begin(), segment_values.begin() + row_count, values.begin());
+        if (is_nullable) {
+          const auto& segment_null_values = value_segment->null_values();
+          std::copy(segment_null_values.begin(), segment_null_values.begin() + row_count, null_values.begin());
+        }
+      } else {
+        // Encoded segments belong to immutable chunks and are not modified anymore.
+        segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+          const auto chunk_offset = position.chunk_offset();
+          if (position.is_null()) {
+            null_values[chunk_offset] = true;
+          } else {
+            values[chunk_offset] = position.value();
+          }
+        });
+      }
+
+      if (is_nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+  return segments;
+}
+
+// Number of rows of a mutable chunk that can safely be read. Inserts resize all segments before they write any row, so
+// that the smallest segment covers all rows that were inserted before the checkpoint started.
+ChunkOffset readable_row_count(const Chunk& chunk) {
+  auto row_count = chunk.size();
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{1}; column_id < column_count; ++column_id) {
+    row_count = std::min(row_count, chunk.get_segment(column_id)->size());
+  }
+  return row_count;
+}
+
+// Reads the single chunk of a file written by write_chunk_file.
+std::shared_ptr<Chunk> read_chunk_file(const std::filesystem::path& path) {
+  const auto chunk_table = BinaryParser::parse(path.string());
+  Assert(chunk_table->chunk_count() == 1, "Checkpoint file '" + path.string() + "' is corrupted.");
+  return chunk_table->get_chunk(ChunkID{0});
+}
+
+}  // namespace
+
+namespace hyrise {
+
+Checkpointer::Checkpointer(const std::filesystem::path& directory) : _directory{directory} {
+  std::filesystem::create_directories(_directory);
+
+  // Continue the numbering of an existing checkpoint so that its chunk files are not overwritten.
+  const auto manifest_path = _directory / MANIFEST_FILENAME;
+  if (std::filesystem::exists(manifest_path)) {
+    auto manifest = std::ifstream{manifest_path, std::ios::binary};
+    manifest.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    _checkpoint_number = read_value<uint64_t>(manifest);
+  }
+}
+
+Checkpointer::~Checkpointer() {
+  // Stop the background thread before the members that it uses are destroyed.
+  _loop_thread.reset();
+}
+
+Checkpointer::Metrics Checkpointer::write_checkpoint() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  // The transaction context registers the snapshot commit ID as active. Thus, the MvccDeletePlugin does not remove
+  // chunks that are still visible for the checkpoint. As the transaction does not modify anything, it does not have to
+  // be committed.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto checkpoint_number = _checkpoint_number + 1;
+
+  auto metrics = Metrics{};
+  metrics.snapshot_commit_id = snapshot_commit_id;
+
+  const auto manifest_path = _directory / MANIFEST_FILENAME;
+  auto temporary_manifest_path = manifest_path;
+  temporary_manifest_path += ".tmp";
+  auto manifest = std::ofstream{};
+  manifest.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  manifest.open(temporary_manifest_path, std::ios::binary | std::ios::trunc);
+
+  const auto tables = Hyrise::get().storage_manager.tables();
+  write_value(manifest, checkpoint_number);
+  write_value(manifest, snapshot_commit_id);
+  write_value(manifest, static_cast<uint32_t>(tables.size()));
+
+  auto written_chunks = std::unordered_map<std::string, std::vector<WrittenChunk>>{};
+  auto referenced_files = std::unordered_set<std::string>{};
+
+  for (const auto& [table_name, table] : tables) {
+    Assert(table->uses_mvcc() == UseMvcc::Yes, "Can only checkpoint tables with MVCC data.");
+
+    write_string(manifest, table_name);
+    write_value(manifest, table->target_chunk_size());
+    const auto column_count = table->column_count();
+    write_value(manifest, column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      write_string(manifest, table->column_name(column_id));
+      write_value(manifest, table->column_data_type(column_id));
+      write_value(manifest, static_cast<BoolAsByteType>(table->column_is_nullable(column_id)));
+    }
+
+    const auto table_directory = _directory / table_name;
+    std::filesystem::create_directories(table_directory);
+
+    const auto& previous_chunks = _written_chunks[table_name];
+    auto& table_chunks = written_chunks[table_name];
+    const auto chunk_count = table->chunk_count();
+    write_value(manifest, chunk_count);
+    table_chunks.resize(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) {
+        write_value(manifest, CheckpointChunkState::Removed);
+        write_string(manifest, "");
+        write_value(manifest, ChunkOffset{0});
+        write_offsets(manifest, {});
+        write_offsets(manifest, {});
+        continue;
+      }
+
+      // Check the mutability first. Once a chunk is immutable, all Inserts into it have finished.
+      const auto is_mutable = chunk->is_mutable();
+      const auto row_count = is_mutable ? readable_row_count(*chunk) : chunk->size();
+
+      const auto& mvcc_data = chunk->mvcc_data();
+      auto deleted_offsets = std::vector<ChunkOffset>{};
+      auto pending_offsets = std::vector<ChunkOffset>{};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (mvcc_data->get_begin_cid(chunk_offset) > snapshot_commit_id) {
+          pending_offsets.push_back(chunk_offset);
+        } else if (mvcc_data->get_end_cid(chunk_offset) <= snapshot_commit_id) {
+          // Deleted or rolled back before the snapshot.
+          deleted_offsets.push_back(chunk_offset);
+        }
+      }
+
+      const auto is_complete = !is_mutable && pending_offsets.empty();
+      auto filename = std::string{};
+      if (is_complete && chunk_id < previous_chunks.size() && previous_chunks[chunk_id].chunk.lock() == chunk) {
+        filename = previous_chunks[chunk_id].filename;
+        ++metrics.skipped_chunk_count;
+      } else if (row_count > 0) {
+        filename = std::to_string(chunk_id) + "_" + std::to_string(checkpoint_number) + ".bin";
+        const auto segments = is_complete ? chunk_segments(*chunk) : materialize_chunk(*table, *chunk, row_count);
+        const auto& sorted_by = is_complete ? chunk->individually_sorted_by() : std::vector<SortColumnDefinition>{};
+        metrics.bytes_written += write_chunk_file(*table, segments, sorted_by, table_directory / filename);
+        ++metrics.written_chunk_count;
+      }
+
+      if (is_complete) {
+        table_chunks[chunk_id] = {chunk, filename};
+      }
+      if (!filename.empty()) {
+        referenced_files.emplace((table_directory / filename).string());
+      }
+
+      write_value(manifest, is_complete ? CheckpointChunkState::Complete : CheckpointChunkState::Incomplete);
+      write_string(manifest, filename);
+      write_value(manifest, row_count);
+      write_offsets(manifest, deleted_offsets);
+      write_offsets(manifest, pending_offsets);
+    }
+  }
+
+  manifest.close();
+  sync_path(temporary_manifest_path);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+  sync_path(_directory);
+
+  // The new checkpoint is durable. Remove the files that only the previous checkpoints referenced.
+  for (const auto& table_directory : std::filesystem::directory_iterator{_directory}) {
+    if (!table_directory.is_directory()) {
+      continue;
+    }
+    for (const auto& file : std::filesystem::directory_iterator{table_directory.path()}) {
+      if (!referenced_files.contains(file.path().string())) {
+        std::filesystem::remove(file.path());
+      }
+    }
+    if (std::filesystem::is_empty(table_directory.path())) {
+      std::filesystem::remove(table_directory.path());
+    }
+  }
+
+  _written_chunks = std::move(written_chunks);
+  _checkpoint_number = checkpoint_number;
+  _metrics = metrics;
+  return metrics;
+}
+
+void Checkpointer::start_background_checkpoints(const std::chrono::milliseconds interval) {
+  Assert(!_loop_thread, "Background checkpoints have already been started.");
+  _loop_thread = std::make_unique<PausableLoopThread>(interval, [this](size_t /*loop_count*/) {
+    write_checkpoint();
+  });
+}
+
+CommitID Checkpointer::load() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto manifest_path = _directory / MANIFEST_FILENAME;
+  if (!std::filesystem::exists(manifest_path)) {
+    return UNSET_COMMIT_ID;
+  }
+
+  auto manifest = std::ifstream{manifest_path, std::ios::binary};
+  manifest.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  _checkpoint_number = read_value<uint64_t>(manifest);
+  const auto snapshot_commit_id = read_value<CommitID>(manifest);
+  const auto table_count = read_value<uint32_t>(manifest);
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  _written_chunks.clear();
+
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    const auto table_name = read_string(manifest);
+    const auto target_chunk_size = read_value<ChunkOffset>(manifest);
+    const auto column_count = read_value<ColumnCount>(manifest);
+    auto column_definitions = TableColumnDefinitions{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto column_name = read_string(manifest);
+      const auto data_type = read_value<DataType>(manifest);
+      const auto is_nullable = read_value<BoolAsByteType>(manifest) != 0;
+      column_definitions.emplace_back(std::move(column_name), data_type, is_nullable);
+    }
+
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, target_chunk_size, UseMvcc::Yes);
+    const auto table_directory = _directory / table_name;
+    const auto chunk_count = read_value<ChunkID>(manifest);
+    auto& table_chunks = _written_chunks[table_name];
+    table_chunks.resize(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto state = read_value<CheckpointChunkState>(manifest);
+      const auto filename = read_string(manifest);
+      const auto row_count = read_value<ChunkOffset>(manifest);
+      const auto deleted_offsets = read_offsets(manifest);
+      const auto pending_offsets = read_offsets(manifest);
+
+      switch (state) {
+        case CheckpointChunkState::Removed: {
+          // Keep the ChunkIDs of the following chunks.
+          table->append_mutable_chunk();
+          table->remove_chunk(chunk_id);
+        } break;
+
+        case CheckpointChunkState::Complete: {
+          const auto file_chunk = read_chunk_file(table_directory / filename);
+          const auto mvcc_data = std::make_shared<MvccData>(row_count, UNSET_COMMIT_ID);
+          table->append_chunk(chunk_segments(*file_chunk), mvcc_data);
+          const auto chunk = table->last_chunk();
+          for (const auto chunk_offset : deleted_offsets) {
+            mvcc_data->set_end_cid(chunk_offset, UNSET_COMMIT_ID);
+          }
+          if (!deleted_offsets.empty()) {
+            chunk->increase_invalid_row_count(ChunkOffset{static_cast<ChunkOffset::base_type>(deleted_offsets.size())});
+            set_atomic_max(mvcc_data->max_end_cid, UNSET_COMMIT_ID);
+          }
+          chunk->set_immutable();
+          if (!file_chunk->individually_sorted_by().empty()) {
+            chunk->set_individually_sorted_by(file_chunk->individually_sorted_by());
+          }
+          table_chunks[chunk_id] = {chunk, filename};
+        } break;
+
+        case CheckpointChunkState::Incomplete: {
+          // Incomplete chunks are restored as mutable chunks, so that the WriteAheadLog can replay Inserts into them.
+          table->append_mutable_chunk();
+          const auto chunk = table->last_chunk();
+          if (row_count > 0) {
+            const auto file_chunk = read_chunk_file(table_directory / filename);
+            for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+              resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+                using ColumnDataType = typename decltype(data_type_t)::type;
+
+                const auto& source_segment =
+                    static_cast<const ValueSegment<ColumnDataType>&>(*file_chunk->get_segment(column_id));
+                auto& target_segment = static_cast<ValueSegment<ColumnDataType>&>(*chunk->get_segment(column_id));
+                target_segment.resize(row_count);
+                std::copy(source_segment.values().begin(), source_segment.values().end(),
+                          target_segment.values().begin());
+                if (source_segment.is_nullable()) {
+                  const auto& null_values = source_segment.null_values();
+                  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+                    if (null_values[chunk_offset]) {
+                      target_segment.set_null_value(chunk_offset);
+                    }
+                  }
+                }
+              });
+            }
+          }
+
+          // Rows are created as pending. All rows that are not pending were committed before the snapshot.
+          const auto& mvcc_data = chunk->mvcc_data();
+          auto pending_iter = pending_offsets.cbegin();
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+            if (pending_iter != pending_offsets.cend() && *pending_iter == chunk_offset) {
+              ++pending_iter;
+              continue;
+            }
+            mvcc_data->set_begin_cid(chunk_offset, UNSET_COMMIT_ID);
+          }
+          for (const auto chunk_offset : deleted_offsets) {
+            mvcc_data->set_end_cid(chunk_offset, UNSET_COMMIT_ID);
+          }
+          if (!deleted_offsets.empty()) {
+            chunk->increase_invalid_row_count(ChunkOffset{static_cast<ChunkOffset::base_type>(deleted_offsets.size())});
+            set_atomic_max(mvcc_data->max_end_cid, UNSET_COMMIT_ID);
+          }
+
+          // Full chunks with pending rows stay mutable until WriteAheadLog::recover has replayed or invalidated them.
+          if (row_count == target_chunk_size && pending_offsets.empty()) {
+            chunk->set_immutable();
+          }
+        } break;
+      }
+    }
+
+    storage_manager.add_table(table_name, table);
+  }
+
+  Hyrise::get().transaction_manager._reset_after_recovery(snapshot_commit_id, INITIAL_TRANSACTION_ID);
+  return snapshot_commit_id;
+}
+
+Checkpointer::Metrics Checkpointer::metrics() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _metrics;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+struct PausableLoopThread;
+
+/**
+ * Writes transactionally consistent snapshots of all tables in the StorageManager to a directory. Together with the
+ * WriteAheadLog, a restart only has to load the latest checkpoint and replay the log records that were committed after
+ * the checkpoint's snapshot:
+ *
+ *   auto checkpointer = Checkpointer{checkpoint_directory};
+ *   checkpointer.load();
+ *   WriteAheadLog::recover(log_path);
+ *
+ * A checkpoint reads the tables at the snapshot commit ID of a read-only transaction, just like a query. Thus, it does
+ * not block concurrent writers. Each chunk is written in the binary format of the BinaryWriter into a file of its own:
+ *  - Immutable chunks in which all rows were committed before the snapshot are written with their current encoding.
+ *    Their data does not change anymore, so that subsequent checkpoints skip them and only store which of their rows
+ *    have been deleted since. This makes checkpoints incremental.
+ *  - All other chunks (i.e., mutable chunks and chunks with Inserts that committed after the snapshot) are materialized
+ *    into ValueSegments and written again in each checkpoint. Rows that were not committed at the snapshot are stored
+ *    as pending. They become visible when their Insert is replayed from the log and are invalidated otherwise.
+ *
+ * Chunk IDs are kept (removed chunks are restored as removed) because the log references rows by their RowIDs.
+ *
+ * The manifest of a checkpoint lists the tables, their chunk files, and the chunks' deleted and pending rows. It is
+ * replaced atomically once all chunk files have been synced. Afterwards, chunk files that are no longer referenced are
+ * removed.
+ */
+class Checkpointer : public Noncopyable {
+ public:
+  struct Metrics {
+    CommitID snapshot_commit_id{UNSET_COMMIT_ID};
+    uint64_t written_chunk_count{0};
+    uint64_t skipped_chunk_count{0};
+    uint64_t bytes_written{0};
+  };
+
+  explicit Checkpointer(const std::filesystem::path& directory);
+
+  ~Checkpointer();
+
+  // Writes a checkpoint of all tables on the calling thread and returns what has been written. Concurrent checkpoints
+  // of the same Checkpointer are serialized.
+  Metrics write_checkpoint();
+
+  // Writes a checkpoint every `interval` on a background thread until the Checkpointer is destroyed.
+  void start_background_checkpoints(const std::chrono::milliseconds interval);
+
+  /**
+   * Adds the tables of the latest checkpoint to the StorageManager and lets the TransactionManager continue after the
+   * checkpoint's snapshot commit ID. Must be called before any transaction runs. The loaded chunks are not written
+   * again by the next checkpoint. Returns the snapshot commit ID of the checkpoint or UNSET_COMMIT_ID if there is none.
+   */
+  CommitID load();
+
+  // Metrics of the last checkpoint written by this Checkpointer.
+  Metrics metrics() const;
+
+  static constexpr auto MANIFEST_FILENAME = "checkpoint.manifest";
+
+ private:
+  // A chunk file that has been written by a previous checkpoint. As long as the chunk is still part of the table, the
+  // file can be reused.
+  struct WrittenChunk {
+    std::weak_ptr<const Chunk> chunk;
+    std::string filename;
+  };
+
+  const std::filesystem::path _directory;
+
+  // Chunk files of complete chunks per table and ChunkID.
+  std::unordered_map<std::string, std::vector<WrittenChunk>> _written_chunks;
+
+  // Number of the last checkpoint. Used to name the chunk files of the next checkpoint.
+  uint64_t _checkpoint_number{0};
+
+  Metrics _metrics;
+  mutable std::mutex _mutex;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
@@ -1,12 +1,15 @@
 #include "transaction_context.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 
 #include "commit_context.hpp"  // IWYU pragma: keep
+#include "concurrency/write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "types.hpp"
@@ -103,10 +106,27 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  // Write the redo record before the modifications are applied. The record has to be durable before the transaction
+  // becomes visible, at least in the GroupCommit mode. Waiting only after commit_records overlaps the flush with
+  // applying the commit.
+  const auto write_ahead_log = Hyrise::get().write_ahead_log;
+  auto log_epoch = std::optional<uint64_t>{};
+  if (write_ahead_log) {
+    auto record = CommitLogRecord{commit_id(), _transaction_id};
+    for (const auto& op : _read_write_operators) {
+      op->log_records(record);
+    }
+    log_epoch = write_ahead_log->append(record);
+  }
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
+  if (log_epoch && write_ahead_log->sync_mode() == LogSyncMode::GroupCommit) {
+    write_ahead_log->wait_for_durability(*log_epoch);
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
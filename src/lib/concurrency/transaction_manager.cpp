@@ -133,4 +133,13 @@ void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<Com
   }
 }
 
+void TransactionManager::_reset_after_recovery(const CommitID last_commit_id, const TransactionID next_transaction_id) {
+  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  Assert(_active_snapshot_commit_ids.empty(), "Cannot recover while transactions are active.");
+
+  _last_commit_id = last_commit_id;
+  _last_commit_context = std::make_shared<CommitContext>(last_commit_id);
+  _next_transaction_id = std::max(_next_transaction_id.load(), TransactionID::base_type{next_transaction_id});
+}
+
 }  // namespace hyrise
@@ -71,14 +71,19 @@ class TransactionManager : public Noncopyable {
   TransactionManager();
   ~TransactionManager();
 
+  friend class Checkpointer;
   friend class Hyrise;
   friend class TransactionContext;
+  friend class WriteAheadLog;
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Continues with the commit and transaction IDs following a replayed log. Must not be called while transactions run.
+  void _reset_after_recovery(const CommitID last_commit_id, const TransactionID next_transaction_id);
+
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
@@ -0,0 +1,541 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+enum class LogRecordType : uint8_t { Header, Commit };
+
+enum class LogEntryType : uint8_t { Insert, Delete };
+
+// uint32_t size | uint32_t checksum | uint8_t LogRecordType
+constexpr auto RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(LogRecordType);
+
+uint32_t checksum(const char* data, const size_t byte_count) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data, byte_count);
+  return crc.checksum();
+}
+
+// Writes the size and checksum of a serialized record into its first bytes.
+void finalize_record(std::vector<char>& data) {
+  const auto size = static_cast<uint32_t>(data.size());
+  const auto crc = checksum(data.data() + 2 * sizeof(uint32_t), data.size() - 2 * sizeof(uint32_t));
+  std::memcpy(data.data(), &size, sizeof(size));
+  std::memcpy(data.data() + sizeof(size), &crc, sizeof(crc));
+}
+
+class LogReader {
+ public:
+  LogReader(const char* begin, const char* end) : _position{begin}, _end{end} {}
+
+  template <typename T>
+  T read() {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      const auto length = read<uint32_t>();
+      Assert(_position + length <= _end, "Log record is corrupted.");
+      auto string = T{_position, length};
+      _position += length;
+      return string;
+    } else {
+      Assert(_position + sizeof(T) <= _end, "Log record is corrupted.");
+      auto value = T{};
+      std::memcpy(&value, _position, sizeof(T));
+      _position += sizeof(T);
+      return value;
+    }
+  }
+
+  bool at_end() const {
+    return _position == _end;
+  }
+
+ private:
+  const char* _position;
+  const char* _end;
+};
+
+void replay_insert(LogReader& reader, const CommitID commit_id) {
+  const auto table = Hyrise::get().storage_manager.get_table(reader.read<std::string>());
+  const auto chunk_id = reader.read<ChunkID>();
+  const auto begin_chunk_offset = reader.read<ChunkOffset>();
+  const auto end_chunk_offset = reader.read<ChunkOffset>();
+
+  while (table->chunk_count() <= chunk_id) {
+    table->append_mutable_chunk();
+  }
+  const auto chunk = table->get_chunk(chunk_id);
+  Assert(chunk->is_mutable() && chunk->has_mvcc_data(), "Logged Insert into chunk that cannot be modified.");
+
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment =
+          std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Cannot replay inserts into non-ValueSegments.");
+      if (value_segment->size() < end_chunk_offset) {
+        value_segment->resize(end_chunk_offset);
+      }
+
+      auto& values = value_segment->values();
+      const auto is_nullable = value_segment->is_nullable();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        if (is_nullable && reader.read<uint8_t>() != 0) {
+          value_segment->set_null_value(chunk_offset);
+          continue;
+        }
+        values[chunk_offset] = reader.read<ColumnDataType>();
+      }
+    });
+  }
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+    mvcc_data->set_tid(chunk_offset, TransactionID{0});
+  }
+  set_atomic_max(mvcc_data->max_begin_cid, commit_id);
+}
+
+void replay_delete(LogReader& reader, const CommitID commit_id, const TransactionID transaction_id) {
+  const auto table = Hyrise::get().storage_manager.get_table(reader.read<std::string>());
+  const auto row_count = reader.read<uint32_t>();
+
+  for (auto index = uint32_t{0}; index < row_count; ++index) {
+    const auto row_id = reader.read<RowID>();
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    Assert(chunk && chunk->has_mvcc_data(), "Logged Delete of row that does not exist.");
+    const auto& mvcc_data = chunk->mvcc_data();
+
+    // Like the Delete operator, we keep the row locked so that subsequent transactions fail to modify it.
+    mvcc_data->set_end_cid(row_id.chunk_offset, commit_id);
+    mvcc_data->set_tid(row_id.chunk_offset, transaction_id);
+    chunk->increase_invalid_row_count(ChunkOffset{1});
+    set_atomic_max(mvcc_data->max_end_cid, commit_id);
+  }
+}
+
+void replay_commit(const char* begin, const char* end) {
+  auto reader = LogReader{begin, end};
+  const auto commit_id = reader.read<CommitID>();
+  const auto transaction_id = reader.read<TransactionID>();
+
+  while (!reader.at_end()) {
+    const auto entry_type = reader.read<LogEntryType>();
+    switch (entry_type) {
+      case LogEntryType::Insert:
+        replay_insert(reader, commit_id);
+        break;
+      case LogEntryType::Delete:
+        replay_delete(reader, commit_id, transaction_id);
+        break;
+      default:
+        Fail("Unknown log entry type.");
+    }
+  }
+}
+
+// Invalidates rows of Inserts that were not replayed and restores the immutability of full chunks.
+void finalize_table(Table& table) {
+  const auto chunk_count = table.chunk_count();
+  const auto target_chunk_size = table.target_chunk_size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || !chunk->is_mutable() || !chunk->has_mvcc_data()) {
+      continue;
+    }
+
+    // Inserts only append chunks when the previous chunk is full. Thus, all chunks but the last one were full before
+    // the crash, even if the Inserts that filled them were not replayed.
+    const auto is_last_chunk = chunk_id == chunk_count - 1;
+    if (!is_last_chunk && chunk->size() < target_chunk_size) {
+      for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+        resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          std::static_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id))
+              ->resize(target_chunk_size);
+        });
+      }
+    }
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) != MAX_COMMIT_ID) {
+        continue;
+      }
+      // Same as the rollback of an Insert.
+      mvcc_data->set_end_cid(chunk_offset, UNSET_COMMIT_ID);
+      mvcc_data->set_begin_cid(chunk_offset, UNSET_COMMIT_ID);
+      mvcc_data->set_tid(chunk_offset, TransactionID{0});
+      chunk->increase_invalid_row_count(ChunkOffset{1});
+    }
+
+    if (chunk_size == target_chunk_size) {
+      chunk->set_immutable();
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CommitLogRecord::CommitLogRecord(const CommitID commit_id, const TransactionID transaction_id)
+    : _commit_id{commit_id} {
+  _data.resize(2 * sizeof(uint32_t));
+  _write(LogRecordType::Commit);
+  _write(commit_id);
+  _write(transaction_id);
+}
+
+void CommitLogRecord::add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                 const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  _write(LogEntryType::Insert);
+  _write_string(table_name);
+  _write(chunk_id);
+  _write(begin_chunk_offset);
+  _write(end_chunk_offset);
+
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Can only log inserts into ValueSegments.");
+
+      const auto& values = value_segment->values();
+      const auto is_nullable = value_segment->is_nullable();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        if (is_nullable) {
+          const auto is_null = value_segment->null_values()[chunk_offset];
+          _write(static_cast<uint8_t>(is_null));
+          if (is_null) {
+            continue;
+          }
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          _write_string(values[chunk_offset]);
+        } else {
+          _write(values[chunk_offset]);
+        }
+      }
+    });
+  }
+}
+
+void CommitLogRecord::add_delete(const std::string& table_name, const AbstractPosList& pos_list) {
+  _write(LogEntryType::Delete);
+  _write_string(table_name);
+  _write(static_cast<uint32_t>(pos_list.size()));
+  for (const auto row_id : pos_list) {
+    _write(row_id);
+  }
+}
+
+CommitID CommitLogRecord::commit_id() const {
+  return _commit_id;
+}
+
+template <typename T>
+void CommitLogRecord::_write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly.");
+  const auto offset = _data.size();
+  _data.resize(offset + sizeof(T));
+  std::memcpy(_data.data() + offset, &value, sizeof(T));
+}
+
+void CommitLogRecord::_write_string(const std::string_view string) {
+  _write(static_cast<uint32_t>(string.size()));
+  _data.insert(_data.end(), string.begin(), string.end());
+}
+
+WriteAheadLog::WriteAheadLog(const Config& config) : _config{config} {
+  Assert(_config.buffer_size > 0 && _config.buffer_size < SEALED_FLAG, "Invalid log buffer size.");
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  _file_descriptor = open(_config.path.c_str(), O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+  Assert(_file_descriptor >= 0,
+         "Failed to open log file '" + _config.path.string() + "': " + std::string{std::strerror(errno)});
+
+  // Each time the log is opened, a header record marks the first commit ID that is logged. Recovery uses it to
+  // identify the records that belong to transactions that never completed before a previous crash.
+  auto header = std::vector<char>(2 * sizeof(uint32_t));
+  header.push_back(static_cast<char>(LogRecordType::Header));
+  const auto first_commit_id = CommitID{Hyrise::get().transaction_manager.last_commit_id() + 1};
+  header.resize(header.size() + sizeof(CommitID));
+  std::memcpy(header.data() + RECORD_HEADER_SIZE, &first_commit_id, sizeof(CommitID));
+  finalize_record(header);
+  _write_to_file(header.data(), header.size());
+  Assert(fdatasync(_file_descriptor) == 0, "Failed to sync log file: " + std::string{std::strerror(errno)});
+
+  for (auto& buffer : _buffers) {
+    buffer.data = std::make_unique<char[]>(_config.buffer_size);
+  }
+  // The buffer of the first epoch is open, the other one is sealed until the first flush.
+  _buffers[0].reserved = SEALED_FLAG;
+  _buffers[1].overflow_offset = std::numeric_limits<uint64_t>::max();
+  _buffers[1].epoch = _current_epoch.load();
+
+  _flush_thread = std::thread{[this]() {
+    _flush_loop();
+  }};
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_flush_mutex};
+    _shutdown = true;
+  }
+  _flush_cv.notify_one();
+  _flush_thread.join();
+  close(_file_descriptor);
+}
+
+uint64_t WriteAheadLog::append(const CommitLogRecord& record) {
+  const auto size = record._data.size();
+  Assert(size <= _config.buffer_size, "Commit record is larger than the log buffer.");
+
+  const auto size_field = static_cast<uint32_t>(size);
+  const auto crc = checksum(record._data.data() + 2 * sizeof(uint32_t), size - 2 * sizeof(uint32_t));
+
+  while (true) {
+    auto& buffer = _buffers[_current_epoch.load() % 2];
+    const auto offset = buffer.reserved.fetch_add(size);
+    if (offset & SEALED_FLAG) {
+      // The buffer is being flushed. The flusher has already switched to the other buffer.
+      std::this_thread::yield();
+      continue;
+    }
+
+    // The reservation succeeded after the flusher has reset the buffer. Thus, the buffer's epoch is up to date, even if
+    // _current_epoch has changed in the meantime.
+    const auto epoch = buffer.epoch.load();
+
+    if (offset + size > _config.buffer_size) {
+      // The record does not fit. Remember where the valid data ends, release the reservation, and retry as soon as the
+      // flusher has switched the buffers.
+      auto overflow_offset = buffer.overflow_offset.load();
+      while (offset < overflow_offset && !buffer.overflow_offset.compare_exchange_weak(overflow_offset, offset)) {}
+      buffer.written.fetch_add(size);
+      _request_flush();
+      std::this_thread::yield();
+      continue;
+    }
+
+    auto* const destination = buffer.data.get() + offset;
+    std::memcpy(destination, record._data.data(), size);
+    std::memcpy(destination, &size_field, sizeof(size_field));
+    std::memcpy(destination + sizeof(size_field), &crc, sizeof(crc));
+
+    buffer.written.fetch_add(size, std::memory_order_release);
+    _record_count.fetch_add(1, std::memory_order_relaxed);
+    return epoch;
+  }
+}
+
+void WriteAheadLog::wait_for_durability(const uint64_t epoch) {
+  if (_durable_epoch.load() >= epoch) {
+    return;
+  }
+
+  _request_flush();
+  auto lock = std::unique_lock<std::mutex>{_durable_mutex};
+  _durable_cv.wait(lock, [&]() {
+    return _durable_epoch.load() >= epoch;
+  });
+}
+
+LogSyncMode WriteAheadLog::sync_mode() const {
+  return _config.sync_mode;
+}
+
+WriteAheadLog::Metrics WriteAheadLog::metrics() const {
+  return {_record_count.load(), _flush_count.load(), _bytes_written.load()};
+}
+
+void WriteAheadLog::_flush_loop() {
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex>{_flush_mutex};
+      _flush_cv.wait_for(lock, _config.flush_interval, [&]() {
+        return _flush_requested || _shutdown;
+      });
+      if (_shutdown) {
+        break;
+      }
+      _flush_requested = false;
+    }
+    _flush();
+  }
+
+  // Flush the records of transactions that committed before the shutdown.
+  while (_flush()) {}
+}
+
+bool WriteAheadLog::_flush() {
+  const auto epoch = _current_epoch.load();
+  auto& buffer = _buffers[epoch % 2];
+  if (buffer.reserved.load() == 0) {
+    return false;
+  }
+
+  // Reset the other buffer and make it the current one. All writers of its previous epoch have finished, and writers
+  // that still try to reserve space in it see the sealed flag until it is reset.
+  auto& next_buffer = _buffers[(epoch + 1) % 2];
+  next_buffer.epoch = epoch + 1;
+  next_buffer.written = 0;
+  next_buffer.overflow_offset = std::numeric_limits<uint64_t>::max();
+  next_buffer.reserved = 0;
+  _current_epoch = epoch + 1;
+
+  // Seal the buffer and wait for the writers that reserved space in it.
+  const auto reserved = buffer.reserved.fetch_or(SEALED_FLAG);
+  while (buffer.written.load(std::memory_order_acquire) != reserved) {
+    std::this_thread::yield();
+  }
+
+  const auto byte_count = std::min(reserved, buffer.overflow_offset.load());
+  _write_to_file(buffer.data.get(), byte_count);
+  if (_config.sync_mode != LogSyncMode::NoSync) {
+    Assert(fdatasync(_file_descriptor) == 0, "Failed to sync log file: " + std::string{std::strerror(errno)});
+  }
+  _bytes_written.fetch_add(byte_count, std::memory_order_relaxed);
+  _flush_count.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_durable_mutex};
+    _durable_epoch = epoch;
+  }
+  _durable_cv.notify_all();
+  return true;
+}
+
+void WriteAheadLog::_request_flush() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_flush_mutex};
+    _flush_requested = true;
+  }
+  _flush_cv.notify_one();
+}
+
+void WriteAheadLog::_write_to_file(const char* data, const uint64_t byte_count) {
+  auto bytes_written = uint64_t{0};
+  while (bytes_written < byte_count) {
+    const auto result = write(_file_descriptor, data + bytes_written, byte_count - bytes_written);
+    Assert(result > 0, "Failed to write to log file: " + std::string{std::strerror(errno)});
+    bytes_written += static_cast<uint64_t>(result);
+  }
+}
+
+CommitID WriteAheadLog::recover(const std::filesystem::path& path) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  // Transactions up to this commit ID are already contained in the tables, e.g., because they were loaded from a
+  // checkpoint.
+  const auto loaded_commit_id = transaction_manager.last_commit_id();
+  auto last_commit_id = loaded_commit_id;
+  if (!std::filesystem::exists(path)) {
+    return last_commit_id;
+  }
+
+  auto file = std::ifstream{path, std::ios::binary};
+  auto data = std::vector<char>(std::filesystem::file_size(path));
+  file.read(data.data(), static_cast<std::streamsize>(data.size()));
+  Assert(file, "Failed to read log file '" + path.string() + "'.");
+
+  auto max_transaction_id = TransactionID{0};
+
+  // Commit records that were read but not replayed yet, ordered by their commit ID.
+  auto pending_records = std::map<CommitID, std::pair<const char*, const char*>>{};
+  const auto replay_pending_records = [&]() {
+    auto record_iter = pending_records.begin();
+    while (record_iter != pending_records.end() && record_iter->first == last_commit_id + 1) {
+      const auto& [begin, end] = record_iter->second;
+      replay_commit(begin, end);
+      last_commit_id = record_iter->first;
+      ++record_iter;
+    }
+    // Remaining records follow a commit ID that was never logged. These transactions never became visible.
+    pending_records.clear();
+  };
+
+  auto offset = size_t{0};
+  while (offset + RECORD_HEADER_SIZE <= data.size()) {
+    auto size = uint32_t{0};
+    auto crc = uint32_t{0};
+    std::memcpy(&size, data.data() + offset, sizeof(size));
+    std::memcpy(&crc, data.data() + offset + sizeof(size), sizeof(crc));
+    if (size < RECORD_HEADER_SIZE || offset + size > data.size() ||
+        checksum(data.data() + offset + 2 * sizeof(uint32_t), size - 2 * sizeof(uint32_t)) != crc) {
+      // The record has not been written completely before the crash.
+      break;
+    }
+
+    const auto* const payload = data.data() + offset + RECORD_HEADER_SIZE;
+    auto reader = LogReader{payload, data.data() + offset + size};
+    if (static_cast<LogRecordType>(data[offset + 2 * sizeof(uint32_t)]) == LogRecordType::Header) {
+      // The log has been (re-)opened. Everything logged before belongs to the previous run.
+      replay_pending_records();
+      last_commit_id = std::max(CommitID{reader.read<CommitID>() - 1}, loaded_commit_id);
+    } else {
+      const auto commit_id = reader.read<CommitID>();
+      max_transaction_id = std::max(max_transaction_id, reader.read<TransactionID>());
+      if (commit_id > last_commit_id) {
+        pending_records.emplace(commit_id, std::pair{payload, data.data() + offset + size});
+      }
+    }
+    offset += size;
+  }
+  replay_pending_records();
+
+  // Tables loaded from a checkpoint can contain pending rows even if the log does not modify them.
+  for (const auto& [_, table] : Hyrise::get().storage_manager.tables()) {
+    finalize_table(*table);
+  }
+
+  transaction_manager._reset_after_recovery(last_commit_id, TransactionID{max_transaction_id + 1});
+
+  // Cut off the torn write (if any) so that the log can be continued.
+  std::filesystem::resize_file(path, offset);
+  return last_commit_id;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractPosList;
+class Table;
+
+/**
+ * Defines when a transaction that wrote a commit record to the WriteAheadLog becomes visible.
+ *  - GroupCommit: The transaction waits until its record has been flushed and synced to disk. Concurrent commits share
+ *    a single fsync (i.e., group commit). No committed transaction is lost on a crash.
+ *  - Asynchronous: The transaction does not wait for its record. The log is flushed and synced in the background every
+ *    `flush_interval`. On a crash, the most recent transactions might be lost, but the database stays consistent.
+ *  - NoSync: Like Asynchronous, but the log is never synced and relies on the operating system to eventually write it.
+ *    Only survives process crashes, not power failures.
+ */
+enum class LogSyncMode { GroupCommit, Asynchronous, NoSync };
+
+/**
+ * Redo information of a single committing transaction. Read/write operators append their modifications in
+ * AbstractReadWriteOperator::log_records. The record is serialized directly into its binary representation so that
+ * appending it to the log is a single copy.
+ *
+ * Format (all integers in host byte order):
+ *   uint32_t record size (including this header) | uint32_t CRC-32 of the remainder | uint8_t LogRecordType
+ *   Commit records continue with: CommitID | TransactionID | entries until the end of the record.
+ *   Insert entries: uint8_t 0 | table name | ChunkID | begin ChunkOffset | end ChunkOffset | per column and row an
+ *                   optional uint8_t NULL flag (for nullable columns) followed by the value (if not NULL).
+ *   Delete entries: uint8_t 1 | table name | uint32_t row count | RowIDs
+ *   Strings (and table names) are stored as uint32_t length followed by the characters.
+ */
+class CommitLogRecord : public Noncopyable {
+ public:
+  CommitLogRecord(const CommitID commit_id, const TransactionID transaction_id);
+
+  // Logs the rows in [begin_chunk_offset, end_chunk_offset) of the given chunk. They must be stored in ValueSegments.
+  void add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                  const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  void add_delete(const std::string& table_name, const AbstractPosList& pos_list);
+
+  CommitID commit_id() const;
+
+ private:
+  friend class WriteAheadLog;
+
+  template <typename T>
+  void _write(const T& value);
+
+  void _write_string(const std::string_view string);
+
+  const CommitID _commit_id;
+  std::vector<char> _data;
+};
+
+/**
+ * Redo log for the modifications of committed transactions. Hyrise writes a commit record for every commit ID while
+ * the log is set in `Hyrise::get().write_ahead_log`. The log should be enabled after the initial data has been loaded
+ * and before any transaction runs. Using `recover`, the log can be replayed onto the same initial data after a restart.
+ *
+ * Committing threads append their records to a lock-free log buffer: A writer reserves space using a single atomic
+ * fetch_add and copies its record without holding any latch. A background thread flushes the buffer: It swaps in the
+ * second buffer, seals the full one, waits for all writers of the sealed buffer to finish their copies, writes the
+ * buffer to the log file, and syncs it. Each flush is an epoch. Writers wait for the epoch of their record (see
+ * LogSyncMode), so that all transactions that committed during one fsync share the next one.
+ */
+class WriteAheadLog : public Noncopyable {
+ public:
+  struct Config {
+    std::filesystem::path path;
+    LogSyncMode sync_mode{LogSyncMode::GroupCommit};
+
+    // Capacity of each of the two log buffers. Single commit records must not be larger than this.
+    size_t buffer_size{4 * 1024 * 1024};
+
+    // In the Asynchronous and NoSync modes, the log is flushed at least once per interval.
+    std::chrono::microseconds flush_interval{1'000};
+  };
+
+  struct Metrics {
+    uint64_t record_count{0};
+    uint64_t flush_count{0};
+    uint64_t bytes_written{0};
+  };
+
+  // Opens the log for appending. Log files that already exist are continued, but they should have been recovered
+  // before (see `recover`) as recovery truncates records that are incomplete.
+  explicit WriteAheadLog(const Config& config);
+
+  // Flushes all outstanding records.
+  ~WriteAheadLog();
+
+  // Appends the record to the log buffer and returns the epoch in which it will be flushed.
+  uint64_t append(const CommitLogRecord& record);
+
+  // Blocks until the given epoch has been flushed (and synced, unless the sync mode is NoSync).
+  void wait_for_durability(const uint64_t epoch);
+
+  LogSyncMode sync_mode() const;
+
+  Metrics metrics() const;
+
+  /**
+   * Replays the committed transactions in the log file onto the tables of the StorageManager. These tables must hold
+   * the same data that they held when the log was enabled, or they must have been loaded from a checkpoint (see
+   * Checkpointer). In the latter case, only transactions that committed after the checkpoint are replayed.
+   * Transactions are replayed in the order of their commit IDs.
+   * As records are appended in no particular order, the log might contain records of transactions that did not
+   * complete before the crash, e.g., because a transaction with a lower commit ID was not logged yet. These are not
+   * visible to anyone and are ignored. Afterwards, rows of unfinished Inserts are invalidated, the TransactionManager
+   * continues after the last replayed commit ID, and a torn write at the end of the log is truncated.
+   * Returns the last replayed commit ID.
+   */
+  static CommitID recover(const std::filesystem::path& path);
+
+ private:
+  struct LogBuffer {
+    std::unique_ptr<char[]> data;
+
+    // Number of bytes reserved by writers. The most significant bit marks the buffer as sealed.
+    std::atomic<uint64_t> reserved{0};
+
+    // Number of bytes that writers finished copying (or gave up because the record did not fit).
+    std::atomic<uint64_t> written{0};
+
+    // Offset of the first reservation that did not fit into the buffer.
+    std::atomic<uint64_t> overflow_offset{0};
+
+    // Epoch in which the buffer is flushed.
+    std::atomic<uint64_t> epoch{0};
+  };
+
+  static constexpr auto SEALED_FLAG = uint64_t{1} << 63u;
+
+  void _flush_loop();
+
+  // Flushes the current buffer (if not empty) and returns whether there was anything to flush.
+  bool _flush();
+
+  void _request_flush();
+
+  void _write_to_file(const char* data, const uint64_t byte_count);
+
+  const Config _config;
+  int _file_descriptor{-1};
+
+  std::array<LogBuffer, 2> _buffers;
+  std::atomic<uint64_t> _current_epoch{1};
+
+  std::atomic<uint64_t> _durable_epoch{0};
+  std::mutex _durable_mutex;
+  std::condition_variable _durable_cv;
+
+  bool _flush_requested{false};
+  bool _shutdown{false};
+  std::mutex _flush_mutex;
+  std::condition_variable _flush_cv;
+
+  std::atomic<uint64_t> _record_count{0};
+  std::atomic<uint64_t> _flush_count{0};
+  std::atomic<uint64_t> _bytes_written{0};
+
+  std::thread _flush_thread;
+};
+
+}  // namespace hyrise
@@ -49,6 +49,7 @@
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/base_value_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
@@ -1515,7 +1516,8 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
     auto nulls = pmr_vector<bool>{};
 
     if (const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
-      // Shortcut
+      // Shortcut. The values are copied directly, so the segment's pages have to be pinned.
+      const auto pin_guard = SharedPagePinGuard{value_segment->buffer_pages()};
       values = pmr_vector<ColumnDataType>{value_segment->values()};
       if (_table->column_is_nullable(column_id)) {
         nulls = pmr_vector<bool>{value_segment->null_values()};
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -52,6 +53,10 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Redo log to which committing transactions write their modifications. If nullptr, commits are not logged and are
+  // lost when Hyrise shuts down. See WriteAheadLog for details.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
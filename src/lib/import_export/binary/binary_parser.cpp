@@ -1,9 +1,14 @@
 #include "binary_parser.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <ios>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -13,13 +18,21 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "binary_writer.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_string_vector.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/run_length_segment.hpp"
@@ -30,6 +43,7 @@
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/enum_constant.hpp"
@@ -37,71 +51,161 @@
 namespace hyrise {
 
 std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  auto file = MappedFileReader{filename};
 
   auto [table, chunk_count] = _read_header(file);
+  const auto chunk_offsets = _read_chunk_directory(file, chunk_count);
+
+  if (!chunk_offsets) {
+    // Files without a chunk directory can only be parsed sequentially.
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      _append_chunk(*table, _import_chunk(file, *table));
+      file.release_consumed_pages();
+    }
+    Assert(file.position() == file.size(), "Unexpected trailing bytes in binary file.");
+    return table;
+  }
+
+  // Each chunk is imported from its own view on the file by one JobTask. The chunks are appended in order afterwards.
+  auto imported_chunks = std::vector<ImportedChunk>(chunk_count);
+  const auto& output_table = *table;
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_end = (*chunk_offsets)[chunk_id + 1];
+      auto chunk_file = MappedFileReader{file, (*chunk_offsets)[chunk_id], chunk_end};
+      imported_chunks[chunk_id] = _import_chunk(chunk_file, output_table);
+      Assert(chunk_file.position() == chunk_end, "Chunk does not end at the offset given in the chunk directory.");
+      chunk_file.release_consumed_pages();
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& imported_chunk : imported_chunks) {
+    _append_chunk(*table, imported_chunk);
   }
 
   return table;
 }
 
+BinaryParser::MappedFileReader::MappedFileReader(const std::string& filename) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Failed to open '" + filename + "': " + std::string{std::strerror(errno)});
+
+  struct stat file_stat {};
+  const auto stat_result = fstat(file_descriptor, &file_stat);
+  _size = static_cast<size_t>(file_stat.st_size);
+  if (stat_result != 0 || _size == 0) {
+    close(file_descriptor);
+    Fail("Cannot read binary file '" + filename + "'.");
+  }
+
+  // The mapping stays valid after the file descriptor has been closed. As segments are only read once and in order, we
+  // let the kernel read ahead aggressively.
+  auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  close(file_descriptor);
+  Assert(data != MAP_FAILED, "Failed to map '" + filename + "': " + std::string{std::strerror(errno)});
+  _data = static_cast<char*>(data);
+  madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+BinaryParser::MappedFileReader::MappedFileReader(const MappedFileReader& file, const size_t begin, const size_t end)
+    : _data{file._data}, _size{end}, _position{begin}, _owns_mapping{false} {
+  Assert(begin <= end && end <= file._size, "View exceeds the binary file.");
+
+  // Pages shared with the preceding range are left to the view on that range.
+  static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  _released_bytes = (begin + page_size - 1) / page_size * page_size;
+}
+
+BinaryParser::MappedFileReader::~MappedFileReader() {
+  if (_owns_mapping) {
+    munmap(_data, _size);
+  }
+}
+
+size_t BinaryParser::MappedFileReader::position() const {
+  return _position;
+}
+
+size_t BinaryParser::MappedFileReader::size() const {
+  return _size;
+}
+
+const char* BinaryParser::MappedFileReader::consume(const size_t byte_count) {
+  Assert(byte_count <= _size - _position, "Unexpected end of binary file.");
+  const auto* const position = _data + _position;
+  _position += byte_count;
+  return position;
+}
+
+void BinaryParser::MappedFileReader::release_consumed_pages() {
+  static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto releasable_bytes = _position / page_size * page_size;
+  if (releasable_bytes > _released_bytes) {
+    madvise(_data + _released_bytes, releasable_bytes - _released_bytes, MADV_DONTNEED);
+    _released_bytes = releasable_bytes;
+  }
+}
+
 template <typename T>
-pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file, const size_t count) {
+pmr_compact_vector BinaryParser::_read_values_compact_vector(MappedFileReader& file, const size_t count) {
   const auto bit_width = _read_value<uint8_t>(file);
   auto values = pmr_compact_vector(bit_width, count);
-  file.read(reinterpret_cast<char*>(values.get()), static_cast<int64_t>(values.bytes()));
+  std::memcpy(values.get(), file.consume(values.bytes()), values.bytes());
   return values;
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(MappedFileReader& file, const size_t count) {
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  std::memcpy(values.data(), file.consume(count * sizeof(T)), count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(MappedFileReader& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()),
-            static_cast<int64_t>(readable_bools.size() * sizeof(BoolAsByteType)));
-  return {readable_bools.begin(), readable_bools.end()};
+pmr_vector<bool> BinaryParser::_read_values(MappedFileReader& file, const size_t count) {
+  static_assert(sizeof(BoolAsByteType) == 1, "Bools are expected to be stored as single bytes.");
+  const auto* const readable_bools = file.consume(count);
+  auto values = pmr_vector<bool>(count);
+  for (auto index = size_t{0}; index < count; ++index) {
+    values[index] = readable_bools[index] != 0;
+  }
+  return values;
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
-  const auto string_lengths = _read_values<size_t>(file, count);
-  const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+pmr_vector<pmr_string> BinaryParser::_read_string_values(MappedFileReader& file, const size_t count) {
+  // The strings follow the array of their lengths. Both are read from the mapping without intermediate copies.
+  const auto* const string_lengths = file.consume(count * sizeof(size_t));
 
   auto values = pmr_vector<pmr_string>{count};
-  auto start = size_t{0};
   for (auto index = size_t{0}; index < count; ++index) {
-    values[index] = pmr_string{buffer.data() + start, buffer.data() + start + string_lengths[index]};
-    start += string_lengths[index];
+    auto string_length = size_t{0};
+    std::memcpy(&string_length, string_lengths + index * sizeof(size_t), sizeof(size_t));
+    const auto* const string = file.consume(string_length);
+    values[index] = pmr_string{string, string_length};
   }
 
   return values;
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(MappedFileReader& file) {
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, file.consume(sizeof(T)), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(MappedFileReader& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -121,33 +225,57 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
-  const auto row_count = _read_value<ChunkOffset>(file);
+std::optional<pmr_vector<uint64_t>> BinaryParser::_read_chunk_directory(const MappedFileReader& file,
+                                                                        const ChunkID chunk_count) {
+  const auto directory_size = (size_t{chunk_count} + 1) * sizeof(uint64_t);
+  if (file.size() - file.position() < directory_size) {
+    return std::nullopt;
+  }
+
+  auto directory = MappedFileReader{file, file.size() - directory_size, file.size()};
+  auto chunk_offsets = _read_values<uint64_t>(directory, chunk_count);
+  if (_read_value<uint64_t>(directory) != BinaryWriter::CHUNK_DIRECTORY_MARKER) {
+    return std::nullopt;
+  }
+
+  // The views on the chunks check that the offsets are ascending and within the file.
+  Assert(chunk_count == 0 || chunk_offsets.front() == file.position(), "Invalid chunk directory in binary file.");
+
+  chunk_offsets.emplace_back(file.size() - directory_size);
+  return chunk_offsets;
+}
+
+BinaryParser::ImportedChunk BinaryParser::_import_chunk(MappedFileReader& file, const Table& table) {
+  auto imported_chunk = ImportedChunk{};
+  imported_chunk.row_count = _read_value<ChunkOffset>(file);
 
   // Import sort column definitions
   const auto num_sorted_columns = _read_value<uint32_t>(file);
-  std::vector<SortColumnDefinition> sorted_columns;
   for (ColumnID sorted_column_id{0}; sorted_column_id < num_sorted_columns; ++sorted_column_id) {
     const auto column_id = _read_value<ColumnID>(file);
     const auto sort_mode = _read_value<SortMode>(file);
-    sorted_columns.emplace_back(column_id, sort_mode);
+    imported_chunk.sorted_columns.emplace_back(column_id, sort_mode);
   }
 
-  Segments output_segments;
-  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
-    output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    imported_chunk.segments.push_back(_import_segment(file, imported_chunk.row_count, table.column_data_type(column_id),
+                                                      table.column_is_nullable(column_id)));
   }
 
-  const auto mvcc_data = std::make_shared<MvccData>(row_count, UNSET_COMMIT_ID);
-  table->append_chunk(output_segments, mvcc_data);
-  table->last_chunk()->set_immutable();
-  if (num_sorted_columns > 0) {
-    table->last_chunk()->set_individually_sorted_by(sorted_columns);
+  return imported_chunk;
+}
+
+void BinaryParser::_append_chunk(Table& table, const ImportedChunk& imported_chunk) {
+  const auto mvcc_data = std::make_shared<MvccData>(imported_chunk.row_count, UNSET_COMMIT_ID);
+  table.append_chunk(imported_chunk.segments, mvcc_data);
+  table.last_chunk()->set_immutable();
+  if (!imported_chunk.sorted_columns.empty()) {
+    table.last_chunk()->set_individually_sorted_by(imported_chunk.sorted_columns);
   }
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                DataType data_type, bool column_is_nullable) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -159,7 +287,7 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                bool column_is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -186,13 +314,27 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
+    case EncodingType::FSSTDictionary:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSSTDictionary>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_dictionary_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSSTDictionary encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                      bool column_is_nullable) {
   if (column_is_nullable) {
     const auto segment_is_nullable = _read_value<bool>(file);
@@ -208,7 +350,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(MappedFileReader& file,
                                                                                ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -220,7 +362,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    MappedFileReader& file, ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -230,7 +372,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(MappedFileReader& file,
                                                                               ChunkOffset /*row_count*/) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -241,25 +383,48 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(MappedFileReader& file,
                                                                                              ChunkOffset row_count) {
+  using EncodedType = typename FrameOfReferenceSegment<T>::EncodedType;
+
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto block_count = _read_value<uint32_t>(file);
-  const auto block_minima = _read_values<T>(file, block_count);
+  auto block_minima = _read_values<EncodedType>(file, block_count);
 
-  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  const auto stored_vectors = _read_value<uint8_t>(file);
   std::optional<pmr_vector<bool>> null_values;
-  if (null_values_stored) {
+  if (stored_vectors & BinaryWriter::FRAME_OF_REFERENCE_STORES_NULL_VALUES) {
     null_values = _read_values<bool>(file, row_count);
   }
 
+  auto block_steps = pmr_vector<EncodedType>{};
+  if (stored_vectors & BinaryWriter::FRAME_OF_REFERENCE_STORES_BLOCK_STEPS) {
+    block_steps = _read_values<EncodedType>(file, block_count);
+  }
+
+  auto exception_positions = pmr_vector<ChunkOffset>{};
+  auto exception_values = pmr_vector<T>{};
+  if (stored_vectors & BinaryWriter::FRAME_OF_REFERENCE_STORES_EXCEPTIONS) {
+    const auto exception_count = _read_value<uint32_t>(file);
+    exception_positions = _read_values<ChunkOffset>(file, exception_count);
+    exception_values = _read_values<T>(file, exception_count);
+  }
+
+  auto decimal_exponent = uint8_t{0};
+  if constexpr (std::is_floating_point_v<T>) {
+    decimal_exponent = _read_value<uint8_t>(file);
+  }
+
   auto offset_values = _import_offset_value_vector(file, row_count, compressed_vector_type_id);
 
-  return std::make_shared<FrameOfReferenceSegment<T>>(block_minima, null_values, std::move(offset_values));
+  return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
+                                                      std::move(offset_values), std::move(block_steps),
+                                                      std::move(exception_positions), std::move(exception_values),
+                                                      decimal_exponent);
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(MappedFileReader& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -303,8 +468,29 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
                                          block_size, last_block_size, compressed_size, num_elements);
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(MappedFileReader& file,
+                                                                            ChunkOffset row_count) {
+  std::optional<pmr_vector<bool>> null_values;
+  if (_read_value<bool>(file)) {
+    null_values = _read_values<bool>(file, row_count);
+  }
+  auto strings = _import_fsst_string_vector(file, row_count);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(strings, std::move(null_values));
+}
+
+std::shared_ptr<FSSTDictionarySegment<pmr_string>> BinaryParser::_import_fsst_dictionary_segment(
+    MappedFileReader& file, ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+  const auto dictionary_size = _read_value<ValueID>(file);
+  auto dictionary = _import_fsst_string_vector(file, dictionary_size);
+  auto attribute_vector = _import_attribute_vector(file, row_count, compressed_vector_type_id);
+
+  return std::make_shared<FSSTDictionarySegment<pmr_string>>(dictionary, attribute_vector);
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    MappedFileReader& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -315,6 +501,8 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
       return std::make_shared<FixedWidthIntegerVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
     case CompressedVectorType::FixedWidthInteger4Byte:
       return std::make_shared<FixedWidthIntegerVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+    case CompressedVectorType::SimdBp128:
+      return _read_simd_bp128_vector(file, row_count);
     default:
       Fail("Cannot import attribute vector with compressed vector type id: " +
            std::to_string(compressed_vector_type_id));
@@ -322,7 +510,7 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    MappedFileReader& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -333,17 +521,51 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
       return std::make_unique<FixedWidthIntegerVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
     case CompressedVectorType::FixedWidthInteger4Byte:
       return std::make_unique<FixedWidthIntegerVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+    case CompressedVectorType::SimdBp128:
+      return _read_simd_bp128_vector(file, row_count);
     default:
       Fail("Cannot import attribute vector with compressed vector type id: " +
            std::to_string(compressed_vector_type_id));
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::unique_ptr<SimdBp128Vector> BinaryParser::_read_simd_bp128_vector(MappedFileReader& file,
+                                                                       const ChunkOffset row_count) {
+  const auto block_count = (row_count + SimdBp128Vector::BLOCK_SIZE - 1) / SimdBp128Vector::BLOCK_SIZE;
+  auto block_offsets = _read_values<uint32_t>(file, block_count + 1);
+  auto data = _read_values<uint32_t>(file, block_offsets.back());
+  auto exception_offsets = _read_values<uint32_t>(file, block_count + 1);
+  const auto exception_count = exception_offsets.back();
+  auto exception_positions = _read_values<uint8_t>(file, exception_count);
+  auto exception_values = _read_values<uint32_t>(file, exception_count);
+  return std::make_unique<SimdBp128Vector>(std::move(data), std::move(block_offsets), std::move(exception_offsets),
+                                           std::move(exception_positions), std::move(exception_values), row_count);
+}
+
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(MappedFileReader& file,
+                                                                             const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
   pmr_vector<char> values(string_length * count);
-  file.read(values.data(), static_cast<int64_t>(values.size()));
+  std::memcpy(values.data(), file.consume(values.size()), values.size());
   return std::make_shared<FixedStringVector>(std::move(values), string_length);
 }
 
+std::shared_ptr<FSSTStringVector> BinaryParser::_import_fsst_string_vector(MappedFileReader& file, const size_t count) {
+  const auto offsets_type_id = _read_value<CompressedVectorTypeID>(file);
+
+  const auto symbol_count = _read_value<uint8_t>(file);
+  const auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+  auto symbols = std::vector<std::string>{};
+  symbols.reserve(symbol_count);
+  for (const auto symbol_length : symbol_lengths) {
+    symbols.emplace_back(file.consume(symbol_length), symbol_length);
+  }
+
+  const auto compressed_data_size = _read_value<uint32_t>(file);
+  auto compressed_data = _read_values<char>(file, compressed_data_size);
+  auto offsets = _import_offset_value_vector(file, static_cast<ChunkOffset>(count + 1), offsets_type_id);
+
+  return std::make_shared<FSSTStringVector>(FSSTSymbolTable{symbols}, std::move(compressed_data), std::move(offsets));
+}
+
 }  // namespace hyrise
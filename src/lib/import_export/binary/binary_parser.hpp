@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -12,11 +11,14 @@
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 namespace hyrise {
 
@@ -29,26 +31,81 @@ class BinaryParser {
   /*
    * Reads the given binary file. The file must be in the following form:
    *
-   * --------------
-   * |   Header   |
-   * |------------|
-   * |   Chunks¹  |
-   * --------------
+   * -------------------
+   * |     Header      |
+   * |-----------------|
+   * |     Chunks¹     |
+   * |-----------------|
+   * | Chunk directory²|
+   * -------------------
    *
    * ¹ Zero or more chunks
+   * ² Optional. If present, the chunks are imported in parallel.
    */
   static std::shared_ptr<Table> parse(const std::string& filename);
 
  private:
+  /*
+   * Sequential reader on a read-only memory mapping of a binary file. Values are copied from the mapping directly into
+   * the segments' vectors. Compared to reading through a stream, this avoids the stream buffer as well as temporary
+   * buffers for strings and bools. Pages of the file are released as soon as they have been parsed, so that loading
+   * large files does not keep both the file and the table in memory.
+   *
+   * This is not a zero-copy load: the imported segments own their data and do not reference the mapping, which is
+   * unmapped once parsing has finished.
+   */
+  class MappedFileReader : public Noncopyable {
+   public:
+    explicit MappedFileReader(const std::string& filename);
+
+    // Creates a view on the bytes [begin, end) of the given file, which must outlive the view. Views of disjoint ranges
+    // can be read concurrently.
+    MappedFileReader(const MappedFileReader& file, const size_t begin, const size_t end);
+
+    ~MappedFileReader();
+
+    size_t position() const;
+
+    size_t size() const;
+
+    // Returns a pointer to the next byte_count bytes (which might not be aligned) and advances the read position.
+    const char* consume(const size_t byte_count);
+
+    // Tells the kernel that the parsed part of the file is not needed anymore.
+    void release_consumed_pages();
+
+   private:
+    char* _data{nullptr};
+    size_t _size{0};
+    size_t _position{0};
+    size_t _released_bytes{0};
+    bool _owns_mapping{true};
+  };
+
+  // Contents of a chunk that has been read from the file but not yet added to the table.
+  struct ImportedChunk {
+    ChunkOffset row_count{0};
+    std::vector<SortColumnDefinition> sorted_columns;
+    Segments segments;
+  };
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(MappedFileReader& file);
+
+  /*
+   * Reads the chunk directory from the end of the file (see BinaryWriter::write). Returns the offsets of all chunks,
+   * followed by the offset at which the last chunk ends, or std::nullopt if the file has no chunk directory.
+   */
+  static std::optional<pmr_vector<uint64_t>> _read_chunk_directory(const MappedFileReader& file,
+                                                                   const ChunkID chunk_count);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Reads a chunk for the given table from the given file. Does not modify the table and can thus be called for
+   * multiple chunks concurrently.
    * The chunk information has the following form:
    *
    * ----------------
@@ -59,59 +116,74 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static ImportedChunk _import_chunk(MappedFileReader& file, const Table& table);
+
+  // Appends the imported chunk to the table as an immutable chunk.
+  static void _append_chunk(Table& table, const ImportedChunk& imported_chunk);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                           DataType data_type, bool column_is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                           bool column_is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                 bool column_is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(MappedFileReader& file,
+                                                                          ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      MappedFileReader& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file,
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(MappedFileReader& file,
                                                                          ChunkOffset /*row_count*/);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(MappedFileReader& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(MappedFileReader& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(MappedFileReader& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTDictionarySegment<pmr_string>> _import_fsst_dictionary_segment(MappedFileReader& file,
+                                                                                            ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given compressed_vector_type_id.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      MappedFileReader& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      MappedFileReader& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(MappedFileReader& file, const size_t count);
+
+  // Reads the symbol table, the compressed data, and the count + 1 offsets of an FSSTStringVector with count strings.
+  static std::shared_ptr<FSSTStringVector> _import_fsst_string_vector(MappedFileReader& file, const size_t count);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  // Reads the blocks and exceptions of a SimdBp128Vector with row_count many values.
+  static std::unique_ptr<SimdBp128Vector> _read_simd_bp128_vector(MappedFileReader& file, ChunkOffset row_count);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(MappedFileReader& file, const size_t count);
 
   // Reads bit width and row_count many values and returns them in a bitpacked compact_vector of type T
   template <typename T>
-  static pmr_compact_vector _read_values_compact_vector(std::ifstream& file, const size_t count);
+  static pmr_compact_vector _read_values_compact_vector(MappedFileReader& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(MappedFileReader& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(MappedFileReader& file);
 };
 
 }  // namespace hyrise
@@ -5,12 +5,19 @@
 #include <cstring>
 #include <fstream>
 #include <ios>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
@@ -27,6 +34,7 @@
 #include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -34,18 +42,18 @@ namespace {
 
 using namespace hyrise;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the ostream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the strings are
+/* Writes the given strings to the ostream. First an array of string lengths is written. After that the strings are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
+void export_string_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
   const auto value_count = values.size();
   auto string_lengths = pmr_vector<size_t>(value_count);
   auto total_length = size_t{0};
@@ -56,7 +64,7 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(ostream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) {
@@ -71,41 +79,49 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(ostream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values) {
+  ostream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
-void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
-  ofstream.write(values.data(), static_cast<int64_t>(values.size() * values.string_length()));
+void export_values(std::ostream& ostream, const FixedStringVector& values) {
+  ostream.write(values.data(), static_cast<int64_t>(values.size() * values.string_length()));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
+  export_string_values(ostream, values);
 }
 
 // specialized implementation for bool values
 template <typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
+void export_values(std::ostream& ostream, const std::vector<bool, Alloc>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the ostream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& ostream, const T& value) {
+  ostream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
-void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& values) {
-  export_value(ofstream, static_cast<uint8_t>(values.bits()));
-  ofstream.write(reinterpret_cast<const char*>(values.get()), static_cast<int64_t>(values.bytes()));
+void export_compact_vector(std::ostream& ostream, const pmr_compact_vector& values) {
+  export_value(ostream, static_cast<uint8_t>(values.bits()));
+  ostream.write(reinterpret_cast<const char*>(values.get()), static_cast<int64_t>(values.bytes()));
+}
+
+void export_simd_bp128_vector(std::ostream& ostream, const SimdBp128Vector& vector) {
+  export_values(ostream, vector.block_offsets());
+  export_values(ostream, vector.data());
+  export_values(ostream, vector.exception_offsets());
+  export_values(ostream, vector.exception_positions());
+  export_values(ostream, vector.exception_values());
 }
 
 }  // namespace
@@ -113,23 +129,57 @@ void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& va
 namespace hyrise {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
+  auto ofstream = std::ofstream{};
   ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
   ofstream.open(filename, std::ios::binary);
 
   _write_header(table, ofstream);
 
+  // Chunks are serialized into in-memory buffers by one JobTask each. To bound the memory used by the buffers, only a
+  // batch of chunks is serialized at a time. A batch is closed once the (sampled) memory usage of its chunks reaches
+  // WRITE_BATCH_BYTES, so that the batches do not depend on the machine. The buffers are then appended to the file in
+  // order.
   const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    _write_chunk(table, ofstream, chunk_id);
+  auto chunk_offsets = pmr_vector<uint64_t>{};
+  chunk_offsets.reserve(chunk_count);
+
+  auto batch_begin = ChunkID{0};
+  while (batch_begin < chunk_count) {
+    auto batch_end = batch_begin;
+    auto batch_bytes = size_t{0};
+    while (batch_end < chunk_count && batch_bytes < WRITE_BATCH_BYTES) {
+      batch_bytes += table.get_chunk(batch_end)->memory_usage(MemoryUsageCalculationMode::Sampled);
+      ++batch_end;
+    }
+
+    auto buffers = std::vector<std::stringstream>(batch_end - batch_begin);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(buffers.size());
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        _write_chunk(table, buffers[chunk_id - batch_begin], chunk_id);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    for (auto& buffer : buffers) {
+      chunk_offsets.emplace_back(static_cast<uint64_t>(ofstream.tellp()));
+      ofstream << buffer.rdbuf();
+    }
+
+    batch_begin = batch_end;
   }
+
+  export_values(ofstream, chunk_offsets);
+  export_value(ofstream, CHUNK_DIRECTORY_MARKER);
 }
 
-void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+void BinaryWriter::_write_header(const Table& table, std::ostream& ostream) {
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
-  export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+  export_value(ostream, static_cast<ChunkOffset>(target_chunk_size));
+  export_value(ostream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(ostream, static_cast<ColumnID::base_type>(table.column_count()));
 
   auto column_types = pmr_vector<pmr_string>(table.column_count());
   auto column_names = pmr_vector<pmr_string>(table.column_count());
@@ -142,54 +192,56 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(ostream, column_types);
+  export_values(ostream, columns_are_nullable);
+  export_string_values(ostream, column_names);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+void BinaryWriter::_write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id) {
   const auto chunk = table.get_chunk(chunk_id);
   Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(ostream, static_cast<ChunkOffset>(chunk->size()));
 
   // Export sort column definitions
   const auto& sorted_columns = chunk->individually_sorted_by();
-  export_value(ofstream, static_cast<uint32_t>(sorted_columns.size()));
+  export_value(ostream, static_cast<uint32_t>(sorted_columns.size()));
   for (const auto& [column, sort_mode] : sorted_columns) {
-    export_value(ofstream, column);
-    export_value(ofstream, sort_mode);
+    export_value(ostream, column);
+    export_value(ostream, sort_mode);
   }
 
   // Iterating over all segments of this chunk and exporting them
   const auto column_count = chunk->column_count();
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    resolve_data_and_segment_type(*chunk->get_segment(column_id),
-                                  [&](const auto /*data_type_t*/, const auto& resolved_segment) {
-                                    _write_segment(resolved_segment, table.column_is_nullable(column_id), ofstream);
-                                  });
+    // The segments' containers are exported directly. Thus, the segments' pages have to be pinned.
+    const auto segment = chunk->get_segment(column_id);
+    const auto pin_guard = SharedPagePinGuard{segment->buffer_pages()};
+    resolve_data_and_segment_type(*segment, [&](const auto /*data_type_t*/, const auto& resolved_segment) {
+      _write_segment(resolved_segment, table.column_is_nullable(column_id), ostream);
+    });
   }
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Unencoded);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::Unencoded);
 
   if (column_is_nullable) {
-    export_value(ofstream, value_segment.is_nullable());
+    export_value(ostream, value_segment.is_nullable());
   }
 
   if (value_segment.is_nullable()) {
-    export_values(ofstream, value_segment.null_values());
+    export_values(ostream, value_segment.null_values());
   }
 
-  export_values(ofstream, value_segment.values());
+  export_values(ostream, value_segment.values());
 }
 
 void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable,
-                                  std::ofstream& ofstream) {
+                                  std::ostream& ostream) {
   // We materialize reference segments and save them as value segments.
-  export_value(ofstream, EncodingType::Unencoded);
+  export_value(ostream, EncodingType::Unencoded);
 
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
     using SegmentDataType = typename decltype(type)::type;
@@ -208,148 +260,209 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, boo
     });
 
     if (column_is_nullable) {
-      export_value(ofstream, true);
-      export_values(ofstream, null_values);
+      export_value(ostream, true);
+      export_values(ostream, null_values);
     }
 
-    export_values(ofstream, values);
+    export_values(ostream, values);
   });
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, bool /*column_is_nullable*/,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Dictionary);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::Dictionary);
 
   // Write attribute vector compression id
   const auto compressed_vector_type_id = _compressed_vector_type_id<T>(dictionary_segment);
-  export_value(ofstream, compressed_vector_type_id);
+  export_value(ostream, compressed_vector_type_id);
 
   // Write the dictionary size and dictionary
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
-  export_values(ofstream, *dictionary_segment.dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
+  export_values(ostream, *dictionary_segment.dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *dictionary_segment.compressed_vector_type(),
                             *dictionary_segment.attribute_vector());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                                  bool /*column_is_nullable*/, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FixedStringDictionary);
+                                  bool /*column_is_nullable*/, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FixedStringDictionary);
 
   // Write attribute vector compression id
   const auto compressed_vector_type_id = _compressed_vector_type_id<T>(fixed_string_dictionary_segment);
-  export_value(ofstream, compressed_vector_type_id);
+  export_value(ostream, compressed_vector_type_id);
 
   // Write the dictionary size, string length and dictionary
   const auto dictionary_size = fixed_string_dictionary_segment.fixed_string_dictionary()->size();
   const auto string_length = fixed_string_dictionary_segment.fixed_string_dictionary()->string_length();
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_size));
-  export_value(ofstream, static_cast<uint32_t>(string_length));
-  export_values(ofstream, *fixed_string_dictionary_segment.fixed_string_dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_size));
+  export_value(ostream, static_cast<uint32_t>(string_length));
+  export_values(ostream, *fixed_string_dictionary_segment.fixed_string_dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *fixed_string_dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *fixed_string_dictionary_segment.compressed_vector_type(),
                             *fixed_string_dictionary_segment.attribute_vector());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, bool /*column_is_nullable*/,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::RunLength);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::RunLength);
 
   // Write size and values
-  export_value(ofstream, static_cast<uint32_t>(run_length_segment.values()->size()));
-  export_values(ofstream, *run_length_segment.values());
+  export_value(ostream, static_cast<uint32_t>(run_length_segment.values()->size()));
+  export_values(ostream, *run_length_segment.values());
 
   // Write NULL values
-  export_values(ofstream, *run_length_segment.null_values());
+  export_values(ostream, *run_length_segment.null_values());
 
   // Write end positions
-  export_values(ofstream, *run_length_segment.end_positions());
+  export_values(ostream, *run_length_segment.end_positions());
 }
 
-template <>
-void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
-                                  bool /*column_is_nullable*/, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FrameOfReference);
+template <typename T>
+void BinaryWriter::_write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment,
+                                  bool /*column_is_nullable*/, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FrameOfReference);
 
   // Write attribute vector compression id
-  const auto compressed_vector_type_id = _compressed_vector_type_id<int32_t>(frame_of_reference_segment);
-  export_value(ofstream, compressed_vector_type_id);
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(frame_of_reference_segment);
+  export_value(ostream, compressed_vector_type_id);
 
   // Write number of blocks and block minima
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
-  export_values(ofstream, frame_of_reference_segment.block_minima());
+  export_value(ostream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
+  export_values(ostream, frame_of_reference_segment.block_minima());
+
+  // Write flags of the optional vectors
+  const auto& exception_positions = frame_of_reference_segment.exception_positions();
+  auto stored_vectors = uint8_t{0};
+  if (frame_of_reference_segment.null_values()) {
+    stored_vectors |= FRAME_OF_REFERENCE_STORES_NULL_VALUES;
+  }
+  if (!frame_of_reference_segment.block_steps().empty()) {
+    stored_vectors |= FRAME_OF_REFERENCE_STORES_BLOCK_STEPS;
+  }
+  if (!exception_positions.empty()) {
+    stored_vectors |= FRAME_OF_REFERENCE_STORES_EXCEPTIONS;
+  }
+  export_value(ostream, stored_vectors);
 
-  // Write flag if optional NULL value vector is written
-  export_value(ofstream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
   if (frame_of_reference_segment.null_values()) {
     // Write NULL values
-    export_values(ofstream, *frame_of_reference_segment.null_values());
+    export_values(ostream, *frame_of_reference_segment.null_values());
+  }
+
+  if (!frame_of_reference_segment.block_steps().empty()) {
+    export_values(ostream, frame_of_reference_segment.block_steps());
+  }
+
+  if (!exception_positions.empty()) {
+    export_value(ostream, static_cast<uint32_t>(exception_positions.size()));
+    export_values(ostream, exception_positions);
+    export_values(ostream, frame_of_reference_segment.exception_values());
+  }
+
+  if constexpr (std::is_floating_point_v<T>) {
+    export_value(ostream, frame_of_reference_segment.decimal_exponent());
   }
 
   // Write offset values
-  _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::LZ4);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::LZ4);
 
   // Write num elements (rows in segment)
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.size()));
 
   // Write number of blocks
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
 
   // Write block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.block_size()));
 
   // Write last block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.last_block_size()));
 
   // Write compressed size for each LZ4 Block
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_block.size()));
   }
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_values(ofstream, lz4_block);
+    export_values(ostream, lz4_block);
   }
 
   if (lz4_segment.null_values()) {
     // Write NULL value size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
     // Write NULL values
-    export_values(ofstream, *lz4_segment.null_values());
+    export_values(ostream, *lz4_segment.null_values());
   } else {
     // No NULL values
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 
   // Write dictionary size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
 
   // Write dictionary
-  export_values(ofstream, lz4_segment.dictionary());
+  export_values(ostream, lz4_segment.dictionary());
 
   if (lz4_segment.string_offsets()) {
     // Write string_offset size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.string_offsets()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.string_offsets()->size()));
     // Write string_offset data_size
-    export_compact_vector(ofstream, dynamic_cast<const BitPackingVector&>(*lz4_segment.string_offsets()).data());
+    export_compact_vector(ostream, dynamic_cast<const BitPackingVector&>(*lz4_segment.string_offsets()).data());
   } else {
     // Write string_offset size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/,
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::FSST);
+
+  // Write NULL values
+  const auto& null_values = fsst_segment.null_values();
+  export_value(ostream, null_values.has_value());
+  if (null_values) {
+    export_values(ostream, *null_values);
+  }
+
+  // Write compressed strings
+  _export_fsst_string_vector(ostream, *fsst_segment.strings());
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTDictionarySegment<T>& fsst_dictionary_segment,
+                                  bool /*column_is_nullable*/, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FSSTDictionary);
+
+  // Write attribute vector compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(fsst_dictionary_segment);
+  export_value(ostream, compressed_vector_type_id);
+
+  // Write the dictionary size and dictionary
+  const auto& dictionary = *fsst_dictionary_segment.fsst_dictionary();
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary.size()));
+  _export_fsst_string_vector(ostream, dictionary);
+
+  // Write attribute vector
+  _export_compressed_vector(ostream, *fsst_dictionary_segment.compressed_vector_type(),
+                            *fsst_dictionary_segment.attribute_vector());
+}
+
 template <typename T>
 CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
     const AbstractEncodedSegment& abstract_encoded_segment) {
@@ -362,6 +475,7 @@ CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
       case CompressedVectorType::FixedWidthInteger2Byte:
       case CompressedVectorType::FixedWidthInteger1Byte:
       case CompressedVectorType::BitPacking:
+      case CompressedVectorType::SimdBp128:
         compressed_vector_type_id = static_cast<uint8_t>(*compressed_vector_type);
         break;
       default:
@@ -371,24 +485,47 @@ CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
   return compressed_vector_type_id;
 }
 
-void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+void BinaryWriter::_export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                              const BaseCompressedVector& compressed_vector) {
   switch (type) {
     case CompressedVectorType::FixedWidthInteger4Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint32_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedWidthIntegerVector<uint32_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedWidthInteger2Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint16_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedWidthIntegerVector<uint16_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedWidthInteger1Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint8_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedWidthIntegerVector<uint8_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::BitPacking:
-      export_compact_vector(ofstream, dynamic_cast<const BitPackingVector&>(compressed_vector).data());
+      export_compact_vector(ostream, dynamic_cast<const BitPackingVector&>(compressed_vector).data());
+      return;
+    case CompressedVectorType::SimdBp128:
+      export_simd_bp128_vector(ostream, dynamic_cast<const SimdBp128Vector&>(compressed_vector));
       return;
     default:
       Fail("Any other type should have been caught before.");
   }
 }
 
+void BinaryWriter::_export_fsst_string_vector(std::ostream& ostream, const FSSTStringVector& strings) {
+  const auto offsets_type = strings.offsets().type();
+  export_value(ostream, static_cast<CompressedVectorTypeID>(offsets_type));
+
+  // Write the symbol table
+  const auto symbols = strings.symbol_table().symbols();
+  export_value(ostream, static_cast<uint8_t>(symbols.size()));
+  for (const auto& symbol : symbols) {
+    export_value(ostream, static_cast<uint8_t>(symbol.size()));
+  }
+  for (const auto& symbol : symbols) {
+    ostream.write(symbol.data(), static_cast<int64_t>(symbol.size()));
+  }
+
+  // Write the compressed strings and their offsets
+  export_value(ostream, static_cast<uint32_t>(strings.compressed_data().size()));
+  export_values(ostream, strings.compressed_data());
+  _export_compressed_vector(ostream, offsets_type, strings.offsets());
+}
+
 }  // namespace hyrise
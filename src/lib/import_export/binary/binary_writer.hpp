@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -7,6 +9,8 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -19,11 +23,47 @@ enum class CompressedVectorType : uint8_t;
 
 class BinaryWriter {
  public:
+  /**
+   * Writes the given table into a binary file of the following form:
+   *
+   * -------------------
+   * |     Header      |
+   * |-----------------|
+   * |     Chunks¹     |
+   * |-----------------|
+   * | Chunk directory |
+   * -------------------
+   *
+   * ¹ Zero or more chunks
+   *
+   * The chunks are serialized in parallel. The chunk directory at the end of the file allows the BinaryParser to
+   * import the chunks in parallel as well:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Chunk offsets               | uint64_t array                      | Chunk count * 8
+   * Directory marker            | uint64_t (CHUNK_DIRECTORY_MARKER)   | 8
+   *
+   * The offsets are counted from the beginning of the file. Files without a directory (i.e., files that do not end
+   * with the marker) are parsed sequentially.
+   */
   static void write(const Table& table, const std::string& filename);
 
+  // Chunks are serialized in batches whose estimated size in memory reaches this bound.
+  static constexpr auto WRITE_BATCH_BYTES = size_t{256} * 1024 * 1024;
+
+  // "CHNKSDIR" in little-endian byte order.
+  static constexpr auto CHUNK_DIRECTORY_MARKER = uint64_t{0x524944534B4E4843};
+
+  // Flags for the optional vectors of FrameOfReferenceSegments. Files written before block steps and exceptions were
+  // added store only the first flag (as a bool).
+  static constexpr auto FRAME_OF_REFERENCE_STORES_NULL_VALUES = uint8_t{1};
+  static constexpr auto FRAME_OF_REFERENCE_STORES_BLOCK_STEPS = uint8_t{2};
+  static constexpr auto FRAME_OF_REFERENCE_STORES_EXCEPTIONS = uint8_t{4};
+
  private:
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given ostream.
    *
    * Description                 | Type                                | Size in bytes
    * --------------------------------------------------------------------------------------------------------
@@ -35,10 +75,10 @@ class BinaryWriter {
    * Column name lengths         | size_t array                        | Column Count * 1
    * Column names                | std::string array                   | Sum of lengths of all names
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& ostream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given ostream.
    * First, it creates a chunk header with the following contents:
    *
    * Description                 | Type                                | Size in bytes
@@ -50,7 +90,7 @@ class BinaryWriter {
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id);
 
   /**
    * ValueSegments are dumped with the following layout:
@@ -73,7 +113,7 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    */
   template <typename T>
-  static void _write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable, std::ofstream& ofstream);
+  static void _write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable, std::ostream& ostream);
 
   /**
    * ReferenceSegments are dumped with the following layout, which is similar to value segments:
@@ -91,8 +131,7 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    */
-  static void _write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable,
-                             std::ofstream& ofstream);
+  static void _write_segment(const ReferenceSegment& reference_segment, bool column_is_nullable, std::ostream& ostream);
 
   /**
    * DictionarySegments are dumped with the following layout:
@@ -109,6 +148,7 @@ class BinaryWriter {
    * Attribute vector values¹    | uint8_t                             | Rows * (vector compr. bit width) / 8
    *                                                                     rounded up to next multiple of word (8 byte)
    * Attribute vector values²    | uint(8|16|32)_t                     | Rows * width of attribute vector
+   * Attribute vector values³    | SimdBp128Vector                     | see _export_compressed_vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
@@ -117,10 +157,11 @@ class BinaryWriter {
    * °: This field is written if the type of the column is NOT a string
    * ¹: This field is only written if the vector compression is BitPacking
    * ²: This field is only written if the vector compression is FixedWidthInteger
+   * ³: This field is only written if the vector compression is SimdBp128
    */
   template <typename T>
   static void _write_segment(const DictionarySegment<T>& dictionary_segment, bool /*column_is_nullable*/,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * FixedStringDictionarySegments are dumped with the following layout:
@@ -136,15 +177,17 @@ class BinaryWriter {
    * Attribute vector values¹    | uint8_t                             | Rows * (vector compr. bit width) / 8
    *                                                                     rounded up to next multiple of word (8 byte)
    * Attribute vector values²    | uint(8|16|32)_t                     | Rows * width of attribute vector
+   * Attribute vector values³    | SimdBp128Vector                     | see _export_compressed_vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    * ¹: This field is only written if the vector compression is BitPacking
    * ²: This field is only written if the vector compression is FixedWidthInteger
+   * ³: This field is only written if the vector compression is SimdBp128
    */
   template <typename T>
   static void _write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                             bool /*column_is_nullable*/, std::ofstream& ofstream);
+                             bool /*column_is_nullable*/, std::ostream& ostream);
 
   /**
    * RunLengthSegments are dumped with the following layout:
@@ -162,7 +205,7 @@ class BinaryWriter {
    */
   template <typename T>
   static void _write_segment(const RunLengthSegment<T>& run_length_segment, bool /*column_is_nullable*/,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * FrameOfReferenceSegments are dumped with the following layout:
@@ -172,13 +215,19 @@ class BinaryWriter {
    * Encoding Type               | EncodingType                        | 1
    * Attribute vector compr. ID. | CompressedVectorTypeID              | 1
    * Number of Blocks            | uint32_t                            | 4
-   * Block minima                | T                                   | Number of blocks * sizeof(T)
-   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * Block minima                | EncodedType (T or int64_t)          | Number of blocks * sizeof(EncodedType)
+   * Stored vectors              | uint8_t (flags)                     | 1
    * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Block steps⁵                | EncodedType                         | Number of blocks * sizeof(EncodedType)
+   * Number of exceptions⁶       | uint32_t                            | 4
+   * Exception positions⁶        | ChunkOffset                         | Number of exceptions * 4
+   * Exception values⁶           | T                                   | Number of exceptions * sizeof(T)
+   * Decimal exponent⁷           | uint8_t                             | 1
    * Vector compress. bit width² | uint8_t                             | 1
    * Offset values²              | uint8_t                             | Rows * (vector compr. bit width) / 8
    *                                                                     rounded up to next multiple of word (8 byte)
    * Offset values³              | uint(8|16|32)_t                     | Rows * width of offset vector
+   * Offset values⁴              | SimdBp128Vector                     | see _export_compressed_vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
@@ -186,10 +235,14 @@ class BinaryWriter {
    * ¹: This field is only written when the optional NULL values are stored
    * ²: This field is only written if the vector compression is BitPacking
    * ³: This field is only written if the vector compression is FixedWidthInteger
+   * ⁴: This field is only written if the vector compression is SimdBp128
+   * ⁵: This field is only written if a block uses a linear frame (FRAME_OF_REFERENCE_STORES_BLOCK_STEPS)
+   * ⁶: These fields are only written if the segment has exceptions (FRAME_OF_REFERENCE_STORES_EXCEPTIONS)
+   * ⁷: This field is only written if the type of the column is float or double
    */
   template <typename T>
   static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, bool /*column_is_nullable*/,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
 
   /**
    * LZ4Segments are dumped with the following layout:
@@ -220,13 +273,83 @@ class BinaryWriter {
    * ³: This field is only written if the vector compression is BitPacking
    */
   template <typename T>
-  static void _write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
+  static void _write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/, std::ostream& ostream);
+
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Stores NULL values          | bool                                | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | Rows * 1
+   * Strings                     | FSSTStringVector                    | see _export_fsst_string_vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written if the segment stores NULL values
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/, std::ostream& ostream);
+
+  /**
+   * FSSTDictionarySegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Attribute vector compr. ID. | CompressedVectorTypeID              | 1
+   * Size of dictionary vector   | ValueID                             | 4
+   * Dictionary Values           | FSSTStringVector                    | see _export_fsst_string_vector
+   * Vector compress. bit width¹ | uint8_t                             | 1
+   * Attribute vector values¹    | uint8_t                             | Rows * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Attribute vector values²    | uint(8|16|32)_t                     | Rows * width of attribute vector
+   * Attribute vector values³    | SimdBp128Vector                     | see _export_compressed_vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   * ¹: This field is only written if the vector compression is BitPacking
+   * ²: This field is only written if the vector compression is FixedWidthInteger
+   * ³: This field is only written if the vector compression is SimdBp128
+   */
+  template <typename T>
+  static void _write_segment(const FSSTDictionarySegment<T>& fsst_dictionary_segment, bool /*column_is_nullable*/,
+                             std::ostream& ostream);
 
   template <typename T>
   static CompressedVectorTypeID _compressed_vector_type_id(const AbstractEncodedSegment& abstract_encoded_segment);
 
-  // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
-  static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  /**
+   * Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
+   *
+   * SimdBp128Vectors are dumped with the following layout. The number of blocks is derived from the number of rows:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Block offsets               | vector<uint32_t>                    | (Number of blocks + 1) * 4
+   * Packed data                 | vector<uint32_t>                    | Last block offset * 4
+   * Exception offsets           | vector<uint32_t>                    | (Number of blocks + 1) * 4
+   * Exception positions         | vector<uint8_t>                     | Last exception offset * 1
+   * Exception values            | vector<uint32_t>                    | Last exception offset * 4
+   */
+  static void _export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                         const BaseCompressedVector& compressed_vector);
+
+  /**
+   * FSSTStringVectors are dumped with the following layout. The number of strings is known from the segment:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Offsets compr. ID           | CompressedVectorTypeID              | 1
+   * Number of symbols           | uint8_t                             | 1
+   * Symbol lengths              | vector<uint8_t>                     | Number of symbols * 1
+   * Symbols                     | char array                          | Sum of symbol lengths
+   * Size of compressed data     | uint32_t                            | 4
+   * Compressed data             | char array                          | Size of compressed data
+   * Offsets                     | see _export_compressed_vector       | (Number of strings + 1) offsets
+   */
+  static void _export_fsst_string_vector(std::ostream& ostream, const FSSTStringVector& strings);
 };
 }  // namespace hyrise
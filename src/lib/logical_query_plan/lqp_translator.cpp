@@ -27,6 +27,7 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_expression.hpp"
 #include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "import_node.hpp"
@@ -59,10 +60,12 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window_function_evaluator.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
@@ -76,6 +79,7 @@
 #include "utils/map_prunable_subquery_predicates.hpp"
 #include "utils/performance_warning.hpp"
 #include "utils/pruning_utils.hpp"
+#include "utils/runtime_join_filters.hpp"
 
 namespace hyrise {
 
@@ -87,6 +91,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   // map_prunable_subquery_predicates.hpp).
   map_prunable_subquery_predicates(_operator_by_lqp_node);
 
+  // Hash joins can pass the keys of their smaller input to the GetTable operators below their larger input, which then
+  // prune chunks that cannot contain join partners (see runtime_join_filters.hpp).
+  add_runtime_join_filters(pqp);
+
   return pqp;
 }
 
@@ -327,10 +335,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = _translate_node_recursively(node->left_input());
+  const auto input_operator = _translate_node_recursively(node->left_input());
+
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(sort_node));
+}
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, sort_node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
   auto sort_mode_iter = sort_node->sort_modes.begin();
@@ -345,9 +357,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(pqp_column_expression->column_id, *sort_mode_iter);
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -452,10 +463,22 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = _translate_node_recursively(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+
+  // A LIMIT with a constant row count on top of an ORDER BY is executed as a TopK, which does not sort the entire
+  // input. If the SortNode has further outputs, its result is needed anyway and we keep the Sort.
+  const auto& input_node = node->left_input();
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1 &&
+      limit_node->num_rows_expression()->type == ExpressionType::Value) {
+    const auto sort_node = std::dynamic_pointer_cast<SortNode>(input_node);
+    const auto input_operator = _translate_node_recursively(sort_node->left_input());
+    return std::make_shared<TopK>(input_operator, _translate_sort_column_definitions(sort_node),
+                                  _translate_expressions({limit_node->num_rows_expression()}, input_node).front());
+  }
+
+  const auto input_operator = _translate_node_recursively(input_node);
+  return std::make_shared<Limit>(input_operator,
+                                 _translate_expressions({limit_node->num_rows_expression()}, input_node).front());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -518,10 +541,25 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
-// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Align methods, even though some can be static.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
-    const std::shared_ptr<AbstractLQPNode>& /* node */) const {
-  FailInput("Hyrise does not yet support window functions.");
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = _translate_node_recursively(node->left_input());
+  const auto& input_expressions = node->left_input()->output_expressions();
+  const auto& window_function = static_cast<const WindowFunctionExpression&>(*node->node_expressions.front());
+
+  // The argument and the window are translated separately. Otherwise, COUNT(*) would be resolved to a
+  // WindowFunctionExpression without window (see _translate_expression()).
+  auto pqp_argument = std::shared_ptr<AbstractExpression>{};
+  if (WindowFunctionExpression::is_count_star(window_function)) {
+    pqp_argument = std::make_shared<PQPColumnExpression>(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  } else if (window_function.argument()) {
+    pqp_argument = _translate_expression(window_function.argument(), node->left_input(), input_expressions);
+  }
+
+  const auto pqp_window = _translate_expression(window_function.window(), node->left_input(), input_expressions);
+  const auto pqp_window_function =
+      std::make_shared<WindowFunctionExpression>(window_function.window_function, pqp_argument, pqp_window);
+  return std::make_shared<WindowFunctionEvaluator>(input_operator, pqp_window_function);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
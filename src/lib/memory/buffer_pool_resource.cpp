@@ -0,0 +1,267 @@
+#include "buffer_pool_resource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "magic_enum.hpp"
+
+#include "memory/default_memory_resource.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/buffer/buffer_manager.hpp"
+#include "storage/buffer/page_id.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+PageSizeType find_fitting_page_size_type(const std::size_t bytes) {
+  for (const auto size_type : magic_enum::enum_values<PageSizeType>()) {
+    if (bytes <= bytes_for_size_type(size_type)) {
+      return size_type;
+    }
+  }
+  Fail("Allocation of " + std::to_string(bytes) + " bytes does not fit into any page.");
+}
+
+// State of a segment migration or destruction that is executed by the current thread. As copy_using_memory_resource
+// and the segments' destructors allocate and deallocate through the generic MemoryResource interface, we pass this
+// state via a thread-local pointer.
+struct PageScope {
+  explicit PageScope(const BufferPoolResource* init_resource) : resource{init_resource} {}
+
+  const BufferPoolResource* resource;
+
+  // Migrated segments use their own small page so that pages are never shared between segments.
+  PageID small_page{INVALID_PAGE_ID};
+  uint64_t small_page_offset{0};
+
+  // Pages that have been allocated during the migration and still hold data.
+  std::unordered_set<PageID> allocated_pages;
+
+  // While a segment is destroyed, its pages are pinned and can only be freed afterwards.
+  bool defer_frees{false};
+  std::vector<PageID> deferred_frees;
+};
+
+thread_local PageScope* current_page_scope = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+PageScope* active_page_scope(const BufferPoolResource* resource) {
+  if (current_page_scope && current_page_scope->resource == resource) {
+    return current_page_scope;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+BufferPoolResource::BufferPoolResource(BufferManager& buffer_manager)
+    : BufferPoolResource(buffer_manager, &DefaultResource::get()) {}
+
+BufferPoolResource::BufferPoolResource(BufferManager& buffer_manager, MemoryResource* upstream_resource)
+    : _buffer_manager{buffer_manager}, _upstream_resource{upstream_resource} {}
+
+void BufferPoolResource::make_evictable() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (const auto page_id : _unevictable_pages) {
+    _buffer_manager.make_evictable(page_id);
+  }
+  _unevictable_pages.clear();
+
+  // Retire the current small page so that no further data is written into it without a pin.
+  if (_current_small_page.valid()) {
+    _retire_small_page(_current_small_page);
+  }
+  _current_small_page = INVALID_PAGE_ID;
+}
+
+std::shared_ptr<AbstractSegment> BufferPoolResource::migrate_segment(const AbstractSegment& segment) {
+  auto scope = PageScope{this};
+  auto* const previous_scope = current_page_scope;
+  current_page_scope = &scope;
+
+  auto copy = std::shared_ptr<AbstractSegment>{};
+  try {
+    const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+    copy = segment.copy_using_memory_resource(*this);
+  } catch (...) {
+    current_page_scope = previous_scope;
+    throw;
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (scope.small_page.valid()) {
+      _retire_small_page(scope.small_page);
+    }
+
+    // The copy has been written completely. From now on, all accesses to it are expected to pin its pages.
+    for (const auto page_id : scope.allocated_pages) {
+      _unevictable_pages.erase(page_id);
+      _buffer_manager.make_evictable(page_id);
+    }
+  }
+  current_page_scope = previous_scope;
+
+  if (scope.allocated_pages.empty()) {
+    return copy;
+  }
+
+  auto pages = SegmentPages{&_buffer_manager, {scope.allocated_pages.cbegin(), scope.allocated_pages.cend()}};
+  std::sort(pages.page_ids.begin(), pages.page_ids.end(), [](const auto& lhs, const auto& rhs) {
+    return std::pair{lhs.size_type(), lhs.index()} < std::pair{rhs.size_type(), rhs.index()};
+  });
+  copy->set_buffer_pages(std::move(pages));
+
+  // The returned pointer shares the ownership of the copy with the deleter, which pins the pages during destruction.
+  auto* const raw_copy = copy.get();
+  auto deleter = [this, copy = std::move(copy)](AbstractSegment* /*segment*/) mutable {
+    _destroy_segment(std::move(copy));
+  };
+  return std::shared_ptr<AbstractSegment>(raw_copy, std::move(deleter));
+}
+
+BufferManager& BufferPoolResource::buffer_manager() const {
+  return _buffer_manager;
+}
+
+void* BufferPoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes > MAX_PAGE_ALLOCATION_SIZE || alignment > OS_PAGE_SIZE) {
+    return _upstream_resource->allocate(bytes, alignment);
+  }
+
+  if (bytes <= MAX_SMALL_ALLOCATION_SIZE) {
+    return _allocate_small(bytes, alignment);
+  }
+
+  const auto page_id = _buffer_manager.allocate_page(find_fitting_page_size_type(bytes));
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _unevictable_pages.insert(page_id);
+  }
+
+  if (auto* const scope = active_page_scope(this)) {
+    scope->allocated_pages.insert(page_id);
+  }
+  return _buffer_manager.get_page(page_id);
+}
+
+void BufferPoolResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  const auto page_id = _buffer_manager.find_page(pointer);
+  if (!page_id.valid()) {
+    _upstream_resource->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  if (bytes <= MAX_SMALL_ALLOCATION_SIZE) {
+    _deallocate_small(page_id);
+    return;
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _unevictable_pages.erase(page_id);
+  }
+  _free_page(page_id);
+}
+
+[[nodiscard]] bool BufferPoolResource::do_is_equal(const MemoryResource& other) const noexcept {
+  return &other == this;
+}
+
+void* BufferPoolResource::_allocate_small(const std::size_t bytes, const std::size_t alignment) {
+  auto* const scope = active_page_scope(this);
+  auto& page_id = scope ? scope->small_page : _current_small_page;
+  auto& page_offset = scope ? scope->small_page_offset : _current_small_page_offset;
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto page_size = bytes_for_size_type(MIN_PAGE_SIZE_TYPE);
+
+  // Align the offset to the requested alignment (always a power of two).
+  auto offset = (page_offset + alignment - 1) & ~(alignment - 1);
+  if (!page_id.valid() || offset + bytes > page_size) {
+    if (page_id.valid()) {
+      _retire_small_page(page_id);
+    }
+
+    page_id = _buffer_manager.allocate_page(MIN_PAGE_SIZE_TYPE);
+    _small_pages.emplace(page_id, SmallPage{});
+    _unevictable_pages.insert(page_id);
+    if (scope) {
+      scope->allocated_pages.insert(page_id);
+    }
+    offset = 0;
+  }
+
+  ++_small_pages[page_id].allocation_count;
+  page_offset = offset + bytes;
+  return _buffer_manager.get_page(page_id) + offset;
+}
+
+void BufferPoolResource::_deallocate_small(const PageID page_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _small_pages.find(page_id);
+  DebugAssert(iter != _small_pages.end() && iter->second.allocation_count > 0, "Small allocation is not known.");
+
+  --iter->second.allocation_count;
+  if (iter->second.allocation_count == 0 && !iter->second.is_open) {
+    _small_pages.erase(iter);
+    _unevictable_pages.erase(page_id);
+    _free_page(page_id);
+  }
+}
+
+void BufferPoolResource::_retire_small_page(const PageID page_id) {
+  const auto iter = _small_pages.find(page_id);
+  DebugAssert(iter != _small_pages.end(), "Small page is not known.");
+
+  // If all allocations of the page are already gone, it can be freed right away.
+  iter->second.is_open = false;
+  if (iter->second.allocation_count == 0) {
+    _small_pages.erase(iter);
+    _unevictable_pages.erase(page_id);
+    _free_page(page_id);
+  }
+}
+
+void BufferPoolResource::_free_page(const PageID page_id) {
+  if (auto* const scope = active_page_scope(this)) {
+    if (scope->defer_frees) {
+      scope->deferred_frees.push_back(page_id);
+      return;
+    }
+    scope->allocated_pages.erase(page_id);
+  }
+  _buffer_manager.free_page(page_id);
+}
+
+void BufferPoolResource::_destroy_segment(std::shared_ptr<AbstractSegment> segment) {
+  // The destructors of the segment's containers might read the data (e.g., to release the heap buffers of strings).
+  // Thus, the pages are pinned while the segment is destroyed. As freeing a page waits until it is no longer pinned,
+  // the pages are freed afterwards.
+  const auto pages = segment->buffer_pages();
+  auto scope = PageScope{this};
+  scope.defer_frees = true;
+  {
+    const auto pin_guard = SharedPagePinGuard{pages};
+    auto* const previous_scope = current_page_scope;
+    current_page_scope = &scope;
+    segment.reset();
+    current_page_scope = previous_scope;
+  }
+
+  for (const auto page_id : scope.deferred_frees) {
+    _buffer_manager.free_page(page_id);
+  }
+}
+
+}  // namespace hyrise
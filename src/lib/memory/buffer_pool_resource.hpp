@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "storage/buffer/page_id.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+class BufferManager;
+
+/**
+ * A memory resource that hands out memory from pages of a BufferManager so that the data of containers using it (e.g.,
+ * the pmr_vectors of segments) can be evicted to disk. A segment is moved into the buffer pool by copying it with
+ * `copy_using_memory_resource` (or a whole chunk with `Chunk::migrate`).
+ *
+ * Allocations up to MAX_PAGE_ALLOCATION_SIZE are placed into a page of the smallest fitting PageSizeType. Small
+ * allocations (e.g., the heap buffers of long strings) share pages of the smallest size type: they are placed
+ * consecutively into the current page, and the page is freed once all of its allocations have been deallocated.
+ * Allocations that are larger than the largest page or require a stricter alignment than OS pages are forwarded to the
+ * upstream resource and are never evicted.
+ *
+ * Pages are not evictable right after allocation because containers write to their memory without pinning it. Once
+ * the data has been written (e.g., after a chunk has been migrated), `make_evictable` hands all pages allocated so far
+ * to the BufferManager's eviction. From then on, the memory must only be accessed while the respective page is pinned.
+ *
+ * Segments should be moved into the buffer pool with `migrate_segment`. The migrated segment's data is placed into
+ * pages that are not shared with other segments, and the segment knows these pages (see AbstractSegment::buffer_pages).
+ * This allows the segment iterables and accessors to pin the pages while they read the segment.
+ */
+class BufferPoolResource : public MemoryResource {
+ public:
+  // Allocations up to this size share pages of the smallest size type.
+  static constexpr uint64_t MAX_SMALL_ALLOCATION_SIZE = bytes_for_size_type(MIN_PAGE_SIZE_TYPE) / 4;
+
+  // Allocations larger than this size are forwarded to the upstream resource.
+  static constexpr uint64_t MAX_PAGE_ALLOCATION_SIZE = bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+
+  explicit BufferPoolResource(BufferManager& buffer_manager);
+
+  BufferPoolResource(BufferManager& buffer_manager, MemoryResource* upstream_resource);
+
+  // Makes all pages that have been allocated so far evictable. Subsequent small allocations use a new page.
+  void make_evictable();
+
+  // Copies the segment into pages of this resource and makes these pages evictable right away. The pages are registered
+  // as the buffer pages of the returned copy and are pinned while the copy is destroyed.
+  std::shared_ptr<AbstractSegment> migrate_segment(const AbstractSegment& segment);
+
+  BufferManager& buffer_manager() const;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const MemoryResource& other) const noexcept override;
+
+ private:
+  struct SmallPage {
+    uint64_t allocation_count{0};
+
+    // Open pages might still receive allocations and are not freed even if they do not hold any allocation.
+    bool is_open{true};
+  };
+
+  void* _allocate_small(const std::size_t bytes, const std::size_t alignment);
+  void _deallocate_small(const PageID page_id);
+
+  // Closes the small page. Expects _mutex to be locked.
+  void _retire_small_page(const PageID page_id);
+
+  // Frees the page unless the current thread destroys a migrated segment. In that case, the page is still pinned and
+  // freed once the segment is destroyed.
+  void _free_page(const PageID page_id);
+
+  void _destroy_segment(std::shared_ptr<AbstractSegment> segment);
+
+  BufferManager& _buffer_manager;
+  MemoryResource* _upstream_resource;
+
+  std::mutex _mutex;
+
+  // Pages that have been allocated but not yet handed to the eviction.
+  std::unordered_set<PageID> _unevictable_pages;
+
+  // The page into which new small allocations are placed and the offset of the next free byte.
+  PageID _current_small_page{INVALID_PAGE_ID};
+  uint64_t _current_small_page_offset{0};
+
+  // Pages that currently hold small allocations or are still open.
+  std::unordered_map<PageID, SmallPage> _small_pages;
+};
+
+}  // namespace hyrise
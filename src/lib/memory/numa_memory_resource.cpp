@@ -0,0 +1,98 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "types.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+#if HYRISE_NUMA_SUPPORT
+const auto numa_is_available = numa_available() >= 0;  // NOLINT(cert-err58-cpp)
+const auto hardware_node_count = static_cast<uint32_t>(numa_is_available ? numa_num_configured_nodes() : 1);  // NOLINT
+
+// Allocations that are placed into pages of their own. Only these can be bound to a node.
+bool uses_numa_pages(const size_t bytes, const size_t alignment) {
+  return numa_is_available &&
+         (bytes >= NumaMemoryResource::NUMA_PAGE_ALLOCATION_SIZE || alignment > alignof(std::max_align_t));
+}
+#endif
+
+}  // namespace
+
+namespace hyrise {
+
+// We discourage manual memory management in Hyrise (such as malloc, or new), but in case of allocator/memory resource
+// implementations, it is fine.
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory,hicpp-no-malloc)
+
+NumaMemoryResource& NumaMemoryResource::get(const NodeID node_id) {
+  // The container is never destroyed so that the resources outlive all static objects that might hold allocations.
+  static auto mutex = std::mutex{};
+  static auto& resources = *new std::vector<std::unique_ptr<NumaMemoryResource>>{};
+
+  const auto lock = std::lock_guard<std::mutex>{mutex};
+  while (resources.size() <= node_id) {
+    resources.emplace_back(std::make_unique<NumaMemoryResource>(NodeID{static_cast<uint32_t>(resources.size())}));
+  }
+  return *resources[node_id];
+}
+
+NumaMemoryResource::NumaMemoryResource(const NodeID node_id)
+    : _node_id{node_id} {}
+
+NodeID NumaMemoryResource::node_id() const {
+  return _node_id;
+}
+
+void* NumaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (uses_numa_pages(bytes, alignment)) {
+    // numa_alloc_onnode() maps whole pages, which satisfies all alignments up to the page size.
+    const auto hardware_node_id = static_cast<int>(_node_id % hardware_node_count);
+    auto* const pointer = numa_alloc_onnode(bytes, hardware_node_id);
+    if (!pointer) {
+      throw std::bad_alloc{};
+    }
+    return pointer;
+  }
+#endif
+
+  auto* const pointer = alignment > alignof(std::max_align_t)
+                            ? std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)
+                            : std::malloc(bytes);
+  if (!pointer) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (uses_numa_pages(bytes, alignment)) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+
+  std::free(pointer);
+}
+
+[[nodiscard]] bool NumaMemoryResource::do_is_equal(const MemoryResource& other) const noexcept {
+  return &other == this;
+}
+
+// NOLINTEND(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory,hicpp-no-malloc)
+
+}  // namespace hyrise
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * A memory resource that binds its allocations to the memory of a NUMA node. There is one resource per node of the
+ * Topology (see Topology::memory_resource), which is used to place TaskQueues, Workers, and the segments of chunks (see
+ * Chunk::migrate) on the node whose CPUs access them.
+ *
+ * NUMA policies apply to whole pages. Allocations of at least NUMA_PAGE_ALLOCATION_SIZE bytes are thus placed into
+ * pages of their own on the resource's node. Smaller allocations (e.g., the heap buffers of short strings) are served
+ * by malloc and end up on the node of the allocating thread. On systems without NUMA support, all allocations are
+ * served by malloc.
+ *
+ * Allocations can be held by tables that outlive the Topology (e.g., across Hyrise::reset()). Thus, the resources are
+ * created once per node and live until the program ends.
+ */
+class NumaMemoryResource : public MemoryResource {
+ public:
+  static constexpr auto NUMA_PAGE_ALLOCATION_SIZE = size_t{4'096};
+
+  // Returns the shared resource of the given node. Nodes of fake NUMA topologies are mapped to the hardware nodes
+  // round-robin.
+  static NumaMemoryResource& get(const NodeID node_id);
+
+  explicit NumaMemoryResource(const NodeID node_id);
+
+  NodeID node_id() const;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const MemoryResource& other) const noexcept override;
+
+ private:
+  const NodeID _node_id;
+};
+
+}  // namespace hyrise
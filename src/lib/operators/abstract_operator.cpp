@@ -1,6 +1,8 @@
 #include "abstract_operator.hpp"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -15,10 +17,14 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "operators/operator_performance_data.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
@@ -26,6 +32,7 @@
 #include "utils/format_bytes.hpp"
 #include "utils/map_prunable_subquery_predicates.hpp"
 #include "utils/print_utils.hpp"
+#include "utils/runtime_join_filters.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -87,9 +94,11 @@ void AbstractOperator::execute() {
   _transition_to(OperatorState::Running);
 
   if constexpr (HYRISE_DEBUG) {
-    Assert(!_left_input || _left_input->executed(), "Left input has not yet been executed");
+    // The left input of a pipeline is the input of its first operator.
+    const auto& left_input = _fused_inputs.empty() ? _left_input : _fused_inputs.front()->_left_input;
+    Assert(!left_input || left_input->executed(), "Left input has not yet been executed");
     Assert(!_right_input || _right_input->executed(), "Right input has not yet been executed");
-    Assert(!_left_input || _left_input->get_output(), "Left input has no output data.");
+    Assert(!left_input || left_input->get_output(), "Left input has no output data.");
     Assert(!_right_input || _right_input->get_output(), "Right input has no output data.");
   }
 
@@ -107,10 +116,10 @@ void AbstractOperator::execute() {
     }
 
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    _output = _fused_inputs.empty() ? _on_execute(transaction_context) : _execute_pipeline();
     transaction_context->on_operator_finished();
   } else {
-    _output = _on_execute(nullptr);
+    _output = _fused_inputs.empty() ? _on_execute(nullptr) : _execute_pipeline();
   }
 
   // release any temporary data if possible
@@ -218,6 +227,9 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   // map_prunable_subquery_predicates.hpp).
   map_prunable_subquery_predicates(copied_ops);
 
+  // The same holds for the source operators of runtime join filters (see runtime_join_filters.hpp).
+  map_runtime_join_filters(copied_ops);
+
   return copy;
 }
 
@@ -383,6 +395,143 @@ std::vector<std::shared_ptr<AbstractOperator>> AbstractOperator::uncorrelated_su
   return subquery_pqps;
 }
 
+PipelineStage AbstractOperator::pipeline_stage() const {
+  return PipelineStage::None;
+}
+
+void AbstractOperator::fuse_pipeline(std::vector<std::shared_ptr<AbstractOperator>> fused_inputs) {
+  Assert(_state == OperatorState::Created && _operator_task.expired(),
+         "Pipelines must be fused before the operator is scheduled.");
+  Assert(pipeline_stage() != PipelineStage::None, "Operator cannot end a pipeline.");
+
+  if constexpr (HYRISE_DEBUG) {
+    auto expected_consumer = static_cast<const AbstractOperator*>(this);
+    for (auto fused_input = fused_inputs.rbegin(); fused_input != fused_inputs.rend(); ++fused_input) {
+      const auto& input = **fused_input;
+      Assert(expected_consumer->_left_input.get() == &input, "Fused inputs must form a chain of left inputs.");
+      Assert(input.can_be_fused_as_input(), "Operator cannot be fused into the pipeline.");
+      expected_consumer = &input;
+    }
+  }
+
+  _fused_inputs = std::move(fused_inputs);
+}
+
+bool AbstractOperator::can_be_fused_as_input() const {
+  return pipeline_stage() == PipelineStage::Any && _state == OperatorState::Created && _consumer_count == 1 &&
+         !_never_clear_output && _operator_task.expired() && !_right_input &&
+         _uncorrelated_subquery_expressions.empty();
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& AbstractOperator::fused_inputs() const {
+  return _fused_inputs;
+}
+
+void AbstractOperator::_on_begin_pipeline(const std::shared_ptr<const Table>& /*input_table*/) {}
+
+std::shared_ptr<Chunk> AbstractOperator::_on_execute_morsel(const std::shared_ptr<const Table>& /*input_table*/,
+                                                            const ChunkID /*chunk_id*/) {
+  Fail("Operator " + name() + " does not support pipelining.");
+}
+
+std::shared_ptr<const Table> AbstractOperator::_on_finish_pipeline(
+    const std::shared_ptr<const Table>& /*input_table*/, std::vector<std::shared_ptr<Chunk>>&& /*output_chunks*/) {
+  Fail("Operator " + name() + " does not support pipelining.");
+}
+
+std::shared_ptr<const Table> AbstractOperator::_execute_pipeline() {
+  // The operators of the pipeline, from the first one to this operator.
+  auto pipeline = std::vector<AbstractOperator*>{};
+  pipeline.reserve(_fused_inputs.size() + 1);
+  for (const auto& fused_input : _fused_inputs) {
+    fused_input->_transition_to(OperatorState::Running);
+    pipeline.emplace_back(fused_input.get());
+  }
+  pipeline.emplace_back(this);
+  const auto stage_count = pipeline.size();
+
+  // The first operator processes the chunks of the pipeline's input table. All other operators receive single-chunk
+  // tables holding the output chunk of the previous operator. As these operators keep the columns of their input (see
+  // PipelineStage::Any), all morsels have the columns of the pipeline's input table.
+  const auto pipeline_input_table = _fused_inputs.front()->left_input_table();
+  const auto& column_definitions = pipeline_input_table->column_definitions();
+  auto stage_input_tables = std::vector<std::shared_ptr<const Table>>{pipeline_input_table};
+  stage_input_tables.resize(stage_count, std::make_shared<Table>(column_definitions, TableType::References));
+  for (auto stage_id = size_t{0}; stage_id < stage_count; ++stage_id) {
+    pipeline[stage_id]->_on_begin_pipeline(stage_input_tables[stage_id]);
+  }
+
+  const auto chunk_count = pipeline_input_table->chunk_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  // The fused inputs do not create output tables. To keep their performance data meaningful, the rows and chunks that
+  // they pass on are counted.
+  const auto fused_input_count = _fused_inputs.size();
+  auto fused_output_row_counts = std::vector<std::atomic_uint64_t>(fused_input_count);
+  auto fused_output_chunk_counts = std::vector<std::atomic_uint64_t>(fused_input_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = pipeline_input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    auto execute_morsel = [&, chunk_id]() {
+      auto morsel_table = pipeline_input_table;
+      auto morsel_chunk_id = chunk_id;
+      for (auto stage_id = size_t{0}; stage_id < stage_count; ++stage_id) {
+        auto output_chunk = pipeline[stage_id]->_on_execute_morsel(morsel_table, morsel_chunk_id);
+        if (!output_chunk) {
+          return;
+        }
+
+        if (stage_id == stage_count - 1) {
+          // Each job writes to its own slot, so that the output chunks keep the order of the input chunks.
+          output_chunks[chunk_id] = std::move(output_chunk);
+          return;
+        }
+
+        fused_output_row_counts[stage_id] += output_chunk->size();
+        ++fused_output_chunk_counts[stage_id];
+        morsel_table = std::make_shared<Table>(column_definitions, TableType::References,
+                                               std::vector<std::shared_ptr<Chunk>>{std::move(output_chunk)});
+        morsel_chunk_id = ChunkID{0};
+      }
+    };
+
+    // Small morsels are not worth the scheduling overhead, see the JOB_SPAWN_THRESHOLD of, e.g., the TableScan.
+    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
+    if (chunk->size() >= JOB_SPAWN_THRESHOLD) {
+      auto job_task = std::make_shared<JobTask>(execute_morsel);
+      job_task->set_preferred_node_id(chunk->numa_node_id());
+      jobs.emplace_back(std::move(job_task));
+    } else {
+      execute_morsel();
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  std::erase(output_chunks, nullptr);
+  auto output = _on_finish_pipeline(stage_input_tables.back(), std::move(output_chunks));
+
+  // The fused inputs finish without output. Each of them releases its input, which clears the output state of the
+  // previous fused input. This operator releases the last fused input as usual once it has been executed. The runtime
+  // of the fused inputs is part of this operator's runtime.
+  for (auto stage_id = size_t{0}; stage_id < fused_input_count; ++stage_id) {
+    const auto& fused_input = _fused_inputs[stage_id];
+    fused_input->_on_cleanup();
+    fused_input->performance_data->has_output = true;
+    fused_input->performance_data->output_row_count = fused_output_row_counts[stage_id].load();
+    fused_input->performance_data->output_chunk_count = fused_output_chunk_counts[stage_id].load();
+    fused_input->_transition_to(OperatorState::ExecutedAndAvailable);
+    fused_input->mutable_left_input()->deregister_consumer();
+  }
+
+  return output;
+}
+
 void AbstractOperator::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {}
 
 void AbstractOperator::_on_cleanup() {}
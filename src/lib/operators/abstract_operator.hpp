@@ -13,6 +13,7 @@
 
 namespace hyrise {
 
+class Chunk;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -46,16 +47,21 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
   Validate,
+  WindowFunctionEvaluator,
   Mock  // for Tests that need to Mock operators
 };
 
 // The state enum values are declared in progressive order to allow for comparisons involving the >, >= operators.
 enum class OperatorState { Created, Running, ExecutedAndAvailable, ExecutedAndCleared };
 
+// Positions that an operator can take in a morsel-driven pipeline (see MORSEL-DRIVEN PIPELINING below).
+enum class PipelineStage { None, Any, Last };
+
 /**
  * AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
  * output table.
@@ -110,6 +116,21 @@ enum class OperatorState { Created, Running, ExecutedAndAvailable, ExecutedAndCl
  *
  *  To disable the automatic clearing in, e.g., tests, one can call never_clear_output.
  *
+ * MORSEL-DRIVEN PIPELINING
+ *  Operators that process each input chunk independently of all other chunks (e.g., TableScan, Validate, and
+ *  Projection) can be fused into pipelines (see OperatorTask::make_tasks_from_operator). Pipelines break at all other
+ *  operators, e.g., at the hash join's build, aggregates, and sorts. Instead of having each operator materialize its
+ *  whole output table before its consumer starts, the last operator of a pipeline executes the entire pipeline: for
+ *  each chunk of the pipeline's input table (a morsel), a single job passes the chunk through all operators of the
+ *  pipeline while the chunk's data is still cached. Only the last operator creates an output table, the fused inputs
+ *  finish without output.
+ *
+ *  Operators declare via pipeline_stage() whether they can be fused at all (PipelineStage::None), anywhere in a
+ *  pipeline (PipelineStage::Any), or only as its last operator (PipelineStage::Last). Operators that can appear
+ *  anywhere must keep the columns of their input and return chunks of ReferenceSegments, as the morsels passed to the
+ *  next operator are single-chunk tables of the same columns. Pipelineable operators implement _on_begin_pipeline(),
+ *  _on_execute_morsel(), and _on_finish_pipeline().
+ *
  * Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
  */
 class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
@@ -212,6 +233,23 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
    */
   std::vector<std::shared_ptr<AbstractOperator>> uncorrelated_subqueries() const;
 
+  // Returns whether and where the operator can be fused into a morsel-driven pipeline. Defaults to PipelineStage::None.
+  virtual PipelineStage pipeline_stage() const;
+
+  /**
+   * Fuses this operator and @param fused_inputs into a pipeline that ends with this operator. The fused inputs are
+   * ordered from the first operator of the pipeline, whose left input provides the morsels, to the direct input of
+   * this operator. Must be called before the operator's task is created and before any fused input is executed.
+   */
+  void fuse_pipeline(std::vector<std::shared_ptr<AbstractOperator>> fused_inputs);
+
+  // Whether the operator can be fused into the pipeline of its only consumer. This requires, among others, that the
+  // operator's output is not needed otherwise (see never_clear_output()).
+  bool can_be_fused_as_input() const;
+
+  // The inputs that are executed as part of this operator's pipeline. Empty if the operator does not end a pipeline.
+  const std::vector<std::shared_ptr<AbstractOperator>>& fused_inputs() const;
+
   // LQP node with which this operator has been created. Might be uninitialized.
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
@@ -229,6 +267,21 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // clean up after execution (if it makes sense)
   virtual void _on_cleanup();
 
+  // Prepare the execution of morsels, e.g., by creating data structures that are shared by all morsels.
+  // @param input_table is the operator's actual input table for the first operator of a pipeline. For all others, it is
+  // a table without chunks, which describes the morsels that the operator receives.
+  virtual void _on_begin_pipeline(const std::shared_ptr<const Table>& input_table);
+
+  // Process the chunk @param chunk_id of @param input_table and return the resulting chunk, or nullptr if no rows
+  // remain. Called concurrently for different morsels.
+  virtual std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id);
+
+  // Create the output table from the chunks of all morsels. Only called for the last operator of a pipeline.
+  // @param input_table is the table that was passed to _on_begin_pipeline().
+  virtual std::shared_ptr<const Table> _on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                           std::vector<std::shared_ptr<Chunk>>&& output_chunks);
+
   // override this if the Operator uses Expressions and set the parameters within them
   virtual void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) = 0;
 
@@ -284,6 +337,13 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   // To prevent race conditions in `get_or_create_operator_task()`.
   std::mutex _operator_task_mutex;
+
+  // Inputs that are fused into the pipeline that this operator ends (see fuse_pipeline()).
+  std::vector<std::shared_ptr<AbstractOperator>> _fused_inputs;
+
+  // Executes this operator's pipeline, i.e., passes each chunk of the pipeline's input through the fused inputs and
+  // this operator.
+  std::shared_ptr<const Table> _execute_pipeline();
 };
 
 std::ostream& operator<<(std::ostream& stream, const AbstractOperator& abstract_operator);
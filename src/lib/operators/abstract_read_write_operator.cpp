@@ -49,6 +49,12 @@ void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   _rw_state = ReadWriteOperatorState::Committed;
 }
 
+void AbstractReadWriteOperator::log_records(CommitLogRecord& record) const {
+  Assert(_rw_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be logged.");
+
+  _on_log_records(record);
+}
+
 void AbstractReadWriteOperator::rollback_records() {
   Assert(_rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::Executed,
          "Operator needs to have state Failed or Executed in order to be rolled back.");
@@ -58,6 +64,8 @@ void AbstractReadWriteOperator::rollback_records() {
   _rw_state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::_on_log_records(CommitLogRecord& /*record*/) const {}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::RolledBack;
 }
@@ -11,6 +11,8 @@
 
 namespace hyrise {
 
+class CommitLogRecord;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -39,6 +41,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void commit_records(const CommitID commit_id);
 
+  /**
+   * Appends the modifications of the operator to the redo record of the committing transaction if a WriteAheadLog is
+   * set. Called by the TransactionContext before commit_records.
+   */
+  void log_records(CommitLogRecord& record) const;
+
   /**
    * Rolls back the operator by unlocking all modified rows. No other action is necessary since commit_records should
    * have never been called and the modifications were not made visible in the first place.
@@ -73,6 +81,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by log_records. Operators that modify table data have to log their modifications so that they can be
+   * replayed by WriteAheadLog::recover. By default, nothing is logged.
+   */
+  virtual void _on_log_records(CommitLogRecord& record) const;
+
   /**
    * Called by rollback_records.
    */
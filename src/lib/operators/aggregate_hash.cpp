@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
@@ -40,6 +41,7 @@
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
@@ -51,20 +53,27 @@ using namespace hyrise;  // NOLINT(build/namespaces)
  * Helper to split results into chunks and prepare output vectors. Callers pass a function to consume the split results.
  * This consumer function receives iterators to the result split and is executed via the scheduler (potentially
  * concurrently). Helper is used either to process RowIDs (for GROUP BY columns) or values (for aggregation results).
+ * The results of each partition are split separately, and the output chunks of a partition follow the ones of the
+ * previous partition.
  */
 template <typename ColumnDataType, WindowFunction aggregate_func, typename ResultConsumer, typename ValueVectorType>
-void split_results_chunk_wise(const bool write_nulls, const AggregateResults<ColumnDataType, aggregate_func>& results,
+void split_results_chunk_wise(const bool write_nulls,
+                              const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results_per_partition,
                               std::vector<ValueVectorType>& value_vectors, std::vector<pmr_vector<bool>>& null_vectors,
                               const ResultConsumer consumer_function) {
-  if (results.empty()) {
-    return;
+  const auto partition_count = results_per_partition.size();
+  auto first_output_chunk_ids = std::vector<ChunkID::base_type>(partition_count + 1);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto result_count = static_cast<double>(results_per_partition[partition_id]->size());
+    first_output_chunk_ids[partition_id + 1] =
+        first_output_chunk_ids[partition_id] +
+        static_cast<ChunkID::base_type>(std::ceil(result_count / static_cast<double>(Chunk::DEFAULT_SIZE)));
   }
 
-  auto results_begin = results.cbegin();
-
-  const auto result_count = static_cast<ChunkID::base_type>(results.size());
-  const auto output_chunk_count = static_cast<ChunkID::base_type>(
-      std::ceil(static_cast<double>(result_count) / static_cast<double>(Chunk::DEFAULT_SIZE)));
+  const auto output_chunk_count = first_output_chunk_ids.back();
+  if (output_chunk_count == 0) {
+    return;
+  }
 
   value_vectors.resize(output_chunk_count);
   if (write_nulls) {
@@ -80,31 +89,41 @@ void split_results_chunk_wise(const bool write_nulls, const AggregateResults<Col
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(output_chunk_count);
-  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
-    const auto write_split_data = [&, output_chunk_id, consumer_function]() {
-      auto begin = results_begin + output_chunk_id * Chunk::DEFAULT_SIZE;
-      auto end = results_begin + std::min(result_count, (output_chunk_id + 1) * Chunk::DEFAULT_SIZE);
-
-      const auto element_count = std::distance(begin, end);
-      if constexpr (std::is_same_v<ValueVectorType, std::shared_ptr<RowIDPosList>>) {
-        value_vectors[output_chunk_id] = std::make_shared<RowIDPosList>();
-        value_vectors[output_chunk_id]->reserve(element_count);
-      } else {
-        value_vectors[output_chunk_id].reserve(element_count);
-      }
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto& results = *results_per_partition[partition_id];
+    const auto results_begin = results.cbegin();
+    const auto result_count = static_cast<ChunkID::base_type>(results.size());
+    const auto first_output_chunk_id = first_output_chunk_ids[partition_id];
+
+    for (auto output_chunk_id = ChunkID{first_output_chunk_id};
+         output_chunk_id < first_output_chunk_ids[partition_id + 1]; ++output_chunk_id) {
+      const auto write_split_data = [&, results_begin, result_count, first_output_chunk_id, output_chunk_id,
+                                     consumer_function]() {
+        const auto split_id = output_chunk_id - first_output_chunk_id;
+        auto begin = results_begin + split_id * Chunk::DEFAULT_SIZE;
+        auto end = results_begin + std::min(result_count, (split_id + 1) * Chunk::DEFAULT_SIZE);
+
+        const auto element_count = std::distance(begin, end);
+        if constexpr (std::is_same_v<ValueVectorType, std::shared_ptr<RowIDPosList>>) {
+          value_vectors[output_chunk_id] = std::make_shared<RowIDPosList>();
+          value_vectors[output_chunk_id]->reserve(element_count);
+        } else {
+          value_vectors[output_chunk_id].reserve(element_count);
+        }
 
-      if (write_nulls) {
-        null_vectors[output_chunk_id].reserve(element_count);
-      }
+        if (write_nulls) {
+          null_vectors[output_chunk_id].reserve(element_count);
+        }
 
-      consumer_function(begin, end, output_chunk_id);
-    };
+        consumer_function(begin, end, output_chunk_id);
+      };
 
-    if (output_chunk_count < 2) {
-      // No reason to spawn a job and wait when there is only a single job.
-      write_split_data();
-    } else {
-      jobs.emplace_back(std::make_shared<JobTask>(write_split_data));
+      if (output_chunk_count < 2) {
+        // No reason to spawn a job and wait when there is only a single job.
+        write_split_data();
+      } else {
+        jobs.emplace_back(std::make_shared<JobTask>(write_split_data));
+      }
     }
   }
 
@@ -236,6 +255,63 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Merges the results of a group that were aggregated by different threads (see `_aggregate_in_parallel`). Skips
+// results with a NULL_ROW_ID, which belong to groups that the thread did not see.
+template <typename ColumnDataType, WindowFunction aggregate_function>
+void merge_aggregate_result(AggregateResult<ColumnDataType, aggregate_function>& target,
+                            const AggregateResult<ColumnDataType, aggregate_function>& source) {
+  using AggregateType = typename AggregateResult<ColumnDataType, aggregate_function>::AggregateType;
+
+  if (source.row_id.is_null()) {
+    return;
+  }
+
+  if (target.row_id.is_null()) {
+    target.row_id = source.row_id;
+  }
+
+  if constexpr (aggregate_function == WindowFunction::CountDistinct) {
+    target.accumulator.insert(source.accumulator.cbegin(), source.accumulator.cend());
+  } else if (source.aggregate_count > 0) {
+    if constexpr (aggregate_function == WindowFunction::Min) {
+      if (target.aggregate_count == 0 || value_smaller(source.accumulator, target.accumulator)) {
+        target.accumulator = source.accumulator;
+      }
+    } else if constexpr (aggregate_function == WindowFunction::Max) {
+      if (target.aggregate_count == 0 || value_greater(source.accumulator, target.accumulator)) {
+        target.accumulator = source.accumulator;
+      }
+    } else if constexpr ((aggregate_function == WindowFunction::Sum || aggregate_function == WindowFunction::Avg) &&
+                         std::is_arithmetic_v<AggregateType>) {
+      target.accumulator += source.accumulator;
+    } else if constexpr (aggregate_function == WindowFunction::StandardDeviationSample) {
+      // Combine the partial results of Welford's algorithm (see WindowFunctionBuilder), cf.
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      auto& count = target.accumulator[0];
+      auto& mean = target.accumulator[1];
+      auto& squared_distance_from_mean = target.accumulator[2];
+      auto& result = target.accumulator[3];
+
+      const auto source_count = source.accumulator[0];
+      const auto source_mean = source.accumulator[1];
+      const auto source_squared_distance_from_mean = source.accumulator[2];
+      if (count == 0) {
+        target.accumulator = source.accumulator;
+      } else {
+        const auto merged_count = count + source_count;
+        const auto delta = source_mean - mean;
+        mean += delta * source_count / merged_count;
+        squared_distance_from_mean +=
+            source_squared_distance_from_mean + delta * delta * count * source_count / merged_count;
+        count = merged_count;
+        result = std::sqrt(squared_distance_from_mean / (count - 1));
+      }
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+}
+
 template <typename Results>
 void write_groupby_output(const std::shared_ptr<const Table>& input_table,
                           const std::vector<std::shared_ptr<WindowFunctionExpression>>& aggregates,
@@ -385,7 +461,7 @@ std::shared_ptr<AbstractOperator> AggregateHash::_on_deep_copy(
 void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 void AggregateHash::_on_cleanup() {
-  _contexts_per_column.clear();
+  _contexts_per_partition.clear();
 }
 
 /*
@@ -420,15 +496,15 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
 };
 
 template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(
+    ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
+    KeysPerChunk<AggregateKey>& keys_per_chunk, std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename WindowFunctionTraits<ColumnDataType, aggregate_function>::ReturnType;
 
   auto aggregator = WindowFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -461,7 +537,7 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+  if (contexts.size() > 1 || _use_immediate_key_shortcut) {
     segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
       process_position(std::true_type{}, position);
     });
@@ -790,210 +866,324 @@ void AggregateHash::_aggregate() {
   /**
    * AGGREGATION STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  auto aggregate_in_parallel = false;
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    aggregate_in_parallel = !_use_immediate_key_shortcut && Hyrise::get().is_multi_threaded() &&
+                            input_table->chunk_count() > 1 &&
+                            input_table->row_count() >= PARALLEL_AGGREGATION_THRESHOLD;
+    if (aggregate_in_parallel) {
+      _aggregate_in_parallel<AggregateKey>(keys_per_chunk);
+    }
+  }
 
-  if (!_has_aggregate_functions) {
-    /*
-    Insert a dummy context for the DISTINCT implementation. That way, `_contexts_per_column` will always have at least
-    one context with results. This is important later on when we write the group keys into the table. The template
-    parameters (int32_t, WindowFunction::Min) do not matter, as we do not calculate an aggregate anyway.
-    */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, WindowFunction::Min, AggregateKey>>(_expected_result_size);
+  if (!aggregate_in_parallel) {
+    // Create the contexts here, and not in the per-chunk-loop below, because there might be no Chunks in the input and
+    // _write_aggregate_output() needs these contexts anyway.
+    _contexts_per_partition = {_create_aggregate_contexts<AggregateKey>(_expected_result_size)};
 
-    _contexts_per_column.push_back(context);
+    // Process chunks and perform aggregations.
+    const auto chunk_count = input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, _contexts_per_partition[0]);
+    }
   }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  const auto aggregate_count = _aggregates.size();
-  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = left_input_table();
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) {
+    return;
+  }
 
-    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-    const auto input_column_id = pqp_column.column_id;
+  const auto input_chunk_size = chunk_in->size();
+  if (!_has_aggregate_functions) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
+     * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
+     * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
+     *
+     * As the grouping happens as part of the aggregation but no aggregate function exists, we use
+     * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
+     * are the same as they are for a regular grouped aggregate.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
+        contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    // Add value or combination of values is added to the list of distinct value(s). This is done by calling
+    // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
+    if (_use_immediate_key_shortcut) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+        // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
+        // is enabled in get_or_add_result.
+        get_or_add_result(std::true_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    } else {
+      // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
+      // get_aggregate_key.
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+        get_or_add_result(std::false_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    }
+  } else {
+    auto aggregate_idx = ColumnID{0};
+    for (const auto& aggregate : _aggregates) {
+      /**
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID. We then go through the
+       * `keys_per_chunk` map and count the occurrences of each group key. The results are saved in the regular
+       * `aggregate_count` variable so that we do not need a specific output logic for COUNT(*).
+       */
 
-    if (input_column_id == INVALID_COLUMN_ID) {
-      Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
-      // SELECT COUNT(*) - we know the template arguments, so we do not need a visitor.
-      auto context = std::make_shared<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-          _expected_result_size);
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
+
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
+        auto context =
+            std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
+                contexts[aggregate_idx]);
+
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows.
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+
+          // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
+          // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
+          // not NULL_ROW_ID.
+          results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+        } else {
+          // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
+          // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
+          if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+              // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
+              // have been written by the immediate key shortcut
+              auto& result =
+                  get_or_add_result(std::true_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          } else {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+              auto& result =
+                  get_or_add_result(std::false_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          }
+        }
 
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
+        ++aggregate_idx;
+        continue;
+      }
+
+      const auto abstract_segment = chunk_in->get_segment(input_column_id);
+      const auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->window_function) {
+          case WindowFunction::Min:
+            _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Max:
+            _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Sum:
+            _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Avg:
+            _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Count:
+            _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Any:
+            // ANY is a pseudo-function and is handled by `write_groupby_output`.
+            break;
+          case WindowFunction::CumeDist:
+          case WindowFunction::DenseRank:
+          case WindowFunction::PercentRank:
+          case WindowFunction::Rank:
+          case WindowFunction::RowNumber:
+            Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function) +
+                 ".");
+        }
+      });
+
+      ++aggregate_idx;
     }
-    const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function);
   }
+}  // NOLINT(readability/fn_size)
 
-  // Process chunks and perform aggregations.
+/**
+ * Parallel aggregation for large inputs. First, each job aggregates a contiguous range of chunks into its own contexts.
+ * Second, the groups found by each job are radix-partitioned by the hash of their AggregateKey. Third, one job per
+ * partition merges the results of the partition's groups. As the GROUP BY keys of all chunks are computed globally by
+ * `_partition_by_groupby_keys`, equal keys of different jobs denote the same group. The partitions are later written
+ * in parallel by `_write_aggregate_output`. Immediate keys (and aggregates without GROUP BY columns) do not require
+ * hashing and are not aggregated by this method.
+ */
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto& input_table = left_input_table();
   const auto chunk_count = input_table->chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) {
-      continue;
-    }
 
-    const auto input_chunk_size = chunk_in->size();
-    if (!_has_aggregate_functions) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
-       * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
-       * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
-       *
-       * As the grouping happens as part of the aggregation but no aggregate function exists, we use
-       * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
-       * are the same as they are for a regular grouped aggregate.
-       */
+  /**
+   * Pre-aggregate contiguous chunk ranges. We create one range per CPU so that the per-range contexts are not
+   * considerably larger than a single context for the entire input.
+   */
+  const auto range_count = std::min(static_cast<size_t>(chunk_count),
+                                    std::max(static_cast<size_t>(Hyrise::get().topology.num_cpus()), size_t{2}));
+  const auto chunks_per_range = (chunk_count + range_count - 1) / range_count;
+  auto contexts_per_range = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(range_count);
 
-      auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
-          _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      // Add value or combination of values is added to the list of distinct value(s). This is done by calling
-      // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
-          get_or_add_result(std::true_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          get_or_add_result(std::false_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(range_count);
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+      auto& contexts = contexts_per_range[range_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      const auto range_end = std::min(static_cast<size_t>(chunk_count), (range_id + 1) * chunks_per_range);
+      for (auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(range_id * chunks_per_range)}; chunk_id < range_end;
+           ++chunk_id) {
+        _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, contexts);
       }
-    } else {
-      auto aggregate_idx = ColumnID{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID. We then go through the
-         * `keys_per_chunk` map and count the occurrences of each group key. The results are saved in the regular
-         * `aggregate_count` variable so that we do not need a specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
-          auto context =
-              std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+  /**
+   * Radix-partition the groups of each range. Only the first aggregate that is not an ANY pseudo-aggregate looks up
+   * the keys in its AggregateResultIdMap. The other contexts use the cached result ids (see get_or_add_result) and
+   * thus use the same result ids for a group.
+   */
+  auto key_context_index = ColumnID{0};
+  if (_has_aggregate_functions) {
+    while (_aggregates[key_context_index]->window_function == WindowFunction::Any) {
+      ++key_context_index;
+    }
+  }
 
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
+  const auto partition_count = std::bit_ceil(range_count);
+  const auto radix_shift = std::numeric_limits<size_t>::digits - std::countr_zero(partition_count);
+  const auto partition_of = [&](const AggregateKey& key) {
+    // Fibonacci hashing spreads the hash values (the identity for single integral keys) over the upper bits.
+    return static_cast<size_t>((std::hash<AggregateKey>{}(key) * 0x9E3779B97F4A7C15) >> radix_shift);
+  };
 
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows.
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
+  using Groups = std::vector<std::pair<AggregateKey, AggregateResultId>>;
+  auto groups_per_range = std::vector<std::vector<Groups>>(range_count, std::vector<Groups>(partition_count));
 
-            // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
-            // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
-            // not NULL_ROW_ID.
-            results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
-          } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
-                auto& result =
-                    get_or_add_result(std::true_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            } else {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                auto& result =
-                    get_or_add_result(std::false_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            }
-          }
+  jobs.clear();
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+      _resolve_aggregate_context_type<AggregateKey>(key_context_index, [&](const auto context_type) {
+        using ContextType = typename decltype(context_type)::type;
+        const auto& context = static_cast<const ContextType&>(*contexts_per_range[range_id][key_context_index]);
 
-          ++aggregate_idx;
-          continue;
+        auto& groups_per_partition = groups_per_range[range_id];
+        for (const auto& [key, result_id] : *context.result_ids) {
+          groups_per_partition[partition_of(key)].emplace_back(key, result_id);
         }
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
-
-        /*
-        Invoke correct aggregator for each segment
-        */
+  /**
+   * Merge the results of each partition. ANY pseudo-aggregates are not merged as they are written using the RowIDs of
+   * the GROUP BY columns.
+   */
+  const auto merged_context_count = _has_aggregate_functions ? _aggregates.size() : size_t{1};
+  _contexts_per_partition.resize(partition_count);
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& contexts = _contexts_per_partition[partition_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      // Assign partition-wide result ids to the groups of all ranges.
+      auto merged_result_ids = boost::unordered_flat_map<AggregateKey, AggregateResultId, std::hash<AggregateKey>>{};
+      auto merged_result_ids_per_range = std::vector<std::vector<AggregateResultId>>(range_count);
+      for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+        const auto& groups = groups_per_range[range_id][partition_id];
+        auto& merged_result_ids_of_range = merged_result_ids_per_range[range_id];
+        merged_result_ids_of_range.reserve(groups.size());
+        for (const auto& group : groups) {
+          const auto next_result_id = merged_result_ids.size();
+          const auto iter = merged_result_ids.try_emplace(group.first, next_result_id).first;
+          merged_result_ids_of_range.emplace_back(iter->second);
+        }
+      }
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+      const auto group_count = merged_result_ids.size();
+      for (auto context_index = ColumnID{0}; context_index < merged_context_count; ++context_index) {
+        if (_has_aggregate_functions && _aggregates[context_index]->window_function == WindowFunction::Any) {
+          continue;
+        }
 
-          switch (aggregate->window_function) {
-            case WindowFunction::Min:
-              _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Max:
-              _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Sum:
-              _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Avg:
-              _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Count:
-              _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Any:
-              // ANY is a pseudo-function and is handled by `write_groupby_output`.
-              break;
-            case WindowFunction::CumeDist:
-            case WindowFunction::DenseRank:
-            case WindowFunction::PercentRank:
-            case WindowFunction::Rank:
-            case WindowFunction::RowNumber:
-              Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function) +
-                   ".");
+        _resolve_aggregate_context_type<AggregateKey>(context_index, [&](const auto context_type) {
+          using ContextType = typename decltype(context_type)::type;
+          auto& merged_results = static_cast<ContextType&>(*contexts[context_index]).results;
+          merged_results.resize(group_count);
+
+          for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+            const auto& results = static_cast<const ContextType&>(*contexts_per_range[range_id][context_index]).results;
+            const auto& groups = groups_per_range[range_id][partition_id];
+            const auto group_count_of_range = groups.size();
+            for (auto group_index = size_t{0}; group_index < group_count_of_range; ++group_index) {
+              DebugAssert(groups[group_index].second < results.size(), "Missing result of group.");
+              merge_aggregate_result(merged_results[merged_result_ids_per_range[range_id][group_index]],
+                                     results[groups[group_index].second]);
+            }
           }
         });
-
-        ++aggregate_idx;
       }
-    }
+    }));
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
-}  // NOLINT(readability/fn_size)
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
@@ -1025,10 +1215,9 @@ std::shared_ptr<const Table> AggregateHash::_on_execute() {
    * Otherwise, it is called by the first call to `_write_aggregate_output`.
    **/
   if (!_has_aggregate_functions) {
-    auto context = std::static_pointer_cast<AggregateResultContext<DistinctColumnType, WindowFunction::Min>>(
-        _contexts_per_column[0]);
     auto groupby_columns_writing_timer = Timer{};
-    write_groupby_output(left_input_table(), _aggregates, _groupby_column_ids, context->results,
+    write_groupby_output(left_input_table(), _aggregates, _groupby_column_ids,
+                         _results_per_partition<DistinctColumnType, WindowFunction::Min>(ColumnID{0}),
                          _output_column_definitions, _intermediate_result);
     DebugAssert(groupby_columns_writing_duration == std::chrono::nanoseconds{0},
                 "groupby_columns_writing_duration() was apparently called more than once.");
@@ -1196,7 +1385,7 @@ template <typename ColumnDataType, typename AggregateType, WindowFunction aggreg
 std::enable_if_t<aggregate_func == WindowFunction::Min || aggregate_func == WindowFunction::Max ||
                      aggregate_func == WindowFunction::Sum || aggregate_func == WindowFunction::Any,
                  bool>
-write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& results,
+write_aggregate_values(const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results,
                        std::vector<pmr_vector<AggregateType>>& value_vectors,
                        std::vector<pmr_vector<bool>>& null_vectors) {
   auto null_written = std::atomic<bool>{};
@@ -1230,7 +1419,7 @@ write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& r
 // COUNT writes the aggregate counter.
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::Count, bool> write_aggregate_values(
-    const AggregateResults<ColumnDataType, aggregate_func>& results,
+    const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results,
     std::vector<pmr_vector<AggregateType>>& value_vectors, std::vector<pmr_vector<bool>>& null_vectors) {
   split_results_chunk_wise(
       false, results, value_vectors, null_vectors, [&](auto begin, const auto end, const ChunkID chunk_id) {
@@ -1254,7 +1443,7 @@ std::enable_if_t<aggregate_func == WindowFunction::Count, bool> write_aggregate_
 // COUNT(DISTINCT) writes the number of distinct values.
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::CountDistinct, bool> write_aggregate_values(
-    const AggregateResults<ColumnDataType, aggregate_func>& results,
+    const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results,
     std::vector<pmr_vector<AggregateType>>& value_vectors, std::vector<pmr_vector<bool>>& null_vectors) {
   split_results_chunk_wise(
       false, results, value_vectors, null_vectors, [&](auto begin, const auto end, const ChunkID chunk_id) {
@@ -1278,7 +1467,7 @@ std::enable_if_t<aggregate_func == WindowFunction::CountDistinct, bool> write_ag
 // AVG writes the calculated average from current aggregate and the aggregate counter.
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::Avg && std::is_arithmetic_v<AggregateType>, bool>
-write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& results,
+write_aggregate_values(const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results,
                        std::vector<pmr_vector<AggregateType>>& value_vectors,
                        std::vector<pmr_vector<bool>>& null_vectors) {
   auto null_written = std::atomic<bool>{};
@@ -1312,7 +1501,7 @@ write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& r
 // AVG is not defined for non-arithmetic types. Avoiding compiler errors.
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::Avg && !std::is_arithmetic_v<AggregateType>, bool>
-write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& /*results*/,
+write_aggregate_values(const PartitionedAggregateResults<ColumnDataType, aggregate_func>& /*results*/,
                        std::vector<pmr_vector<AggregateType>>& /* values */,
                        std::vector<pmr_vector<bool>>& /* null_vectors */) {
   Fail("Invalid aggregate.");
@@ -1321,7 +1510,7 @@ write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& /
 // STDDEV_SAMP writes the calculated standard deviation from current aggregate and the aggregate counter.
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::StandardDeviationSample && std::is_arithmetic_v<AggregateType>, bool>
-write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& results,
+write_aggregate_values(const PartitionedAggregateResults<ColumnDataType, aggregate_func>& results,
                        std::vector<pmr_vector<AggregateType>>& value_vectors,
                        std::vector<pmr_vector<bool>>& null_vectors) {
   auto null_written = std::atomic<bool>{};
@@ -1357,7 +1546,7 @@ write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& r
 template <typename ColumnDataType, typename AggregateType, WindowFunction aggregate_func>
 std::enable_if_t<aggregate_func == WindowFunction::StandardDeviationSample && !std::is_arithmetic_v<AggregateType>,
                  bool>
-write_aggregate_values(const AggregateResults<ColumnDataType, aggregate_func>& /*results*/,
+write_aggregate_values(const PartitionedAggregateResults<ColumnDataType, aggregate_func>& /*results*/,
                        std::vector<pmr_vector<AggregateType>>& /* values */,
                        std::vector<pmr_vector<bool>>& /* null_vectors */) {
   Fail("Invalid aggregate.");
@@ -1385,10 +1574,7 @@ void AggregateHash::_write_aggregate_output(ColumnID aggregate_index) {
     result_type = left_input_table()->column_data_type(input_column_id);
   }
 
-  auto context = std::static_pointer_cast<AggregateResultContext<ColumnDataType, aggregate_function>>(
-      _contexts_per_column[aggregate_index]);
-
-  const auto& results = context->results;
+  const auto results = _results_per_partition<ColumnDataType, aggregate_function>(aggregate_index);
 
   // Before writing the first aggregate column, write all group keys into the respective columns.
   if (aggregate_index == 0) {
@@ -1447,12 +1633,71 @@ void AggregateHash::_write_aggregate_output(ColumnID aggregate_index) {
   aggregate_columns_writing_duration += timer.lap() - excluded_time;
 }
 
+template <typename ColumnDataType, WindowFunction aggregate_function>
+PartitionedAggregateResults<ColumnDataType, aggregate_function> AggregateHash::_results_per_partition(
+    const ColumnID context_index) const {
+  auto results_per_partition = PartitionedAggregateResults<ColumnDataType, aggregate_function>{};
+  results_per_partition.reserve(_contexts_per_partition.size());
+  for (const auto& contexts : _contexts_per_partition) {
+    const auto& context =
+        static_cast<const AggregateResultContext<ColumnDataType, aggregate_function>&>(*contexts[context_index]);
+    results_per_partition.emplace_back(&context.results);
+  }
+
+  return results_per_partition;
+}
+
+/**
+ * Create an AggregateContext for each aggregate. For DISTINCT (i.e., no aggregate functions), the first context is a
+ * dummy context (see `_aggregate_chunk`). That way, there is always at least one context with results. This is
+ * important later on when we write the group keys into the table. The template parameters (DistinctColumnType,
+ * WindowFunction::Min) do not matter, as we do not calculate an aggregate anyway.
+ */
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size) const {
+  const auto& input_table = left_input_table();
+  const auto aggregate_count = _aggregates.size();
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(aggregate_count);
+
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
+      // SELECT COUNT(*) - we know the template arguments, so we do not need a visitor.
+      contexts[aggregate_idx] =
+          std::make_shared<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(preallocated_size);
+      continue;
+    }
+    const auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function, preallocated_size);
+  }
+
+  if (!_has_aggregate_functions) {
+    // All aggregates are ANY pseudo-aggregates (if any), whose contexts are never used.
+    auto context =
+        std::make_shared<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(preallocated_size);
+    if (contexts.empty()) {
+      contexts.push_back(context);
+    } else {
+      contexts[0] = context;
+    }
+  }
+
+  return contexts;
+}
+
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const WindowFunction aggregate_function) const {
+    const DataType data_type, const WindowFunction aggregate_function, const size_t preallocated_size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
+    const auto size = preallocated_size;
     using ColumnDataType = typename decltype(type)::type;
     switch (aggregate_function) {
       case WindowFunction::Min:
@@ -1493,4 +1738,56 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
   return context;
 }
 
+template <typename AggregateKey, typename Functor>
+void AggregateHash::_resolve_aggregate_context_type(const ColumnID context_index, const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    DebugAssert(context_index == 0, "DISTINCT only uses the first context.");
+    functor(hana::type_c<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>);
+    return;
+  }
+
+  const auto& aggregate = _aggregates[context_index];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+  if (input_column_id == INVALID_COLUMN_ID) {
+    functor(hana::type_c<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>);
+    return;
+  }
+
+  resolve_data_type(left_input_table()->column_data_type(input_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    switch (aggregate->window_function) {
+      case WindowFunction::Min:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Min, AggregateKey>>);
+        break;
+      case WindowFunction::Max:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Max, AggregateKey>>);
+        break;
+      case WindowFunction::Sum:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Sum, AggregateKey>>);
+        break;
+      case WindowFunction::Avg:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Avg, AggregateKey>>);
+        break;
+      case WindowFunction::Count:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Count, AggregateKey>>);
+        break;
+      case WindowFunction::CountDistinct:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>>);
+        break;
+      case WindowFunction::StandardDeviationSample:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>>);
+        break;
+      case WindowFunction::Any:
+        functor(hana::type_c<AggregateContext<ColumnDataType, WindowFunction::Any, AggregateKey>>);
+        break;
+      case WindowFunction::CumeDist:
+      case WindowFunction::DenseRank:
+      case WindowFunction::PercentRank:
+      case WindowFunction::Rank:
+      case WindowFunction::RowNumber:
+        Fail("Unsupported aggregate function '" + window_function_to_string.left.at(aggregate->window_function) + "'.");
+    }
+  });
+}
+
 }  // namespace hyrise
@@ -93,6 +93,11 @@ template <typename ColumnDataType, WindowFunction aggregate_function>
 using AggregateResults = pmr_vector<AggregateResult<ColumnDataType, aggregate_function>>;
 using AggregateResultId = size_t;
 
+// The parallel aggregation (see AggregateHash::_aggregate_in_parallel) radix-partitions the groups, and each partition
+// holds its own results. The sequential aggregation creates a single partition.
+template <typename ColumnDataType, WindowFunction aggregate_function>
+using PartitionedAggregateResults = std::vector<const AggregateResults<ColumnDataType, aggregate_function>*>;
+
 // The AggregateResultIdMap maps AggregateKeys to their index in the list of aggregate results.
 template <typename AggregateKey>
 using AggregateResultIdMapAllocator = PolymorphicAllocator<std::pair<const AggregateKey, AggregateResultId>>;
@@ -142,6 +147,10 @@ class AggregateHash : public AbstractAggregateOperator {
 
   const std::string& name() const override;
 
+  // Inputs with fewer rows are aggregated by a single thread. For larger inputs, multi-threaded schedulers aggregate
+  // chunk ranges in parallel and merge their results (see _aggregate_in_parallel()).
+  static constexpr auto PARALLEL_AGGREGATION_THRESHOLD = size_t{100'000};
+
   enum class OperatorSteps : uint8_t {
     GroupByKeyPartitioning,
     Aggregating,
@@ -159,6 +168,13 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  void _aggregate_chunk(ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -173,13 +189,25 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename ColumnDataType, WindowFunction aggregate_function>
   void _write_aggregate_output(ColumnID aggregate_index);
 
+  template <typename ColumnDataType, WindowFunction aggregate_function>
+  PartitionedAggregateResults<ColumnDataType, aggregate_function> _results_per_partition(ColumnID context_index) const;
+
   template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(size_t preallocated_size) const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const WindowFunction aggregate_function) const;
+                                                                   const WindowFunction aggregate_function,
+                                                                   size_t preallocated_size) const;
+
+  // Calls the functor with the (boost::hana) type of the AggregateContext that is used for the given context index.
+  template <typename AggregateKey, typename Functor>
+  void _resolve_aggregate_context_type(ColumnID context_index, const Functor& functor) const;
 
   // Data structure used to gather intermediate results of grouping and aggregation. This data structure stores both
   // the PosLists for group-by columns as well as the materialized aggregate results that are later returned as
@@ -187,7 +215,8 @@ class AggregateHash : public AbstractAggregateOperator {
   std::vector<Segments> _intermediate_result;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
-  std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
+  // One context per aggregate (or a single one for DISTINCT) for each partition of the groups.
+  std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>> _contexts_per_partition;
   bool _has_aggregate_functions;
 
   std::atomic_size_t _expected_result_size{};
@@ -6,6 +6,8 @@
 
 #include "all_type_variant.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -151,6 +153,29 @@ void Delete::_on_commit_records(const CommitID commit_id) {
   }
 }
 
+void Delete::_on_log_records(CommitLogRecord& record) const {
+  // The log identifies tables by their name, which the Delete operator does not know. Thus, we look up the referenced
+  // tables in the StorageManager. Usually, all chunks reference the same table.
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  auto last_referenced_table = std::shared_ptr<const Table>{};
+  auto table_name = std::string{};
+
+  const auto chunk_count = _referencing_table->chunk_count();
+  for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
+    const auto& referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto& referencing_segment =
+        static_cast<const ReferenceSegment&>(*referencing_chunk->get_segment(ColumnID{0}));
+    const auto referenced_table = referencing_segment.referenced_table();
+
+    if (referenced_table != last_referenced_table) {
+      table_name = storage_manager.get_table_name(referenced_table);
+      last_referenced_table = referenced_table;
+    }
+
+    record.add_delete(table_name, *referencing_segment.pos_list());
+  }
+}
+
 void Delete::_on_rollback_records() {
   const auto chunk_count = _referencing_table->chunk_count();
   for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
@@ -4,8 +4,10 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <sstream>
@@ -23,14 +25,93 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/abstract_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/pqp_utils.hpp"
 #include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/pruning_utils.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Range and Bloom filter of the (non-NULL) key values of a runtime join filter's source.
+template <typename T>
+struct RuntimeJoinKeys {
+  std::optional<T> min;
+  std::optional<T> max;
+  BloomFilter bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
+
+  void add(const RuntimeJoinKeys& other) {
+    if (!other.min) {
+      return;
+    }
+
+    min = min ? std::min(*min, *other.min) : *other.min;
+    max = max ? std::max(*max, *other.max) : *other.max;
+    bloom_filter |= other.bloom_filter;
+  }
+};
+
+template <typename T>
+RuntimeJoinKeys<T> collect_runtime_join_keys(const Table& source_table, const ColumnID column_id) {
+  const auto hash_function = std::hash<T>{};
+  auto keys = RuntimeJoinKeys<T>{};
+  auto keys_mutex = std::mutex{};
+
+  const auto chunk_count = source_table.chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = source_table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto collect_chunk_keys = [&, chunk]() {
+      auto chunk_keys = RuntimeJoinKeys<T>{};
+      segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        if (!chunk_keys.min || value < *chunk_keys.min) {
+          chunk_keys.min = value;
+        }
+        if (!chunk_keys.max || value > *chunk_keys.max) {
+          chunk_keys.max = value;
+        }
+        chunk_keys.bloom_filter[hash_function(value) & BLOOM_FILTER_MASK] = true;
+      });
+
+      const auto lock = std::lock_guard<std::mutex>{keys_mutex};
+      keys.add(chunk_keys);
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > chunk->size()) {
+      collect_chunk_keys();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(collect_chunk_keys));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return keys;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
@@ -110,6 +191,19 @@ void GetTable::set_prunable_subquery_predicates(
   _prunable_subquery_scans = subquery_scans;
 }
 
+void GetTable::set_runtime_join_filters(const std::vector<RuntimeJoinFilter>& runtime_join_filters) const {
+  DebugAssert(std::all_of(runtime_join_filters.cbegin(), runtime_join_filters.cend(),
+                          [](const auto& runtime_join_filter) {
+                            return runtime_join_filter.source.lock();
+                          }),
+              "Source of runtime join filter expired.");
+  _runtime_join_filters = runtime_join_filters;
+}
+
+const std::vector<RuntimeJoinFilter>& GetTable::runtime_join_filters() const {
+  return _runtime_join_filters;
+}
+
 std::vector<std::shared_ptr<const AbstractOperator>> GetTable::prunable_subquery_predicates() const {
   auto subquery_scans = std::vector<std::shared_ptr<const AbstractOperator>>{};
   subquery_scans.reserve(_prunable_subquery_scans.size());
@@ -159,6 +253,10 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
   auto overall_pruned_chunk_ids = _prune_chunks_dynamically();
+  const auto runtime_join_filtered_chunk_ids = _prune_chunks_with_runtime_join_filters(*stored_table, chunk_count);
+  _dynamically_pruned_chunk_ids.insert(runtime_join_filtered_chunk_ids.cbegin(),
+                                       runtime_join_filtered_chunk_ids.cend());
+  overall_pruned_chunk_ids.insert(runtime_join_filtered_chunk_ids.cbegin(), runtime_join_filtered_chunk_ids.cend());
   overall_pruned_chunk_ids.insert(_pruned_chunk_ids.cbegin(), _pruned_chunk_ids.cend());
   auto pruned_chunk_ids_iter = overall_pruned_chunk_ids.begin();
   auto excluded_chunk_ids = std::vector<ChunkID>{};
@@ -417,4 +515,75 @@ std::set<ChunkID> GetTable::_prune_chunks_dynamically() {
   return _dynamically_pruned_chunk_ids;
 }
 
+std::set<ChunkID> GetTable::_prune_chunks_with_runtime_join_filters(const Table& stored_table,
+                                                                     const ChunkID chunk_count) const {
+  auto pruned_chunk_ids = std::set<ChunkID>{};
+
+  for (const auto& runtime_join_filter : _runtime_join_filters) {
+    const auto source = runtime_join_filter.source.lock();
+    Assert(source, "Source of runtime join filter expired. PQP is invalid.");
+
+    // If the PQP is not executed via OperatorTasks, the GetTable might be executed before the source.
+    if (source->state() != OperatorState::ExecutedAndAvailable) {
+      continue;
+    }
+
+    const auto column_id = runtime_join_filter.column_id;
+    Assert(source->get_output()->column_data_type(runtime_join_filter.source_column_id) ==
+               stored_table.column_data_type(column_id),
+           "Runtime join filters require join columns of the same data type.");
+    resolve_data_type(stored_table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto keys = collect_runtime_join_keys<ColumnDataType>(*source->get_output(),
+                                                                  runtime_join_filter.source_column_id);
+      const auto hash_function = std::hash<ColumnDataType>{};
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        if (pruned_chunk_ids.contains(chunk_id)) {
+          continue;
+        }
+
+        // Without any keys, the join does not produce any rows.
+        if (!keys.min) {
+          pruned_chunk_ids.emplace(chunk_id);
+          continue;
+        }
+
+        const auto chunk = stored_table.get_chunk(chunk_id);
+        if (!chunk) {
+          continue;
+        }
+
+        const auto& pruning_statistics = chunk->pruning_statistics();
+        if (pruning_statistics && can_prune(*(*pruning_statistics)[column_id], PredicateCondition::BetweenInclusive,
+                                            AllTypeVariant{*keys.min}, AllTypeVariant{*keys.max})) {
+          pruned_chunk_ids.emplace(chunk_id);
+          continue;
+        }
+
+        // Dictionaries are sorted, so only the values within the keys' range have to be checked.
+        const auto dictionary_segment =
+            std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(chunk->get_segment(column_id));
+        if (!dictionary_segment) {
+          continue;
+        }
+
+        const auto pin_guard = SharedPagePinGuard{dictionary_segment->buffer_pages()};
+        const auto& dictionary = *dictionary_segment->dictionary();
+        const auto range_begin = std::lower_bound(dictionary.cbegin(), dictionary.cend(), *keys.min);
+        const auto range_end = std::upper_bound(range_begin, dictionary.cend(), *keys.max);
+        const auto any_value_passes = std::any_of(range_begin, range_end, [&](const auto& value) {
+          return keys.bloom_filter[hash_function(value) & BLOOM_FILTER_MASK];
+        });
+        if (!any_value_passes) {
+          pruned_chunk_ids.emplace(chunk_id);
+        }
+      }
+    });
+  }
+
+  return pruned_chunk_ids;
+}
+
 }  // namespace hyrise
@@ -13,6 +13,17 @@
 
 namespace hyrise {
 
+// A join input whose key values can be used by a GetTable operator to prune chunks during execution (see
+// GetTable::set_runtime_join_filters()).
+struct RuntimeJoinFilter {
+  // The join input that provides the key values, i.e., the input that does not consume the GetTable's output.
+  std::weak_ptr<AbstractOperator> source;
+  ColumnID source_column_id{INVALID_COLUMN_ID};
+
+  // Column of the stored table (i.e., not adjusted for pruned columns) that is joined with the source column.
+  ColumnID column_id{INVALID_COLUMN_ID};
+};
+
 // Operator to retrieve a table from the StorageManager by specifying its name. Depending on how the operator was
 // constructed, chunks and columns may be pruned if they are irrelevant for the final result. The returned table is NOT
 // the same table as stored in the StorageManager. If that stored table is changed (most importantly: if a chunk is
@@ -44,6 +55,15 @@ class GetTable : public AbstractReadOnlyOperator {
   void set_prunable_subquery_predicates(const std::vector<std::weak_ptr<const AbstractOperator>>& subquery_scans) const;
   std::vector<std::shared_ptr<const AbstractOperator>> prunable_subquery_predicates() const;
 
+  // Inner and semi joins drop all rows whose key does not occur in their other input. If the GetTable's output only
+  // reaches such a join through operators that do not add rows (see add_runtime_join_filters()), chunks without any of
+  // the other input's keys do not contribute to the join result. The tasks of the other inputs are scheduled before
+  // the GetTable's task so that their keys can be used for pruning during execution ("sideways information passing").
+  // A chunk is pruned if its MinMaxFilter or RangeFilter does not overlap with the range of the keys or if no value of
+  // its dictionary passes a Bloom filter of the keys. Filters whose source has not been executed yet are ignored.
+  void set_runtime_join_filters(const std::vector<RuntimeJoinFilter>& runtime_join_filters) const;
+  const std::vector<RuntimeJoinFilter>& runtime_join_filters() const;
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
@@ -57,12 +77,16 @@ class GetTable : public AbstractReadOnlyOperator {
   // pruning with the predicates and return the pruned ChunkIDs.
   std::set<ChunkID> _prune_chunks_dynamically();
 
+  // Return the ChunkIDs that cannot contain any key of the sources of the runtime join filters.
+  std::set<ChunkID> _prune_chunks_with_runtime_join_filters(const Table& stored_table, const ChunkID chunk_count) const;
+
   // Name of the table to retrieve.
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
 
   mutable std::vector<std::weak_ptr<const AbstractOperator>> _prunable_subquery_scans{};
+  mutable std::vector<RuntimeJoinFilter> _runtime_join_filters{};
   std::set<ChunkID> _dynamically_pruned_chunk_ids{};
 };
 
@@ -9,6 +9,7 @@
 
 #include "all_type_variant.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
@@ -263,6 +264,13 @@ void Insert::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Insert::_on_log_records(CommitLogRecord& record) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    record.add_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                      target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 void Insert::_on_rollback_records() {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
@@ -68,11 +68,15 @@ std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size) {
+  return calculate_radix_bits(build_side_size, probe_side_size, Hyrise::get().topology.private_cache_size());
+}
+
+size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size,
+                                      const size_t cache_size) {
   /*
     The number of radix bits is used to determine the number of build partitions. The idea is to size the partitions in
     a way that keeps the whole hash map cache resident. We aim for the largest unshared cache (for most Intel systems
-    that's the L2 cache, for Apple's M1 the L1 cache). This calculation should include hardware knowledge, once
-    available in Hyrise. As of now, we assume a cache size of 1024 KB, of which we use 75 %.
+    that's the L2 cache, for Apple's M1 the L1 cache), of which we use 75 %.
 
     We estimate the size the following way:
       - we assume each key appears once (that is an overestimation space-wise, but we
@@ -90,10 +94,11 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
     PerformanceWarning("Build side larger than probe side in hash join");
   }
 
-  // We assume a cache of 1024 KB for an Intel Xeon Platinum 8180. For local deployments or other CPUs, this size might
-  // be different (e.g., an AMD EPYC 7F72 CPU has an L2 cache size of 512 KB and Apple's M1 has 128 KB).
-  constexpr auto L2_CACHE_SIZE = 1'024'000;                   // bytes
-  constexpr auto L2_CACHE_MAX_USABLE = L2_CACHE_SIZE * 0.75;  // use 75% of the L2 cache size
+  // If the cache size could not be detected, we assume a cache of 1024 KB as found in an Intel Xeon Platinum 8180.
+  // Other CPUs have considerably smaller private caches (e.g., an AMD EPYC 7F72 CPU has an L2 cache size of 512 KB and
+  // Apple's M1 has an L1 cache of 128 KB).
+  constexpr auto DEFAULT_CACHE_SIZE = size_t{1'024'000};  // bytes
+  const auto cache_max_usable = static_cast<double>(cache_size > 0 ? cache_size : DEFAULT_CACHE_SIZE) * 0.75;
 
   // Since it is hard to estimate the number of distinct values in a radix partition (and, thus, the size of each hash
   // table), we accomodate a little bit extra space for slightly skewed data distributions and aim for a fill level of
@@ -104,13 +109,13 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
       // key + value (and one byte overhead, see link above)
       static_cast<double>(sizeof(uint32_t)) / 0.8;
 
-  const auto cluster_count = std::max(1.0, complete_hash_map_size / L2_CACHE_MAX_USABLE);
+  // If the hash map fits into the cache, partitioning does not pay off and is skipped (zero bits).
+  const auto cluster_count = std::max(1.0, complete_hash_map_size / cache_max_usable);
 
-  // We limit the max fan out for radix partitioning to 8 bits (i.e., 256 partitions). "An Experimental Comparison of
-  // Thirteen Relational Equi-Joins in Main Memory" by Schuh et al. analyzed the number of radix bits and how much
-  // large fan outs hurt performance due to TLB misses. As we do not use software-managed buffers, a smaller number of
-  // bits has shown the best results.
-  return std::min(size_t{8}, static_cast<size_t>(std::ceil(std::log2(cluster_count))));
+  // Up to MAX_RADIX_BITS_PER_PASS bits are partitioned in a single pass, more bits in two passes (see
+  // refine_radix_partitions()). Beyond that, the partitions are allowed to exceed the cache.
+  return std::min(MAX_RADIX_BITS_PER_PASS * MAX_RADIX_PASS_COUNT,
+                  static_cast<size_t>(std::ceil(std::log2(cluster_count))));
 }
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
@@ -166,8 +171,57 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   auto adjusted_column_ids = std::make_pair(build_column_id, probe_column_id);
 
-  const auto build_column_type = build_input_table->column_data_type(build_column_id);
-  const auto probe_column_type = probe_input_table->column_data_type(probe_column_id);
+  auto build_column_type = build_input_table->column_data_type(build_column_id);
+  auto probe_column_type = probe_input_table->column_data_type(probe_column_id);
+
+  auto& join_hash_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+
+  /**
+   * Multi-column equi-joins are executed on a composite key of all equality predicates (see join_hash_steps.hpp). The
+   * keys are materialized into separate tables, which are then joined on their only column. The output still refers to
+   * the input tables.
+   */
+  auto build_key_table = build_input_table;
+  auto probe_key_table = probe_input_table;
+
+  auto build_key_column_ids = std::vector<ColumnID>{build_column_id};
+  auto probe_key_column_ids = std::vector<ColumnID>{probe_column_id};
+  auto build_key_data_types = std::vector<DataType>{build_column_type};
+  auto probe_key_data_types = std::vector<DataType>{probe_column_type};
+  for (const auto& predicate : adjusted_secondary_predicates) {
+    if (predicate.predicate_condition != PredicateCondition::Equals) {
+      continue;
+    }
+
+    build_key_column_ids.emplace_back(predicate.column_ids.first);
+    probe_key_column_ids.emplace_back(predicate.column_ids.second);
+    build_key_data_types.emplace_back(build_input_table->column_data_type(predicate.column_ids.first));
+    probe_key_data_types.emplace_back(probe_input_table->column_data_type(predicate.column_ids.second));
+  }
+
+  const auto composite_key = build_key_column_ids.size() > 1
+                                 ? plan_composite_key(build_key_data_types, probe_key_data_types)
+                                 : std::nullopt;
+  if (composite_key) {
+    build_key_table = materialize_composite_keys(*build_input_table, build_key_column_ids, *composite_key);
+    probe_key_table = materialize_composite_keys(*probe_input_table, probe_key_column_ids, *composite_key);
+
+    if (composite_key->type == CompositeKeyType::Packed) {
+      // Equal packed keys imply that all equality predicates are satisfied.
+      std::erase_if(adjusted_secondary_predicates, [](const auto& predicate) {
+        return predicate.predicate_condition == PredicateCondition::Equals;
+      });
+    } else {
+      // Rows with equal hashed keys still need to be checked, including the primary predicate.
+      adjusted_secondary_predicates.emplace_back(adjusted_column_ids, PredicateCondition::Equals);
+    }
+
+    adjusted_column_ids = std::make_pair(ColumnID{0}, ColumnID{0});
+    build_column_type = DataType::Long;
+    probe_column_type = DataType::Long;
+    join_hash_performance_data.composite_key_column_count = build_key_column_ids.size();
+    join_hash_performance_data.composite_key_is_packed = composite_key->type == CompositeKeyType::Packed;
+  }
 
   // Depending on which input table became the build/probe table we have to order the columns of the output table.
   // Semi/Anti* Joins only emit tuples from the probe table, which is given by the right input table in Hyrise.
@@ -182,7 +236,6 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
     output_column_order = OutputColumnOrder::LeftFirstRightSecond;
   }
 
-  auto& join_hash_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
   resolve_data_type(build_column_type, [&](const auto build_data_type_t) {
     using BuildColumnDataType = typename decltype(build_data_type_t)::type;
     resolve_data_type(probe_column_type, [&](const auto probe_data_type_t) {
@@ -208,7 +261,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
                "Partition count too small (potential overflows in hash map offsetting).");
 
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
-            *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
+            *this, build_input_table, probe_input_table, build_key_table, probe_key_table, _mode, adjusted_column_ids,
             _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
             adjusted_secondary_predicates);
       } else {
@@ -219,6 +272,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   Assert(_radix_bits, "Radix bits are not set.");
   join_hash_performance_data.radix_bits = *_radix_bits;
+  join_hash_performance_data.radix_pass_count =
+      *_radix_bits == 0 ? 0 : (*_radix_bits <= MAX_RADIX_BITS_PER_PASS ? 1 : MAX_RADIX_PASS_COUNT);
   join_hash_performance_data.left_input_is_build_side = !build_hash_table_for_right_input;
 
   return _impl->_on_execute();
@@ -232,7 +287,9 @@ template <typename BuildColumnType, typename ProbeColumnType>
 class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
  public:
   JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const Table>& build_input_table,
-               const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
+               const std::shared_ptr<const Table>& probe_input_table,
+               const std::shared_ptr<const Table>& build_key_table,
+               const std::shared_ptr<const Table>& probe_key_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
                JoinHash::PerformanceData& performance_data, std::vector<OperatorJoinPredicate>& secondary_predicates)
@@ -241,11 +298,15 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         _performance_data(performance_data),
         _build_input_table(build_input_table),
         _probe_input_table(probe_input_table),
+        _build_key_table(build_key_table),
+        _probe_key_table(probe_key_table),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
         _output_column_order(output_column_order),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _first_pass_radix_bits(std::min(radix_bits, JoinHash::MAX_RADIX_BITS_PER_PASS)),
+        _second_pass_radix_bits(radix_bits - _first_pass_radix_bits) {}
 
  protected:
   // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members): const members and references are problematic with
@@ -257,12 +318,19 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
 
   std::shared_ptr<const Table> _build_input_table, _probe_input_table;
+  // The tables that the join keys are materialized from. These are the input tables unless the join uses a composite
+  // key, in which case _column_ids refer to the key tables.
+  std::shared_ptr<const Table> _build_key_table, _probe_key_table;
   JoinMode _mode;
   ColumnIDPair _column_ids;
   PredicateCondition _predicate_condition;
   OutputColumnOrder _output_column_order;
   std::shared_ptr<Table> _output_table;
   size_t _radix_bits;
+  // The materialization computes the histograms for the first radix partitioning pass. If more than
+  // MAX_RADIX_BITS_PER_PASS bits are used, the remaining bits are partitioned in a second pass.
+  size_t _first_pass_radix_bits;
+  size_t _second_pass_radix_bits;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
@@ -336,12 +404,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     const auto materialize_build_side = [&](const auto& input_bloom_filter) {
       if (keep_nulls_build_column) {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            _build_key_table, _column_ids.first, histograms_build_column, _first_pass_radix_bits,
+            build_side_bloom_filter, input_bloom_filter);
       } else {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            _build_key_table, _column_ids.first, histograms_build_column, _first_pass_radix_bits,
+            build_side_bloom_filter, input_bloom_filter);
       }
     };
 
@@ -352,12 +420,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     const auto materialize_probe_side = [&](const auto& input_bloom_filter) {
       if (keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            _probe_key_table, _column_ids.second, histograms_probe_column, _first_pass_radix_bits,
+            probe_side_bloom_filter, input_bloom_filter);
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            _probe_key_table, _column_ids.second, histograms_probe_column, _first_pass_radix_bits,
+            probe_side_bloom_filter, input_bloom_filter);
       }
     };
 
@@ -403,28 +471,48 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         // radix partition the build table
         if (keep_nulls_build_column) {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _first_pass_radix_bits);
         } else {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _first_pass_radix_bits);
         }
 
         // After the data in materialized_build_column has been partitioned, it is not needed anymore.
         materialized_build_column.clear();
+
+        if (_second_pass_radix_bits > 0) {
+          if (keep_nulls_build_column) {
+            radix_build_column = refine_radix_partitions<BuildColumnType, HashedType, true>(
+                std::move(radix_build_column), _first_pass_radix_bits, _second_pass_radix_bits);
+          } else {
+            radix_build_column = refine_radix_partitions<BuildColumnType, HashedType, false>(
+                std::move(radix_build_column), _first_pass_radix_bits, _second_pass_radix_bits);
+          }
+        }
       }));
 
       jobs.emplace_back(std::make_shared<JobTask>([&]() {
         // radix partition the probe column.
         if (keep_nulls_probe_column) {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _first_pass_radix_bits);
         } else {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _first_pass_radix_bits);
         }
 
         // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
         materialized_probe_column.clear();
+
+        if (_second_pass_radix_bits > 0) {
+          if (keep_nulls_probe_column) {
+            radix_probe_column = refine_radix_partitions<ProbeColumnType, HashedType, true>(
+                std::move(radix_probe_column), _first_pass_radix_bits, _second_pass_radix_bits);
+          } else {
+            radix_probe_column = refine_radix_partitions<ProbeColumnType, HashedType, false>(
+                std::move(radix_probe_column), _first_pass_radix_bits, _second_pass_radix_bits);
+          }
+        }
       }));
 
       Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
@@ -588,7 +676,14 @@ void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, Descripti
 
   const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
   stream << separator << "Radix bits: " << radix_bits << ".";
+  if (radix_pass_count > 1) {
+    stream << separator << "Radix partitioned in " << radix_pass_count << " passes.";
+  }
   stream << separator << "Build side is " << (left_input_is_build_side ? "left." : "right.");
+  if (composite_key_column_count > 0) {
+    stream << separator << (composite_key_is_packed ? "Packed" : "Hashed") << " composite key of "
+           << composite_key_column_count << " columns.";
+  }
 }
 
 }  // namespace hyrise
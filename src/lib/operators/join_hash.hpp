@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -30,6 +31,13 @@ class JoinHash : public AbstractJoinOperator {
   // directly. This threshold needs to be re-evaluated over time to find the value which gives the best performance.
   static constexpr auto JOB_SPAWN_THRESHOLD = 500;
 
+  // Radix partitioning writes to 1 << radix_bits partitions at the same time. "An Experimental Comparison of Thirteen
+  // Relational Equi-Joins in Main Memory" by Schuh et al. showed that large fan-outs hurt performance due to TLB
+  // misses. As we do not use software-managed buffers, each partitioning pass uses at most MAX_RADIX_BITS_PER_PASS
+  // bits (i.e., 256 partitions). Build sides that require more partitions are partitioned in two passes.
+  static constexpr auto MAX_RADIX_BITS_PER_PASS = size_t{8};
+  static constexpr auto MAX_RADIX_PASS_COUNT = size_t{2};
+
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
@@ -37,7 +45,11 @@ class JoinHash : public AbstractJoinOperator {
 
   const std::string& name() const override;
 
+  // Determines the number of radix bits so that the hash table of each build partition fits into the largest private
+  // cache of the CPU as reported by the topology. The second overload expects the cache size in bytes.
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size);
+  static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size,
+                                     const size_t cache_size);
 
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
@@ -52,6 +64,8 @@ class JoinHash : public AbstractJoinOperator {
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
 
     size_t radix_bits{0};
+    // Number of radix partitioning passes (0 if the build side is small enough to skip the partitioning).
+    size_t radix_pass_count{0};
     // Initially, the left input is the build side and the right side is the probe side.
     bool left_input_is_build_side{true};
 
@@ -67,6 +81,11 @@ class JoinHash : public AbstractJoinOperator {
     // build_side_position_count (see order of materialization in hash_join.cpp).
     size_t hash_tables_distinct_value_count{0};
     std::optional<size_t> hash_tables_position_count;
+
+    // Number of equality predicates that were combined into a composite key (0 if the join hashes only the primary
+    // join column) and whether the key columns were packed or hashed into the key.
+    size_t composite_key_column_count{0};
+    bool composite_key_is_packed{false};
   };
 
  protected:
@@ -2,14 +2,17 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <memory_resource>
 #include <mutex>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
+#include <boost/container_hash/hash.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
@@ -24,6 +27,8 @@
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 
@@ -429,6 +434,165 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   return radix_container;
 }
 
+/*
+  Multi-column equi-joins (e.g., `a1 = a2 AND b1 = b2`) are executed on one composite key per row instead of hashing
+  only the primary join column and checking the other equality predicates for all rows with the same primary value.
+  With a low-cardinality primary column, the latter produces huge candidate lists. The composite key is 64 bits wide:
+    - Packed: If all key columns are integers and their widths add up to at most 64 bits, their values are
+      concatenated. Equal keys imply equal values, so the equality predicates do not need to be checked again.
+    - Hashed: Otherwise, the hashes of the values are combined. As different values can yield the same key, the
+      equality predicates are still checked by the MultiPredicateJoinEvaluator, but only for rows with equal keys.
+  Both key types are finally passed through a bijective mixing function (see finalize_composite_key()), so that the
+  lower bits used for radix partitioning and the Bloom filter depend on all key columns.
+  The key of a row is NULL if any of its key columns is NULL. materialize_composite_keys() writes the keys to a table
+  with a single Long column, whose chunks have the same sizes as the chunks of the input table. This table is then
+  passed to materialize_input() instead of the input table, so that the materialized RowIDs refer to the input table.
+*/
+enum class CompositeKeyType { Packed, Hashed };
+
+struct CompositeKey {
+  CompositeKeyType type{CompositeKeyType::Hashed};
+
+  // For packed keys, the number of bits of each key column. If a column is an Int on one side and a Long on the other
+  // side, both sides use 64 bits so that equal values yield equal keys.
+  std::vector<uint8_t> bit_widths;
+};
+
+// Returns the composite key for joining the build columns with the given data types to the probe columns with the
+// given data types. Returns std::nullopt if the columns cannot be combined into a key, e.g., if a numeric column is
+// compared to a string column or an integer column to a floating-point column.
+inline std::optional<CompositeKey> plan_composite_key(const std::vector<DataType>& build_data_types,
+                                                      const std::vector<DataType>& probe_data_types) {
+  DebugAssert(build_data_types.size() == probe_data_types.size(), "Expected one build and one probe column per key.");
+  const auto is_integral = [](const DataType data_type) {
+    return data_type == DataType::Int || data_type == DataType::Long;
+  };
+  const auto is_floating_point = [](const DataType data_type) {
+    return data_type == DataType::Float || data_type == DataType::Double;
+  };
+
+  auto composite_key = CompositeKey{};
+  auto total_bit_width = size_t{0};
+  auto all_integral = true;
+  const auto column_count = build_data_types.size();
+  for (auto column_idx = size_t{0}; column_idx < column_count; ++column_idx) {
+    const auto build_data_type = build_data_types[column_idx];
+    const auto probe_data_type = probe_data_types[column_idx];
+    if (is_integral(build_data_type) && is_integral(probe_data_type)) {
+      const auto bit_width = build_data_type == DataType::Int && probe_data_type == DataType::Int ? 32 : 64;
+      composite_key.bit_widths.emplace_back(bit_width);
+      total_bit_width += bit_width;
+      continue;
+    }
+
+    all_integral = false;
+    if (!(is_floating_point(build_data_type) && is_floating_point(probe_data_type)) &&
+        !(build_data_type == DataType::String && probe_data_type == DataType::String)) {
+      return std::nullopt;
+    }
+  }
+
+  if (all_integral && total_bit_width <= 64) {
+    composite_key.type = CompositeKeyType::Packed;
+  } else {
+    composite_key.type = CompositeKeyType::Hashed;
+    composite_key.bit_widths.clear();
+  }
+
+  return composite_key;
+}
+
+// The hash of a Long is the value itself. For packed keys, the lower bits would only depend on the last key column,
+// so that all rows end up in a few radix partitions if that column has few distinct values (e.g., a status flag).
+// This is the finalizer of MurmurHash3, which is bijective, so that packed keys are still equal iff the values are.
+inline uint64_t finalize_composite_key(uint64_t key) {
+  key ^= key >> 33;
+  key *= 0xFF51AFD7ED558CCD;
+  key ^= key >> 33;
+  key *= 0xC4CEB9FE1A85EC53;
+  key ^= key >> 33;
+  return key;
+}
+
+// Materializes the composite key of each row of `table` into a table with a single, nullable Long column (see above).
+inline std::shared_ptr<const Table> materialize_composite_keys(const Table& table,
+                                                               const std::vector<ColumnID>& column_ids,
+                                                               const CompositeKey& composite_key) {
+  const auto chunk_count = table.chunk_count();
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Physically deleted and empty chunks are skipped by materialize_input().
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    const auto row_count = chunk->size();
+    const auto materialize_keys = [&, chunk, chunk_id, row_count]() {
+      auto keys = std::vector<uint64_t>(row_count);
+      auto null_values = pmr_vector<bool>(row_count);
+
+      const auto column_count = column_ids.size();
+      for (auto column_idx = size_t{0}; column_idx < column_count; ++column_idx) {
+        const auto& segment = *chunk->get_segment(column_ids[column_idx]);
+        resolve_data_type(table.column_data_type(column_ids[column_idx]), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            const auto chunk_offset = position.chunk_offset();
+            // The last chunk of a data table might have grown since we retrieved its size. Rows inserted
+            // concurrently are not visible to our transaction, so we ignore them.
+            if (chunk_offset >= row_count) {
+              return;
+            }
+
+            if (position.is_null()) {
+              null_values[chunk_offset] = true;
+              return;
+            }
+
+            auto& key = keys[chunk_offset];
+            if constexpr (std::is_integral_v<ColumnDataType>) {
+              // Equal integers yield equal keys, no matter whether they are stored as Int or Long on either side.
+              const auto value = static_cast<uint64_t>(static_cast<int64_t>(position.value()));
+              if (composite_key.type == CompositeKeyType::Packed) {
+                const auto bit_width = composite_key.bit_widths[column_idx];
+                key = bit_width == 64 ? value : (key << bit_width) | (value & ((uint64_t{1} << bit_width) - 1));
+              } else {
+                boost::hash_combine(key, std::hash<int64_t>{}(static_cast<int64_t>(value)));
+              }
+            } else if constexpr (std::is_floating_point_v<ColumnDataType>) {
+              boost::hash_combine(key, std::hash<double>{}(static_cast<double>(position.value())));
+            } else {
+              boost::hash_combine(key, std::hash<ColumnDataType>{}(position.value()));
+            }
+          });
+        });
+      }
+
+      auto key_values = pmr_vector<int64_t>(row_count);
+      std::transform(keys.cbegin(), keys.cend(), key_values.begin(), [](const auto key) {
+        return static_cast<int64_t>(finalize_composite_key(key));
+      });
+      const auto segment = std::make_shared<ValueSegment<int64_t>>(std::move(key_values), std::move(null_values));
+      chunks[chunk_id] = std::make_shared<Chunk>(Segments{segment});
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > row_count) {
+      materialize_keys();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(materialize_keys));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return std::make_shared<Table>(TableColumnDefinitions{{"composite_key", DataType::Long, true}}, TableType::Data,
+                                 chunks);
+}
+
 /*
 Build all the hash tables for the partitions of the build column. One job per partition
 */
@@ -629,6 +793,148 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+// Second pass of a two-pass radix partitioning. partition_by_radix() has partitioned the elements by the lowest
+// `first_pass_radix_bits` bits of their hashes. This pass splits each of these partitions by the next
+// `second_pass_radix_bits` bits. The element with hash h ends up in partition h & ((1 << radix_bits) - 1), with
+// radix_bits being the sum of both passes, just as if it had been partitioned in a single pass. As each pass writes to
+// at most 1 << MAX_RADIX_BITS_PER_PASS partitions at a time, the writes are less likely to miss the TLB and the caches.
+// Each input partition is refined by a separate job, which is the only one to write to its output partitions. The input
+// partitions are released as soon as they have been refined.
+template <typename T, typename HashedType, bool keep_null_values>
+RadixContainer<T> refine_radix_partitions(RadixContainer<T>&& radix_container, const size_t first_pass_radix_bits,
+                                          const size_t second_pass_radix_bits) {
+  const auto input_partition_count = radix_container.size();
+  Assert(input_partition_count == size_t{1} << first_pass_radix_bits,
+         "Expected one input partition per value of the first pass's radix bits");
+
+  const std::hash<HashedType> hash_function;
+
+  const auto second_pass_partition_count = size_t{1} << second_pass_radix_bits;
+  const auto second_pass_radix_mask = second_pass_partition_count - 1;
+
+  auto output = RadixContainer<T>(input_partition_count * second_pass_partition_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_partition_count);
+
+  for (auto input_partition_idx = size_t{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
+    const auto elements_count = radix_container[input_partition_idx].elements.size();
+
+    const auto perform_partition = [&, input_partition_idx, elements_count]() {
+      auto& input_partition = radix_container[input_partition_idx];
+      const auto& elements = input_partition.elements;
+
+      if constexpr (keep_null_values) {
+        Assert(elements_count == input_partition.null_values.size(),
+               "refine_radix_partitions() called with NULL consideration but radix container does not store any NULL "
+               "value information");
+      }
+
+      const auto second_pass_radix = [&](const auto& element) {
+        return (hash_function(static_cast<HashedType>(element.value)) >> first_pass_radix_bits) &
+               second_pass_radix_mask;
+      };
+
+      auto histogram = std::vector<size_t>(second_pass_partition_count);
+      for (const auto& element : elements) {
+        ++histogram[second_pass_radix(element)];
+      }
+
+      for (auto radix = size_t{0}; radix < second_pass_partition_count; ++radix) {
+        auto& output_partition = output[(radix << first_pass_radix_bits) | input_partition_idx];
+        output_partition.elements.resize(histogram[radix]);
+        if constexpr (keep_null_values) {
+          output_partition.null_values.resize(histogram[radix]);
+        }
+      }
+
+      auto output_offsets = std::vector<size_t>(second_pass_partition_count);
+      for (auto input_idx = size_t{0}; input_idx < elements_count; ++input_idx) {
+        const auto& element = elements[input_idx];
+        const auto radix = second_pass_radix(element);
+        auto& output_partition = output[(radix << first_pass_radix_bits) | input_partition_idx];
+        auto& output_idx = output_offsets[radix];
+
+        output_partition.elements[output_idx] = element;
+        if constexpr (keep_null_values) {
+          output_partition.null_values[output_idx] = input_partition.null_values[input_idx];
+        }
+
+        ++output_idx;
+      }
+
+      input_partition = Partition<T>{};
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+      perform_partition();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(perform_partition));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  radix_container.clear();
+  return output;
+}
+
+/*
+  For joins with secondary predicates, the probe functions do not check the secondary predicates for every pair of
+  build and probe rows that satisfies the primary predicate individually. Instead, these candidate pairs are collected
+  and checked by the evaluator at once, one predicate after another. The candidates of each probe row are stored
+  contiguously: the candidates of the i-th probe row of a batch are stored in
+  [probe_row_ends[i - 1], probe_row_ends[i]). A probe row can have no candidates (e.g., when its value is NULL), which
+  matters for outer and anti joins.
+
+  A batch is checked as soon as it holds MultiPredicateJoinEvaluator::BATCH_SIZE candidates or probe rows. As a probe
+  row with a frequent value can have many more candidates, the probe functions also check the batch while a probe row
+  is still being added. The candidates behind the last finished probe row then belong to this open probe row, which is
+  continued in the next batch. For semi and anti joins, the remaining candidates of the open probe row are dropped if
+  one of its candidates already matches.
+*/
+struct JoinCandidates {
+  void add(const RowID& build_row_id, const RowID& probe_row_id) {
+    build_row_ids.emplace_back(build_row_id);
+    probe_row_ids.emplace_back(probe_row_id);
+  }
+
+  // Called after all candidates of a probe row have been added.
+  void finish_probe_row(const RowID& probe_row_id) {
+    probe_row_ends.emplace_back(build_row_ids.size());
+    batch_probe_row_ids.emplace_back(probe_row_id);
+  }
+
+  size_t probe_row_count() const {
+    return probe_row_ends.size();
+  }
+
+  size_t candidate_count() const {
+    return build_row_ids.size();
+  }
+
+  bool is_full() const {
+    return candidate_count() >= MultiPredicateJoinEvaluator::BATCH_SIZE ||
+           probe_row_count() >= MultiPredicateJoinEvaluator::BATCH_SIZE;
+  }
+
+  // Does not reset open_probe_row_matches, as the open probe row is continued in the next batch.
+  void clear() {
+    build_row_ids.clear();
+    probe_row_ids.clear();
+    probe_row_ends.clear();
+    batch_probe_row_ids.clear();
+  }
+
+  RowIDPosList build_row_ids;
+  RowIDPosList probe_row_ids;
+  std::vector<size_t> probe_row_ends;
+  RowIDPosList batch_probe_row_ids;
+  std::vector<uint8_t> matches;
+
+  // Whether a candidate of the open probe row matched in a previous batch.
+  bool open_probe_row_matches{false};
+};
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -676,9 +982,9 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
       if (!hash_tables.empty() && hash_tables.at(hash_table_idx)) {
         const auto& hash_table = *hash_tables[hash_table_idx];
 
-        // The MultiPredicateJoinEvaluator use accessors internally. Those are not thread-safe, so we create one
+        // The MultiPredicateJoinEvaluator uses accessors internally. Those are not thread-safe, so we create one
         // evaluator per job.
-        std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
+        auto multi_predicate_join_evaluator = std::optional<MultiPredicateJoinEvaluator>{};
         if (!secondary_join_predicates.empty()) {
           multi_predicate_join_evaluator.emplace(build_table, probe_table, mode, secondary_join_predicates);
         }
@@ -689,74 +995,125 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_side_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
-          const auto& probe_column_element = elements[partition_offset];
+        if (multi_predicate_join_evaluator) {
+          auto candidates = JoinCandidates{};
+          const auto emit_candidates = [&]() {
+            multi_predicate_join_evaluator->satisfies_all_predicates(candidates.build_row_ids,
+                                                                     candidates.probe_row_ids, candidates.matches);
+
+            const auto emit_matches = [&](auto& candidate_idx, const size_t candidate_end, auto& match_found) {
+              for (; candidate_idx < candidate_end; ++candidate_idx) {
+                if (candidates.matches[candidate_idx]) {
+                  pos_list_build_side_local.emplace_back(candidates.build_row_ids[candidate_idx]);
+                  pos_list_probe_side_local.emplace_back(candidates.probe_row_ids[candidate_idx]);
+                  match_found = true;
+                }
+              }
+            };
 
-          if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
-            // From previous joins, we could potentially have NULL values that do not refer to
-            // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
-            continue;
-          }
+            // The first probe row of the batch might have been continued from the previous batch.
+            auto candidate_idx = size_t{0};
+            auto match_found = candidates.open_probe_row_matches;
+            const auto probe_row_count = candidates.probe_row_count();
+            for (auto probe_row_idx = size_t{0}; probe_row_idx < probe_row_count; ++probe_row_idx) {
+              emit_matches(candidate_idx, candidates.probe_row_ends[probe_row_idx], match_found);
+
+              // We have not found matching items for all predicates.
+              if constexpr (keep_null_values) {
+                if (!match_found) {
+                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                  pos_list_probe_side_local.emplace_back(candidates.batch_probe_row_ids[probe_row_idx]);
+                }
+              }
+              match_found = false;
+            }
 
-          auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
-              hash_table.find(static_cast<HashedType>(probe_column_element.value));
+            emit_matches(candidate_idx, candidates.candidate_count(), match_found);
+            candidates.open_probe_row_matches = match_found;
+            candidates.clear();
+          };
 
-          if (primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end) {
-            // Key exists, thus we have at least one hit for the primary predicate
+          for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+            const auto& probe_column_element = elements[partition_offset];
+
+            if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
+              continue;
+            }
 
-            // Since we cannot store NULL values directly in off-the-shelf containers,
-            // we need to the check the NULL bit vector here because a NULL value (represented
-            // as a zero) yields the same rows as an actual zero value.
-            // For inner joins, we skip NULL values and output them for outer joins.
-            // Note: If the materialization/radix partitioning phase did not explicitly consider
-            // NULL values, they will not be handed to the probe function.
+            // A NULL value on the probe side never satisfies the primary predicate. For outer joins, it is emitted
+            // with a NULL_ROW_ID on the build side as a probe row without candidates.
+            auto is_null = false;
             if constexpr (keep_null_values) {
-              if (null_values[partition_offset]) {
-                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                // ignore found matches and continue with next probe item
-                continue;
-              }
+              is_null = null_values[partition_offset];
             }
 
-            // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
-            // lists.
-            if (!multi_predicate_join_evaluator) {
+            if (!is_null) {
+              auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
+                  hash_table.find(static_cast<HashedType>(probe_column_element.value));
               for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
                    ++primary_predicate_matching_rows_iter) {
-                const auto row_id = *primary_predicate_matching_rows_iter;
-                pos_list_build_side_local.emplace_back(row_id);
-                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-              }
-            } else {
-              auto match_found = false;
-              for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
-                   ++primary_predicate_matching_rows_iter) {
-                const auto row_id = *primary_predicate_matching_rows_iter;
-                if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                  pos_list_build_side_local.emplace_back(row_id);
-                  pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
-                  match_found = true;
+                candidates.add(*primary_predicate_matching_rows_iter, probe_column_element.row_id);
+                if (candidates.is_full()) {
+                  emit_candidates();
                 }
               }
+            }
 
-              // We have not found matching items for all predicates.
+            candidates.finish_probe_row(probe_column_element.row_id);
+            if (candidates.is_full()) {
+              emit_candidates();
+            }
+          }
+          emit_candidates();
+        } else {
+          for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+            const auto& probe_column_element = elements[partition_offset];
+
+            if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
+              // From previous joins, we could potentially have NULL values that do not refer to
+              // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
+              continue;
+            }
+
+            auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
+                hash_table.find(static_cast<HashedType>(probe_column_element.value));
+
+            if (primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end) {
+              // Key exists, thus we have at least one hit for the primary predicate
+
+              // Since we cannot store NULL values directly in off-the-shelf containers,
+              // we need to the check the NULL bit vector here because a NULL value (represented
+              // as a zero) yields the same rows as an actual zero value.
+              // For inner joins, we skip NULL values and output them for outer joins.
+              // Note: If the materialization/radix partitioning phase did not explicitly consider
+              // NULL values, they will not be handed to the probe function.
               if constexpr (keep_null_values) {
-                if (!match_found) {
+                if (null_values[partition_offset]) {
                   pos_list_build_side_local.emplace_back(NULL_ROW_ID);
                   pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+                  // ignore found matches and continue with next probe item
+                  continue;
                 }
               }
-            }
 
-          } else {
-            // We have not found matching items for the first predicate. Only continue for non-equi join modes.
-            // We use constexpr to prune this conditional for the equi-join implementation.
-            // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
-            // relation since the relations are swapped upfront.
-            if constexpr (keep_null_values) {
-              pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-              pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+              // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
+              // lists.
+              for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
+                   ++primary_predicate_matching_rows_iter) {
+                const auto row_id = *primary_predicate_matching_rows_iter;
+                pos_list_build_side_local.emplace_back(row_id);
+                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+              }
+
+            } else {
+              // We have not found matching items for the first predicate. Only continue for non-equi join modes.
+              // We use constexpr to prune this conditional for the equi-join implementation.
+              // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
+              // relation since the relations are swapped upfront.
+              if constexpr (keep_null_values) {
+                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+              }
             }
           }
         }
@@ -825,9 +1182,38 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         // Valid hash table found, so there is at least one match in this partition
         const auto& hash_table = *hash_tables[hash_table_idx];
 
-        // Accessors are not thread-safe, so we create one evaluator per job
-        MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
-                                                                   secondary_join_predicates);
+        // The MultiPredicateJoinEvaluator uses accessors internally. Those are not thread-safe, so we create one
+        // evaluator per job.
+        auto multi_predicate_join_evaluator = std::optional<MultiPredicateJoinEvaluator>{};
+        if (!secondary_join_predicates.empty()) {
+          multi_predicate_join_evaluator.emplace(build_table, probe_table, mode, secondary_join_predicates);
+        }
+
+        auto candidates = JoinCandidates{};
+        const auto emit_candidates = [&]() {
+          multi_predicate_join_evaluator->satisfies_all_predicates(candidates.build_row_ids, candidates.probe_row_ids,
+                                                                   candidates.matches);
+
+          const auto any_matches = [&](auto& candidate_idx, const size_t candidate_end) {
+            auto any_build_column_value_matches = false;
+            for (; candidate_idx < candidate_end; ++candidate_idx) {
+              any_build_column_value_matches |= static_cast<bool>(candidates.matches[candidate_idx]);
+            }
+            return any_build_column_value_matches;
+          };
+
+          // A continued probe row has no matching candidates in the previous batches, as it would have been finished.
+          auto candidate_idx = size_t{0};
+          const auto probe_row_count = candidates.probe_row_count();
+          for (auto probe_row_idx = size_t{0}; probe_row_idx < probe_row_count; ++probe_row_idx) {
+            if ((mode == JoinMode::Semi) == any_matches(candidate_idx, candidates.probe_row_ends[probe_row_idx])) {
+              pos_list_local.emplace_back(candidates.batch_probe_row_ids[probe_row_idx]);
+            }
+          }
+
+          candidates.open_probe_row_matches = any_matches(candidate_idx, candidates.candidate_count());
+          candidates.clear();
+        };
 
         for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
@@ -842,7 +1228,15 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
             // NULL values on the probe side always lead to the tuple being emitted for AntiNullAsFalse, irrespective
             // of secondary predicates (`NULL("as false") AND <anything>` is always false)
             if (null_values[partition_offset]) {
-              pos_list_local.emplace_back(probe_column_element.row_id);
+              if (multi_predicate_join_evaluator) {
+                // Keep the order of the probe rows by emitting the NULL value as a probe row without candidates.
+                candidates.finish_probe_row(probe_column_element.row_id);
+                if (candidates.is_full()) {
+                  emit_candidates();
+                }
+              } else {
+                pos_list_local.emplace_back(probe_column_element.row_id);
+              }
               continue;
             }
           } else if constexpr (mode == JoinMode::AntiNullAsTrue) {
@@ -853,30 +1247,52 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
             }
           }
 
-          auto any_build_column_value_matches = false;
-
-          if (secondary_join_predicates.empty()) {
-            any_build_column_value_matches = hash_table.contains(static_cast<HashedType>(probe_column_element.value));
-          } else {
+          if (multi_predicate_join_evaluator) {
+            // The probe row is emitted once the secondary predicates have been checked for the whole batch.
             auto [primary_predicate_matching_rows_iter, primary_predicate_matching_rows_end] =
                 hash_table.find(static_cast<HashedType>(probe_column_element.value));
 
             for (; primary_predicate_matching_rows_iter != primary_predicate_matching_rows_end;
                  ++primary_predicate_matching_rows_iter) {
-              const auto row_id = *primary_predicate_matching_rows_iter;
-              if (multi_predicate_join_evaluator.satisfies_all_predicates(row_id, probe_column_element.row_id)) {
-                any_build_column_value_matches = true;
-                break;
+              candidates.add(*primary_predicate_matching_rows_iter, probe_column_element.row_id);
+              if (candidates.is_full()) {
+                emit_candidates();
+                if (candidates.open_probe_row_matches) {
+                  break;
+                }
+              }
+            }
+
+            if (candidates.open_probe_row_matches) {
+              // The remaining candidates of the probe row are dropped. As all previous probe rows have been emitted,
+              // the probe row can be emitted directly.
+              if constexpr (mode == JoinMode::Semi) {
+                pos_list_local.emplace_back(probe_column_element.row_id);
               }
+              candidates.open_probe_row_matches = false;
+              continue;
             }
+
+            candidates.finish_probe_row(probe_column_element.row_id);
+            if (candidates.is_full()) {
+              emit_candidates();
+            }
+            continue;
           }
 
+          const auto any_build_column_value_matches =
+              hash_table.contains(static_cast<HashedType>(probe_column_element.value));
+
           if ((mode == JoinMode::Semi && any_build_column_value_matches) ||
               ((mode == JoinMode::AntiNullAsTrue || mode == JoinMode::AntiNullAsFalse) &&
                !any_build_column_value_matches)) {
             pos_list_local.emplace_back(probe_column_element.row_id);
           }
         }
+
+        if (multi_predicate_join_evaluator) {
+          emit_candidates();
+        }
       } else if constexpr (mode == JoinMode::AntiNullAsFalse) {
         // no hash table on other side, but we are in AntiNullAsFalse mode which means all tuples from the probing side
         // get emitted.
@@ -352,13 +352,33 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   // where the secondary predicates are satisfied.
   void _emit_combinations_multi_predicated_inner(size_t output_cluster, TableRange left_range, TableRange right_range,
                                                  MultiPredicateJoinEvaluator& multi_predicate_join_evaluator) {
+    // The secondary predicates are checked for batches of candidate pairs (see MultiPredicateJoinEvaluator).
+    auto left_row_ids = RowIDPosList{};
+    auto right_row_ids = RowIDPosList{};
+    auto matches = std::vector<uint8_t>{};
+    const auto emit_candidates = [&]() {
+      multi_predicate_join_evaluator.satisfies_all_predicates(left_row_ids, right_row_ids, matches);
+      const auto candidate_count = left_row_ids.size();
+      for (auto candidate_idx = size_t{0}; candidate_idx < candidate_count; ++candidate_idx) {
+        if (matches[candidate_idx]) {
+          _emit_combination(output_cluster, left_row_ids[candidate_idx], right_row_ids[candidate_idx]);
+        }
+      }
+      left_row_ids.clear();
+      right_row_ids.clear();
+    };
+
     left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
-          _emit_combination(output_cluster, left_row_id, right_row_id);
-        }
+        left_row_ids.emplace_back(left_row_id);
+        right_row_ids.emplace_back(right_row_id);
       });
+
+      if (left_row_ids.size() >= MultiPredicateJoinEvaluator::BATCH_SIZE) {
+        emit_candidates();
+      }
     });
+    emit_candidates();
   }
 
   // Only for multi predicated left outer joins.
@@ -1,5 +1,6 @@
 #include "multi_predicate_join_evaluator.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -7,7 +8,8 @@
 
 #include "operators/operator_join_predicate.hpp"
 #include "resolve_type.hpp"
-#include "storage/base_segment_accessor.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/table.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
@@ -32,8 +34,8 @@ MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, cons
         constexpr auto BOTH_ARE_STRING_COLUMNS = LEFT_IS_STRING_COLUMN && RIGHT_IS_STRING_COLUMN;
 
         if constexpr (NEITHER_IS_STRING_COLUMN || BOTH_ARE_STRING_COLUMNS) {
-          auto left_accessors = _create_accessors<LeftColumnDataType>(left, predicate.column_ids.first);
-          auto right_accessors = _create_accessors<RightColumnDataType>(right, predicate.column_ids.second);
+          auto left_accessors = ColumnAccessors<LeftColumnDataType>{left, predicate.column_ids.first};
+          auto right_accessors = ColumnAccessors<RightColumnDataType>{right, predicate.column_ids.second};
           auto join_mode_copy = join_mode;
 
           with_comparator(predicate.predicate_condition, [&](auto comparator) {
@@ -59,21 +61,16 @@ bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row
   return true;
 }
 
-template <typename T>
-std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> MultiPredicateJoinEvaluator::_create_accessors(
-    const Table& table, const ColumnID column_id) {
-  auto accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>>{};
-  accessors.resize(table.chunk_count());
-  const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk = table.get_chunk(chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+void MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowIDPosList& left_row_ids,
+                                                           const RowIDPosList& right_row_ids,
+                                                           std::vector<uint8_t>& matches) {
+  DebugAssert(left_row_ids.size() == right_row_ids.size(), "Expected one left and one right RowID per candidate.");
+  matches.assign(left_row_ids.size(), uint8_t{1});
 
-    const auto& segment = chunk->get_segment(column_id);
-    accessors[chunk_id] = create_segment_accessor<T>(segment);
+  // Each comparator evaluates its predicate for all candidates before the next predicate is evaluated.
+  for (const auto& comparator : _comparators) {
+    comparator->compare(left_row_ids, right_row_ids, matches);
   }
-
-  return accessors;
 }
 
 }  // namespace hyrise
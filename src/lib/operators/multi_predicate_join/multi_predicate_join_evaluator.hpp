@@ -1,72 +1,124 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "operators/operator_join_predicate.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
 // This class is used to evaluate secondary join predicates. It is called by the join operators after the primary
 // predicate has been handled by, e.g., probing the hash table.
-// As accessors are not thread-safe, instances of this class should not be used in multiple threads.
+// The segments are read through accessors, which are only created for the chunks that candidates are located in. As
+// accessors are not thread-safe, instances of this class should not be used in multiple threads. Candidate pairs can
+// either be checked one at a time or in batches. For batches, each predicate is evaluated for all candidates that
+// satisfy the previous predicates before the next predicate is evaluated.
 class MultiPredicateJoinEvaluator {
  public:
   MultiPredicateJoinEvaluator(const Table& left, const Table& right, const JoinMode join_mode,
                               const std::vector<OperatorJoinPredicate>& join_predicates);
 
+  // Number of candidate pairs that the join operators collect before checking them as a batch. Small batches keep the
+  // candidates in the CPU caches.
+  static constexpr auto BATCH_SIZE = size_t{1'024};
+
   bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id);
 
+  // Checks the candidate pairs (left_row_ids[i], right_row_ids[i]) and sets matches[i] to 1 if the pair satisfies all
+  // predicates and to 0 otherwise.
+  void satisfies_all_predicates(const RowIDPosList& left_row_ids, const RowIDPosList& right_row_ids,
+                                std::vector<uint8_t>& matches);
+
  protected:
+  // The accessors of a column's segments. An accessor is created when its chunk is accessed for the first time.
+  template <typename T>
+  class ColumnAccessors {
+   public:
+    ColumnAccessors(const Table& table, const ColumnID column_id)
+        : _table{table}, _column_id{column_id}, _accessors(table.chunk_count()) {}
+
+    std::optional<T> access(const RowID& row_id) {
+      auto& accessor = _accessors[row_id.chunk_id];
+      if (!accessor) {
+        const auto chunk = _table.get_chunk(row_id.chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+        accessor = create_segment_accessor<T>(chunk->get_segment(_column_id));
+      }
+      return accessor->access(row_id.chunk_offset);
+    }
+
+   private:
+    const Table& _table;
+    const ColumnID _column_id;
+    std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _accessors;
+  };
+
   class BaseFieldComparator : public Noncopyable {
    public:
-    virtual bool compare(const RowID& left, const RowID& right) const = 0;
+    virtual bool compare(const RowID& left, const RowID& right) = 0;
+    virtual void compare(const RowIDPosList& left, const RowIDPosList& right, std::vector<uint8_t>& matches) = 0;
     virtual ~BaseFieldComparator() = default;
   };
 
   template <typename CompareFunctor, typename L, typename R>
   class FieldComparator : public BaseFieldComparator {
    public:
-    FieldComparator(CompareFunctor compare_functor, JoinMode join_mode,
-                    std::vector<std::unique_ptr<AbstractSegmentAccessor<L>>> left_accessors,
-                    std::vector<std::unique_ptr<AbstractSegmentAccessor<R>>> right_accessors)
+    FieldComparator(CompareFunctor compare_functor, JoinMode join_mode, ColumnAccessors<L> left_accessors,
+                    ColumnAccessors<R> right_accessors)
         : _compare_functor{std::move(compare_functor)},
           _join_mode{join_mode},
           _left_accessors{std::move(left_accessors)},
           _right_accessors{std::move(right_accessors)} {}
 
     /**
-     * Tests the value behind the left and right RowID for equality.
+     * Compares the values behind the left and right RowID.
      */
-    bool compare(const RowID& left, const RowID& right) const override {
-      const auto left_value = _left_accessors[left.chunk_id]->access(left.chunk_offset);
-      const auto right_value = _right_accessors[right.chunk_id]->access(right.chunk_offset);
+    bool compare(const RowID& left, const RowID& right) override {
+      return _compare(left, right);
+    }
+
+    /**
+     * Compares the candidate pairs and clears the matches of all pairs whose values do not satisfy the predicate. The
+     * values of pairs that an earlier predicate has already rejected are not read.
+     */
+    void compare(const RowIDPosList& left, const RowIDPosList& right, std::vector<uint8_t>& matches) override {
+      const auto candidate_count = left.size();
+      for (auto candidate_idx = size_t{0}; candidate_idx < candidate_count; ++candidate_idx) {
+        if (matches[candidate_idx]) {
+          matches[candidate_idx] = static_cast<uint8_t>(_compare(left[candidate_idx], right[candidate_idx]));
+        }
+      }
+    }
+
+   private:
+    bool _compare(const RowID& left, const RowID& right) {
+      const auto left_value = _left_accessors.access(left);
+      const auto right_value = _right_accessors.access(right);
       // NULL value handling:
       // If either left or right value is NULL, the comparison will evaluate to TRUE for AntiNullAsTrue and to FALSE
       // for all other JoinModes.
       if (!left_value || !right_value) {
         return _join_mode == JoinMode::AntiNullAsTrue;
-      } else {
-        return _compare_functor(*left_value, *right_value);
       }
+
+      return _compare_functor(*left_value, *right_value);
     }
 
-   private:
     const CompareFunctor _compare_functor;
     const JoinMode _join_mode;
-    const std::vector<std::unique_ptr<AbstractSegmentAccessor<L>>> _left_accessors;
-    const std::vector<std::unique_ptr<AbstractSegmentAccessor<R>>> _right_accessors;
+    ColumnAccessors<L> _left_accessors;
+    ColumnAccessors<R> _right_accessors;
   };
 
   std::vector<std::unique_ptr<BaseFieldComparator>> _comparators;
-
-  template <typename T>
-  static std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>> _create_accessors(const Table& table,
-                                                                                    const ColumnID column_id);
 };
 
 }  // namespace hyrise
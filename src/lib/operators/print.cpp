@@ -256,6 +256,14 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::FSST: {
+        segment_type += "FSST";
+        break;
+      }
+      case EncodingType::FSSTDictionary: {
+        segment_type += "FSSTD";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
@@ -275,6 +283,10 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
           segment_type += ":BitP";
           break;
         }
+        case CompressedVectorType::SimdBp128: {
+          segment_type += ":SBP128";
+          break;
+        }
       }
     }
   } else {
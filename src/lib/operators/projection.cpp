@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -32,6 +33,56 @@
 
 namespace hyrise {
 
+namespace {
+
+// Maps the output columns that forward an input column without modifications to that input column. This is necessary
+// as the order may have been changed.
+std::unordered_map<ColumnID, ColumnID> map_output_columns_to_input_columns(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    const ExpressionUnorderedSet& forwarded_pqp_columns) {
+  auto output_column_to_input_column = std::unordered_map<ColumnID, ColumnID>{};
+  const auto expression_count = expressions.size();
+  for (auto expression_id = ColumnID{0}; expression_id < expression_count; ++expression_id) {
+    const auto& expression = expressions[expression_id];
+    if (const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
+      if (forwarded_pqp_columns.contains(expression)) {
+        const auto& original_id = pqp_column_expression->column_id;
+        output_column_to_input_column[expression_id] = original_id;
+      }
+    }
+  }
+  return output_column_to_input_column;
+}
+
+// Forward sorted_by flags, mapping column ids.
+void forward_sorted_by(const Chunk& input_chunk, Chunk& output_chunk,
+                       const std::unordered_map<ColumnID, ColumnID>& output_column_to_input_column) {
+  const auto& sorted_by = input_chunk.individually_sorted_by();
+  if (sorted_by.empty()) {
+    return;
+  }
+
+  std::vector<SortColumnDefinition> transformed;
+  transformed.reserve(sorted_by.size());
+
+  // We need to iterate both sorted information and the output/input mapping as multiple output columns might
+  // originate from the same sorted input column.
+  for (const auto& [output_column_id, input_column_id] : output_column_to_input_column) {
+    const auto iter =
+        std::find_if(sorted_by.begin(), sorted_by.end(), [input_column_id = input_column_id](const auto sort) {
+          return input_column_id == sort.column;
+        });
+    if (iter != sorted_by.end()) {
+      transformed.emplace_back(output_column_id, iter->sort_mode);
+    }
+  }
+  if (!transformed.empty()) {
+    output_chunk.set_individually_sorted_by(transformed);
+  }
+}
+
+}  // namespace
+
 Projection::Projection(const std::shared_ptr<const AbstractOperator>& input_operator,
                        const std::vector<std::shared_ptr<AbstractExpression>>& init_expressions)
     : AbstractReadOnlyOperator(OperatorType::Projection, input_operator, nullptr,
@@ -179,6 +230,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
+      job_task->set_preferred_node_id(input_chunk->numa_node_id());
       jobs.push_back(job_task);
     } else {
       perform_projection_evaluation();
@@ -218,18 +270,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
   auto projection_result_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
 
-  // Create a mapping from output columns to input columns for future use. This is necessary as the order may have been
-  // changed. The mapping only contains column IDs that are forwarded without modfications.
-  auto output_column_to_input_column = std::unordered_map<ColumnID, ColumnID>{};
-  for (auto expression_id = ColumnID{0}; expression_id < expression_count; ++expression_id) {
-    const auto& expression = expressions[expression_id];
-    if (const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
-      if (forwarded_pqp_columns.contains(expression)) {
-        const auto& original_id = pqp_column_expression->column_id;
-        output_column_to_input_column[expression_id] = original_id;
-      }
-    }
-  }
+  // Create a mapping from output columns to input columns for future use. The mapping only contains column IDs that are
+  // forwarded without modfications.
+  const auto output_column_to_input_column = map_output_columns_to_input_columns(expressions, forwarded_pqp_columns);
 
   // Create the actual chunks, and, if needed, fill the projection_result_table. Also set MVCC and
   // individually_sorted_by information as needed.
@@ -275,28 +318,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       }
     }
 
-    // Forward sorted_by flags, mapping column ids
-    const auto& sorted_by = input_chunk->individually_sorted_by();
-    if (!sorted_by.empty()) {
-      std::vector<SortColumnDefinition> transformed;
-      transformed.reserve(sorted_by.size());
-
-      // We need to iterate both sorted information and the output/input mapping as multiple output columns might
-      // originate from the same sorted input column.
-      for (const auto& [output_column_id, input_column_id] : output_column_to_input_column) {
-        const auto iter =
-            std::find_if(sorted_by.begin(), sorted_by.end(), [input_column_id = input_column_id](const auto sort) {
-              return input_column_id == sort.column;
-            });
-        if (iter != sorted_by.end()) {
-          transformed.emplace_back(output_column_id, iter->sort_mode);
-        }
-      }
-      if (!transformed.empty()) {
-        chunk->set_individually_sorted_by(transformed);
-      }
-    }
-
+    forward_sorted_by(*input_chunk, *chunk, output_column_to_input_column);
     output_chunks[chunk_id] = chunk;
   }
 
@@ -306,6 +328,124 @@ std::shared_ptr<const Table> Projection::_on_execute() {
                                  input_table.uses_mvcc());
 }
 
+PipelineStage Projection::pipeline_stage() const {
+  // Uncorrelated subqueries are resolved once per execution (see _search_and_register_uncorrelated_subqueries()).
+  // Projections only end pipelines as their output does not keep the columns of their input.
+  return _uncorrelated_subquery_expressions.empty() ? PipelineStage::Last : PipelineStage::None;
+}
+
+void Projection::_on_begin_pipeline(const std::shared_ptr<const Table>& input_table) {
+  DebugAssert(input_table->type() == TableType::References, "Pipelined projections expect reference morsels.");
+
+  // As the morsels are reference tables, the output types are those of case 2 and case 3 in _on_execute().
+  _pipeline_forwarded_columns = _determine_forwarded_columns(TableType::References);
+  _pipeline_output_column_to_input_column =
+      map_output_columns_to_input_columns(expressions, _pipeline_forwarded_columns);
+  const auto forwards_any_columns = std::any_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+    return expression->type == ExpressionType::PQPColumn;
+  });
+  _pipeline_output_table_type = forwards_any_columns ? TableType::References : TableType::Data;
+
+  const auto expression_count = expressions.size();
+  _pipeline_column_is_nullable = std::vector<std::atomic_bool>(expression_count);
+  auto projection_result_column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    const auto& expression = expressions[column_id];
+    if (_pipeline_forwarded_columns.contains(expression)) {
+      const auto input_column_id = static_cast<const PQPColumnExpression&>(*expression).column_id;
+      _pipeline_column_is_nullable[column_id] = input_table->column_is_nullable(input_column_id);
+    } else if (_pipeline_output_table_type == TableType::References) {
+      // The nullability of newly generated columns is only known once all morsels have been evaluated. As the
+      // projection_result_table is only accessed through the output's ReferenceSegments, its columns are simply
+      // declared nullable.
+      projection_result_column_definitions.emplace_back(expression->as_column_name(), expression->data_type(), true);
+    }
+  }
+
+  _pipeline_result_table = nullptr;
+  if (!projection_result_column_definitions.empty()) {
+    _pipeline_result_table = std::make_shared<Table>(projection_result_column_definitions, TableType::Data,
+                                                     std::nullopt, UseMvcc::No);
+  }
+}
+
+std::shared_ptr<Chunk> Projection::_on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                                      const ChunkID chunk_id) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  const auto expression_count = expressions.size();
+
+  auto output_segments = Segments{expression_count};
+  auto projection_result_segments = Segments{};
+  auto evaluator = std::optional<ExpressionEvaluator>{};
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    const auto& expression = *expressions[column_id];
+    if (_pipeline_forwarded_columns.contains(expressions[column_id])) {
+      const auto input_column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      output_segments[column_id] = input_chunk->get_segment(input_column_id);
+      continue;
+    }
+
+    if (!evaluator) {
+      evaluator.emplace(input_table, chunk_id);
+    }
+    auto output_segment = evaluator->evaluate_expression_to_segment(expression);
+    if (output_segment->is_nullable()) {
+      _pipeline_column_is_nullable[column_id] = true;
+    }
+
+    if (_pipeline_output_table_type == TableType::References) {
+      projection_result_segments.emplace_back(output_segment);
+    }
+    output_segments[column_id] = std::move(output_segment);
+  }
+
+  if (_pipeline_result_table) {
+    // Make the newly generated segments accessible through ReferenceSegments (see case 3 in _on_execute()).
+    auto result_chunk_id = ChunkID{};
+    {
+      const auto lock = std::lock_guard<std::mutex>{_pipeline_result_table_mutex};
+      _pipeline_result_table->append_chunk(projection_result_segments);
+      result_chunk_id = ChunkID{_pipeline_result_table->chunk_count() - 1};
+    }
+
+    const auto entire_chunk_pos_list = std::make_shared<EntireChunkPosList>(result_chunk_id, input_chunk->size());
+    auto projection_result_column_id = ColumnID{0};
+    for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+      if (!_pipeline_forwarded_columns.contains(expressions[column_id])) {
+        output_segments[column_id] = std::make_shared<ReferenceSegment>(
+            _pipeline_result_table, projection_result_column_id, entire_chunk_pos_list);
+        ++projection_result_column_id;
+      }
+    }
+  }
+
+  // Reference chunks neither have MVCC data nor track invalid rows, so there is nothing to forward.
+  auto chunk = std::make_shared<Chunk>(std::move(output_segments));
+  chunk->set_immutable();
+  forward_sorted_by(*input_chunk, *chunk, _pipeline_output_column_to_input_column);
+  return chunk;
+}
+
+std::shared_ptr<const Table> Projection::_on_finish_pipeline(const std::shared_ptr<const Table>& /*input_table*/,
+                                                             std::vector<std::shared_ptr<Chunk>>&& output_chunks) {
+  auto output_column_definitions = TableColumnDefinitions{};
+  const auto expression_count = expressions.size();
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    const auto& expression = *expressions[column_id];
+    output_column_definitions.emplace_back(expression.as_column_name(), expression.data_type(),
+                                           _pipeline_column_is_nullable[column_id].load());
+  }
+
+  return std::make_shared<Table>(output_column_definitions, _pipeline_output_table_type, std::move(output_chunks));
+}
+
+void Projection::_on_cleanup() {
+  _pipeline_forwarded_columns.clear();
+  _pipeline_output_column_to_input_column.clear();
+  _pipeline_column_is_nullable.clear();
+  _pipeline_result_table = nullptr;
+}
+
 // returns the singleton dummy table used for literal projections
 std::shared_ptr<Table> Projection::dummy_table() {
   static auto shared_dummy = std::make_shared<DummyTable>();
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -47,6 +49,8 @@ class Projection : public AbstractReadOnlyOperator {
 
   static std::shared_ptr<Table> dummy_table();
 
+  PipelineStage pipeline_stage() const override;
+
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
  protected:
@@ -59,7 +63,25 @@ class Projection : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
 
+  void _on_cleanup() override;
+
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& input_table) override;
+
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                            const ChunkID chunk_id) override;
+
+  std::shared_ptr<const Table> _on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                   std::vector<std::shared_ptr<Chunk>>&& output_chunks) override;
+
   ExpressionUnorderedSet _determine_forwarded_columns(const TableType table_type) const;
+
+  // State of a pipelined execution, set in _on_begin_pipeline() and shared by all morsels.
+  ExpressionUnorderedSet _pipeline_forwarded_columns;
+  std::unordered_map<ColumnID, ColumnID> _pipeline_output_column_to_input_column;
+  TableType _pipeline_output_table_type{TableType::Data};
+  std::vector<std::atomic_bool> _pipeline_column_is_nullable;
+  std::shared_ptr<Table> _pipeline_result_table;
+  std::mutex _pipeline_result_table_mutex;
 };
 
 }  // namespace hyrise
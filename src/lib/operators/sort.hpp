@@ -18,7 +18,8 @@ namespace hyrise {
 /**
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
- * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run. All sort
+ * columns are encoded into binary-comparable keys that are sorted in a single pass.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -26,6 +27,10 @@ class Sort : public AbstractReadOnlyOperator {
 
   enum class OperatorSteps : uint8_t { MaterializeSortColumns, Sort, TemporaryResultWriting, WriteOutput };
 
+  // The normalized keys of consecutive chunks are written by one job until it covers at least JOB_SPAWN_THRESHOLD
+  // rows. Groups of fewer rows (i.e., small inputs) are written directly.
+  static constexpr auto JOB_SPAWN_THRESHOLD = size_t{500};
+
   Sort(const std::shared_ptr<const AbstractOperator>& input_operator,
        const std::vector<SortColumnDefinition>& sort_definitions,
        const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE,
@@ -43,12 +48,8 @@ class Sort : public AbstractReadOnlyOperator {
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
   class SortImpl;
 
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
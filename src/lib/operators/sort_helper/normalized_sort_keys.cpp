@@ -0,0 +1,340 @@
+#include "normalized_sort_keys.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Inputs with fewer rows are sorted as a single run. Larger inputs are split into runs of at least this many rows that
+// are sorted and merged by concurrent jobs.
+constexpr auto MIN_ROWS_PER_SORT_RUN = size_t{50'000};
+
+// Number of bytes that the key of a value of type T occupies (excluding the NULL flag).
+template <typename T>
+constexpr size_t normalized_value_width() {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return NormalizedSortKeys::STRING_PREFIX_LENGTH;
+  } else {
+    return sizeof(T);
+  }
+}
+
+constexpr auto MAX_NORMALIZED_VALUE_WIDTH = std::max(
+    {normalized_value_width<int64_t>(), normalized_value_width<double>(), normalized_value_width<pmr_string>()});
+
+// Writes the NULL flag and the normalized value to `key` (see NormalizedSortKeys).
+template <typename T>
+void write_normalized_value(const T& value, const SortMode sort_mode, uint8_t* key) {
+  key[0] = 1;
+  auto* const value_key = key + 1;
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto prefix_length = std::min(value.size(), NormalizedSortKeys::STRING_PREFIX_LENGTH);
+    std::memcpy(value_key, value.data(), prefix_length);
+    std::memset(value_key + prefix_length, 0, NormalizedSortKeys::STRING_PREFIX_LENGTH - prefix_length);
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = UnsignedType{};
+    if constexpr (std::is_floating_point_v<T>) {
+      // -0.0 and 0.0 compare equal and must thus have the same key.
+      bits = std::bit_cast<UnsignedType>(value == T{0} ? T{0} : value);
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+    }
+
+    for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+      value_key[byte_index] = static_cast<uint8_t>(bits >> ((sizeof(T) - 1 - byte_index) * 8));
+    }
+  }
+
+  if (sort_mode == SortMode::Descending) {
+    for (auto byte_index = size_t{0}; byte_index < normalized_value_width<T>(); ++byte_index) {
+      value_key[byte_index] = static_cast<uint8_t>(~value_key[byte_index]);
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+NormalizedSortKeys::NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                                       const std::vector<SortColumnDefinition>& sort_definitions,
+                                       const size_t row_count)
+    : _table(table), _sort_definitions(sort_definitions) {
+  const auto sort_column_count = _sort_definitions.size();
+  _key_offsets.reserve(sort_column_count + 1);
+  _strings_by_sort_column.resize(sort_column_count);
+  _is_string_column.resize(sort_column_count);
+
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+    _key_offsets.push_back(_key_width);
+
+    const auto data_type = _table->column_data_type(_sort_definitions[sort_column_index].column);
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _key_width += 1 + normalized_value_width<ColumnDataType>();
+    });
+
+    _is_string_column[sort_column_index] = data_type == DataType::String;
+    _has_string_column |= data_type == DataType::String;
+  }
+  _key_offsets.push_back(_key_width);
+
+  resize(row_count);
+}
+
+size_t NormalizedSortKeys::size() const {
+  return _row_ids.size();
+}
+
+size_t NormalizedSortKeys::sort_column_count() const {
+  return _sort_definitions.size();
+}
+
+void NormalizedSortKeys::resize(const size_t row_count) {
+  _keys.resize(row_count * _key_width);
+  _row_ids.resize(row_count);
+
+  const auto sort_column_count = _sort_definitions.size();
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+    if (_is_string_column[sort_column_index]) {
+      _strings_by_sort_column[sort_column_index].resize(row_count);
+    }
+  }
+}
+
+void NormalizedSortKeys::write_chunk(const ChunkID chunk_id, const size_t first_row_index) {
+  const auto chunk = _table->get_chunk(chunk_id);
+  Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+  const auto chunk_size = chunk->size();
+  DebugAssert(first_row_index + chunk_size <= size(), "Chunk does not fit into the keys.");
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    _row_ids[first_row_index + chunk_offset] = RowID{chunk_id, chunk_offset};
+  }
+
+  const auto sort_column_count = _sort_definitions.size();
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+    const auto& sort_definition = _sort_definitions[sort_column_index];
+    const auto key_offset = _key_offsets[sort_column_index];
+    auto& strings = _strings_by_sort_column[sort_column_index];
+    const auto& abstract_segment = *chunk->get_segment(sort_definition.column);
+
+    resolve_data_type(_table->column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      constexpr auto KEY_WIDTH = 1 + normalized_value_width<ColumnDataType>();
+
+      segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
+        const auto row_index = first_row_index + position.chunk_offset();
+        auto* const key = &_keys[row_index * _key_width + key_offset];
+
+        if (position.is_null()) {
+          std::memset(key, 0, KEY_WIDTH);
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            strings[row_index].clear();
+          }
+          return;
+        }
+
+        write_normalized_value(position.value(), sort_definition.sort_mode, key);
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          strings[row_index] = position.value();
+        }
+      });
+    });
+  }
+}
+
+void NormalizedSortKeys::copy_row(const NormalizedSortKeys& source, const size_t source_row_index,
+                                  const size_t row_index) {
+  DebugAssert(source._key_width == _key_width, "Keys were created for different sort columns.");
+  std::memcpy(&_keys[row_index * _key_width], &source._keys[source_row_index * _key_width], _key_width);
+  _row_ids[row_index] = source._row_ids[source_row_index];
+
+  if (_has_string_column) {
+    const auto sort_column_count = _sort_definitions.size();
+    for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+      if (_is_string_column[sort_column_index]) {
+        _strings_by_sort_column[sort_column_index][row_index] =
+            source._strings_by_sort_column[sort_column_index][source_row_index];
+      }
+    }
+  }
+}
+
+bool NormalizedSortKeys::less(const size_t lhs_row_index, const NormalizedSortKeys& rhs_keys,
+                              const size_t rhs_row_index) const {
+  const auto* const lhs_key = &_keys[lhs_row_index * _key_width];
+  const auto* const rhs_key = &rhs_keys._keys[rhs_row_index * _key_width];
+  const auto& lhs_row_id = _row_ids[lhs_row_index];
+  const auto& rhs_row_id = rhs_keys._row_ids[rhs_row_index];
+
+  if (!_has_string_column) {
+    const auto result = std::memcmp(lhs_key, rhs_key, _key_width);
+    return result == 0 ? lhs_row_id < rhs_row_id : result < 0;
+  }
+
+  const auto sort_column_count = _sort_definitions.size();
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+    const auto key_offset = _key_offsets[sort_column_index];
+    const auto result =
+        std::memcmp(lhs_key + key_offset, rhs_key + key_offset, _key_offsets[sort_column_index + 1] - key_offset);
+    if (result != 0) {
+      return result < 0;
+    }
+
+    // Equal prefixes do not imply equal strings. NULLs are stored as empty strings and thus compare as equal.
+    if (_is_string_column[sort_column_index]) {
+      const auto& lhs_string = _strings_by_sort_column[sort_column_index][lhs_row_index];
+      const auto& rhs_string = rhs_keys._strings_by_sort_column[sort_column_index][rhs_row_index];
+      if (lhs_string != rhs_string) {
+        const auto ascending = _sort_definitions[sort_column_index].sort_mode == SortMode::Ascending;
+        return ascending ? lhs_string < rhs_string : lhs_string > rhs_string;
+      }
+    }
+  }
+
+  return lhs_row_id < rhs_row_id;
+}
+
+bool NormalizedSortKeys::less(const size_t lhs_row_index, const size_t rhs_row_index) const {
+  return less(lhs_row_index, *this, rhs_row_index);
+}
+
+bool NormalizedSortKeys::equal(const size_t lhs_row_index, const size_t rhs_row_index,
+                               const size_t sort_column_count) const {
+  DebugAssert(sort_column_count <= _sort_definitions.size(), "Invalid number of sort columns.");
+  const auto* const lhs_key = &_keys[lhs_row_index * _key_width];
+  const auto* const rhs_key = &_keys[rhs_row_index * _key_width];
+  if (std::memcmp(lhs_key, rhs_key, _key_offsets[sort_column_count]) != 0) {
+    return false;
+  }
+
+  if (_has_string_column) {
+    for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+      if (_is_string_column[sort_column_index] && _strings_by_sort_column[sort_column_index][lhs_row_index] !=
+                                                      _strings_by_sort_column[sort_column_index][rhs_row_index]) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+size_t NormalizedSortKeys::hash(const size_t row_index, const size_t sort_column_count) const {
+  DebugAssert(sort_column_count <= _sort_definitions.size(), "Invalid number of sort columns.");
+  // Equal strings have equal prefixes. Hashing the keys is thus sufficient.
+  const auto* const key = reinterpret_cast<const char*>(&_keys[row_index * _key_width]);
+  return std::hash<std::string_view>{}(std::string_view{key, _key_offsets[sort_column_count]});
+}
+
+// Sorts runs of row indexes with concurrent jobs and merges adjacent runs pairwise until a single run remains. As the
+// keys define a total order, neither the sort nor the merges need to be stable.
+std::vector<size_t> NormalizedSortKeys::sorted_row_indexes() const {
+  const auto row_count = size();
+  auto row_indexes = std::vector<size_t>(row_count);
+  std::iota(row_indexes.begin(), row_indexes.end(), size_t{0});
+
+  const auto less = [&](const size_t lhs, const size_t rhs) {
+    return this->less(lhs, rhs);
+  };
+
+  auto run_count = size_t{1};
+  if (Hyrise::get().is_multi_threaded()) {
+    run_count = std::clamp(row_count / MIN_ROWS_PER_SORT_RUN, size_t{1}, Hyrise::get().topology.num_cpus());
+  }
+
+  auto run_bounds = std::vector<size_t>(run_count + 1);
+  for (auto run_id = size_t{0}; run_id <= run_count; ++run_id) {
+    run_bounds[run_id] = row_count * run_id / run_count;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(run_count);
+  for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+      std::sort(row_indexes.begin() + run_bounds[run_id], row_indexes.begin() + run_bounds[run_id + 1], less);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  if (run_count == 1) {
+    return row_indexes;
+  }
+
+  auto merged_row_indexes = std::vector<size_t>(row_count);
+  while (run_bounds.size() > 2) {
+    const auto current_run_count = run_bounds.size() - 1;
+    auto merged_run_bounds = std::vector<size_t>{};
+    merged_run_bounds.reserve(current_run_count / 2 + 2);
+
+    jobs.clear();
+    for (auto run_id = size_t{0}; run_id < current_run_count; run_id += 2) {
+      // If the number of runs is odd, the last run is merged with an empty run (i.e., copied).
+      const auto begin = run_bounds[run_id];
+      const auto middle = run_bounds[run_id + 1];
+      const auto end = run_bounds[std::min(run_id + 2, current_run_count)];
+      merged_run_bounds.push_back(begin);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, begin, middle, end]() {
+        std::merge(row_indexes.begin() + begin, row_indexes.begin() + middle, row_indexes.begin() + middle,
+                   row_indexes.begin() + end, merged_row_indexes.begin() + begin, less);
+      }));
+    }
+    merged_run_bounds.push_back(row_count);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    std::swap(row_indexes, merged_row_indexes);
+    run_bounds = std::move(merged_run_bounds);
+  }
+
+  return row_indexes;
+}
+
+const RowID& NormalizedSortKeys::row_id(const size_t row_index) const {
+  return _row_ids[row_index];
+}
+
+bool NormalizedSortKeys::first_value_follows(const AllTypeVariant& value, const size_t row_index) const {
+  DebugAssert(!variant_is_null(value), "Expected non-NULL value.");
+  const auto& sort_definition = _sort_definitions.front();
+
+  auto value_key = std::array<uint8_t, 1 + MAX_NORMALIZED_VALUE_WIDTH>{};
+  resolve_data_type(_table->column_data_type(sort_definition.column), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    write_normalized_value(boost::get<ColumnDataType>(value), sort_definition.sort_mode, value_key.data());
+  });
+
+  // A string prefix that follows the row's prefix implies that the full string follows the row's full string.
+  return std::memcmp(value_key.data(), &_keys[row_index * _key_width], _key_offsets[1]) > 0;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Stores the sort columns of rows as fixed-width, binary-comparable keys. For every sort column, a key holds a NULL
+ * flag followed by the normalized value: integers are stored big-endian with a flipped sign bit, floating-point numbers
+ * additionally have all bits flipped if they are negative, and strings are stored as zero-padded prefixes. The value
+ * bytes of descending columns are inverted. Comparing two keys with memcmp thus yields the order of their rows, unless
+ * string columns share a prefix, in which case the full strings are compared. Remaining ties are broken by the rows'
+ * RowIDs, i.e., their positions in the input table.
+ *
+ * NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have a NULLS
+ * LAST mode, but never used it over multiple years. Different databases have different behaviors, and storing NULLs
+ * first even for descending orders is somewhat uncommon:
+ *   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
+ * For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
+ *
+ * Used by Sort, TopK, and WindowFunctionEvaluator. Different rows can be written concurrently.
+ */
+class NormalizedSortKeys {
+ public:
+  // Number of leading bytes of a string that are stored in its key. Strings sharing this prefix are compared by their
+  // full values.
+  static constexpr auto STRING_PREFIX_LENGTH = size_t{16};
+
+  NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                     const std::vector<SortColumnDefinition>& sort_definitions, const size_t row_count = 0);
+
+  size_t size() const;
+  size_t sort_column_count() const;
+  void resize(const size_t row_count);
+
+  // Writes the keys of all rows of the chunk to the rows starting at first_row_index.
+  void write_chunk(const ChunkID chunk_id, const size_t first_row_index);
+
+  // Copies a row of keys that were created for the same table and sort definitions.
+  void copy_row(const NormalizedSortKeys& source, const size_t source_row_index, const size_t row_index);
+
+  // Returns whether the row at lhs_row_index precedes the row of rhs_keys at rhs_row_index.
+  bool less(const size_t lhs_row_index, const NormalizedSortKeys& rhs_keys, const size_t rhs_row_index) const;
+  bool less(const size_t lhs_row_index, const size_t rhs_row_index) const;
+
+  // Returns whether both rows hold the same values in the first sort_column_count sort columns. NULLs are equal.
+  bool equal(const size_t lhs_row_index, const size_t rhs_row_index, const size_t sort_column_count) const;
+
+  // Hashes the keys of the first sort_column_count sort columns. Rows that are equal in these columns have equal hashes.
+  size_t hash(const size_t row_index, const size_t sort_column_count) const;
+
+  // Returns the indexes of all rows in sorted order. Larger inputs are sorted by a parallel merge sort.
+  std::vector<size_t> sorted_row_indexes() const;
+
+  const RowID& row_id(const size_t row_index) const;
+
+  // Returns whether every row whose first sort column holds the (non-NULL) value comes after the row at row_index.
+  bool first_value_follows(const AllTypeVariant& value, const size_t row_index) const;
+
+ private:
+  std::shared_ptr<const Table> _table;
+  std::vector<SortColumnDefinition> _sort_definitions;
+
+  // Byte offset of each sort column's NULL flag within a key. The last entry holds the key width.
+  std::vector<size_t> _key_offsets;
+  size_t _key_width{0};
+
+  // Keys of all rows, stored consecutively.
+  std::vector<uint8_t> _keys;
+  std::vector<RowID> _row_ids;
+
+  // Full values of string sort columns to break ties between equal prefixes. Empty for other columns.
+  std::vector<std::vector<pmr_string>> _strings_by_sort_column;
+  std::vector<bool> _is_string_column;
+  bool _has_string_column{false};
+};
+
+}  // namespace hyrise
@@ -0,0 +1,281 @@
+#include "sort_output_writing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/base_segment_accessor.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Ceiling of integer division
+size_t div_ceil(const size_t lhs, const ChunkOffset rhs) {
+  DebugAssert(rhs > 0, "Divisor must be larger than 0.");
+  return (lhs + rhs - 1u) / rhs;
+}
+
+
+// Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
+// creating chunks of output_chunk_size rows at maximum.
+std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
+                                                       RowIDPosList pos_list, const ChunkOffset output_chunk_size) {
+  // First, we create a new table as the output
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
+
+  // After we created the output table and initialized the column structure, we can start adding values. Because the
+  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead, every output chunk is
+  // written by a separate job that copies the values of its rows column by column.
+
+  const auto row_count = pos_list.size();
+  const auto output_chunk_count = div_ceil(row_count, output_chunk_size);
+  Assert(row_count == unsorted_table->row_count(), "Mismatching size of input table and PosList");
+
+  const auto input_chunk_count = unsorted_table->chunk_count();
+  const auto output_column_count = unsorted_table->column_count();
+
+  // Vector of segments for each chunk
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(output_column_count));
+
+  const auto write_output_chunk = [&](const ChunkID output_chunk_id) {
+    const auto begin_row_index = static_cast<size_t>(output_chunk_id) * output_chunk_size;
+    const auto end_row_index = std::min(begin_row_index + output_chunk_size, row_count);
+    auto& output_segments = output_segments_by_chunk[output_chunk_id];
+
+    for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
+      const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
+
+      resolve_data_type(output->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto value_segment_value_vector = pmr_vector<ColumnDataType>{};
+        auto value_segment_null_vector = pmr_vector<bool>{};
+        value_segment_value_vector.reserve(end_row_index - begin_row_index);
+        if (column_is_nullable) {
+          value_segment_null_vector.reserve(end_row_index - begin_row_index);
+        }
+
+        // Segment accessors cache state and cannot be shared between jobs. Each job creates the accessors for the
+        // input chunks that its rows stem from.
+        auto accessor_by_chunk_id =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+
+        for (auto row_index = begin_row_index; row_index < end_row_index; ++row_index) {
+          const auto [chunk_id, chunk_offset] = pos_list[row_index];
+
+          auto& accessor = accessor_by_chunk_id[chunk_id];
+          if (!accessor) {
+            const auto& abstract_segment = unsorted_table->get_chunk(chunk_id)->get_segment(column_id);
+            accessor = create_segment_accessor<ColumnDataType>(abstract_segment);
+          }
+          const auto typed_value = accessor->access(chunk_offset);
+          const auto is_null = !typed_value;
+          value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
+          if (column_is_nullable) {
+            value_segment_null_vector.push_back(is_null);
+          }
+        }
+
+        if (column_is_nullable) {
+          output_segments[column_id] = std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(value_segment_value_vector), std::move(value_segment_null_vector));
+        } else {
+          output_segments[column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
+        }
+      });
+    }
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output_chunk_count);
+  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_id]() {
+      write_output_chunk(output_chunk_id);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto& segments : output_segments_by_chunk) {
+    output->append_chunk(segments);
+  }
+
+  return output;
+}
+
+// Given an unsorted_table and an input_pos_list that defines the output order, this writes the output table as a
+// reference table. This is usually faster, but can only be done if a single column in the input table does not
+// reference multiple tables. An example where this restriction applies is the sorted result of a union between two
+// tables. The restriction is needed because a ReferenceSegment can only reference a single table. It does, however,
+// not necessarily apply to joined tables, so two tables referenced in different columns is fine.
+//
+// If unsorted_table is of TableType::Data, this is trivial and the input_pos_list is used to create the output
+// reference table. If the input is already a reference table, the double indirection needs to be resolved.
+std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const Table>& unsorted_table,
+                                                    RowIDPosList input_pos_list, const ChunkOffset output_chunk_size) {
+  // First we create a new table as the output
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  auto output_table = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::References);
+
+  const auto resolve_indirection = unsorted_table->type() == TableType::References;
+  const auto column_count = output_table->column_count();
+
+  const auto input_pos_list_size = input_pos_list.size();
+  const auto output_chunk_count = div_ceil(input_pos_list_size, output_chunk_size);
+  Assert(input_pos_list_size == unsorted_table->row_count(), "Mismatching size of input table and PosList");
+
+  // Vector of segments for each chunk
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
+
+  if (!resolve_indirection && input_pos_list_size <= output_chunk_size) {
+    // Shortcut: No need to copy RowIDs if input_pos_list is small enough and we do not need to resolve the indirection.
+    const auto output_pos_list = std::make_shared<RowIDPosList>(std::move(input_pos_list));
+    auto& output_segments = output_segments_by_chunk.at(0);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
+    }
+  } else {
+    // Collect the input segments and the referenced table and column of each column.
+    const auto input_chunk_count = unsorted_table->chunk_count();
+    auto input_segments_by_column = std::vector<std::vector<std::shared_ptr<AbstractSegment>>>(column_count);
+    auto referenced_tables = std::vector<std::shared_ptr<const Table>>(column_count, unsorted_table);
+    auto referenced_column_ids = std::vector<ColumnID>(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      referenced_column_ids[column_id] = column_id;
+      if (!resolve_indirection) {
+        continue;
+      }
+
+      auto& input_segments = input_segments_by_column[column_id];
+      input_segments.resize(input_chunk_count);
+      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+        input_segments[input_chunk_id] = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
+      }
+
+      const auto& first_reference_segment = static_cast<const ReferenceSegment&>(*input_segments.at(0));
+      referenced_tables[column_id] = first_reference_segment.referenced_table();
+      referenced_column_ids[column_id] = first_reference_segment.referenced_column_id();
+    }
+
+    // Every output chunk is written by a separate job. If the input is a data table, all columns of an output chunk
+    // share one PosList. Otherwise, we write the output ReferenceSegments column by column. This means that even if
+    // input ReferenceSegments share a PosList, the output will contain independent PosLists. While this is slightly
+    // more expensive to generate and slightly less efficient for following operators, we assume that the lion's share
+    // of the work has been done before the Sort operator is executed and that the relative cost of this is acceptable.
+    // In the future, this could be improved.
+    const auto write_output_chunk = [&](const ChunkID output_chunk_id) {
+      const auto begin_offset = static_cast<size_t>(output_chunk_id) * output_chunk_size;
+      const auto end_offset = std::min(begin_offset + output_chunk_size, input_pos_list_size);
+      auto& output_segments = output_segments_by_chunk[output_chunk_id];
+
+      if (!resolve_indirection) {
+        const auto output_pos_list = std::make_shared<RowIDPosList>(input_pos_list.begin() + begin_offset,
+                                                                    input_pos_list.begin() + end_offset);
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
+        }
+        return;
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& input_segments = input_segments_by_column[column_id];
+        const auto& referenced_table = referenced_tables[column_id];
+        const auto referenced_column_id = referenced_column_ids[column_id];
+
+        // Dereference the rows of the sorted input pos list.
+        const auto output_pos_list = std::make_shared<RowIDPosList>();
+        output_pos_list->reserve(end_offset - begin_offset);
+        for (auto input_pos_list_offset = begin_offset; input_pos_list_offset < end_offset; ++input_pos_list_offset) {
+          const auto& row_id = input_pos_list[input_pos_list_offset];
+          const auto& input_reference_segment = static_cast<ReferenceSegment&>(*input_segments[row_id.chunk_id]);
+          DebugAssert(input_reference_segment.referenced_table() == referenced_table,
+                      "Input column references more than one table");
+          DebugAssert(input_reference_segment.referenced_column_id() == referenced_column_id,
+                      "Input column references more than one column");
+          const auto& input_reference_pos_list = input_reference_segment.pos_list();
+          output_pos_list->emplace_back((*input_reference_pos_list)[row_id.chunk_offset]);
+        }
+
+        output_segments[column_id] =
+            std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list);
+      }
+    };
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(output_chunk_count);
+    for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_id]() {
+        write_output_chunk(output_chunk_id);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  for (auto& segments : output_segments_by_chunk) {
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::shared_ptr<Table> write_sorted_output_table(const std::shared_ptr<const Table>& unsorted_table,
+                                                 RowIDPosList pos_list, const ChunkOffset output_chunk_size,
+                                                 const bool force_materialization) {
+  // Cases (b) and (c) can only occur if there is more than one ReferenceSegment in an input chunk.
+  auto must_materialize = force_materialization;
+  const auto input_chunk_count = unsorted_table->chunk_count();
+  if (!must_materialize && unsorted_table->type() == TableType::References && input_chunk_count > 1) {
+    const auto input_column_count = unsorted_table->column_count();
+
+    for (auto input_column_id = ColumnID{0}; input_column_id < input_column_count; ++input_column_id) {
+      const auto& first_segment = unsorted_table->get_chunk(ChunkID{0})->get_segment(input_column_id);
+      const auto& first_reference_segment = static_cast<ReferenceSegment&>(*first_segment);
+
+      const auto& common_referenced_table = first_reference_segment.referenced_table();
+      const auto& common_referenced_column_id = first_reference_segment.referenced_column_id();
+
+      for (auto input_chunk_id = ChunkID{1}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+        const auto& segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(input_column_id);
+        const auto& referenced_table = static_cast<ReferenceSegment&>(*segment).referenced_table();
+        const auto& referenced_column_id = static_cast<ReferenceSegment&>(*segment).referenced_column_id();
+
+        if (common_referenced_table != referenced_table || common_referenced_column_id != referenced_column_id) {
+          must_materialize = true;
+          break;
+        }
+      }
+      if (must_materialize) {
+        break;
+      }
+    }
+  }
+
+  if (must_materialize) {
+    return write_materialized_output_table(unsorted_table, std::move(pos_list), output_chunk_size);
+  }
+
+  return write_reference_output_table(unsorted_table, std::move(pos_list), output_chunk_size);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Writes the rows of unsorted_table in the order defined by pos_list, which points into unsorted_table (i.e., possibly
+ * to its ReferenceSegments), to chunks of output_chunk_size rows at maximum. Each output chunk is written by a separate
+ * job. Used by Sort and TopK.
+ *
+ * The output is a reference table unless we have to materialize it (i.e., write ValueSegments) because
+ *  (a) it is requested by the caller,
+ *  (b) a column in the table references multiple tables (see write_reference_output_table for details), or
+ *  (c) a column in the table references multiple columns in the same table (which is an unlikely edge case).
+ */
+std::shared_ptr<Table> write_sorted_output_table(const std::shared_ptr<const Table>& unsorted_table,
+                                                 RowIDPosList pos_list, const ChunkOffset output_chunk_size,
+                                                 const bool force_materialization);
+
+}  // namespace hyrise
@@ -20,6 +20,7 @@
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
@@ -30,6 +31,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -41,6 +43,7 @@
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
+#include "table_scan/multi_predicate_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
@@ -130,104 +133,21 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     const auto& chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) {
+    auto perform_table_scan = [this, chunk_id, &in_table, &output_mutex, &output_chunks]() {
+      auto chunk = _scan_chunk(*_impl, in_table, chunk_id);
+      if (!chunk) {
         return;
       }
 
-      const auto column_count = in_table->column_count();
-      auto out_segments = Segments{};
-      out_segments.reserve(column_count);
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
-       */
-      auto keep_chunk_sort_order = true;
-      if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
-          // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
-          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-            out_segments.emplace_back(segment_in);
-          }
-        } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-
-            auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-            DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-            const auto pos_list_in = ref_segment_in->pos_list();
-
-            const auto table_out = ref_segment_in->referenced_table();
-            const auto column_id_out = ref_segment_in->referenced_column_id();
-
-            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-            if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              auto offset = size_t{0};
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
-            }
-
-            const auto ref_segment_out =
-                std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-            out_segments.push_back(ref_segment_out);
-          }
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
-
-        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-          const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      }
-
-      const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
-      chunk->set_immutable();
-      if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
-        chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
-      }
       const auto lock = std::lock_guard<std::mutex>{output_mutex};
-      output_chunks.emplace_back(chunk);
+      output_chunks.emplace_back(std::move(chunk));
     };
     // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
     // time to find the value which gives the best performance.
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_table_scan);
+      job_task->set_preferred_node_id(chunk_in->numa_node_id());
       jobs.push_back(job_task);
     } else {
       perform_table_scan();
@@ -236,14 +156,117 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-  auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
-  scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
-  scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
-  scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
-
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+std::shared_ptr<Chunk> TableScan::_scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                              const ChunkID chunk_id) const {
+  const auto& chunk_in = in_table->get_chunk(chunk_id);
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(in_table, chunk_id);
+  if (matches_out->empty()) {
+    return nullptr;
+  }
+
+  const auto column_count = in_table->column_count();
+  auto out_segments = Segments{};
+  out_segments.reserve(column_count);
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
+   * the matches to construct the reference segments of the output. If it is a reference segment, we need to
+   * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
+   * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
+   * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
+   * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
+   * share their position list).
+   */
+  auto keep_chunk_sort_order = true;
+  if (in_table->type() == TableType::References) {
+    if (matches_out->size() == chunk_in->size()) {
+      // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+        out_segments.emplace_back(segment_in);
+      }
+    } else {
+      auto filtered_pos_lists =
+          std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          if (pos_list_in->references_single_chunk()) {
+            // The filtered positions still reference a single chunk, so storing their ChunkOffsets suffices.
+            auto chunk_offsets = ChunkOffsetPosList::Vector(matches_out->size());
+            auto offset = size_t{0};
+            for (const auto& match : *matches_out) {
+              chunk_offsets[offset] = (*pos_list_in)[match.chunk_offset].chunk_offset;
+              ++offset;
+            }
+            filtered_pos_list =
+                std::make_shared<const ChunkOffsetPosList>(pos_list_in->common_chunk_id(), std::move(chunk_offsets));
+          } else {
+            // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+            // reason is that several table scan implementations split the pos lists by chunks (see
+            // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+            // this does not affect all scan implementations, we chose the safe and defensive path for now.
+            keep_chunk_sort_order = false;
+
+            auto row_ids = std::make_shared<RowIDPosList>(matches_out->size());
+            auto offset = size_t{0};
+            for (const auto& match : *matches_out) {
+              (*row_ids)[offset] = (*pos_list_in)[match.chunk_offset];
+              ++offset;
+            }
+            filtered_pos_list = row_ids;
+          }
+        }
+
+        const auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    }
+  } else {
+    // If the entire chunk is matched, create an EntireChunkPosList instead. Otherwise, all matches reference this
+    // chunk and we only keep their ChunkOffsets, which halves the memory that the following operators read.
+    auto output_pos_list = std::shared_ptr<const AbstractPosList>{};
+    if (matches_out->size() == chunk_in->size()) {
+      output_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+    } else {
+      auto chunk_offsets = ChunkOffsetPosList::Vector(matches_out->size());
+      std::transform(matches_out->cbegin(), matches_out->cend(), chunk_offsets.begin(), [](const auto& row_id) {
+        return row_id.chunk_offset;
+      });
+      output_pos_list = std::make_shared<ChunkOffsetPosList>(chunk_id, std::move(chunk_offsets));
+    }
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+  chunk->set_immutable();
+  if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
+    chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+  }
+  return chunk;
+}
+
 std::shared_ptr<const AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     const std::shared_ptr<const AbstractExpression>& predicate) {
   /**
@@ -315,6 +338,10 @@ std::shared_ptr<const AbstractExpression> TableScan::_resolve_uncorrelated_subqu
 }
 
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
+  return _create_impl(left_input_table());
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(const std::shared_ptr<const Table>& in_table) {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -329,6 +356,16 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
 
   const auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
 
+  if (auto impl = _create_dedicated_impl(in_table, resolved_predicate)) {
+    return impl;
+  }
+
+  // Predicate pattern: Everything else. Fall back to ExpressionEvaluator.
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate);
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_dedicated_impl(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const AbstractExpression>& resolved_predicate) {
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<const BinaryPredicateExpression>(resolved_predicate)) {
     auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -376,23 +413,23 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column of type string> LIKE <value of type string>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnLikeTableScanImpl>(in_table, left_column_expression->column_id,
                                                        predicate_condition, boost::get<pmr_string>(*right_value));
     }
 
     // Predicate pattern: <column of type T> <binary predicate_condition> <value of type T>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, left_column_expression->column_id,
                                                           predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), right_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, right_column_expression->column_id,
                                                           flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                            predicate_condition, right_column_expression->column_id);
     }
   }
@@ -401,7 +438,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnIsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                          is_null_expression->predicate_condition);
     }
   }
@@ -445,16 +482,89 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column of type T> BETWEEN <value of type T> AND <value of type T>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(left_input_table(), left_column->column_id,
+      return std::make_unique<ColumnBetweenTableScanImpl>(in_table, left_column->column_id,
                                                           *lower_bound_value, *upper_bound_value, predicate_condition);
     }
   }
 
-  // Predicate pattern: Everything else. Fall back to ExpressionEvaluator.
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(left_input_table(), resolved_predicate);
+  // Predicate pattern: <predicate> AND/OR <predicate> [AND/OR ...], where each predicate has a dedicated scan
+  // implementation. Uncorrelated subqueries are only resolved for top-level predicates (see
+  // _resolve_uncorrelated_subqueries()), so we leave predicates that contain them to the ExpressionEvaluator.
+  if (const auto logical_expression = std::dynamic_pointer_cast<const LogicalExpression>(resolved_predicate);
+      logical_expression && _uncorrelated_subquery_expressions.empty()) {
+    auto operands = std::vector<std::shared_ptr<const AbstractExpression>>{};
+    auto pending_expressions = std::vector<std::shared_ptr<const AbstractExpression>>{logical_expression};
+    while (!pending_expressions.empty()) {
+      const auto expression = pending_expressions.back();
+      pending_expressions.pop_back();
+      const auto nested_logical_expression = std::dynamic_pointer_cast<const LogicalExpression>(expression);
+      if (nested_logical_expression &&
+          nested_logical_expression->logical_operator == logical_expression->logical_operator) {
+        pending_expressions.emplace_back(nested_logical_expression->right_operand());
+        pending_expressions.emplace_back(nested_logical_expression->left_operand());
+      } else {
+        operands.emplace_back(expression);
+      }
+    }
+
+    auto predicate_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    predicate_impls.reserve(operands.size());
+    for (const auto& operand : operands) {
+      auto predicate_impl = _create_dedicated_impl(in_table, operand);
+      if (!predicate_impl) {
+        return nullptr;
+      }
+      predicate_impls.emplace_back(std::move(predicate_impl));
+    }
+
+    return std::make_unique<MultiPredicateTableScanImpl>(in_table, logical_expression->logical_operator,
+                                                         std::move(predicate_impls));
+  }
+
+  return nullptr;
+}
+
+PipelineStage TableScan::pipeline_stage() const {
+  // Uncorrelated subqueries are resolved once per execution and excluded chunks refer to the chunks of the actual input
+  // table. Neither fits the per-morsel execution.
+  if (!_uncorrelated_subquery_expressions.empty() || !excluded_chunk_ids->empty()) {
+    return PipelineStage::None;
+  }
+  return PipelineStage::Any;
+}
+
+void TableScan::_on_begin_pipeline(const std::shared_ptr<const Table>& input_table) {
+  // A single impl scans all morsels, even if they are tables of their own (see AbstractTableScanImpl::scan_chunk()).
+  // Thus, LikeMatchers and regexes are built only once, and MultiPredicateTableScanImpls order their predicates based
+  // on all morsels.
+  _impl = _create_impl(input_table);
+  _impl_description = _impl->description();
+}
+
+std::shared_ptr<Chunk> TableScan::_on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                                     const ChunkID chunk_id) {
+  return _scan_chunk(*_impl, input_table, chunk_id);
+}
+
+std::shared_ptr<const Table> TableScan::_on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                            std::vector<std::shared_ptr<Chunk>>&& output_chunks) {
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+void TableScan::_add_impl_statistics(const AbstractTableScanImpl& impl) {
+  auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+  scan_performance_data.num_chunks_with_early_out += impl.num_chunks_with_early_out.load();
+  scan_performance_data.num_chunks_with_all_rows_matching += impl.num_chunks_with_all_rows_matching.load();
+  scan_performance_data.num_chunks_with_binary_search += impl.num_chunks_with_binary_search.load();
 }
 
 void TableScan::_on_cleanup() {
+  // Fused inputs of a pipeline are cleaned up without being finished, so the statistics of the _impl are collected
+  // here.
+  if (_impl) {
+    _add_impl_statistics(*_impl);
+  }
+
   _impl.reset();
 }
 
@@ -53,6 +53,8 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<std::vector<ChunkID>> excluded_chunk_ids;
 
+  PipelineStage pipeline_stage() const override;
+
   struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
     std::atomic_size_t num_chunks_with_early_out{0};
     std::atomic_size_t num_chunks_with_all_rows_matching{0};
@@ -81,12 +83,35 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& input_table) override;
+
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                            const ChunkID chunk_id) override;
+
+  std::shared_ptr<const Table> _on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                   std::vector<std::shared_ptr<Chunk>>&& output_chunks) override;
+
   // Turns top-level uncorrelated subqueries into their value, e.g. `a = (SELECT 123)` becomes `a = 123`. This makes it
   // easier to avoid using the more expensive ExpressionEvaluatorTableScanImpl.
   std::shared_ptr<const AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<const AbstractExpression>& predicate);
 
  private:
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(const std::shared_ptr<const Table>& in_table);
+
+  // Returns the specialized scan implementation for @param resolved_predicate, or nullptr if only the
+  // ExpressionEvaluator can handle it. Conjunctions and disjunctions of such predicates are scanned by a
+  // MultiPredicateTableScanImpl.
+  std::unique_ptr<AbstractTableScanImpl> _create_dedicated_impl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const AbstractExpression>& resolved_predicate);
+
+  // Adds the number of chunks that were handled by a shortcut of @param impl to the performance data.
+  void _add_impl_statistics(const AbstractTableScanImpl& impl);
+
+  // Scans a single chunk and returns the output chunk, or nullptr if no row matches.
+  std::shared_ptr<Chunk> _scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                     const ChunkID chunk_id) const;
+
   const std::shared_ptr<AbstractExpression> _predicate;
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
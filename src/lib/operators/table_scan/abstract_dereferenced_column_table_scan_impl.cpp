@@ -16,32 +16,34 @@ AbstractDereferencedColumnTableScanImpl::AbstractDereferencedColumnTableScanImpl
     const PredicateCondition init_predicate_condition)
     : predicate_condition(init_predicate_condition), _in_table(in_table), _column_id(column_id) {}
 
-std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(const ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
+std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(
+    const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id) {
+  const auto chunk = in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
   auto matches = std::make_shared<RowIDPosList>();
 
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
-    _scan_reference_segment(*reference_segment, chunk_id, *matches);
+    _scan_reference_segment(*reference_segment, *chunk, chunk_id, *matches);
   } else {
-    _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
+    _scan_non_reference_segment(*segment, *chunk, chunk_id, *matches, nullptr);
   }
 
   return matches;
 }
 
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
-                                                                      const ChunkID chunk_id, RowIDPosList& matches) {
+                                                                      const Chunk& chunk, const ChunkID chunk_id,
+                                                                      RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
 
   if (pos_list->references_single_chunk() && !pos_list->empty()) {
     // Fast path :)
 
-    const auto chunk = segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
-    auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
+    const auto referenced_chunk = segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+    auto referenced_segment = referenced_chunk->get_segment(segment.referenced_column_id());
 
-    _scan_non_reference_segment(*referenced_segment, chunk_id, matches, pos_list);
+    _scan_non_reference_segment(*referenced_segment, chunk, chunk_id, matches, pos_list);
 
     return;
   }
@@ -63,12 +65,12 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
       continue;
     }
 
-    const auto chunk = segment.referenced_table()->get_chunk(referenced_chunk_id);
-    auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
+    const auto referenced_chunk = segment.referenced_table()->get_chunk(referenced_chunk_id);
+    auto referenced_segment = referenced_chunk->get_segment(segment.referenced_column_id());
 
     const auto num_previous_matches = static_cast<ChunkOffset>(matches.size());
 
-    _scan_non_reference_segment(*referenced_segment, chunk_id, matches, position_filter);
+    _scan_non_reference_segment(*referenced_segment, chunk, chunk_id, matches, position_filter);
 
     const auto num_matches = static_cast<ChunkOffset>(matches.size());
 
@@ -9,6 +9,7 @@
 
 namespace hyrise {
 
+class Chunk;
 class Table;
 class ReferenceSegment;
 class AbstractSegment;
@@ -26,21 +27,25 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
   AbstractDereferencedColumnTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                           const PredicateCondition init_predicate_condition);
 
-  std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
+  std::shared_ptr<RowIDPosList> scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
 
   const PredicateCondition predicate_condition;
 
  protected:
-  void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
+  void _scan_reference_segment(const ReferenceSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
+                               RowIDPosList& matches);
 
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
   // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
-  // no option because it would break multithreading.
-  virtual void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+  // no option because it would break multithreading. @param chunk is the scanned chunk @param chunk_id, which holds
+  // @param segment or a ReferenceSegment that references it.
+  virtual void _scan_non_reference_segment(const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
                                            RowIDPosList& matches,
                                            const std::shared_ptr<const AbstractPosList>& position_filter) = 0;
 
+  // The table that the impl was created for. Its chunks are not necessarily the scanned ones (see scan_chunk()).
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
 };
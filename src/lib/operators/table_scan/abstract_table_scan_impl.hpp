@@ -9,6 +9,9 @@
 
 #include <array>
 #include <atomic>
+#include <bit>
+#include <cstdint>
+#include <vector>
 
 #include "operators/operator_performance_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -19,6 +22,8 @@
 
 namespace hyrise {
 
+class Table;
+
 /**
  * @brief the base class of all table scan impls
  */
@@ -28,7 +33,10 @@ class AbstractTableScanImpl {
 
   virtual std::string description() const = 0;
 
-  virtual std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) = 0;
+  // Scans the chunk @param chunk_id of @param in_table. @param in_table has to have the same columns as the table that
+  // the impl was created for. Thus, a single impl can scan the morsels of a pipeline, which are tables of their own.
+  virtual std::shared_ptr<RowIDPosList> scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                   const ChunkID chunk_id) = 0;
 
   std::atomic_size_t num_chunks_with_early_out{0};
   std::atomic_size_t num_chunks_with_all_rows_matching{0};
@@ -242,6 +250,21 @@ class AbstractTableScanImpl {
   }
 
   /**@}*/
+
+  // Appends a RowID for every set bit of a bitmap in which bit (chunk_offset % 64) of bitmap[chunk_offset / 64]
+  // represents the row at chunk_offset.
+  static void _append_matches_from_bitmap(const std::vector<uint64_t>& bitmap, const ChunkID chunk_id,
+                                          RowIDPosList& matches_out) {
+    const auto word_count = bitmap.size();
+    for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+      auto word = bitmap[word_idx];
+      while (word) {
+        const auto bit = static_cast<size_t>(std::countr_zero(word));
+        matches_out.emplace_back(chunk_id, static_cast<ChunkOffset>(word_idx * 64 + bit));
+        word &= word - 1;
+      }
+    }
+  }
 };
 
 }  // namespace hyrise
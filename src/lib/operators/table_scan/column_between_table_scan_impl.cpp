@@ -40,9 +40,9 @@ std::string ColumnBetweenTableScanImpl::description() const {
 }
 
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
-  const auto& chunk_sorted_by = _in_table->get_chunk(chunk_id)->individually_sorted_by();
+  const auto& chunk_sorted_by = chunk.individually_sorted_by();
 
   // Check if a sorted scan is possible for the current predicate. Do not use the sorted search for predicates on
   // pre-filtered dictionary segments with string data. In this case, the optimized _scan_dictionary_segment() path is
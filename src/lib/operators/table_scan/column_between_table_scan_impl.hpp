@@ -33,7 +33,8 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant right_value;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
+                                   RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
@@ -10,7 +10,11 @@
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/base_value_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -20,6 +24,32 @@
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns nullptr if the segment is not a FrameOfReferenceSegment or if T is not supported by FrameOfReference.
+template <typename T>
+auto as_frame_of_reference_segment(const AbstractSegment& segment) {
+  if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::type_c<T>)) {
+    return dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment);
+  } else {
+    return static_cast<const FrameOfReferenceSegment<int32_t>*>(nullptr);
+  }
+}
+
+// Returns nullptr if the segment is not an FSSTSegment or if T is not supported by FSST.
+template <typename T>
+auto as_fsst_segment(const AbstractSegment& segment) {
+  if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>, hana::type_c<T>)) {
+    return dynamic_cast<const FSSTSegment<T>*>(&segment);
+  } else {
+    return static_cast<const FSSTSegment<pmr_string>*>(nullptr);
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
 ColumnIsNullTableScanImpl::ColumnIsNullTableScanImpl(const std::shared_ptr<const Table>& in_table,
@@ -35,14 +65,14 @@ std::string ColumnIsNullTableScanImpl::description() const {
 }
 
 void ColumnIsNullTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
   resolve_data_type(segment.data_type(), [&](auto type) {
     using SegmentDataType = typename decltype(type)::type;
 
-    // The ColumnIsNullTableScan is optimized for Value, Dictionary, LZ4, and FrameofReference segments since their
-    // NULL values can be efficiently iterated through their null_values or attribute vector. RunLength segments use
-    // the _scan_generic_segment() method because their NULL values are stored in runs, making iteration less easy.
+    // The ColumnIsNullTableScan is optimized for Value, Dictionary, LZ4, FrameofReference, and FSST segments since
+    // their NULL values can be efficiently iterated through their null_values or attribute vector. RunLength segments
+    // use the _scan_generic_segment() method because their NULL values are stored in runs, making iteration less easy.
 
     if (const auto* typed_segment = dynamic_cast<const BaseValueSegment*>(&segment)) {
       _scan_typed_segment(*typed_segment, chunk_id, matches, position_filter);
@@ -50,10 +80,12 @@ void ColumnIsNullTableScanImpl::_scan_non_reference_segment(
       _scan_typed_segment(*typed_segment, chunk_id, matches, position_filter);
     } else if (const auto* typed_segment = dynamic_cast<const LZ4Segment<SegmentDataType>*>(&segment)) {
       _scan_typed_segment(*typed_segment, chunk_id, matches, position_filter);
-    } else if (const auto* typed_segment = dynamic_cast<const FrameOfReferenceSegment<int32_t>*>(&segment)) {
+    } else if (const auto* typed_segment = as_frame_of_reference_segment<SegmentDataType>(segment)) {
+      _scan_typed_segment(*typed_segment, chunk_id, matches, position_filter);
+    } else if (const auto* typed_segment = as_fsst_segment<SegmentDataType>(segment)) {
       _scan_typed_segment(*typed_segment, chunk_id, matches, position_filter);
     } else {
-      const auto& chunk_sorted_by = _in_table->get_chunk(chunk_id)->individually_sorted_by();
+      const auto& chunk_sorted_by = chunk.individually_sorted_by();
       if (!chunk_sorted_by.empty()) {
         for (const auto& sorted_by : chunk_sorted_by) {
           if (sorted_by.column == _column_id) {
@@ -134,6 +166,9 @@ void ColumnIsNullTableScanImpl::_scan_typed_segment(const BaseSegmentType& segme
     return;
   }
 
+  // NullValueVectorIterable only knows the null value vector, so we pin the segment's pages here.
+  const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+
   // TODO(anyone): Merge the first and third branch in case of harmonized null_values() interfaces.
   if constexpr (std::is_same_v<BaseSegmentType, BaseValueSegment>) {
     DebugAssert(segment.is_nullable(), "Columns that are not nullable should have been caught by edge case handling.");
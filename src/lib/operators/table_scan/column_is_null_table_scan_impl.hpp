@@ -25,7 +25,8 @@ class ColumnIsNullTableScanImpl : public AbstractDereferencedColumnTableScanImpl
   std::string description() const final;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
+                                   RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) final;
 
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
@@ -36,7 +37,7 @@ class ColumnIsNullTableScanImpl : public AbstractDereferencedColumnTableScanImpl
                                     const SortMode sorted_by) const;
 
   /**
-   * @defgroup Methods used for faster handling of value, dictionary, LZ4, and frame-of-reference segments 
+   * @defgroup Methods used for faster handling of value, dictionary, LZ4, frame-of-reference, and FSST segments
    * @{
    */
 
@@ -1,23 +1,51 @@
 #include "column_like_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_access_counter.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/compressed_vector_scan.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+std::optional<pmr_string> prefix_of_pattern(const pmr_string& pattern) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  if (tokens.size() == 2 && std::holds_alternative<pmr_string>(tokens[0]) &&
+      tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars}) {
+    return std::get<pmr_string>(tokens[0]);
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
@@ -25,6 +53,7 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
+      _prefix{prefix_of_pattern(pattern)},
       _invert_results(predicate_condition == PredicateCondition::NotLike) {}
 
 std::string ColumnLikeTableScanImpl::description() const {
@@ -32,7 +61,7 @@ std::string ColumnLikeTableScanImpl::description() const {
 }
 
 void ColumnLikeTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const Chunk& /*chunk*/, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
   // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
   // input rows, use an optimized implementation.
@@ -40,6 +69,9 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+             !position_filter && _prefix && encoded_segment && encoded_segment->encoding_type() == EncodingType::FSST) {
+    _scan_fsst_segment_with_prefix(static_cast<const FSSTSegment<pmr_string>&>(segment), chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -78,12 +110,19 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   // position_filter), this optimization is detrimental. See caller for that case.
   std::pair<size_t, std::vector<bool>> result;
 
-  if (segment.encoding_type() == EncodingType::Dictionary) {
-    const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
-  } else {
-    const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+  {
+    // The dictionary is read directly. Thus, the segment's pages are pinned while it is matched.
+    const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+    if (segment.encoding_type() == EncodingType::Dictionary) {
+      const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
+      result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    } else if (segment.encoding_type() == EncodingType::FSSTDictionary) {
+      const auto& typed_segment = static_cast<const FSSTDictionarySegment<pmr_string>&>(segment);
+      result = _find_matches_in_dictionary(*typed_segment.fsst_dictionary());
+    } else {
+      const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
+      result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+    }
   }
 
   const auto& match_count = result.first;
@@ -118,6 +157,60 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment_with_prefix(const FSSTSegment<pmr_string>& segment,
+                                                             const ChunkID chunk_id, RowIDPosList& matches) const {
+  constexpr auto BLOCK_SIZE = size_t{2048};
+
+  const auto segment_size = static_cast<size_t>(segment.size());
+  const auto& strings = *segment.strings();
+  const auto& symbol_table = strings.symbol_table();
+  auto bitmap = std::vector<uint64_t>((segment_size + 63) / 64);
+
+  {
+    // The symbol table, the codes, and the NULL flags are all stored in the segment's pages.
+    const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+
+    // All strings starting with the prefix start with the codes of the compressed prefix (see FSSTSymbolTable). Only
+    // the codes of the remaining bytes (less than FSSTSymbolTable::MAX_SYMBOL_LENGTH) are decompressed and compared.
+    auto compressed_prefix = std::string{};
+    const auto compressed_prefix_length = symbol_table.compress_prefix(*_prefix, compressed_prefix);
+    const auto prefix_remainder = std::string_view{*_prefix}.substr(compressed_prefix_length);
+
+    const auto* const compressed_data = strings.compressed_data().data();
+
+    // The codes of a row end where the codes of the next row begin. Thus, one more offset than rows is unpacked.
+    auto offsets = std::array<uint32_t, BLOCK_SIZE + 1>{};
+    for (auto block_begin = size_t{0}; block_begin < segment_size; block_begin += BLOCK_SIZE) {
+      const auto count = std::min(BLOCK_SIZE, segment_size - block_begin);
+      decompress_block(strings.offsets(), block_begin, count + 1, offsets.data());
+
+      for (auto index = size_t{0}; index < count; ++index) {
+        const auto codes = std::string_view{compressed_data + offsets[index], offsets[index + 1] - offsets[index]};
+        const auto is_match =
+            codes.substr(0, compressed_prefix.size()) == compressed_prefix &&
+            symbol_table.decompresses_with_prefix(codes.data() + compressed_prefix.size(), codes.data() + codes.size(),
+                                                  prefix_remainder);
+        if (is_match != _invert_results) {
+          const auto position = block_begin + index;
+          bitmap[position / 64] |= uint64_t{1} << (position % 64);
+        }
+      }
+    }
+
+    // NULLs are stored as empty strings and match neither LIKE nor NOT LIKE.
+    if (const auto& null_values = segment.null_values()) {
+      for (auto position = size_t{0}; position < segment_size; ++position) {
+        if ((*null_values)[position]) {
+          bitmap[position / 64] &= ~(uint64_t{1} << (position % 64));
+        }
+      }
+    }
+  }
+
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+  _append_matches_from_bitmap(bitmap, chunk_id, matches);
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -11,6 +12,7 @@
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "expression/evaluation/like_matcher.hpp"
+#include "storage/fsst_segment.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -25,6 +27,8 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments and prefix patterns (e.g., 'abc%'), we compare the compressed codes of each row to the
+ *   compressed prefix and only decompress the codes of the prefix's last bytes.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -37,13 +41,16 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   std::string description() const override;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
+                                   RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment_with_prefix(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                      RowIDPosList& matches) const;
 
   /**
    * Used for dictionary segments
@@ -54,6 +61,9 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   const LikeMatcher _matcher;
 
+  // The prefix of patterns like 'abc%', which FSST segments evaluate on the compressed strings. Unset otherwise.
+  const std::optional<pmr_string> _prefix;
+
   // For NOT LIKE support
   const bool _invert_results;
 };
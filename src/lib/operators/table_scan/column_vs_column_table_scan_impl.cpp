@@ -20,12 +20,11 @@
 
 namespace hyrise {
 
-ColumnVsColumnTableScanImpl::ColumnVsColumnTableScanImpl(const std::shared_ptr<const Table>& in_table,
+ColumnVsColumnTableScanImpl::ColumnVsColumnTableScanImpl(const std::shared_ptr<const Table>& /*in_table*/,
                                                          const ColumnID left_column_id,
                                                          const PredicateCondition& predicate_condition,
                                                          const ColumnID right_column_id)
-    : _in_table(in_table),
-      _left_column_id(left_column_id),
+    : _left_column_id(left_column_id),
       _predicate_condition(predicate_condition),
       _right_column_id{right_column_id} {}
 
@@ -33,8 +32,9 @@ std::string ColumnVsColumnTableScanImpl::description() const {
   return "ColumnVsColumn";
 }
 
-std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
+std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                                      const ChunkID chunk_id) {
+  const auto chunk = in_table->get_chunk(chunk_id);
   const auto left_segment = chunk->get_segment(_left_column_id);
   const auto right_segment = chunk->get_segment(_right_column_id);
 
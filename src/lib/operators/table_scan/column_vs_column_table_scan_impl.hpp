@@ -29,10 +29,10 @@ class ColumnVsColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::string description() const override;
 
-  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+  std::shared_ptr<RowIDPosList> scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
 
  private:
-  const std::shared_ptr<const Table> _in_table;
   const ColumnID _left_column_id;
   const PredicateCondition _predicate_condition;
   const ColumnID _right_column_id;
@@ -1,8 +1,12 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -10,14 +14,22 @@
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
 #include "sorted_segment_search.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_access_counter.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_scan.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -41,9 +53,9 @@ std::string ColumnVsValueTableScanImpl::description() const {
 }
 
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
-  const auto& chunk_sorted_by = _in_table->get_chunk(chunk_id)->individually_sorted_by();
+  const auto& chunk_sorted_by = chunk.individually_sorted_by();
 
   if (!chunk_sorted_by.empty()) {
     for (const auto& sorted_by : chunk_sorted_by) {
@@ -56,9 +68,32 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-  } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    return;
+  }
+
+  const auto* encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+  if (!position_filter && encoded_segment && encoded_segment->encoding_type() == EncodingType::FrameOfReference) {
+    resolve_data_type(segment.data_type(), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                hana::type_c<ColumnDataType>)) {
+        _scan_frame_of_reference_segment(static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(segment),
+                                         chunk_id, matches);
+      } else {
+        Fail("FrameOfReferenceSegment does not support data type.");
+      }
+    });
+    return;
+  }
+
+  if (!position_filter && encoded_segment && encoded_segment->encoding_type() == EncodingType::FSST &&
+      (predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(static_cast<const FSSTSegment<pmr_string>&>(segment), chunk_id, matches);
+    return;
   }
+
+  _scan_generic_segment(segment, chunk_id, matches, position_filter);
 }
 
 void ColumnVsValueTableScanImpl::_scan_generic_segment(
@@ -86,6 +121,124 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+template <typename T>
+void ColumnVsValueTableScanImpl::_scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment,
+                                                                  const ChunkID chunk_id, RowIDPosList& matches) const {
+  constexpr auto BLOCK_SIZE = size_t{FrameOfReferenceSegment<T>::block_size};
+  static_assert(BLOCK_SIZE % 64 == 0, "Blocks must cover entire bitmap words.");
+
+  const auto segment_size = static_cast<size_t>(segment.size());
+  const auto typed_value = boost::get<T>(value);
+  auto bitmap = std::vector<uint64_t>((segment_size + 63) / 64);
+
+  {
+    // The offsets, the exceptions, and the NULL flags are all stored in the segment's pages.
+    const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+
+    with_comparator(predicate_condition, [&](auto predicate_comparator) {
+      // The offsets of a block are unpacked at once, decoded with the block's frame, and compared to the search value
+      // while they are in the L1 cache. Other than for dictionary segments, the search value cannot be translated into
+      // a range of offsets: with linear frames and decimals, the offsets are not ordered like the values.
+      auto offsets = std::array<uint32_t, BLOCK_SIZE>{};
+      auto values = std::array<T, BLOCK_SIZE>{};
+      for (auto block_begin = size_t{0}; block_begin < segment_size; block_begin += BLOCK_SIZE) {
+        const auto count = std::min(BLOCK_SIZE, segment_size - block_begin);
+        decompress_block(segment.offset_values(), block_begin, count, offsets.data());
+        segment.decode_block(block_begin / BLOCK_SIZE, offsets.data(), count, values.data());
+
+        for (auto word_begin = size_t{0}; word_begin < count; word_begin += 64) {
+          const auto bit_count = std::min(size_t{64}, count - word_begin);
+          auto word = uint64_t{0};
+
+          // This empty block is used to convince clang-format to keep the pragma indented.
+          // NOLINTNEXTLINE
+          {}  // clang-format off
+          #pragma omp simd reduction(|:word)
+          // clang-format on
+          for (auto bit = size_t{0}; bit < bit_count; ++bit) {
+            word |= static_cast<uint64_t>(predicate_comparator(values[word_begin + bit], typed_value)) << bit;
+          }
+          bitmap[(block_begin + word_begin) / 64] = word;
+        }
+      }
+
+      // Exceptions were decoded from an offset of zero and are now compared with their actual values.
+      const auto& exception_positions = segment.exception_positions();
+      const auto& exception_values = segment.exception_values();
+      const auto exception_count = exception_positions.size();
+      for (auto exception_idx = size_t{0}; exception_idx < exception_count; ++exception_idx) {
+        const auto position = static_cast<size_t>(exception_positions[exception_idx]);
+        const auto mask = uint64_t{1} << (position % 64);
+        if (predicate_comparator(exception_values[exception_idx], typed_value)) {
+          bitmap[position / 64] |= mask;
+        } else {
+          bitmap[position / 64] &= ~mask;
+        }
+      }
+    });
+
+    // NULLs have been decoded as the block's minimum and never match.
+    if (const auto& null_values = segment.null_values()) {
+      for (auto position = size_t{0}; position < segment_size; ++position) {
+        if ((*null_values)[position]) {
+          bitmap[position / 64] &= ~(uint64_t{1} << (position % 64));
+        }
+      }
+    }
+  }
+
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+  _append_matches_from_bitmap(bitmap, chunk_id, matches);
+}
+
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                    RowIDPosList& matches) const {
+  constexpr auto BLOCK_SIZE = size_t{2048};
+
+  const auto segment_size = static_cast<size_t>(segment.size());
+  const auto& strings = *segment.strings();
+  auto bitmap = std::vector<uint64_t>((segment_size + 63) / 64);
+
+  {
+    // The symbol table, the codes, and the NULL flags are all stored in the segment's pages.
+    const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+
+    // FSST compresses deterministically. Hence, a string equals the search value iff their codes are equal, and the
+    // search value only needs to be compressed once.
+    auto compressed_value = std::string{};
+    strings.symbol_table().compress(boost::get<pmr_string>(value), compressed_value);
+    const auto matches_equal_codes = predicate_condition == PredicateCondition::Equals;
+    const auto* const compressed_data = strings.compressed_data().data();
+
+    // The codes of a row end where the codes of the next row begin. Thus, one more offset than rows is unpacked.
+    auto offsets = std::array<uint32_t, BLOCK_SIZE + 1>{};
+    for (auto block_begin = size_t{0}; block_begin < segment_size; block_begin += BLOCK_SIZE) {
+      const auto count = std::min(BLOCK_SIZE, segment_size - block_begin);
+      decompress_block(strings.offsets(), block_begin, count + 1, offsets.data());
+
+      for (auto index = size_t{0}; index < count; ++index) {
+        const auto codes = std::string_view{compressed_data + offsets[index], offsets[index + 1] - offsets[index]};
+        if ((codes == compressed_value) == matches_equal_codes) {
+          const auto position = block_begin + index;
+          bitmap[position / 64] |= uint64_t{1} << (position % 64);
+        }
+      }
+    }
+
+    // NULLs are stored as empty strings and never match.
+    if (const auto& null_values = segment.null_values()) {
+      for (auto position = size_t{0}; position < segment_size; ++position) {
+        if ((*null_values)[position]) {
+          bitmap[position / 64] &= ~(uint64_t{1} << (position % 64));
+        }
+      }
+    }
+  }
+
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment_size;
+  _append_matches_from_bitmap(bitmap, chunk_id, matches);
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -160,6 +313,34 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  /**
+   * Except for NotEquals, the matching value IDs form a single range. If all rows of the segment are scanned, we
+   * compare the compressed attribute vector to this range block by block and turn the resulting bitmap into matches
+   * (see compressed_vector_scan.hpp). This is considerably faster than decoding one value ID at a time through the
+   * attribute vector's iterators. NULLs (i.e., null_value_id) are never part of the range.
+   */
+  if (!position_filter && predicate_condition != PredicateCondition::NotEquals) {
+    auto lower_bound = ValueID{0};
+    auto upper_bound = search_value_id;
+    if (predicate_condition == PredicateCondition::Equals) {
+      lower_bound = search_value_id;
+      upper_bound = ValueID{search_value_id + 1};
+    } else if (predicate_condition == PredicateCondition::GreaterThan ||
+               predicate_condition == PredicateCondition::GreaterThanEquals) {
+      lower_bound = search_value_id;
+      upper_bound = segment.null_value_id();
+    }
+
+    auto bitmap = std::vector<uint64_t>{};
+    {
+      const auto pin_guard = SharedPagePinGuard{segment.buffer_pages()};
+      scan_range_to_bitmap(*segment.attribute_vector(), lower_bound, upper_bound, bitmap);
+    }
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+    _append_matches_from_bitmap(bitmap, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -9,6 +9,8 @@
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -21,6 +23,10 @@ namespace hyrise {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - Frame-of-reference segments are decoded block by block, and the values of each block are compared to the literal
+ *   while they are in the cache.
+ * - For FSST segments, (not) equals predicates compare the compressed codes of each row to the compressed search
+ *   value without decompressing the strings.
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -32,7 +38,8 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant value;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const Chunk& chunk, const ChunkID chunk_id,
+                                   RowIDPosList& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
@@ -40,6 +47,12 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  template <typename T>
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches) const;
+
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
 
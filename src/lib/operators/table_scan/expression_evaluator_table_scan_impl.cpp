@@ -11,16 +11,17 @@
 namespace hyrise {
 
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
-    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const AbstractExpression>& expression)
-    : _in_table(in_table), _expression(expression) {}
+    const std::shared_ptr<const Table>& /*in_table*/, const std::shared_ptr<const AbstractExpression>& expression)
+    : _expression(expression) {}
 
 std::string ExpressionEvaluatorTableScanImpl::description() const {
   return "ExpressionEvaluator";
 }
 
-std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
+std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(
+    const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id) {
   return std::make_shared<RowIDPosList>(
-      ExpressionEvaluator{_in_table, chunk_id}.evaluate_expression_to_pos_list(*_expression));
+      ExpressionEvaluator{in_table, chunk_id}.evaluate_expression_to_pos_list(*_expression));
 }
 
 }  // namespace hyrise
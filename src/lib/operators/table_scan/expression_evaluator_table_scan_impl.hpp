@@ -23,10 +23,10 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
                                    const std::shared_ptr<const AbstractExpression>& expression);
 
   std::string description() const override;
-  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+  std::shared_ptr<RowIDPosList> scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
 
  private:
-  std::shared_ptr<const Table> _in_table;
   std::shared_ptr<const AbstractExpression> _expression;
 };
 
@@ -0,0 +1,166 @@
+#include "multi_predicate_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/logical_expression.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+size_t word_count(const size_t row_count) {
+  return (row_count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+// The last word of a chunk's bitmap has no bits for rows that do not exist.
+uint64_t last_word_mask(const size_t row_count) {
+  const auto remainder = row_count % BITS_PER_WORD;
+  return remainder == 0 ? ~uint64_t{0} : (uint64_t{1} << remainder) - 1;
+}
+
+size_t bitmap_popcount(const MultiPredicateTableScanImpl::Bitmap& bitmap) {
+  return std::accumulate(bitmap.cbegin(), bitmap.cend(), size_t{0}, [](const auto sum, const auto word) {
+    return sum + std::popcount(word);
+  });
+}
+
+}  // namespace
+
+namespace hyrise {
+
+MultiPredicateTableScanImpl::MultiPredicateTableScanImpl(
+    const std::shared_ptr<const Table>& /*in_table*/, const LogicalOperator logical_operator,
+    std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls)
+    : _logical_operator(logical_operator),
+      _predicate_impls(std::move(predicate_impls)),
+      _predicate_statistics(_predicate_impls.size()) {
+  Assert(_predicate_impls.size() > 1, "MultiPredicateTableScanImpl requires at least two predicates.");
+}
+
+std::string MultiPredicateTableScanImpl::description() const {
+  auto stream = std::stringstream{};
+  stream << "MultiPredicate " << _logical_operator << " (";
+  for (auto predicate_idx = size_t{0}; predicate_idx < _predicate_impls.size(); ++predicate_idx) {
+    stream << (predicate_idx > 0 ? ", " : "") << _predicate_impls[predicate_idx]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<RowIDPosList> MultiPredicateTableScanImpl::scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                                      const ChunkID chunk_id) {
+  auto bitmap = Bitmap{};
+  scan_chunk_to_bitmap(in_table, chunk_id, bitmap);
+
+  auto matches = std::make_shared<RowIDPosList>();
+  matches->reserve(bitmap_popcount(bitmap));
+  _append_matches_from_bitmap(bitmap, chunk_id, *matches);
+  return matches;
+}
+
+void MultiPredicateTableScanImpl::scan_chunk_to_bitmap(const std::shared_ptr<const Table>& in_table,
+                                                       const ChunkID chunk_id, Bitmap& bitmap) {
+  const auto row_count = static_cast<size_t>(in_table->get_chunk(chunk_id)->size());
+  const auto word_count = ::word_count(row_count);
+  const auto is_conjunction = _logical_operator == LogicalOperator::And;
+
+  // A conjunction starts with all rows, a disjunction without any row.
+  bitmap.assign(word_count, is_conjunction ? ~uint64_t{0} : uint64_t{0});
+  if (is_conjunction && word_count > 0) {
+    bitmap.back() &= last_word_mask(row_count);
+  }
+
+  const auto predicate_order = this->predicate_order();
+  auto predicate_bitmap = Bitmap{};
+  for (auto order_idx = size_t{0}; order_idx < predicate_order.size(); ++order_idx) {
+    const auto predicate_idx = predicate_order[order_idx];
+    auto& predicate_impl = *_predicate_impls[predicate_idx];
+
+    if (auto* const multi_predicate_impl = dynamic_cast<MultiPredicateTableScanImpl*>(&predicate_impl)) {
+      multi_predicate_impl->scan_chunk_to_bitmap(in_table, chunk_id, predicate_bitmap);
+    } else {
+      // The matches of all scan impls are positions in the scanned chunk, even if it references another table.
+      const auto matches = predicate_impl.scan_chunk(in_table, chunk_id);
+      predicate_bitmap.assign(word_count, uint64_t{0});
+      for (const auto& match : *matches) {
+        predicate_bitmap[match.chunk_offset / BITS_PER_WORD] |= uint64_t{1} << (match.chunk_offset % BITS_PER_WORD);
+      }
+    }
+
+    auto& statistics = _predicate_statistics[predicate_idx];
+    statistics.scanned_row_count += row_count;
+    statistics.matched_row_count += bitmap_popcount(predicate_bitmap);
+
+    // Combining the bitmaps word by word is auto-vectorized.
+    if (is_conjunction) {
+      for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+        bitmap[word_idx] &= predicate_bitmap[word_idx];
+      }
+    } else {
+      for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+        bitmap[word_idx] |= predicate_bitmap[word_idx];
+      }
+    }
+
+    const auto is_last_predicate = order_idx + 1 == predicate_order.size();
+    if (is_last_predicate) {
+      break;
+    }
+
+    if (is_conjunction && std::none_of(bitmap.cbegin(), bitmap.cend(), [](const auto word) {
+          return word != 0;
+        })) {
+      ++num_chunks_with_early_out;
+      break;
+    }
+
+    if (!is_conjunction && bitmap_popcount(bitmap) == row_count) {
+      ++num_chunks_with_all_rows_matching;
+      break;
+    }
+  }
+}
+
+std::vector<size_t> MultiPredicateTableScanImpl::predicate_order() const {
+  const auto predicate_count = _predicate_impls.size();
+  auto selectivities = std::vector<double>(predicate_count, 1.0);
+  for (auto predicate_idx = size_t{0}; predicate_idx < predicate_count; ++predicate_idx) {
+    const auto& statistics = _predicate_statistics[predicate_idx];
+    const auto scanned_row_count = statistics.scanned_row_count.load();
+    if (scanned_row_count > 0) {
+      selectivities[predicate_idx] =
+          static_cast<double>(statistics.matched_row_count.load()) / static_cast<double>(scanned_row_count);
+    }
+  }
+
+  // Predicates without observations keep their position from the query plan (stable sort).
+  auto order = std::vector<size_t>(predicate_count);
+  std::iota(order.begin(), order.end(), size_t{0});
+  if (_logical_operator == LogicalOperator::And) {
+    std::stable_sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+      return selectivities[lhs] < selectivities[rhs];
+    });
+  } else {
+    std::stable_sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+      return selectivities[lhs] > selectivities[rhs];
+    });
+  }
+  return order;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+#include "expression/logical_expression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Scans a conjunction (AND) or a disjunction (OR) of predicates in a single operator. Each predicate is scanned by its
+ * dedicated AbstractTableScanImpl, and its matches are combined with the previous ones in a bitmap that holds one bit
+ * per row of the chunk. Only the final bitmap is turned into a PosList. Thus, unlike a chain of TableScans, we neither
+ * create intermediate ReferenceSegments nor dereference the matches of previous predicates.
+ *
+ * The predicates are scanned in the order of their observed selectivity: the predicate that so far removed the most
+ * rows comes first for conjunctions, the predicate that matched the most rows comes first for disjunctions. As soon as
+ * the remaining predicates cannot change the result anymore (i.e., no row is left for a conjunction or all rows match
+ * for a disjunction), they are skipped for the chunk.
+ */
+class MultiPredicateTableScanImpl : public AbstractTableScanImpl {
+ public:
+  using Bitmap = std::vector<uint64_t>;
+
+  MultiPredicateTableScanImpl(const std::shared_ptr<const Table>& in_table, const LogicalOperator logical_operator,
+                              std::vector<std::unique_ptr<AbstractTableScanImpl>>&& predicate_impls);
+
+  std::string description() const override;
+  std::shared_ptr<RowIDPosList> scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
+
+  // Sets the bits of the rows that satisfy the predicates and clears all others. Nested MultiPredicateTableScanImpls
+  // are combined via their bitmaps without creating a PosList.
+  void scan_chunk_to_bitmap(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id, Bitmap& bitmap);
+
+  // Indexes into the predicates in the order in which the next chunk will be scanned. Public for testing purposes.
+  std::vector<size_t> predicate_order() const;
+
+ private:
+  // Number of rows that were scanned and matched by a predicate, used to order the predicates.
+  struct PredicateStatistics {
+    std::atomic_uint64_t scanned_row_count{0};
+    std::atomic_uint64_t matched_row_count{0};
+  };
+
+  const LogicalOperator _logical_operator;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _predicate_impls;
+  std::vector<PredicateStatistics> _predicate_statistics;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,306 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/abstract_read_only_operator.hpp"
+#include "operators/sort_helper/normalized_sort_keys.hpp"
+#include "operators/sort_helper/sort_output_writing.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+size_t evaluate_row_count(const AbstractExpression& row_count_expression) {
+  auto row_count = size_t{};
+
+  resolve_data_type(row_count_expression.data_type(), [&](const auto data_type_t) {
+    using RowCountDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<RowCountDataType>) {
+      const auto row_count_expression_result =
+          ExpressionEvaluator{}.evaluate_expression_to_result<RowCountDataType>(row_count_expression);
+      Assert(row_count_expression_result->size() == 1, "Expected exactly one row for LIMIT.");
+      Assert(!row_count_expression_result->is_null(0), "Expected non-NULL for LIMIT.");
+
+      const auto signed_row_count = row_count_expression_result->value(0);
+      Assert(signed_row_count >= 0, "Cannot limit to a negative number of rows.");
+
+      row_count = static_cast<size_t>(signed_row_count);
+    } else {
+      Fail("Non-integral types not allowed in LIMIT.");
+    }
+  });
+
+  return row_count;
+}
+
+// Returns the first value of the chunk's segment in the given sort mode (i.e., its minimum or maximum) if pruning
+// statistics provide it. The statistics only cover non-NULL values. For ReferenceSegments that reference a single
+// chunk, the statistics of the referenced chunk are a valid bound as well.
+std::optional<AllTypeVariant> first_value_from_pruning_statistics(const Chunk& chunk, const DataType data_type,
+                                                                  const SortColumnDefinition& sort_definition) {
+  auto referenced_chunk = std::shared_ptr<const Chunk>{};
+  auto column_id = sort_definition.column;
+  const auto& segment = chunk.get_segment(column_id);
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) {
+      return std::nullopt;
+    }
+
+    referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+    column_id = reference_segment->referenced_column_id();
+  }
+
+  const auto& statistics_chunk = referenced_chunk ? *referenced_chunk : chunk;
+  const auto& pruning_statistics = statistics_chunk.pruning_statistics();
+  if (!pruning_statistics) {
+    return std::nullopt;
+  }
+
+  auto first_value = std::optional<AllTypeVariant>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto attribute_statistics = std::dynamic_pointer_cast<const AttributeStatistics<ColumnDataType>>(
+        (*pruning_statistics)[column_id]);
+    if (!attribute_statistics) {
+      return;
+    }
+
+    const auto ascending = sort_definition.sort_mode == SortMode::Ascending;
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      const auto& range_filter = attribute_statistics->range_filter;
+      if (range_filter && !range_filter->ranges.empty()) {
+        first_value = ascending ? range_filter->ranges.front().first : range_filter->ranges.back().second;
+        return;
+      }
+    }
+
+    const auto& min_max_filter = attribute_statistics->min_max_filter;
+    if (min_max_filter) {
+      first_value = ascending ? min_max_filter->min : min_max_filter->max;
+    }
+  });
+
+  return first_value;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& input_operator,
+           const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, input_operator),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion.");
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator;
+  stream << "Row count: " << _row_count_expression->as_column_name();
+  for (const auto& sort_definition : _sort_definitions) {
+    stream << separator << "Column #" << sort_definition.column << " " << sort_definition.sort_mode;
+  }
+
+  return stream.str();
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const {
+  return _sort_definitions;
+}
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const {
+  return _row_count_expression;
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy(copied_ops));
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition.");
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count.");
+  }
+
+  const auto row_count = std::min(evaluate_row_count(*_row_count_expression), input_table->row_count());
+  if (row_count == 0) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  }
+
+  // Chunks are split into one consecutive range per job.
+  const auto chunk_count = input_table->chunk_count();
+  auto range_count = size_t{1};
+  if (Hyrise::get().is_multi_threaded()) {
+    range_count = std::min(static_cast<size_t>(chunk_count), Hyrise::get().topology.num_cpus());
+  }
+
+  // A chunk can only be skipped if its pruning statistics cover all values of the first sort column, i.e., if the
+  // column does not contain NULLs, which precede all values.
+  const auto& first_sort_definition = _sort_definitions.front();
+  const auto first_data_type = input_table->column_data_type(first_sort_definition.column);
+  const auto chunks_are_prunable = !input_table->column_is_nullable(first_sort_definition.column);
+
+  // Each range keeps its best rows in a bounded max-heap of row indexes into its candidate keys. The front of the heap
+  // is the worst candidate, which is replaced by every row that precedes it once the heap is full. The candidate keys
+  // have one spare row that new rows are written to before they enter the heap.
+  auto candidates_per_range = std::vector<NormalizedSortKeys>{};
+  candidates_per_range.reserve(range_count);
+  auto heaps = std::vector<std::vector<size_t>>(range_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(range_count);
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * range_id / range_count)};
+    const auto end_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (range_id + 1) / range_count)};
+
+    auto range_row_count = size_t{0};
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      range_row_count += chunk->size();
+    }
+    const auto heap_capacity = std::min(row_count, range_row_count);
+    candidates_per_range.emplace_back(input_table, _sort_definitions, heap_capacity + 1);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id, begin_chunk_id, end_chunk_id, heap_capacity]() {
+      auto& candidates = candidates_per_range[range_id];
+      auto& heap = heaps[range_id];
+      heap.reserve(heap_capacity);
+      const auto heap_less = [&](const size_t lhs, const size_t rhs) {
+        return candidates.less(lhs, rhs);
+      };
+
+      auto chunk_keys = NormalizedSortKeys(input_table, _sort_definitions);
+      auto spare_row_index = size_t{0};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (heap.size() == row_count && chunks_are_prunable) {
+          const auto first_value = first_value_from_pruning_statistics(*chunk, first_data_type, first_sort_definition);
+          if (first_value && candidates.first_value_follows(*first_value, heap.front())) {
+            continue;
+          }
+        }
+
+        const auto chunk_size = chunk->size();
+        chunk_keys.resize(chunk_size);
+        chunk_keys.write_chunk(chunk_id, 0);
+
+        for (auto row_index = size_t{0}; row_index < chunk_size; ++row_index) {
+          if (heap.size() < row_count) {
+            candidates.copy_row(chunk_keys, row_index, spare_row_index);
+            heap.push_back(spare_row_index);
+            std::push_heap(heap.begin(), heap.end(), heap_less);
+            spare_row_index = heap.size();
+            continue;
+          }
+
+          if (!chunk_keys.less(row_index, candidates, heap.front())) {
+            continue;
+          }
+
+          std::pop_heap(heap.begin(), heap.end(), heap_less);
+          const auto replaced_row_index = heap.back();
+          candidates.copy_row(chunk_keys, row_index, spare_row_index);
+          heap.back() = spare_row_index;
+          std::push_heap(heap.begin(), heap.end(), heap_less);
+          spare_row_index = replaced_row_index;
+        }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Merge the candidates of all ranges and keep the best rows.
+  auto candidate_count = size_t{0};
+  for (const auto& heap : heaps) {
+    candidate_count += heap.size();
+  }
+
+  auto merged_candidates = NormalizedSortKeys(input_table, _sort_definitions, candidate_count);
+  auto merged_row_index = size_t{0};
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    for (const auto row_index : heaps[range_id]) {
+      merged_candidates.copy_row(candidates_per_range[range_id], row_index, merged_row_index);
+      ++merged_row_index;
+    }
+  }
+
+  auto row_indexes = std::vector<size_t>(candidate_count);
+  std::iota(row_indexes.begin(), row_indexes.end(), size_t{0});
+  std::partial_sort(row_indexes.begin(), row_indexes.begin() + static_cast<std::ptrdiff_t>(row_count),
+                    row_indexes.end(), [&](const size_t lhs, const size_t rhs) {
+                      return merged_candidates.less(lhs, rhs);
+                    });
+
+  auto pos_list = RowIDPosList(row_count);
+  for (auto output_offset = size_t{0}; output_offset < row_count; ++output_offset) {
+    pos_list[output_offset] = merged_candidates.row_id(row_indexes[output_offset]);
+  }
+
+  const auto output_table = write_sorted_output_table(input_table, std::move(pos_list), Chunk::DEFAULT_SIZE, false);
+  const auto output_chunk_count = output_table->chunk_count();
+  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    const auto& output_chunk = output_table->get_chunk(output_chunk_id);
+    output_chunk->set_immutable();
+    output_chunk->set_individually_sorted_by(first_sort_definition);
+  }
+
+  return output_table;
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+}  // namespace hyrise
@@ -14,11 +14,13 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"  // IWYU pragma: keep
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -104,21 +106,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   auto job_end_chunk_id = ChunkID{0};
   auto job_row_count = uint32_t{0};
 
-  // In some cases, we can identify a chunk as being entirely visible for the current transaction. Simply said,
-  // if the youngest row in a chunk is visible, all other rows are older and hence visible, too. This applies if
-  // (1) the chunk is immutable, i.e., no new rows can be added while this transaction is being executed,
-  // (2) all rows in the chunk have been committed (i.e., their begin_cid has been set),
-  // (3) the highest begin_cid in the chunk is lower than/equal to the snapshot_cid of the transaction
-  //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
-  // (4) no rows in the chunk have been invalidated before this transaction was started,
-  // (5) the current transaction has no in-flight deletes.
-  const auto& read_write_operators = transaction_context->read_write_operators();
-  for (const auto& read_write_operator : read_write_operators) {
-    if (read_write_operator->type() == OperatorType::Delete) {
-      _can_use_chunk_shortcut = false;
-      break;
-    }
-  }
+  _determine_chunk_shortcut(*transaction_context);
 
   while (job_end_chunk_id < chunk_count) {
     const auto chunk = input_table->get_chunk(job_end_chunk_id);
@@ -153,6 +141,54 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+PipelineStage Validate::pipeline_stage() const {
+  return PipelineStage::Any;
+}
+
+void Validate::_determine_chunk_shortcut(TransactionContext& transaction_context) {
+  // In some cases, we can identify a chunk as being entirely visible for the current transaction. Simply said,
+  // if the youngest row in a chunk is visible, all other rows are older and hence visible, too. This applies if
+  // (1) the chunk is immutable, i.e., no new rows can be added while this transaction is being executed,
+  // (2) all rows in the chunk have been committed (i.e., their begin_cid has been set),
+  // (3) the highest begin_cid in the chunk is lower than/equal to the snapshot_cid of the transaction
+  //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
+  // (4) no rows in the chunk have been invalidated before this transaction was started,
+  // (5) the current transaction has no in-flight deletes.
+  const auto& read_write_operators = transaction_context.read_write_operators();
+  for (const auto& read_write_operator : read_write_operators) {
+    if (read_write_operator->type() == OperatorType::Delete) {
+      _can_use_chunk_shortcut = false;
+      break;
+    }
+  }
+}
+
+void Validate::_on_begin_pipeline(const std::shared_ptr<const Table>& /*input_table*/) {
+  const auto transaction_context = this->transaction_context();
+  Assert(transaction_context, "Validate cannot be called without a transaction context.");
+  DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
+
+  _pipeline_transaction_id = transaction_context->transaction_id();
+  _pipeline_snapshot_commit_id = transaction_context->snapshot_commit_id();
+  _determine_chunk_shortcut(*transaction_context);
+}
+
+std::shared_ptr<Chunk> Validate::_on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id) {
+  // _validate_chunks() is shared with the regular execution, which collects the chunks of multiple jobs. A morsel is
+  // validated by a single job, so the mutex is never contended.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto output_mutex = std::mutex{};
+  _validate_chunks(input_table, chunk_id, chunk_id, _pipeline_transaction_id, _pipeline_snapshot_commit_id,
+                   output_chunks, output_mutex);
+  return output_chunks.empty() ? nullptr : output_chunks.front();
+}
+
+std::shared_ptr<const Table> Validate::_on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                           std::vector<std::shared_ptr<Chunk>>&& output_chunks) {
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
 void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
                                 const ChunkID chunk_id_end, const TransactionID our_tid,
                                 const CommitID snapshot_commit_id, std::vector<std::shared_ptr<Chunk>>& output_chunks,
@@ -207,14 +243,17 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
         } else {
-          auto temp_pos_list = RowIDPosList{};
-          temp_pos_list.guarantee_single_chunk();
-          for (const auto row_id : *pos_list_in) {
-            if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
+          // The visible rows still reference a single chunk, so we only store their ChunkOffsets.
+          auto temp_pos_list = std::make_shared<ChunkOffsetPosList>(pos_list_in->common_chunk_id());
+          temp_pos_list->reserve(pos_list_in->size());
+          resolve_pos_list_type(pos_list_in, [&](const auto& resolved_pos_list_in) {
+            for (const auto row_id : *resolved_pos_list_in) {
+              if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+                temp_pos_list->emplace_back(row_id.chunk_offset);
+              }
             }
-          }
-          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+          });
+          pos_list_out = temp_pos_list;
         }
       } else {
         // Slow path - we are looking at multiple referenced chunks and have to look at each row individually. We first
@@ -273,17 +312,16 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
-        auto temp_pos_list = RowIDPosList{};
-        temp_pos_list.reserve(expected_number_of_valid_rows);
-        temp_pos_list.guarantee_single_chunk();
+        auto temp_pos_list = std::make_shared<ChunkOffsetPosList>(chunk_id);
+        temp_pos_list->reserve(expected_number_of_valid_rows);
         // Generate pos_list_out.
         auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
           if (hyrise::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
-            temp_pos_list.emplace_back(chunk_id, chunk_offset);
+            temp_pos_list->emplace_back(chunk_offset);
           }
         }
-        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+        pos_list_out = temp_pos_list;
       }
 
       // Create actual ReferenceSegment objects.
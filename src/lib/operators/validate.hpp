@@ -11,6 +11,8 @@
 
 namespace hyrise {
 
+class TransactionContext;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -29,7 +31,12 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  PipelineStage pipeline_stage() const override;
+
  private:
+  // Determines whether _is_entire_chunk_visible() may be used by the given transaction.
+  void _determine_chunk_shortcut(TransactionContext& transaction_context);
+
   void _validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
                         const ChunkID chunk_id_end, const TransactionID our_tid, const CommitID snapshot_commit_id,
                         std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
@@ -40,6 +47,10 @@ class Validate : public AbstractReadOnlyOperator {
 
   bool _can_use_chunk_shortcut = true;
 
+  // Set in _on_begin_pipeline() for the validation of morsels.
+  TransactionID _pipeline_transaction_id{INVALID_TRANSACTION_ID};
+  CommitID _pipeline_snapshot_commit_id{MAX_COMMIT_ID};
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
@@ -48,6 +59,14 @@ class Validate : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& input_table) override;
+
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& input_table,
+                                            const ChunkID chunk_id) override;
+
+  std::shared_ptr<const Table> _on_finish_pipeline(const std::shared_ptr<const Table>& input_table,
+                                                   std::vector<std::shared_ptr<Chunk>>&& output_chunks) override;
 };
 
 }  // namespace hyrise
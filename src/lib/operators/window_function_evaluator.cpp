@@ -0,0 +1,772 @@
+#include "window_function_evaluator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
+#include "null_value.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/abstract_read_only_operator.hpp"
+#include "operators/aggregate/window_function_traits.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "operators/sort_helper/normalized_sort_keys.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Rows are distributed to buckets of at least this many rows (on average) that are sorted and evaluated by concurrent
+// jobs.
+constexpr auto MIN_ROWS_PER_BUCKET = size_t{10'000};
+
+// Compile-time counterpart of `aggregate_functions`.
+constexpr bool is_aggregate_function(const WindowFunction window_function) {
+  switch (window_function) {
+    case WindowFunction::Min:
+    case WindowFunction::Max:
+    case WindowFunction::Sum:
+    case WindowFunction::Avg:
+    case WindowFunction::Count:
+    case WindowFunction::CountDistinct:
+    case WindowFunction::StandardDeviationSample:
+    case WindowFunction::Any:
+      return true;
+    case WindowFunction::CumeDist:
+    case WindowFunction::DenseRank:
+    case WindowFunction::PercentRank:
+    case WindowFunction::Rank:
+    case WindowFunction::RowNumber:
+      return false;
+  }
+  return false;
+}
+
+bool bound_has_offset(const FrameBound& frame_bound) {
+  return !frame_bound.unbounded && frame_bound.type != FrameBoundType::CurrentRow;
+}
+
+/**
+ * Aggregate state of a frame for the aggregate window functions. MIN, MAX, and SUM hold the aggregated value, which is
+ * std::nullopt as long as there are no non-NULL values. AVG holds the sum and the number of non-NULL values. COUNT holds
+ * the number of non-NULL values (or of rows for COUNT(*)). All states are combined associatively and commutatively,
+ * which allows for both running aggregates and segment trees.
+ */
+template <typename ColumnDataType, WindowFunction window_function>
+struct WindowAggregate {
+  using ReturnType = typename WindowFunctionTraits<ColumnDataType, window_function>::ReturnType;
+  using State = std::conditional_t<
+      window_function == WindowFunction::Count, int64_t,
+      std::conditional_t<window_function == WindowFunction::Avg, std::pair<double, int64_t>, std::optional<ReturnType>>>;
+
+  static State from_value(const ColumnDataType& value) {
+    if constexpr (window_function == WindowFunction::Count) {
+      return 1;
+    } else if constexpr (window_function == WindowFunction::Avg) {
+      return {static_cast<double>(value), 1};
+    } else {
+      return static_cast<ReturnType>(value);
+    }
+  }
+
+  static State combine(const State& lhs, const State& rhs) {
+    if constexpr (window_function == WindowFunction::Count) {
+      return lhs + rhs;
+    } else if constexpr (window_function == WindowFunction::Avg) {
+      return {lhs.first + rhs.first, lhs.second + rhs.second};
+    } else {
+      if (!lhs) {
+        return rhs;
+      }
+
+      if (!rhs) {
+        return lhs;
+      }
+
+      if constexpr (window_function == WindowFunction::Min) {
+        return std::min(*lhs, *rhs);
+      } else if constexpr (window_function == WindowFunction::Max) {
+        return std::max(*lhs, *rhs);
+      } else {
+        return *lhs + *rhs;
+      }
+    }
+  }
+
+  // Writes the result of the state to value. Returns false if the result is NULL.
+  static bool write(const State& state, ReturnType& value) {
+    if constexpr (window_function == WindowFunction::Count) {
+      value = state;
+      return true;
+    } else if constexpr (window_function == WindowFunction::Avg) {
+      if (state.second == 0) {
+        return false;
+      }
+
+      value = state.first / static_cast<double>(state.second);
+      return true;
+    } else {
+      if (!state) {
+        return false;
+      }
+
+      value = *state;
+      return true;
+    }
+  }
+};
+
+/**
+ * Segment tree over the aggregate states of the rows of a partition (in sort order). The leaves hold the states of
+ * single rows, each inner node holds the combined state of its two children. The state of any frame is thus combined
+ * from O(log n) nodes, independent of the frame size.
+ */
+template <typename Aggregate>
+class SegmentTree {
+ public:
+  using State = typename Aggregate::State;
+
+  explicit SegmentTree(std::vector<State>&& leaves) : _leaf_count(leaves.size()), _nodes(2 * leaves.size()) {
+    std::move(leaves.begin(), leaves.end(), _nodes.begin() + static_cast<int64_t>(_leaf_count));
+    for (auto node = _leaf_count; node > 1;) {
+      --node;
+      _nodes[node] = Aggregate::combine(_nodes[2 * node], _nodes[2 * node + 1]);
+    }
+  }
+
+  // Returns the combined state of the leaves in [begin, end).
+  State query(size_t begin, size_t end) const {
+    auto state = State{};
+    for (begin += _leaf_count, end += _leaf_count; begin < end; begin /= 2, end /= 2) {
+      if (begin & 1u) {
+        state = Aggregate::combine(state, _nodes[begin++]);
+      }
+      if (end & 1u) {
+        state = Aggregate::combine(state, _nodes[--end]);
+      }
+    }
+    return state;
+  }
+
+ private:
+  size_t _leaf_count;
+  std::vector<State> _nodes;
+};
+
+// Rows of the input, sorted by PARTITION BY and ORDER BY columns within buckets. A partition never spans two buckets.
+struct SortedBuckets {
+  std::vector<size_t> row_indexes;
+  std::vector<size_t> bucket_bounds;
+  bool is_sorted{false};
+};
+
+/**
+ * Evaluates a window function on all partitions of the sorted buckets. The results are written to the rows' positions
+ * in the input table, i.e., values[row_index].
+ */
+template <typename ColumnDataType, WindowFunction window_function>
+class WindowFunctionEvaluation {
+ public:
+  using ReturnType = typename WindowFunctionTraits<ColumnDataType, window_function>::ReturnType;
+
+  WindowFunctionEvaluation(const NormalizedSortKeys& keys, const size_t partition_column_count,
+                           const FrameDescription& frame)
+      : values(keys.size()),
+        null_values(keys.size()),
+        _keys(keys),
+        _partition_column_count(partition_column_count),
+        _sort_column_count(keys.sort_column_count()),
+        _frame(frame) {}
+
+  void evaluate(SortedBuckets& buckets) {
+    const auto bucket_count = buckets.bucket_bounds.size() - 1;
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(bucket_count);
+    for (auto bucket_id = size_t{0}; bucket_id < bucket_count; ++bucket_id) {
+      const auto bucket_begin = buckets.row_indexes.begin() + static_cast<int64_t>(buckets.bucket_bounds[bucket_id]);
+      const auto bucket_end = buckets.row_indexes.begin() + static_cast<int64_t>(buckets.bucket_bounds[bucket_id + 1]);
+      if (bucket_begin == bucket_end) {
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, bucket_begin, bucket_end]() {
+        if (!buckets.is_sorted) {
+          std::sort(bucket_begin, bucket_end, [&](const size_t lhs, const size_t rhs) {
+            return _keys.less(lhs, rhs);
+          });
+        }
+
+        // Split the bucket into its partitions.
+        for (auto partition_begin = bucket_begin; partition_begin != bucket_end;) {
+          auto partition_end = std::next(partition_begin);
+          while (partition_end != bucket_end &&
+                 _keys.equal(*partition_begin, *partition_end, _partition_column_count)) {
+            ++partition_end;
+          }
+
+          _evaluate_partition(&*partition_begin, static_cast<size_t>(std::distance(partition_begin, partition_end)));
+          partition_begin = partition_end;
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  // Aggregate states of the rows (by row index). Only used for aggregate functions.
+  std::vector<typename WindowAggregate<ColumnDataType, window_function>::State> row_states;
+
+  // Values of the single ORDER BY column (by row index), negated for descending order. Only used for RANGE frames with
+  // offsets. We use doubles for all numeric types, which only loses precision for integers beyond 2^53.
+  std::vector<std::optional<double>> order_values;
+
+  std::vector<ReturnType> values;
+  // Not a std::vector<bool> as concurrent jobs write adjacent rows.
+  std::vector<uint8_t> null_values;
+
+ private:
+  void _evaluate_partition(const size_t* rows, const size_t row_count) {
+    if constexpr (!is_aggregate_function(window_function)) {
+      _evaluate_rank_function(rows, row_count);
+    } else {
+      _evaluate_aggregate(rows, row_count);
+    }
+  }
+
+  // Calls functor(group_begin, group_end) for every group of peers, i.e., rows that are equal in all sort columns.
+  template <typename Functor>
+  void _for_each_peer_group(const size_t* rows, const size_t row_count, const Functor& functor) const {
+    for (auto group_begin = size_t{0}; group_begin < row_count;) {
+      auto group_end = group_begin + 1;
+      while (group_end < row_count && _keys.equal(rows[group_begin], rows[group_end], _sort_column_count)) {
+        ++group_end;
+      }
+
+      functor(group_begin, group_end);
+      group_begin = group_end;
+    }
+  }
+
+  void _evaluate_rank_function(const size_t* rows, const size_t row_count) {
+    auto dense_rank = int64_t{0};
+    _for_each_peer_group(rows, row_count, [&](const size_t group_begin, const size_t group_end) {
+      ++dense_rank;
+      for (auto position = group_begin; position < group_end; ++position) {
+        auto& value = values[rows[position]];
+        if constexpr (window_function == WindowFunction::RowNumber) {
+          value = static_cast<int64_t>(position) + 1;
+        } else if constexpr (window_function == WindowFunction::Rank) {
+          value = static_cast<int64_t>(group_begin) + 1;
+        } else if constexpr (window_function == WindowFunction::DenseRank) {
+          value = dense_rank;
+        } else if constexpr (window_function == WindowFunction::PercentRank) {
+          value = row_count > 1 ? static_cast<double>(group_begin) / static_cast<double>(row_count - 1) : 0.0;
+        } else if constexpr (window_function == WindowFunction::CumeDist) {
+          value = static_cast<double>(group_end) / static_cast<double>(row_count);
+        } else {
+          Fail("Unexpected rank function.");
+        }
+      }
+    });
+  }
+
+  void _evaluate_aggregate(const size_t* rows, const size_t row_count) {
+    using Aggregate = WindowAggregate<ColumnDataType, window_function>;
+    using State = typename Aggregate::State;
+
+    // For RANGE frames, CURRENT ROW refers to the first or last peer of a row.
+    auto peer_group_begins = std::vector<size_t>{};
+    auto peer_group_ends = std::vector<size_t>{};
+    if (_frame.type == FrameType::Range) {
+      peer_group_begins.resize(row_count);
+      peer_group_ends.resize(row_count);
+      _for_each_peer_group(rows, row_count, [&](const size_t group_begin, const size_t group_end) {
+        std::fill(peer_group_begins.begin() + static_cast<int64_t>(group_begin),
+                  peer_group_begins.begin() + static_cast<int64_t>(group_end), group_begin);
+        std::fill(peer_group_ends.begin() + static_cast<int64_t>(group_begin),
+                  peer_group_ends.begin() + static_cast<int64_t>(group_end), group_end);
+      });
+    }
+
+    // For RANGE frames with offsets, the bounds are searched in the ordered values. NULLs come first.
+    auto partition_order_values = std::vector<double>{};
+    auto first_non_null_position = size_t{0};
+    if (!order_values.empty()) {
+      partition_order_values.resize(row_count);
+      for (auto position = size_t{0}; position < row_count; ++position) {
+        const auto& order_value = order_values[rows[position]];
+        if (!order_value) {
+          first_non_null_position = position + 1;
+          continue;
+        }
+        partition_order_values[position] = *order_value;
+      }
+    }
+
+    // Returns the position of a frame bound for the row at `position`. Start bounds are inclusive, end bounds
+    // exclusive.
+    const auto bound_position = [&](const FrameBound& bound, const size_t position, const bool is_start) -> size_t {
+      if (bound.unbounded) {
+        return bound.type == FrameBoundType::Preceding ? 0 : row_count;
+      }
+
+      if (_frame.type == FrameType::Rows) {
+        const auto offset = std::min(bound.offset, row_count);
+        const auto end_adjustment = is_start ? size_t{0} : size_t{1};
+        switch (bound.type) {
+          case FrameBoundType::Preceding:
+            return position + end_adjustment >= offset ? position + end_adjustment - offset : 0;
+          case FrameBoundType::CurrentRow:
+            return position + end_adjustment;
+          case FrameBoundType::Following:
+            return std::min(position + offset + end_adjustment, row_count);
+        }
+      }
+
+      // RANGE frames: NULLs are peers of each other and do not have any other rows in their frame.
+      const auto& order_value = order_values.empty() ? std::optional<double>{} : order_values[rows[position]];
+      if (bound.type == FrameBoundType::CurrentRow || !order_value) {
+        return is_start ? peer_group_begins[position] : peer_group_ends[position];
+      }
+
+      const auto offset = static_cast<double>(bound.offset);
+      const auto target = bound.type == FrameBoundType::Preceding ? *order_value - offset : *order_value + offset;
+      const auto non_null_begin = partition_order_values.begin() + static_cast<int64_t>(first_non_null_position);
+      const auto bound_iter = is_start ? std::lower_bound(non_null_begin, partition_order_values.end(), target)
+                                       : std::upper_bound(non_null_begin, partition_order_values.end(), target);
+      return static_cast<size_t>(std::distance(partition_order_values.begin(), bound_iter));
+    };
+
+    const auto write_result = [&](const size_t position, const State& state) {
+      const auto row_index = rows[position];
+      null_values[row_index] = !Aggregate::write(state, values[row_index]);
+    };
+
+    // Frames that start with the partition grow monotonically and are computed as running aggregates.
+    if (_frame.start.unbounded) {
+      auto state = State{};
+      auto aggregated_row_count = size_t{0};
+      for (auto position = size_t{0}; position < row_count; ++position) {
+        const auto frame_end = bound_position(_frame.end, position, false);
+        for (; aggregated_row_count < frame_end; ++aggregated_row_count) {
+          state = Aggregate::combine(state, row_states[rows[aggregated_row_count]]);
+        }
+        write_result(position, state);
+      }
+      return;
+    }
+
+    auto leaves = std::vector<State>(row_count);
+    for (auto position = size_t{0}; position < row_count; ++position) {
+      leaves[position] = row_states[rows[position]];
+    }
+    const auto segment_tree = SegmentTree<Aggregate>{std::move(leaves)};
+
+    for (auto position = size_t{0}; position < row_count; ++position) {
+      const auto frame_begin = bound_position(_frame.start, position, true);
+      const auto frame_end = bound_position(_frame.end, position, false);
+      write_result(position, frame_begin < frame_end ? segment_tree.query(frame_begin, frame_end) : State{});
+    }
+  }
+
+  const NormalizedSortKeys& _keys;
+  const size_t _partition_column_count;
+  const size_t _sort_column_count;
+  const FrameDescription& _frame;
+};
+
+}  // namespace
+
+namespace hyrise {
+
+WindowFunctionEvaluator::WindowFunctionEvaluator(
+    const std::shared_ptr<const AbstractOperator>& input_operator,
+    const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::WindowFunctionEvaluator, input_operator, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _window_function_expression(window_function_expression) {
+  Assert(_window_function_expression->window(), "WindowFunctionEvaluator requires a window.");
+
+  const auto column_id_of_expression = [](const AbstractExpression& expression) {
+    Assert(expression.type == ExpressionType::PQPColumn,
+           "Arguments of window functions must be computed before the WindowFunctionEvaluator.");
+    return static_cast<const PQPColumnExpression&>(expression).column_id;
+  };
+
+  const auto& argument = _window_function_expression->argument();
+  if (argument) {
+    _argument_column_id = column_id_of_expression(*argument);
+  }
+
+  const auto& window = _window();
+  const auto window_argument_count = window.arguments.size();
+  for (auto expression_idx = size_t{0}; expression_idx < window_argument_count; ++expression_idx) {
+    const auto column_id = column_id_of_expression(*window.arguments[expression_idx]);
+    if (expression_idx < window.order_by_expressions_begin_idx) {
+      _partition_by_column_ids.emplace_back(column_id);
+    } else {
+      _order_by_column_ids.emplace_back(column_id);
+    }
+  }
+}
+
+const std::string& WindowFunctionEvaluator::name() const {
+  static const auto name = std::string{"WindowFunctionEvaluator"};
+  return name;
+}
+
+std::string WindowFunctionEvaluator::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator;
+  stream << _window_function_expression->description(AbstractExpression::DescriptionMode::Detailed);
+  return stream.str();
+}
+
+std::shared_ptr<WindowFunctionExpression> WindowFunctionEvaluator::window_function_expression() const {
+  return _window_function_expression;
+}
+
+const std::vector<ColumnID>& WindowFunctionEvaluator::partition_by_column_ids() const {
+  return _partition_by_column_ids;
+}
+
+const std::vector<ColumnID>& WindowFunctionEvaluator::order_by_column_ids() const {
+  return _order_by_column_ids;
+}
+
+ColumnID WindowFunctionEvaluator::argument_column_id() const {
+  return _argument_column_id;
+}
+
+const WindowExpression& WindowFunctionEvaluator::_window() const {
+  return static_cast<const WindowExpression&>(*_window_function_expression->window());
+}
+
+std::shared_ptr<AbstractOperator> WindowFunctionEvaluator::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<WindowFunctionEvaluator>(
+      copied_left_input,
+      std::static_pointer_cast<WindowFunctionExpression>(_window_function_expression->deep_copy(copied_ops)));
+}
+
+void WindowFunctionEvaluator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> WindowFunctionEvaluator::_on_execute() {
+  const auto& input_table = left_input_table();
+  const auto window_function = _window_function_expression->window_function;
+  const auto& window = _window();
+  const auto& frame = window.frame_description;
+
+  AssertInput(window_function != WindowFunction::CountDistinct &&
+                  window_function != WindowFunction::StandardDeviationSample && window_function != WindowFunction::Any,
+              "Window function " + window_function_to_string.left.at(window_function) + " is not supported.");
+  const auto range_with_offset =
+      frame.type == FrameType::Range && (bound_has_offset(frame.start) || bound_has_offset(frame.end));
+  const auto uses_order_values = range_with_offset && is_aggregate_function(window_function);
+  if (uses_order_values) {
+    AssertInput(_order_by_column_ids.size() == 1 &&
+                    input_table->column_data_type(_order_by_column_ids.front()) != DataType::String,
+                "RANGE frames with offsets require exactly one numeric ORDER BY column.");
+  }
+
+  auto timer = Timer{};
+
+  // 1. Encode the PARTITION BY and ORDER BY columns of all rows into normalized keys. Rows are indexed by their
+  //    position in the input table.
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(_partition_by_column_ids.size() + _order_by_column_ids.size());
+  for (const auto column_id : _partition_by_column_ids) {
+    sort_definitions.emplace_back(column_id, SortMode::Ascending);
+  }
+  const auto order_by_column_count = _order_by_column_ids.size();
+  for (auto order_by_idx = size_t{0}; order_by_idx < order_by_column_count; ++order_by_idx) {
+    sort_definitions.emplace_back(_order_by_column_ids[order_by_idx], window.sort_modes[order_by_idx]);
+  }
+
+  const auto row_count = static_cast<size_t>(input_table->row_count());
+  const auto chunk_count = input_table->chunk_count();
+  auto keys = NormalizedSortKeys{input_table, sort_definitions, row_count};
+  auto chunk_first_row_indexes = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    chunk_first_row_indexes[chunk_id + 1] = chunk_first_row_indexes[chunk_id] + chunk->size();
+  }
+
+  const auto for_each_chunk_in_parallel = [&](const auto& functor) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        functor(chunk_id);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  };
+
+  for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+    keys.write_chunk(chunk_id, chunk_first_row_indexes[chunk_id]);
+  });
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::MaterializeKeys, timer.lap());
+
+  // 2. Distribute the rows to buckets by the hash of their PARTITION BY keys. Each job then sorts and evaluates one
+  //    bucket. Without PARTITION BY (or for small inputs), all rows are sorted at once.
+  const auto partition_column_count = _partition_by_column_ids.size();
+  auto bucket_count = size_t{1};
+  if (partition_column_count > 0 && Hyrise::get().is_multi_threaded()) {
+    bucket_count = std::clamp(row_count / MIN_ROWS_PER_BUCKET, size_t{1}, 4 * Hyrise::get().topology.num_cpus());
+  }
+
+  auto buckets = SortedBuckets{};
+  if (bucket_count == 1) {
+    buckets.row_indexes = keys.sorted_row_indexes();
+    buckets.bucket_bounds = {0, row_count};
+    buckets.is_sorted = true;
+  } else {
+    // Count the rows per chunk and bucket, then scatter them so that the buckets are stored consecutively.
+    auto bucket_ids = std::vector<uint32_t>(row_count);
+    auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(bucket_count));
+    for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+      auto& histogram = histograms[chunk_id];
+      for (auto row_index = chunk_first_row_indexes[chunk_id]; row_index < chunk_first_row_indexes[chunk_id + 1];
+           ++row_index) {
+        const auto bucket_id = keys.hash(row_index, partition_column_count) % bucket_count;
+        bucket_ids[row_index] = static_cast<uint32_t>(bucket_id);
+        ++histogram[bucket_id];
+      }
+    });
+
+    buckets.bucket_bounds.resize(bucket_count + 1);
+    auto write_offset = size_t{0};
+    for (auto bucket_id = size_t{0}; bucket_id < bucket_count; ++bucket_id) {
+      buckets.bucket_bounds[bucket_id] = write_offset;
+      for (auto& histogram : histograms) {
+        const auto chunk_bucket_row_count = histogram[bucket_id];
+        histogram[bucket_id] = write_offset;
+        write_offset += chunk_bucket_row_count;
+      }
+    }
+    buckets.bucket_bounds[bucket_count] = write_offset;
+
+    buckets.row_indexes.resize(row_count);
+    for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+      auto& write_offsets = histograms[chunk_id];
+      for (auto row_index = chunk_first_row_indexes[chunk_id]; row_index < chunk_first_row_indexes[chunk_id + 1];
+           ++row_index) {
+        buckets.row_indexes[write_offsets[bucket_ids[row_index]]++] = row_index;
+      }
+    });
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Partition, timer.lap());
+
+  // 3. Evaluate the window function on the buckets and write the results to new segments, one per input chunk.
+  const auto result_data_type = _window_function_expression->data_type();
+  auto result_nullable = false;
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>(chunk_count);
+
+  const auto evaluate = [&](const auto column_data_type_t, const auto window_function_t) {
+    using ColumnDataType = typename decltype(column_data_type_t)::type;
+    constexpr auto WINDOW_FUNCTION = decltype(window_function_t)::value;
+
+    if constexpr (WindowFunctionTraits<ColumnDataType, WINDOW_FUNCTION>::RESULT_TYPE == DataType::Null) {
+      FailInput("Window function " + window_function_to_string.left.at(WINDOW_FUNCTION) +
+                " is not supported on arguments of type " +
+                data_type_to_string.left.at(data_type_from_type<ColumnDataType>()) + ".");
+    } else {
+      using Evaluation = WindowFunctionEvaluation<ColumnDataType, WINDOW_FUNCTION>;
+      using ReturnType = typename Evaluation::ReturnType;
+      auto evaluation = Evaluation{keys, partition_column_count, frame};
+
+      if constexpr (is_aggregate_function(WINDOW_FUNCTION)) {
+        using Aggregate = WindowAggregate<ColumnDataType, WINDOW_FUNCTION>;
+        evaluation.row_states.resize(row_count);
+        if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
+          // COUNT(*) counts all rows.
+          std::fill(evaluation.row_states.begin(), evaluation.row_states.end(), 1);
+        } else {
+          for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+            const auto first_row_index = chunk_first_row_indexes[chunk_id];
+            const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(_argument_column_id);
+            segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+              if (!position.is_null()) {
+                evaluation.row_states[first_row_index + position.chunk_offset()] =
+                    Aggregate::from_value(position.value());
+              }
+            });
+          });
+        }
+
+        if (uses_order_values) {
+          const auto order_by_column_id = _order_by_column_ids.front();
+          const auto direction = window.sort_modes.front() == SortMode::Ascending ? 1.0 : -1.0;
+          evaluation.order_values.resize(row_count);
+          resolve_data_type(input_table->column_data_type(order_by_column_id), [&](const auto order_data_type_t) {
+            using OrderDataType = typename decltype(order_data_type_t)::type;
+            if constexpr (std::is_arithmetic_v<OrderDataType>) {
+              for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+                const auto first_row_index = chunk_first_row_indexes[chunk_id];
+                const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(order_by_column_id);
+                segment_iterate<OrderDataType>(segment, [&](const auto& position) {
+                  if (!position.is_null()) {
+                    evaluation.order_values[first_row_index + position.chunk_offset()] =
+                        direction * static_cast<double>(position.value());
+                  }
+                });
+              });
+            }
+          });
+        }
+
+        result_nullable = WINDOW_FUNCTION != WindowFunction::Count;
+      }
+
+      evaluation.evaluate(buckets);
+      step_performance_data.set_step_runtime(OperatorSteps::Evaluate, timer.lap());
+
+      for_each_chunk_in_parallel([&](const ChunkID chunk_id) {
+        const auto begin = static_cast<int64_t>(chunk_first_row_indexes[chunk_id]);
+        const auto end = static_cast<int64_t>(chunk_first_row_indexes[chunk_id + 1]);
+        auto values = pmr_vector<ReturnType>(evaluation.values.begin() + begin, evaluation.values.begin() + end);
+        if (!result_nullable) {
+          result_segments[chunk_id] = std::make_shared<ValueSegment<ReturnType>>(std::move(values));
+          return;
+        }
+
+        auto null_values = pmr_vector<bool>(evaluation.null_values.begin() + begin,
+                                            evaluation.null_values.begin() + end);
+        result_segments[chunk_id] =
+            std::make_shared<ValueSegment<ReturnType>>(std::move(values), std::move(null_values));
+      });
+    }
+  };
+
+  // Rank functions and COUNT(*) do not depend on an argument.
+  const auto null_value_t = hana::type_c<NullValue>;
+  if (_argument_column_id == INVALID_COLUMN_ID) {
+    switch (window_function) {
+      case WindowFunction::Count:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::Count>{});
+        break;
+      case WindowFunction::CumeDist:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::CumeDist>{});
+        break;
+      case WindowFunction::DenseRank:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::DenseRank>{});
+        break;
+      case WindowFunction::PercentRank:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::PercentRank>{});
+        break;
+      case WindowFunction::Rank:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::Rank>{});
+        break;
+      case WindowFunction::RowNumber:
+        evaluate(null_value_t, std::integral_constant<WindowFunction, WindowFunction::RowNumber>{});
+        break;
+      default:
+        Fail("Window function " + window_function_to_string.left.at(window_function) + " requires an argument.");
+    }
+  } else {
+    resolve_data_type(input_table->column_data_type(_argument_column_id), [&](const auto column_data_type_t) {
+      switch (window_function) {
+        case WindowFunction::Min:
+          evaluate(column_data_type_t, std::integral_constant<WindowFunction, WindowFunction::Min>{});
+          break;
+        case WindowFunction::Max:
+          evaluate(column_data_type_t, std::integral_constant<WindowFunction, WindowFunction::Max>{});
+          break;
+        case WindowFunction::Sum:
+          evaluate(column_data_type_t, std::integral_constant<WindowFunction, WindowFunction::Sum>{});
+          break;
+        case WindowFunction::Avg:
+          evaluate(column_data_type_t, std::integral_constant<WindowFunction, WindowFunction::Avg>{});
+          break;
+        case WindowFunction::Count:
+          evaluate(column_data_type_t, std::integral_constant<WindowFunction, WindowFunction::Count>{});
+          break;
+        default:
+          Fail("Window function " + window_function_to_string.left.at(window_function) + " has no argument.");
+      }
+    });
+  }
+
+  // 4. Build the output. It forwards the input segments and adds the result segments. As a table cannot mix data and
+  //    reference segments, the result segments of a reference input are stored in an internal table and referenced by
+  //    ReferenceSegments with EntireChunkPosLists (see Projection::_on_execute() for details).
+  auto output_column_definitions = input_table->column_definitions();
+  const auto result_column_definition =
+      TableColumnDefinition{_window_function_expression->as_column_name(), result_data_type, result_nullable};
+  output_column_definitions.emplace_back(result_column_definition);
+
+  auto result_table = std::shared_ptr<Table>{};
+  if (input_table->type() == TableType::References) {
+    result_table = std::make_shared<Table>(TableColumnDefinitions{result_column_definition}, TableType::Data,
+                                           std::nullopt, input_table->uses_mvcc());
+  }
+
+  const auto column_count = input_table->column_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count + 1);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(input_chunk->get_segment(column_id));
+    }
+
+    auto output_chunk = std::shared_ptr<Chunk>{};
+    if (input_table->type() == TableType::Data) {
+      output_segments.emplace_back(result_segments[chunk_id]);
+      output_chunk = std::make_shared<Chunk>(std::move(output_segments), input_chunk->mvcc_data());
+      output_chunk->increase_invalid_row_count(input_chunk->invalid_row_count(), std::memory_order_relaxed);
+    } else {
+      result_table->append_chunk(Segments{result_segments[chunk_id]}, input_chunk->mvcc_data());
+      const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size());
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(result_table, ColumnID{0}, pos_list));
+      output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+    }
+
+    // The input columns keep their positions, so their sort orders still hold.
+    const auto& sorted_by = input_chunk->individually_sorted_by();
+    if (!sorted_by.empty()) {
+      output_chunk->set_individually_sorted_by(sorted_by);
+    }
+    output_chunk->set_immutable();
+    output_chunks[chunk_id] = output_chunk;
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, input_table->type(), std::move(output_chunks),
+                                 input_table->uses_mvcc());
+}
+
+}  // namespace hyrise
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class WindowExpression;
+
+/**
+ * Operator that evaluates a WindowFunctionExpression (e.g., RANK() OVER (PARTITION BY a ORDER BY b)) and appends its
+ * result as a new column to the input. The argument of the window function and the PARTITION BY and ORDER BY
+ * expressions of its window must be PQPColumnExpressions, i.e., they have been computed by a previous operator. The
+ * output keeps the input's rows and chunks in their original order.
+ *
+ * The PARTITION BY and ORDER BY columns of all rows are encoded into normalized keys (see NormalizedSortKeys). Rows are
+ * then distributed to buckets by the hash of their PARTITION BY keys so that each partition lies entirely in one
+ * bucket. Each bucket is sorted and evaluated by a separate job. Without PARTITION BY, all rows form one partition that
+ * is sorted by a parallel merge sort.
+ *
+ * Rank functions (ROW_NUMBER, RANK, DENSE_RANK, PERCENT_RANK, and CUME_DIST) ignore the frame. Aggregates (MIN, MAX,
+ * SUM, AVG, and COUNT) are computed for ROWS and RANGE frames. Frames that start at UNBOUNDED PRECEDING are computed as
+ * running aggregates, all other frames are answered by a segment tree over the partition. RANGE frames with offsets
+ * require a single, numeric ORDER BY column.
+ */
+class WindowFunctionEvaluator : public AbstractReadOnlyOperator {
+ public:
+  WindowFunctionEvaluator(const std::shared_ptr<const AbstractOperator>& input_operator,
+                          const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  enum class OperatorSteps : uint8_t { MaterializeKeys, Partition, Evaluate, WriteOutput };
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+  const std::vector<ColumnID>& partition_by_column_ids() const;
+  const std::vector<ColumnID>& order_by_column_ids() const;
+
+  // INVALID_COLUMN_ID for rank functions and COUNT(*).
+  ColumnID argument_column_id() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const WindowExpression& _window() const;
+
+ private:
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+  std::vector<ColumnID> _partition_by_column_ids;
+  std::vector<ColumnID> _order_by_column_ids;
+  ColumnID _argument_column_id{INVALID_COLUMN_ID};
+};
+
+}  // namespace hyrise
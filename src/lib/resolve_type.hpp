@@ -11,6 +11,7 @@
 #include "all_type_variant.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -146,6 +147,9 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto chunk_offset_pos_list =
+                   std::dynamic_pointer_cast<const ChunkOffsetPosList>(untyped_pos_list)) {
+      functor(chunk_offset_pos_list);
     } else {
       Fail("Unrecognized PosList type encountered");
     }
@@ -83,6 +83,15 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+void AbstractTask::set_preferred_node_id(NodeID preferred_node_id) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the preferred node after the Task was scheduled.");
+  _preferred_node_id = preferred_node_id;
+}
+
+NodeID AbstractTask::preferred_node_id() const {
+  return _preferred_node_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -111,7 +120,9 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
     return;
   }
 
-  Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
+  Hyrise::get().scheduler()->schedule(shared_from_this(),
+                                      preferred_node_id != CURRENT_NODE_ID ? preferred_node_id : _preferred_node_id,
+                                      _priority);
 }
 
 void AbstractTask::_join() {
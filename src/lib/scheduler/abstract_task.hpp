@@ -145,6 +145,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * Node whose queue the task is added to if it is scheduled without an explicit node (e.g., by
+   * AbstractScheduler::schedule_tasks). Operators set it to the node that holds the data a task processes (see
+   * Chunk::numa_node_id). Defaults to CURRENT_NODE_ID. Node IDs without workers are ignored by the scheduler.
+   */
+  void set_preferred_node_id(NodeID preferred_node_id);
+  NodeID preferred_node_id() const;
+
   /**
    * Callback to be executed right after the task finished. Notice the execution of the callback might happen on ANY
    * thread.
@@ -152,7 +160,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   void set_done_callback(const std::function<void()>& done_callback);
 
   /**
-   * Schedules the task if a scheduler is available, otherwise just executes it on the current thread.
+   * Schedules the task if a scheduler is available, otherwise just executes it on the current thread. If no node is
+   * passed, the task's preferred node is used.
    */
   void schedule(NodeID preferred_node_id = CURRENT_NODE_ID);
 
@@ -202,6 +211,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id{INVALID_NODE_ID};
+  NodeID _preferred_node_id{CURRENT_NODE_ID};
   SchedulePriority _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
@@ -7,13 +7,14 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <optional>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "memory/numa_memory_resource.hpp"
 #include "shutdown_task.hpp"
 #include "task_queue.hpp"
 #include "types.hpp"
@@ -54,13 +55,18 @@ void NodeQueueScheduler::begin() {
     // ShutdownTasks are not stealable, placing tasks on nodes without workers can lead to failing shutdowns.
     if (!topology_node.cpus.empty()) {
       _active_nodes.push_back(node_id);
-      auto queue = std::make_shared<TaskQueue>(node_id);
+
+      // The queue and the workers are mostly accessed by the node's CPUs. Thus, we allocate them on the node.
+      auto& memory_resource = Hyrise::get().topology.memory_resource(node_id);
+      const auto node_worker_count = topology_node.cpus.size();
+      auto queue = std::allocate_shared<TaskQueue>(PolymorphicAllocator<TaskQueue>{&memory_resource}, node_id,
+                                                   node_worker_count);
       _queues[node_id] = queue;
 
-      for (const auto& topology_cpu : topology_node.cpus) {
-        // TODO(anybody): Place queues on the actual NUMA node once we have NUMA-aware allocators.
-        _workers.emplace_back(
-            std::make_shared<Worker>(queue, WorkerID{_worker_id_allocator->allocate()}, topology_cpu.cpu_id));
+      for (auto local_index = size_t{0}; local_index < node_worker_count; ++local_index) {
+        _workers.emplace_back(std::allocate_shared<Worker>(
+            PolymorphicAllocator<Worker>{&memory_resource}, queue, WorkerID{_worker_id_allocator->allocate()},
+            topology_node.cpus[local_index].cpu_id, local_index));
       }
     }
   }
@@ -214,7 +220,17 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   const auto node_id_for_queue = determine_queue_id(preferred_node_id);
   DebugAssert((static_cast<size_t>(node_id_for_queue) < _queues.size()),
               "Node ID is not within range of available nodes.");
-  _queues[node_id_for_queue]->push(task, priority);
+  const auto& queue = _queues[node_id_for_queue];
+
+  // Tasks that a worker schedules for its own node (e.g., the jobs of an operator) are pushed to the worker's deque.
+  // Spawning them does not contend with the other workers, which can steal them when they are idle.
+  const auto& worker = Worker::get_this_thread_worker();
+  if (worker && worker->queue() == queue && priority == SchedulePriority::Default && task->is_stealable()) {
+    queue->push_local(task, worker->local_index());
+    return;
+  }
+
+  queue->push(task, priority);
 }
 
 NodeID NodeQueueScheduler::determine_queue_id(const NodeID preferred_node_id) const {
@@ -225,7 +241,9 @@ NodeID NodeQueueScheduler::determine_queue_id(const NodeID preferred_node_id) co
     return _active_nodes[0];
   }
 
-  if (preferred_node_id != CURRENT_NODE_ID) {
+  // Tasks might prefer a node without workers (e.g., the node that holds the data they process, see
+  // AbstractTask::set_preferred_node_id). Such tasks are treated as if they had no preference.
+  if (preferred_node_id < _queues.size() && _queues[preferred_node_id]) {
     return preferred_node_id;
   }
 
@@ -265,32 +283,32 @@ void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<Abstract
   // Approach: Skip all tasks that already have predecessors or successors, as adding relationships to these could
   // introduce cyclic dependencies. Again, this is far from perfect, but better than not grouping the tasks.
 
-  auto round_robin_counter = 0;
-  auto common_node_id = std::optional<NodeID>{};
+  //
+  // Tasks are only grouped with tasks that prefer the same node. As a chain of tasks is executed by the worker that
+  // executes its first task (see Worker::execute_next), all tasks of the chain are then executed on their preferred
+  // node.
 
-  auto grouped_tasks = std::vector<std::shared_ptr<AbstractTask>>(NUM_GROUPS);
+  auto round_robin_counters = std::unordered_map<NodeID, size_t>{};
+  auto grouped_tasks = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
   for (const auto& task : tasks) {
     if (!task->predecessors().empty() || !task->successors().empty() || dynamic_cast<ShutdownTask*>(&*task)) {
       // Do not group tasks that either have precessors/successors or are ShutdownTasks.
       return;
     }
 
-    if (common_node_id) {
-      // This is not really a hard assertion. As the chain will likely be executed on the same worker (see
-      // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-      // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-      // node ids.
-      DebugAssert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id.");
-    } else {
-      common_node_id = task->node_id();
+    const auto preferred_node_id = task->preferred_node_id();
+    auto& node_grouped_tasks = grouped_tasks[preferred_node_id];
+    if (node_grouped_tasks.empty()) {
+      node_grouped_tasks.resize(NUM_GROUPS);
     }
 
+    auto& round_robin_counter = round_robin_counters[preferred_node_id];
     const auto group_id = round_robin_counter % NUM_GROUPS;
-    const auto& first_task_in_group = grouped_tasks[group_id];
+    const auto& first_task_in_group = node_grouped_tasks[group_id];
     if (first_task_in_group) {
       task->set_as_predecessor_of(first_task_in_group);
     }
-    grouped_tasks[group_id] = task;
+    node_grouped_tasks[group_id] = task;
     ++round_robin_counter;
   }
 }
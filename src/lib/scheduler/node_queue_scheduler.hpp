@@ -26,16 +26,18 @@ namespace hyrise {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore idle
- * CPU threads) while there are still tasks in the system that need to be processed. A worker gets idle when its local
- * TaskQueue is empty. In this case, the worker is checking non-local TaskQueues of other NUMA nodes for tasks. The
- * worker pulls a task from a remote TaskQueue and checks if this task is stealable. If not, the task is pushed to the
- * TaskQueue again.
+ * Work stealing is useful to avoid idle workers (and therefore idle CPU threads) while there are still tasks in the
+ * system that need to be processed. Each worker owns a lock-free work-stealing deque in its node's TaskQueue (see
+ * WorkStealingDeque). Stealable tasks that a worker schedules for its own node are pushed to its deque, which the
+ * worker processes in LIFO order. When a worker's deque and the node's shared queues are empty, the worker steals the
+ * oldest task from the deque of another worker of the same node. If the node has no tasks left, the worker checks the
+ * TaskQueues of other NUMA nodes for stealable tasks. Unstealable tasks are never taken by workers of other nodes.
  * In case no tasks can be processed, the worker thread is put to sleep and waits on the semaphore of its node-local
  * TaskQueue.
  *
- * Note: currently, TaskQueues are not explicitly allocated on a NUMA node. This means most workers will frequently
- * access distant TaskQueues, which is ~1.6 times slower than accessing a local node [1]. 
+ * TaskQueues and workers are allocated on their NUMA node (see Topology::memory_resource), as accessing a distant
+ * node is ~1.6 times slower than accessing a local node [1]. Tasks that process data placed on a specific node (e.g.,
+ * per-chunk jobs of operators, see Chunk::numa_node_id) prefer the queue of that node.
  *
  *  [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  *
@@ -87,7 +89,7 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::atomic_int64_t& active_worker_count() const;
 
-  // Number of groups for _group_tasks
+  // Number of groups per preferred node for _group_tasks
   static constexpr auto NUM_GROUPS = 10;
 
  protected:
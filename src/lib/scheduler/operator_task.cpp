@@ -1,5 +1,6 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -7,6 +8,7 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/get_table.hpp"
@@ -19,6 +21,48 @@ namespace {
 
 using namespace hyrise;  // NOLINT(build/namespaces)
 
+/**
+ * Fuse operators into morsel-driven pipelines (see AbstractOperator). Starting at an operator that can end a pipeline,
+ * the pipeline grows along the left inputs as long as they can be fused and are not consumed by other operators.
+ * Called by `make_tasks_from_operator` before any task is created.
+ */
+void fuse_pipelines_recursively(const std::shared_ptr<AbstractOperator>& op,
+                                std::unordered_set<std::shared_ptr<AbstractOperator>>& visited_operators) {
+  if (!visited_operators.emplace(op).second) {
+    return;
+  }
+
+  const auto can_end_pipeline = op->pipeline_stage() != PipelineStage::None && op->state() == OperatorState::Created;
+  if (can_end_pipeline && op->fused_inputs().empty()) {
+    auto fused_inputs = std::vector<std::shared_ptr<AbstractOperator>>{};
+    auto input = op->mutable_left_input();
+    while (input && input->can_be_fused_as_input()) {
+      fused_inputs.emplace_back(input);
+      input = input->mutable_left_input();
+    }
+
+    if (!fused_inputs.empty()) {
+      std::reverse(fused_inputs.begin(), fused_inputs.end());
+      op->fuse_pipeline(std::move(fused_inputs));
+    }
+  }
+
+  // Continue with the operators that provide the pipeline's morsels.
+  const auto left_input =
+      op->fused_inputs().empty() ? op->mutable_left_input() : op->fused_inputs().front()->mutable_left_input();
+  if (left_input) {
+    fuse_pipelines_recursively(left_input, visited_operators);
+  }
+
+  if (const auto right_input = op->mutable_right_input()) {
+    fuse_pipelines_recursively(right_input, visited_operators);
+  }
+
+  for (const auto& subquery : op->uncorrelated_subqueries()) {
+    fuse_pipelines_recursively(subquery, visited_operators);
+  }
+}
+
 /**
  * Create tasks recursively. Called by `make_tasks_from_operator`.
  * @returns the root of the subtree that was added.
@@ -34,7 +78,10 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
     return task;
   }
 
-  if (auto left = op->mutable_left_input()) {
+  // The fused inputs of a pipeline are executed by the task of the pipeline's last operator.
+  const auto left =
+      op->fused_inputs().empty() ? op->mutable_left_input() : op->fused_inputs().front()->mutable_left_input();
+  if (left) {
     const auto& left_subtree_root = add_operator_tasks_recursively(left, tasks);
     left_subtree_root->set_as_predecessor_of(task);
   }
@@ -86,6 +133,28 @@ void link_tasks_for_subquery_pruning(const std::unordered_set<std::shared_ptr<Op
   }
 }
 
+/**
+ * Sets the tasks of the source operators of runtime join filters as predecessors of the GetTable tasks. When adding
+ * the filters, add_runtime_join_filters() ensures that the GetTable operators are not part of their sources' subtrees.
+ */
+void link_tasks_for_runtime_join_filters(const std::unordered_set<std::shared_ptr<OperatorTask>>& tasks) {
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    if (op->type() != OperatorType::GetTable) {
+      continue;
+    }
+
+    const auto& get_table = static_cast<GetTable&>(*op);
+    for (const auto& runtime_join_filter : get_table.runtime_join_filters()) {
+      const auto source = runtime_join_filter.source.lock();
+      Assert(source, "Source of runtime join filter expired.");
+      const auto& source_task = source->get_or_create_operator_task();
+      Assert(tasks.contains(source_task), "Unknown OperatorTask.");
+      source_task->set_as_predecessor_of(task);
+    }
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -98,6 +167,12 @@ std::string OperatorTask::description() const {
 
 std::pair<std::vector<std::shared_ptr<AbstractTask>>, std::shared_ptr<OperatorTask>>
 OperatorTask::make_tasks_from_operator(const std::shared_ptr<AbstractOperator>& op) {
+  // Pipelines only pay off when their morsels can be processed concurrently.
+  if (Hyrise::get().is_multi_threaded()) {
+    auto visited_operators = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+    fuse_pipelines_recursively(op, visited_operators);
+  }
+
   auto operator_tasks_set = std::unordered_set<std::shared_ptr<OperatorTask>>{};
   const auto& root_operator_task = add_operator_tasks_recursively(op, operator_tasks_set);
 
@@ -110,6 +185,9 @@ OperatorTask::make_tasks_from_operator(const std::shared_ptr<AbstractOperator>&
   // it is acyclic.
   link_tasks_for_subquery_pruning(operator_tasks_set);
 
+  // Similarly, the sources of runtime join filters must be executed before the GetTable operators they prune.
+  link_tasks_for_runtime_join_filters(operator_tasks_set);
+
   // Ensure the task graph is acyclic, i.e., no task is any (n-th) successor of itself. Tasks in cycles would end up in
   // a deadlock during execution, mutually waiting for the other tasks' execution. Even if the tasks are never executed,
   // cycles create memory leaks since tasks hold shared pointers to their predecessors.
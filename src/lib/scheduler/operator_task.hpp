@@ -24,6 +24,9 @@ class OperatorTask : public AbstractTask {
    * Creates tasks recursively from the given operator @param op and sets task dependencies automatically.
    * @returns a pair, consisting of a vector of unordered tasks and a pointer to the root operator task that would
    *          otherwise be hidden inside the vector.
+   * If a multi-threaded scheduler is active, chains of pipelineable operators are fused into morsel-driven pipelines
+   * first (see AbstractOperator). Fused inputs do not get tasks of their own but are executed by the task of the
+   * pipeline's last operator.
    * Note: Creating tasks is not thread-safe and concurrently creating tasks from the same (sub-)PQP is discouraged. We
    *       used to create tasks for uncorrelated subqueries ad-hoc and likely concurrently in the past, but this caused
    *       either segfaults or deadlocks (see #2520). Thus, we only create (i) almost all tasks at once for each
@@ -3,18 +3,32 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <random>
 
 #include "abstract_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace hyrise {
 
-TaskQueue::TaskQueue(NodeID node_id) : _node_id{node_id} {}
+TaskQueue::TaskQueue(NodeID node_id, const size_t worker_count) : _node_id{node_id} {
+  _worker_deques.reserve(worker_count);
+  for (auto worker_index = size_t{0}; worker_index < worker_count; ++worker_index) {
+    _worker_deques.emplace_back(std::make_unique<WorkStealingDeque>());
+  }
+}
 
 bool TaskQueue::empty() const {
-  for (const auto& queue : _queues) {
-    if (!queue.empty()) {
+  for (auto priority = uint32_t{0}; priority < NUM_PRIORITY_LEVELS; ++priority) {
+    if (!_queues[priority].empty() || !_unstealable_queues[priority].empty()) {
+      return false;
+    }
+  }
+
+  for (const auto& deque : _worker_deques) {
+    if (deque->estimate_size() > 0) {
       return false;
     }
   }
@@ -35,16 +49,48 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, const SchedulePr
   }
 
   task->set_node_id(_node_id);
-  _queues[priority_uint].push(task);
+  if (task->is_stealable()) {
+    _queues[priority_uint].push(task);
+  } else {
+    _unstealable_queues[priority_uint].push(task);
+  }
   semaphore.signal();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  auto task = std::shared_ptr<AbstractTask>{};
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      return task;
-    }
+void TaskQueue::push_local(const std::shared_ptr<AbstractTask>& task, const size_t worker_index) {
+  DebugAssert(worker_index < _worker_deques.size(), "Worker index is out of range.");
+  DebugAssert(task->is_stealable(), "Only stealable tasks can be pushed to a worker's deque.");
+
+  if (!task->try_mark_as_enqueued()) {
+    return;
+  }
+
+  task->set_node_id(_node_id);
+  _worker_deques[worker_index]->push(task);
+  semaphore.signal();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull(const size_t worker_index) {
+  DebugAssert(worker_index < _worker_deques.size(), "Worker index is out of range.");
+
+  auto task = _pull_from_shared_queues(SchedulePriority::High);
+  if (task) {
+    return task;
+  }
+
+  task = _worker_deques[worker_index]->pop();
+  if (task) {
+    return task;
+  }
+
+  task = _pull_from_shared_queues(SchedulePriority::Default);
+  if (task) {
+    return task;
+  }
+
+  task = _steal_from_deques(worker_index);
+  if (task) {
+    return task;
   }
 
   // We waited for the semaphore to enter pull() but did not receive a task. Ensure that queues are checked again.
@@ -56,15 +102,15 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   auto task = std::shared_ptr<AbstractTask>{};
   for (auto& queue : _queues) {
     if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        return task;
-      }
-
-      queue.push(task);
-      semaphore.signal();
+      return task;
     }
   }
 
+  task = _steal_from_deques(std::nullopt);
+  if (task) {
+    return task;
+  }
+
   // We waited for the semaphore to enter steal() but did not receive a task. Ensure that queues are checked again.
   semaphore.signal();
   return nullptr;
@@ -77,7 +123,12 @@ size_t TaskQueue::estimate_load() const {
   // (starting with 2^0) to calculate the cost factor per priority level.
   for (auto queue_id = size_t{0}; queue_id < NUM_PRIORITY_LEVELS; ++queue_id) {
     // The lowest priority has a multiplier of 2^0, the next higher priority 2^1, and so on.
-    estimated_load += _queues[queue_id].unsafe_size() * (size_t{1} << (NUM_PRIORITY_LEVELS - 1 - queue_id));
+    const auto queue_size = _queues[queue_id].unsafe_size() + _unstealable_queues[queue_id].unsafe_size();
+    estimated_load += queue_size * (size_t{1} << (NUM_PRIORITY_LEVELS - 1 - queue_id));
+  }
+
+  for (const auto& deque : _worker_deques) {
+    estimated_load += deque->estimate_size();
   }
 
   return estimated_load;
@@ -87,4 +138,37 @@ void TaskQueue::signal(const int32_t count) {
   semaphore.signal(count);
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::_pull_from_shared_queues(const SchedulePriority priority) {
+  const auto priority_uint = static_cast<uint32_t>(priority);
+  auto task = std::shared_ptr<AbstractTask>{};
+  if (_unstealable_queues[priority_uint].try_pop(task) || _queues[priority_uint].try_pop(task)) {
+    return task;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_steal_from_deques(const std::optional<size_t> excluded_worker_index) {
+  const auto deque_count = _worker_deques.size();
+  if (deque_count == 0) {
+    return nullptr;
+  }
+
+  // Start at a random deque so that thieves spread across the workers instead of all contending on the first one.
+  thread_local auto random_engine = std::minstd_rand{std::random_device{}()};
+  const auto first_index = static_cast<size_t>(random_engine()) % deque_count;
+  for (auto offset = size_t{0}; offset < deque_count; ++offset) {
+    const auto worker_index = (first_index + offset) % deque_count;
+    if (worker_index == excluded_worker_index) {
+      continue;
+    }
+
+    auto task = _worker_deques[worker_index]->steal();
+    if (task) {
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
 }  // namespace hyrise
@@ -6,6 +6,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <oneapi/tbb/concurrent_queue.h>  // NOLINT(build/include_order): cpplint identifies TBB as C system headers.
 
@@ -13,6 +15,7 @@
 #include "lightweightsemaphore.h"
 
 #include "types.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace moodycamel {  //
 class LightweightSemaphore;
@@ -23,7 +26,16 @@ namespace hyrise {
 class AbstractTask;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds the tasks of a node, usually one of these exists per node. Tasks are either held in one of the node's shared
+ * queues or in the work-stealing deque of one of the node's workers:
+ *  - Tasks that a worker schedules for its own node (e.g., the JobTasks of an operator) are pushed to the worker's
+ *    deque (push_local). Only the worker itself pushes to its deque, so that spawning tasks does not contend with
+ *    other workers. The worker executes its most recent tasks first (LIFO), while idle workers steal the oldest ones.
+ *  - All other tasks (e.g., tasks scheduled by non-worker threads, high-priority tasks, and unstealable tasks) are
+ *    pushed to the shared queues (push). Unstealable tasks are kept in queues of their own so that stealing never has
+ *    to pop and re-push them.
+ *
+ * The semaphore counts the tasks of all queues and deques. Workers acquire it before they call pull() or steal().
  */
 class TaskQueue {
  public:
@@ -31,7 +43,7 @@ class TaskQueue {
 
   TaskQueue() = delete;
 
-  explicit TaskQueue(NodeID node_id);
+  explicit TaskQueue(NodeID node_id, const size_t worker_count = 0);
 
   bool empty() const;
 
@@ -40,12 +52,21 @@ class TaskQueue {
   void push(const std::shared_ptr<AbstractTask>& task, const SchedulePriority priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Adds a stealable task of default priority to the deque of the worker with the given index. Must only be called by
+   * that worker.
    */
-  std::shared_ptr<AbstractTask> pull();
+  void push_local(const std::shared_ptr<AbstractTask>& task, const size_t worker_index);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from the queue. Must only be called by the worker with
+   * the given index. Checks, in this order, the high-priority queues, the worker's own deque, the default-priority
+   * queues, and the deques of the other workers of the node (starting at a random one).
+   */
+  std::shared_ptr<AbstractTask> pull(const size_t worker_index);
+
+  /**
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues or one of the
+   * workers' deques.
    */
   std::shared_ptr<AbstractTask> steal();
 
@@ -53,7 +74,7 @@ class TaskQueue {
    * Returns the estimated load for the TaskQueue (i.e., all queues of the TaskQueue instance). The load is "estimated"
    * as TBB's concurrent queue does not guarantee that `unsafe_size()` returns the correct size at a given point in
    * time. The priority queues are weighted, i.e., a task in the high priority queue leads to a larger load than a task
-   * in the default priority queue.
+   * in the default priority queue. Tasks in the workers' deques are weighted like default-priority tasks.
    */
   size_t estimate_load() const;
 
@@ -67,8 +88,16 @@ class TaskQueue {
   moodycamel::LightweightSemaphore semaphore;
 
  private:
+  using SharedQueue = tbb::concurrent_queue<std::shared_ptr<AbstractTask>>;
+
+  std::shared_ptr<AbstractTask> _pull_from_shared_queues(const SchedulePriority priority);
+
+  std::shared_ptr<AbstractTask> _steal_from_deques(const std::optional<size_t> excluded_worker_index);
+
   NodeID _node_id{INVALID_NODE_ID};
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<SharedQueue, NUM_PRIORITY_LEVELS> _queues;
+  std::array<SharedQueue, NUM_PRIORITY_LEVELS> _unstealable_queues;
+  std::vector<std::unique_ptr<WorkStealingDeque>> _worker_deques;
 };
 
 }  // namespace hyrise
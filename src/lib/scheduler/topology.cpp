@@ -1,19 +1,102 @@
 #include "topology.hpp"
 
+// clang-format off
 #if HYRISE_NUMA_SUPPORT
 #include <numa.h>
 #endif
 
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#else
+#include <unistd.h>
+#endif
+// clang-format on
+
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <numeric>
+#include <optional>
 #include <ostream>
+#include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "memory/numa_memory_resource.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+#ifdef __linux__
+std::optional<std::string> read_sysfs_file(const std::filesystem::path& path) {
+  auto file = std::ifstream{path};
+  auto content = std::string{};
+  if (!file || !std::getline(file, content)) {
+    return std::nullopt;
+  }
+  return content;
+}
+
+// Returns the number of CPUs in a sysfs CPU list, such as "0-3,8,10-11".
+uint32_t count_cpus_in_list(const std::string& cpu_list) {
+  auto cpu_count = uint32_t{0};
+  auto stream = std::istringstream{cpu_list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+
+    const auto dash_position = range.find('-');
+    if (dash_position == std::string::npos) {
+      ++cpu_count;
+      continue;
+    }
+    const auto first_cpu = std::stoul(range.substr(0, dash_position));
+    const auto last_cpu = std::stoul(range.substr(dash_position + 1));
+    cpu_count += static_cast<uint32_t>(last_cpu - first_cpu + 1);
+  }
+  return cpu_count;
+}
+
+// Parses sysfs cache sizes, such as "48K" or "32M", into bytes.
+size_t parse_cache_size(const std::string& size_string) {
+  auto unit_position = size_t{0};
+  const auto size = std::stoull(size_string, &unit_position);
+  if (unit_position < size_string.size()) {
+    switch (size_string[unit_position]) {
+      case 'K':
+        return size * 1'024;
+      case 'M':
+        return size * 1'024 * 1'024;
+      case 'G':
+        return size * 1'024 * 1'024 * 1'024;
+      default:
+        break;
+    }
+  }
+  return size;
+}
+#endif
+
+#ifdef __APPLE__
+int64_t read_sysctl(const char* name) {
+  auto value = int64_t{0};
+  auto size = sizeof(value);
+  if (sysctlbyname(name, &value, &size, nullptr, 0) != 0) {
+    return 0;
+  }
+  return value;
+}
+#endif
+
+}  // namespace
 
 namespace hyrise {
 
@@ -24,6 +107,7 @@ const int Topology::_number_of_hardware_nodes = 1;  // NOLINT
 #endif
 
 Topology::Topology() {
+  _detect_caches();
   _init_default_topology();
 }
 
@@ -41,6 +125,12 @@ std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node
   return stream;
 }
 
+std::ostream& operator<<(std::ostream& stream, const TopologyCache& topology_cache) {
+  stream << "L" << topology_cache.level << ": " << topology_cache.size / 1'024 << " KiB, shared by "
+         << topology_cache.shared_cpu_count << " CPU(s)";
+  return stream;
+}
+
 void Topology::use_default_topology(uint32_t max_num_cores) {
   _init_default_topology(max_num_cores);
 }
@@ -186,6 +276,106 @@ size_t Topology::num_cpus() const {
   return _num_cpus;
 }
 
+NumaMemoryResource& Topology::memory_resource(const NodeID node_id) const {
+  Assert(node_id < _nodes.size(), "Node ID is not within range of the topology's nodes.");
+  return NumaMemoryResource::get(node_id);
+}
+
+const std::vector<TopologyCache>& Topology::caches() const {
+  return _caches;
+}
+
+size_t Topology::cache_size(const uint32_t level) const {
+  const auto cache = std::find_if(_caches.cbegin(), _caches.cend(), [&](const auto& topology_cache) {
+    return topology_cache.level == level;
+  });
+  return cache != _caches.cend() ? cache->size : 0;
+}
+
+size_t Topology::private_cache_size() const {
+  auto size = size_t{0};
+  for (const auto& cache : _caches) {
+    if (cache.shared_cpu_count <= _smt_cpu_count) {
+      size = std::max(size, cache.size);
+    }
+  }
+  return size;
+}
+
+uint32_t Topology::num_physical_cores() const {
+  return _num_physical_cores;
+}
+
+void Topology::_detect_caches() {
+  _caches.clear();
+  const auto num_logical_cpus = std::max(std::thread::hardware_concurrency(), 1u);
+
+#ifdef __linux__
+  // sysfs lists the caches of each CPU, including which CPUs share them. We assume that all CPUs have the same caches.
+  const auto cpu_path = std::filesystem::path{"/sys/devices/system/cpu/cpu0"};
+  for (auto index = uint32_t{0};; ++index) {
+    const auto cache_path = cpu_path / "cache" / ("index" + std::to_string(index));
+    const auto level = read_sysfs_file(cache_path / "level");
+    const auto type = read_sysfs_file(cache_path / "type");
+    const auto size = read_sysfs_file(cache_path / "size");
+    if (!level || !type || !size) {
+      break;
+    }
+    if (*type == "Instruction") {
+      continue;
+    }
+
+    const auto shared_cpu_list = read_sysfs_file(cache_path / "shared_cpu_list");
+    const auto shared_cpu_count = shared_cpu_list ? std::max(count_cpus_in_list(*shared_cpu_list), uint32_t{1}) : 1;
+    _caches.emplace_back(TopologyCache{static_cast<uint32_t>(std::stoul(*level)), parse_cache_size(*size),
+                                       shared_cpu_count});
+  }
+
+  const auto thread_siblings_list = read_sysfs_file(cpu_path / "topology" / "thread_siblings_list");
+  _smt_cpu_count = thread_siblings_list ? std::max(count_cpus_in_list(*thread_siblings_list), uint32_t{1}) : 1;
+
+  if (_caches.empty()) {
+    // sysfs is not available (e.g., in some containers). glibc reports the cache sizes, but not which CPUs share them.
+    // We assume that the L1 and L2 caches are private to a core and that the L3 cache is shared by all CPUs.
+    const auto cache_sizes = std::array{sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_SIZE),
+                                        sysconf(_SC_LEVEL3_CACHE_SIZE)};
+    for (auto level = uint32_t{1}; level <= cache_sizes.size(); ++level) {
+      if (cache_sizes[level - 1] > 0) {
+        _caches.emplace_back(TopologyCache{level, static_cast<size_t>(cache_sizes[level - 1]),
+                                           level < 3 ? _smt_cpu_count : num_logical_cpus});
+      }
+    }
+  }
+#endif
+
+#ifdef __APPLE__
+  // On Apple silicon, the L2 cache is shared by the cores of a cluster. hw.perflevel0.cpusperl2 reports the cluster
+  // size of the performance cores. If it is unavailable, we conservatively assume that the L2 cache is shared by all
+  // CPUs.
+  const auto physical_cpu_count = read_sysctl("hw.physicalcpu");
+  if (physical_cpu_count > 0 && num_logical_cpus % physical_cpu_count == 0) {
+    _smt_cpu_count = static_cast<uint32_t>(num_logical_cpus / physical_cpu_count);
+  }
+
+  const auto l2_shared_cpu_count = read_sysctl("hw.perflevel0.cpusperl2");
+  const auto cache_sizes = std::array{read_sysctl("hw.l1dcachesize"), read_sysctl("hw.l2cachesize"),
+                                      read_sysctl("hw.l3cachesize")};
+  const auto l2_shared_by = l2_shared_cpu_count > 0 ? static_cast<uint32_t>(l2_shared_cpu_count) : num_logical_cpus;
+  const auto shared_cpu_counts = std::array{_smt_cpu_count, l2_shared_by, num_logical_cpus};
+  for (auto level = uint32_t{1}; level <= cache_sizes.size(); ++level) {
+    if (cache_sizes[level - 1] > 0) {
+      _caches.emplace_back(
+          TopologyCache{level, static_cast<size_t>(cache_sizes[level - 1]), shared_cpu_counts[level - 1]});
+    }
+  }
+#endif
+
+  std::stable_sort(_caches.begin(), _caches.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.level < rhs.level;
+  });
+  _num_physical_cores = std::max(num_logical_cpus / _smt_cpu_count, 1u);
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _num_cpus = 0;
@@ -193,6 +383,10 @@ void Topology::_clear() {
 
 std::ostream& operator<<(std::ostream& stream, const Topology& topology) {
   stream << "Number of CPUs: " << topology.num_cpus() << '\n';
+  stream << "Number of physical cores: " << topology.num_physical_cores() << '\n';
+  for (const auto& cache : topology.caches()) {
+    stream << "Cache " << cache << '\n';
+  }
   if (topology._filtered_by_affinity) {
     stream << "Available CPUs / nodes were filtered by externally set CPU affinity (e.g., numactl).\n";
   }
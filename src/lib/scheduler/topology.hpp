@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -9,6 +11,8 @@
 
 namespace hyrise {
 
+class NumaMemoryResource;
+
 struct TopologyCpu final {
   explicit TopologyCpu(CpuID init_cpu_id) : cpu_id(init_cpu_id) {}
 
@@ -23,6 +27,16 @@ struct TopologyNode final {
 
 std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node);
 
+// A data or unified CPU cache as seen from the first CPU of the system.
+struct TopologyCache final {
+  uint32_t level{0};
+  size_t size{0};  // in bytes
+  // Number of logical CPUs that share this cache (e.g., 2 for an L2 cache shared by two hyperthreads).
+  uint32_t shared_cpu_count{1};
+};
+
+std::ostream& operator<<(std::ostream& stream, const TopologyCache& topology_cache);
+
 /**
  * Topology is a singleton that encapsulates the Machine Architecture, i.e. how many Nodes/Cores there are.
  * It is initialized with the actual system topology by default, but can be newly initialized with a custom topology
@@ -81,6 +95,31 @@ class Topology final : public Noncopyable {
 
   size_t num_cpus() const;
 
+  /**
+   * Memory resource that places allocations on the given node (see NumaMemoryResource). Used to allocate TaskQueues,
+   * Workers, and chunk data close to the CPUs of the node.
+   */
+  NumaMemoryResource& memory_resource(const NodeID node_id) const;
+
+  /**
+   * The CPU caches and the number of physical cores are detected once when the topology is created (via sysfs or
+   * sysconf on Linux, via sysctl on macOS). In contrast to the nodes and CPUs, they are not changed by the
+   * 'use_*_topology()' methods, as they describe the hardware and not the CPUs Hyrise decided to use.
+   */
+  const std::vector<TopologyCache>& caches() const;
+
+  // Size of the data cache of the given level in bytes, 0 if there is no such cache or its size is unknown.
+  size_t cache_size(const uint32_t level) const;
+
+  // Size of the largest cache that is private to a physical core (i.e., only shared between the hyperthreads of that
+  // core), 0 if unknown. For most x86 CPUs, this is the L2 cache. Operators use it to size their cache-resident data
+  // structures (e.g., the hash tables of radix-partitioned joins).
+  size_t private_cache_size() const;
+
+  // Number of physical cores, which is smaller than the number of logical CPUs if simultaneous multithreading is
+  // enabled.
+  uint32_t num_physical_cores() const;
+
  private:
   Topology();
 
@@ -94,7 +133,12 @@ class Topology final : public Noncopyable {
 
   void _clear();
 
+  void _detect_caches();
+
   std::vector<TopologyNode> _nodes;
+  std::vector<TopologyCache> _caches;
+  uint32_t _num_physical_cores{0};
+  uint32_t _smt_cpu_count{1};
   uint32_t _num_cpus{0};
   bool _fake_numa_topology{false};
   bool _filtered_by_affinity{false};
@@ -0,0 +1,129 @@
+#include "work_stealing_deque.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Takes ownership of a task that has been claimed from a slot.
+std::shared_ptr<AbstractTask> take_task(std::shared_ptr<AbstractTask>* const slot_task) {
+  auto task = std::move(*slot_task);
+  delete slot_task;  // NOLINT(cppcoreguidelines-owning-memory)
+  return task;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+WorkStealingDeque::RingBuffer::RingBuffer(const int64_t init_capacity)
+    : capacity{init_capacity}, slots(static_cast<size_t>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two.");
+}
+
+WorkStealingDeque::Slot& WorkStealingDeque::RingBuffer::operator[](const int64_t index) {
+  return slots[static_cast<size_t>(index & (capacity - 1))];
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<RingBuffer>(static_cast<int64_t>(std::bit_ceil(initial_capacity))));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  auto& buffer = *_buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    take_task(buffer[index].load(std::memory_order_relaxed));
+  }
+}
+
+void WorkStealingDeque::push(std::shared_ptr<AbstractTask> task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  if (bottom - top > buffer->capacity - 1) {
+    buffer = _grow(*buffer, top, bottom);
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  auto* const slot_task = new std::shared_ptr<AbstractTask>{std::move(task)};
+  (*buffer)[bottom].store(slot_task, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto& buffer = *_buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* const slot_task = buffer[bottom].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task. Race against thieves for it.
+    const auto claimed =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!claimed) {
+      return nullptr;
+    }
+  }
+
+  return take_task(slot_task);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  auto& buffer = *_buffer.load(std::memory_order_acquire);
+  auto* const slot_task = buffer[top].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // The owner or another thief claimed the task.
+    return nullptr;
+  }
+
+  return take_task(slot_task);
+}
+
+size_t WorkStealingDeque::estimate_size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+WorkStealingDeque::RingBuffer* WorkStealingDeque::_grow(RingBuffer& buffer, const int64_t top, const int64_t bottom) {
+  auto new_buffer = std::make_unique<RingBuffer>(buffer.capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    (*new_buffer)[index].store(buffer[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  auto* const new_buffer_pointer = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_pointer, std::memory_order_release);
+  return new_buffer_pointer;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque after Chase and Lev [1], using the C11 memory orderings of Lê et al. [2]. Exactly one
+ * thread (the owning worker) pushes and pops tasks at the bottom in LIFO order, so that freshly spawned tasks are
+ * executed while their data is still in the cache. All other threads steal the oldest tasks from the top.
+ *
+ * push() and pop() only synchronize with thieves when the deque holds a single task or is full. When it is full, the
+ * ring buffer is doubled. Replaced buffers are kept until the deque is destroyed, as thieves might still read from
+ * them.
+ *
+ * The slots store owning pointers to heap-allocated shared_ptrs: a thief reads the slot before it claims it, so a slot
+ * must be copyable without touching reference counts. The thread that successfully claims a slot takes ownership.
+ *
+ *  [1] Chase and Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005.
+ *  [2] Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 256);
+
+  ~WorkStealingDeque();
+
+  WorkStealingDeque(WorkStealingDeque&&) = delete;
+  WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+  // Adds the task at the bottom. Must only be called by the owning thread.
+  void push(std::shared_ptr<AbstractTask> task);
+
+  // Removes the most recently pushed task. Must only be called by the owning thread.
+  std::shared_ptr<AbstractTask> pop();
+
+  // Removes the oldest task. Can be called by any thread. Returns nullptr if the deque is empty or if another thread
+  // claimed the task concurrently.
+  std::shared_ptr<AbstractTask> steal();
+
+  // Number of tasks in the deque. Only exact if no other thread modifies the deque concurrently.
+  size_t estimate_size() const;
+
+ private:
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct RingBuffer {
+    explicit RingBuffer(const int64_t init_capacity);
+
+    Slot& operator[](const int64_t index);
+
+    const int64_t capacity;
+    std::vector<Slot> slots;
+  };
+
+  RingBuffer* _grow(RingBuffer& buffer, const int64_t top, const int64_t bottom);
+
+  // Top and bottom are on separate cache lines, as the former is written by thieves and the latter by the owner.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<RingBuffer*> _buffer{nullptr};
+
+  // All buffers that have been used, only modified by the owning thread.
+  std::vector<std::unique_ptr<RingBuffer>> _buffers;
+};
+
+}  // namespace hyrise
@@ -40,8 +40,8 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() {
   return ::this_thread_worker.lock();
 }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id)
-    : _queue(queue), _id(worker_id), _cpu_id(cpu_id) {
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id, const size_t local_index)
+    : _queue(queue), _id(worker_id), _cpu_id(cpu_id), _local_index(local_index) {
   // Generate a random distribution from 0-99 for later use, see below
   _random.resize(100);
   std::iota(_random.begin(), _random.end(), 0);
@@ -60,6 +60,10 @@ CpuID Worker::cpu_id() const {
   return _cpu_id;
 }
 
+size_t Worker::local_index() const {
+  return _local_index;
+}
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker.");
 
@@ -81,7 +85,7 @@ void Worker::_work(const AllowSleep allow_sleep) {
     _next_task = nullptr;
   } else {
     if (_queue->semaphore.tryWait()) {
-      task = _queue->pull();
+      task = _queue->pull(_local_index);
     }
   }
 
@@ -105,7 +109,7 @@ void Worker::_work(const AllowSleep allow_sleep) {
   // If there is no ready task neither in our queue nor in any other and we are allowed to sleep, wait on the semaphore.
   if (!task && allow_sleep == AllowSleep::Yes) {
     _queue->semaphore.wait();
-    task = _queue->pull();
+    task = _queue->pull(_local_index);
   }
 
   if (!task) {
@@ -146,6 +150,8 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution.");
     _next_task = task;
+  } else if (task->is_stealable()) {
+    _queue->push_local(task, _local_index);
   } else {
     _queue->push(task, SchedulePriority::Default);
   }
@@ -22,7 +22,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id);
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id, const size_t local_index);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -31,6 +31,11 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
 
+  /**
+   * Index of the worker among the workers of its TaskQueue, identifies the worker's deque in the queue.
+   */
+  size_t local_index() const;
+
   void start();
   void join();
 
@@ -38,7 +43,8 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // execute the task while the caches are still fresh instead of having to wait for it to be scheduled again. A task
   // can have multiple successors and all of them could become executable at the same time. In that case, the current
   // worker can only execute one of them immediately. The others are placed into a high priority queue on the same node
-  // so that they are worked on as soon as possible by either this or another worker.
+  // so that they are worked on as soon as possible by either this or another worker. Stealable tasks are placed into
+  // this worker's deque instead, where they are executed next unless another worker steals them first.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
   // Returns the number of tasks the worker has processed. This method is used as part of the scheduler shutdown. Be
@@ -68,6 +74,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> _queue{};
   WorkerID _id{0};
   CpuID _cpu_id{0};
+  size_t _local_index{0};
   std::thread _thread;
   std::atomic_uint64_t _num_finished_tasks{0};
 
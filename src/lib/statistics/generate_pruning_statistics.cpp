@@ -17,6 +17,7 @@
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/table.hpp"
@@ -69,7 +70,9 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
 
       // TODO(anyone): use dictionary-optimized path for FixedStringDictionarySegments as well.
       if constexpr (std::is_same_v<SegmentType, DictionarySegment<ColumnDataType>>) {
-        // We can use the fact that dictionary segments have an accessor for the dictionary.
+        // We can use the fact that dictionary segments have an accessor for the dictionary. As the dictionary is read
+        // directly, the segment's pages have to be pinned.
+        const auto pin_guard = SharedPagePinGuard{typed_segment.buffer_pages()};
         const auto& dictionary = *typed_segment.dictionary();
         create_pruning_statistics_for_segment(*segment_statistics, dictionary);
       } else {
@@ -1,6 +1,9 @@
 #include "abstract_segment.hpp"
 
+#include <utility>
+
 #include "all_type_variant.hpp"
+#include "storage/buffer/pin_guard.hpp"
 
 namespace hyrise {
 
@@ -10,4 +13,12 @@ DataType AbstractSegment::data_type() const {
   return _data_type;
 }
 
+const SegmentPages& AbstractSegment::buffer_pages() const {
+  return _buffer_pages;
+}
+
+void AbstractSegment::set_buffer_pages(SegmentPages buffer_pages) {
+  _buffer_pages = std::move(buffer_pages);
+}
+
 }  // namespace hyrise
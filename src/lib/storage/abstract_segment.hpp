@@ -5,6 +5,7 @@
 
 #include "all_type_variant.hpp"
 #include "segment_access_counter.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -32,9 +33,17 @@ class AbstractSegment : private Noncopyable {
   // non-primitive data, such as strings, whose memory usage is implementation-defined.
   virtual size_t memory_usage(const MemoryUsageCalculationMode mode) const = 0;
 
+  // The pages of the BufferManager that hold the segment's data. Readers pin them while accessing the segment (see
+  // pin_guard.hpp). Empty if the segment does not live in the buffer pool.
+  const SegmentPages& buffer_pages() const;
+
+  void set_buffer_pages(SegmentPages buffer_pages);
+
   mutable SegmentAccessCounter access_counter;
 
  private:
   const DataType _data_type;
+
+  SegmentPages _buffer_pages;
 };
 }  // namespace hyrise
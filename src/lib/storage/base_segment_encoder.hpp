@@ -9,6 +9,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -141,6 +142,8 @@ class SegmentEncoder : public BaseSegmentEncoder {
   std::shared_ptr<AbstractEncodedSegment> encode(const std::shared_ptr<const AbstractSegment>& abstract_segment,
                                                  hana::basic_type<ColumnDataType> data_type_c) {
     static_assert(decltype(supports(data_type_c))::value);
+    // Encoders might read the segment multiple times. Its pages are pinned once for the entire encoding.
+    const auto pin_guard = SharedPagePinGuard{abstract_segment->buffer_pages()};
     const auto iterable = create_any_segment_iterable<ColumnDataType>(*abstract_segment);
 
     // For now, we allocate without a specific memory source.
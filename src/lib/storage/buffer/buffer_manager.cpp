@@ -0,0 +1,339 @@
+#include "buffer_manager.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "magic_enum.hpp"
+
+#include "storage/buffer/frame.hpp"
+#include "storage/buffer/page_id.hpp"
+#include "storage/buffer/ssd_region.hpp"
+#include "storage/buffer/volatile_region.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+BufferManager::BufferManager() : BufferManager(Config{}) {}
+
+BufferManager::BufferManager(const Config& config)
+    : _dram_buffer_pool_size{config.dram_buffer_pool_size},
+      _ssd_region{std::make_unique<SSDRegion>(config.ssd_path)} {
+  Assert(_dram_buffer_pool_size >= bytes_for_size_type(MAX_PAGE_SIZE_TYPE),
+         "The buffer pool must be able to hold at least one page of the largest size type.");
+  for (auto size_type_index = uint64_t{0}; size_type_index < PAGE_SIZE_TYPES_COUNT; ++size_type_index) {
+    _volatile_regions[size_type_index] = std::make_unique<VolatileRegion>(
+        magic_enum::enum_value<PageSizeType>(size_type_index), config.reserved_virtual_memory_per_size_type);
+    const auto region_page_count = _volatile_regions[size_type_index]->page_count();
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _enqueued_flags[size_type_index] = std::make_unique<std::atomic_flag[]>(region_page_count);
+  }
+}
+
+void BufferManager::pin_shared(const PageID page_id) {
+  auto* const frame = get_frame(page_id);
+
+  while (true) {
+    const auto state_and_version = frame->state_and_version();
+    const auto state = Frame::state(state_and_version);
+
+    if (state == Frame::EVICTED) {
+      // Load the page under an exclusive latch, release it, and retry to acquire the shared latch. Another thread
+      // might acquire an exclusive latch in between, which is fine since we then simply wait for it.
+      if (frame->try_lock_exclusive(state_and_version)) {
+        _make_resident(page_id, frame, state_and_version);
+        frame->unlock_exclusive();
+        _add_to_eviction_queue(page_id, frame->state_and_version());
+      }
+      continue;
+    }
+
+    if ((state < Frame::MAX_LOCKED_SHARED || state == Frame::MARKED) && frame->try_lock_shared(state_and_version)) {
+      return;
+    }
+
+    // The page is locked exclusively (or the maximum number of readers is reached).
+    std::this_thread::yield();
+  }
+}
+
+void BufferManager::unpin_shared(const PageID page_id) {
+  // Shared latches do not remove the page's entry from the eviction queue.
+  get_frame(page_id)->unlock_shared();
+}
+
+void BufferManager::pin_exclusive(const PageID page_id) {
+  auto* const frame = get_frame(page_id);
+
+  while (true) {
+    const auto state_and_version = frame->state_and_version();
+    const auto state = Frame::state(state_and_version);
+
+    if (state == Frame::EVICTED) {
+      if (frame->try_lock_exclusive(state_and_version)) {
+        _make_resident(page_id, frame, state_and_version);
+        return;
+      }
+      continue;
+    }
+
+    if ((state == Frame::UNLOCKED || state == Frame::MARKED) && frame->try_lock_exclusive(state_and_version)) {
+      return;
+    }
+
+    std::this_thread::yield();
+  }
+}
+
+void BufferManager::unpin_exclusive(const PageID page_id) {
+  auto* const frame = get_frame(page_id);
+  frame->unlock_exclusive();
+  // The entry of a locked page might have been dropped from the eviction queue. If it still exists, it is kept.
+  _add_to_eviction_queue(page_id, frame->state_and_version());
+}
+
+PageID BufferManager::allocate_page(const PageSizeType size_type) {
+  auto& page_index_allocator = _page_index_allocators[static_cast<uint64_t>(size_type)];
+  auto page_index = uint64_t{0};
+  {
+    const auto lock = std::lock_guard<std::mutex>{page_index_allocator.mutex};
+    if (!page_index_allocator.free_indexes.empty()) {
+      page_index = page_index_allocator.free_indexes.back();
+      page_index_allocator.free_indexes.pop_back();
+    } else {
+      Assert(page_index_allocator.next_index < page_count(size_type),
+             "No unused pages of size type " + std::string{magic_enum::enum_name(size_type)} + " left.");
+      page_index = page_index_allocator.next_index++;
+    }
+  }
+
+  const auto page_id = PageID{size_type, page_index};
+  auto* const frame = get_frame(page_id);
+  const auto state_and_version = frame->state_and_version();
+  Assert(Frame::state(state_and_version) == Frame::EVICTED, "Unused page is expected to be evicted.");
+  const auto locked = frame->try_lock_exclusive(state_and_version);
+  Assert(locked, "Unused page must not be accessed concurrently.");
+
+  // Unused pages have been released with madvise before. Thus, they contain zeros, and we do not read them from disk.
+  if (!_reserve_memory(page_id.byte_count())) {
+    frame->unlock_exclusive_and_set_evicted();
+    {
+      const auto lock = std::lock_guard<std::mutex>{page_index_allocator.mutex};
+      page_index_allocator.free_indexes.push_back(page_index);
+    }
+    Fail("Cannot evict any page from the buffer pool. All resident pages are pinned.");
+  }
+  frame->mark_dirty();
+  frame->unlock_exclusive();
+
+  return page_id;
+}
+
+void BufferManager::free_page(const PageID page_id) {
+  auto* const frame = get_frame(page_id);
+
+  while (true) {
+    const auto state_and_version = frame->state_and_version();
+    const auto state = Frame::state(state_and_version);
+
+    if (state == Frame::EVICTED || state == Frame::UNLOCKED || state == Frame::MARKED) {
+      if (!frame->try_lock_exclusive(state_and_version)) {
+        continue;
+      }
+
+      if (state != Frame::EVICTED) {
+        _region(page_id.size_type()).free(page_id);
+        _current_bytes_used -= page_id.byte_count();
+      }
+
+      // Setting the page to EVICTED increments the version and thereby invalidates all entries in the eviction queue.
+      frame->reset_dirty();
+      frame->unlock_exclusive_and_set_evicted();
+      break;
+    }
+
+    // The page is still pinned by a concurrent eviction that currently writes it to disk.
+    std::this_thread::yield();
+  }
+
+  auto& page_index_allocator = _page_index_allocators[static_cast<uint64_t>(page_id.size_type())];
+  const auto lock = std::lock_guard<std::mutex>{page_index_allocator.mutex};
+  page_index_allocator.free_indexes.push_back(page_id.index());
+}
+
+void BufferManager::make_evictable(const PageID page_id) {
+  _add_to_eviction_queue(page_id, get_frame(page_id)->state_and_version());
+}
+
+void BufferManager::set_dirty(const PageID page_id) {
+  get_frame(page_id)->mark_dirty();
+}
+
+std::byte* BufferManager::get_page(const PageID page_id) const {
+  return _region(page_id.size_type()).get_page(page_id);
+}
+
+Frame* BufferManager::get_frame(const PageID page_id) {
+  return _region(page_id.size_type()).get_frame(page_id);
+}
+
+PageID BufferManager::find_page(const void* ptr) const {
+  for (const auto& region : _volatile_regions) {
+    const auto page_id = region->find_page(ptr);
+    if (page_id.valid()) {
+      return page_id;
+    }
+  }
+
+  return INVALID_PAGE_ID;
+}
+
+uint64_t BufferManager::page_count(const PageSizeType size_type) const {
+  return _region(size_type).page_count();
+}
+
+uint64_t BufferManager::dram_buffer_pool_size() const {
+  return _dram_buffer_pool_size;
+}
+
+BufferManager::Metrics BufferManager::metrics() const {
+  auto metrics = Metrics{};
+  metrics.current_bytes_used = _current_bytes_used.load();
+  metrics.total_bytes_read_from_ssd = _total_bytes_read_from_ssd.load();
+  metrics.total_bytes_written_to_ssd = _total_bytes_written_to_ssd.load();
+  metrics.total_bytes_evicted = _total_bytes_evicted.load();
+  metrics.total_evictions = _total_evictions.load();
+  return metrics;
+}
+
+VolatileRegion& BufferManager::_region(const PageSizeType size_type) const {
+  return *_volatile_regions[static_cast<uint64_t>(size_type)];
+}
+
+void BufferManager::_make_resident(const PageID page_id, Frame* frame,
+                                   const Frame::StateVersionType state_and_version) {
+  DebugAssert(Frame::state(frame->state_and_version()) == Frame::LOCKED, "Frame must be locked to load the page.");
+  const auto byte_count = page_id.byte_count();
+  if (!_reserve_memory(byte_count)) {
+    // Otherwise, the page would remain locked and block all later accesses.
+    frame->unlock_exclusive_and_set_evicted();
+    Fail("Cannot evict any page from the buffer pool. All resident pages are pinned.");
+  }
+
+  // A page with version 0 has never been resident before. Hence, it has never been written to the SSD, and the freshly
+  // reserved (or released) virtual memory already contains zeros. We can skip reading it.
+  if (Frame::version(state_and_version) == 0) {
+    return;
+  }
+
+  _ssd_region->read_page(page_id, get_page(page_id));
+  _total_bytes_read_from_ssd += byte_count;
+}
+
+bool BufferManager::_reserve_memory(const uint64_t bytes) {
+  _current_bytes_used += bytes;
+
+  auto failed_attempts = uint64_t{0};
+  while (_current_bytes_used.load() > _dram_buffer_pool_size) {
+    if (_try_evict_one()) {
+      failed_attempts = 0;
+      continue;
+    }
+
+    ++failed_attempts;
+    if (failed_attempts >= MAX_EVICTION_ATTEMPTS) {
+      _current_bytes_used -= bytes;
+      return false;
+    }
+    std::this_thread::yield();
+  }
+
+  return true;
+}
+
+bool BufferManager::_try_evict_one() {
+  auto item = EvictionItem{};
+  if (!_eviction_queue.try_pop(item)) {
+    return false;
+  }
+
+  auto* const frame = get_frame(item.page_id);
+  const auto state_and_version = frame->state_and_version();
+
+  switch (Frame::state(state_and_version)) {
+    case Frame::UNLOCKED:
+      // First chance: Mark the page and enqueue it again. If it is still marked when we see it again, it has not been
+      // accessed in the meantime.
+      frame->try_mark(state_and_version);
+      _eviction_queue.push(item);
+      return false;
+
+    case Frame::MARKED:
+      break;
+
+    case Frame::LOCKED:
+    case Frame::EVICTED:
+      // An exclusively locked page is enqueued again when it is unlocked, an evicted page when it is loaded.
+      _drop_from_eviction_queue(item.page_id);
+      return false;
+
+    default:
+      // The page is pinned in shared mode. We keep it in the queue as it might become evictable later.
+      _eviction_queue.push(item);
+      return false;
+  }
+
+  if (!frame->try_lock_exclusive(state_and_version)) {
+    // Someone accessed the page concurrently.
+    _drop_from_eviction_queue(item.page_id);
+    return false;
+  }
+
+  const auto byte_count = item.page_id.byte_count();
+  if (frame->is_dirty()) {
+    _ssd_region->write_page(item.page_id, get_page(item.page_id));
+    frame->reset_dirty();
+    _total_bytes_written_to_ssd += byte_count;
+  }
+
+  _region(item.page_id.size_type()).free(item.page_id);
+  // The flag is cleared while the page is locked. Thus, the page is enqueued again as soon as it is loaded.
+  _is_enqueued(item.page_id).clear();
+  frame->unlock_exclusive_and_set_evicted();
+
+  _current_bytes_used -= byte_count;
+  _total_bytes_evicted += byte_count;
+  ++_total_evictions;
+  return true;
+}
+
+void BufferManager::_add_to_eviction_queue(const PageID page_id, const Frame::StateVersionType state_and_version) {
+  const auto state = Frame::state(state_and_version);
+  if (state == Frame::LOCKED || state == Frame::EVICTED) {
+    return;
+  }
+
+  // Pages are unlocked exclusively far more often than the queue is processed. Without this check, the queue would
+  // grow with each exclusive unpin.
+  if (_is_enqueued(page_id).test_and_set()) {
+    return;
+  }
+
+  _eviction_queue.push(EvictionItem{page_id});
+}
+
+void BufferManager::_drop_from_eviction_queue(const PageID page_id) {
+  // A concurrent _add_to_eviction_queue() might have skipped the page before the flag is cleared. Thus, the state is
+  // checked again afterwards.
+  _is_enqueued(page_id).clear();
+  _add_to_eviction_queue(page_id, get_frame(page_id)->state_and_version());
+}
+
+std::atomic_flag& BufferManager::_is_enqueued(const PageID page_id) {
+  return _enqueued_flags[static_cast<uint64_t>(page_id.size_type())][page_id.index()];
+}
+
+}  // namespace hyrise
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <oneapi/tbb/concurrent_queue.h>  // NOLINT(build/include_order): cpplint identifies TBB as C system headers.
+
+#include "storage/buffer/frame.hpp"
+#include "storage/buffer/page_id.hpp"
+#include "storage/buffer/ssd_region.hpp"
+#include "storage/buffer/volatile_region.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * The BufferManager manages pages of different sizes (see PageSizeType) that are either resident in main memory or
+ * evicted to an SSD file. It follows the design of vmcache ("Virtual-Memory Assisted Buffer Management", Leis et al.,
+ * SIGMOD'23): For each PageSizeType, a VolatileRegion reserves a large range of virtual memory so that each PageID has
+ * a fixed virtual address. Pages are faulted in from the SSDRegion on demand when they are pinned and released again
+ * with madvise(MADV_DONTNEED) when they are evicted.
+ *
+ * Pages must be pinned before they are accessed and unpinned afterwards. Pinning latches the page's Frame either in
+ * shared mode (multiple concurrent readers) or in exclusive mode (single writer). Pinned pages are never evicted.
+ * Writers must call `set_dirty` so that modified pages are written back to the SSD before their memory is released.
+ *
+ * Eviction follows the Second-Chance (Clock) policy: Every page that becomes resident or is unlocked exclusively is
+ * added to the eviction queue unless it already has an entry. Thus, the queue holds at most one entry per page. When
+ * memory is needed, the queue is processed. An UNLOCKED page is MARKED and enqueued again. A page that is still MARKED
+ * when it is dequeued the second time has not been accessed in the meantime and is evicted. Since any access (shared
+ * or exclusive latch) resets the MARKED state, frequently accessed pages survive. Entries of pages that are locked
+ * exclusively or evicted are dropped. These pages are enqueued again when they are unlocked or loaded.
+ *
+ * Eviction is performed synchronously by the threads that need memory. There is no background eviction thread.
+ */
+class BufferManager final : public Noncopyable {
+ public:
+  struct Config {
+    // Maximum number of bytes of main memory used for resident pages.
+    uint64_t dram_buffer_pool_size = uint64_t{1} << 30;  // 1 GiB
+
+    // Number of bytes of virtual memory reserved for each PageSizeType. This limits the number of pages per size type.
+    uint64_t reserved_virtual_memory_per_size_type = uint64_t{1} << 34;  // 16 GiB
+
+    // Directory in which the SSDRegion stores evicted pages.
+    std::filesystem::path ssd_path = std::filesystem::temp_directory_path() / "hyrise_buffer_pool";
+  };
+
+  struct Metrics {
+    // Number of bytes currently used by resident pages.
+    uint64_t current_bytes_used = 0;
+
+    // Total number of bytes read from the SSD.
+    uint64_t total_bytes_read_from_ssd = 0;
+
+    // Total number of bytes written to the SSD.
+    uint64_t total_bytes_written_to_ssd = 0;
+
+    // Total number of bytes released from main memory due to eviction.
+    uint64_t total_bytes_evicted = 0;
+
+    // Total number of evicted pages.
+    uint64_t total_evictions = 0;
+  };
+
+  BufferManager();
+
+  explicit BufferManager(const Config& config);
+
+  /**
+   * Pins the page in shared mode. If the page is not resident, it is loaded from the SSD first. Multiple threads can
+   * pin a page in shared mode concurrently. Blocks while the page is pinned exclusively.
+   */
+  void pin_shared(const PageID page_id);
+
+  // Unpins a page that was pinned in shared mode.
+  void unpin_shared(const PageID page_id);
+
+  /**
+   * Pins the page in exclusive mode. If the page is not resident, it is loaded from the SSD first. Blocks while the
+   * page is pinned by any other thread.
+   */
+  void pin_exclusive(const PageID page_id);
+
+  // Unpins a page that was pinned in exclusive mode and makes it a candidate for eviction.
+  void unpin_exclusive(const PageID page_id);
+
+  /**
+   * Returns an unused page of the given size type. The page is resident, unpinned, and marked as dirty. Newly
+   * allocated pages are not considered for eviction until `make_evictable` is called for them. This allows callers to
+   * fill a page without holding a pin, e.g., when a page is handed out by a memory resource and written by a container.
+   */
+  PageID allocate_page(const PageSizeType size_type);
+
+  // Releases the page's memory and returns it to the pool of unused pages. The page must not be pinned.
+  void free_page(const PageID page_id);
+
+  // Adds a page that was returned by `allocate_page` to the eviction queue.
+  void make_evictable(const PageID page_id);
+
+  // Marks the page as modified so that it is written back to the SSD on eviction. Requires an exclusive pin.
+  void set_dirty(const PageID page_id);
+
+  // Returns the virtual memory address of the page. The content is only valid while the page is pinned.
+  std::byte* get_page(const PageID page_id) const;
+
+  // Returns the frame (i.e., latching state and version) of the page.
+  Frame* get_frame(const PageID page_id);
+
+  // Returns the PageID of the page that contains the address or INVALID_PAGE_ID if it is not part of the buffer pool.
+  PageID find_page(const void* ptr) const;
+
+  // Returns the number of pages that can be addressed for the given PageSizeType.
+  uint64_t page_count(const PageSizeType size_type) const;
+
+  // Returns the maximum number of bytes of main memory used for resident pages.
+  uint64_t dram_buffer_pool_size() const;
+
+  Metrics metrics() const;
+
+ private:
+  // Unused page indexes of a size type. Indexes of freed pages are reused before new indexes are handed out.
+  struct PageIndexAllocator {
+    std::mutex mutex;
+    std::vector<uint64_t> free_indexes;
+    uint64_t next_index{0};
+  };
+
+  // Entry of the eviction queue. PageID is not default-constructible, which tbb::concurrent_queue requires.
+  struct EvictionItem {
+    PageID page_id{INVALID_PAGE_ID};
+  };
+
+  // Number of consecutive unsuccessful eviction attempts after which we assume that all resident pages are pinned.
+  static constexpr uint64_t MAX_EVICTION_ATTEMPTS = 1'000'000;
+
+  VolatileRegion& _region(const PageSizeType size_type) const;
+
+  // Loads the page from the SSD. The frame must be locked exclusively. If the page cannot be loaded because all
+  // resident pages are pinned, the frame is set to EVICTED again before the error is thrown.
+  void _make_resident(const PageID page_id, Frame* frame, const Frame::StateVersionType state_and_version);
+
+  // Evicts pages until `bytes` additional bytes fit into the buffer pool and accounts for them. Returns false without
+  // accounting for the bytes if no page can be evicted, i.e., all resident pages are pinned.
+  bool _reserve_memory(const uint64_t bytes);
+
+  // Processes a single item of the eviction queue. Returns true if a page has been evicted.
+  bool _try_evict_one();
+
+  // Enqueues the page unless it is locked exclusively, evicted, or already enqueued.
+  void _add_to_eviction_queue(const PageID page_id, const Frame::StateVersionType state_and_version);
+
+  // Removes the page's entry from the eviction queue after it has been dequeued. If the page has become evictable in
+  // the meantime, it is enqueued again, as _add_to_eviction_queue() skipped it while the entry existed.
+  void _drop_from_eviction_queue(const PageID page_id);
+
+  // Flag that is set while the page has an entry in the eviction queue.
+  std::atomic_flag& _is_enqueued(const PageID page_id);
+
+  const uint64_t _dram_buffer_pool_size;
+
+  std::array<std::unique_ptr<VolatileRegion>, PAGE_SIZE_TYPES_COUNT> _volatile_regions;
+  std::unique_ptr<SSDRegion> _ssd_region;
+
+  std::array<PageIndexAllocator, PAGE_SIZE_TYPES_COUNT> _page_index_allocators;
+
+  tbb::concurrent_queue<EvictionItem> _eviction_queue;
+
+  // For each PageSizeType, one flag per page that indicates whether the page has an entry in the eviction queue.
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+  std::array<std::unique_ptr<std::atomic_flag[]>, PAGE_SIZE_TYPES_COUNT> _enqueued_flags;
+
+  std::atomic<uint64_t> _current_bytes_used{0};
+  std::atomic<uint64_t> _total_bytes_read_from_ssd{0};
+  std::atomic<uint64_t> _total_bytes_written_to_ssd{0};
+  std::atomic<uint64_t> _total_bytes_evicted{0};
+  std::atomic<uint64_t> _total_evictions{0};
+};
+
+}  // namespace hyrise
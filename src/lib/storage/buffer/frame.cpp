@@ -53,8 +53,8 @@ void Frame::unlock_exclusive_and_set_evicted() {
 
 bool Frame::try_mark(const Frame::StateVersionType old_state_and_version) {
   DebugAssert(
-      state(_state_and_version.load()) == UNLOCKED,
-      "Frame must be UNLOCKED to transition to MARKED, instead: " + std::to_string(state(_state_and_version.load())));
+      state(old_state_and_version) == UNLOCKED,
+      "Frame must be UNLOCKED to transition to MARKED, instead: " + std::to_string(state(old_state_and_version)));
   auto state_and_version = old_state_and_version;
   return _state_and_version.compare_exchange_strong(state_and_version,
                                                     _update_state_with_same_version(old_state_and_version, MARKED));
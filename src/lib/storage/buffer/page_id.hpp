@@ -1,7 +1,9 @@
 #pragma once
 
 #include <bit>
+#include <functional>
 #include <limits>
+#include <ostream>
 
 #include "magic_enum.hpp"
 
@@ -96,7 +98,7 @@ struct PageID {
 
 static_assert(sizeof(PageID) == 8, "PageID must be 64 bit");
 
-std::ostream& operator<<(std::ostream& os, const PageID& page_id) {
+inline std::ostream& operator<<(std::ostream& os, const PageID& page_id) {
   os << "PageID(valid = " << page_id.valid() << ", size_type = " << magic_enum::enum_name(page_id.size_type())
      << ", index = " << page_id.index() << ")";
   return os;
@@ -107,3 +109,15 @@ std::ostream& operator<<(std::ostream& os, const PageID& page_id) {
 static constexpr PageID INVALID_PAGE_ID = PageID{MIN_PAGE_SIZE_TYPE, 0, false};
 
 }  // namespace hyrise
+
+namespace std {
+
+template <>
+struct hash<hyrise::PageID> {
+  size_t operator()(const hyrise::PageID& page_id) const {
+    return std::hash<uint64_t>{}((page_id.index() << hyrise::PAGE_SIZE_TYPE_BITS) |
+                                 static_cast<uint64_t>(page_id.size_type()));
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,53 @@
+#include "pin_guard.hpp"
+
+#include <cstdint>
+
+#include "storage/buffer/buffer_manager.hpp"
+#include "storage/buffer/frame.hpp"
+
+namespace hyrise {
+
+void SharedPagePinGuard::_pin() {
+  for (const auto page_id : _pages.page_ids) {
+    _pages.buffer_manager->pin_shared(page_id);
+  }
+}
+
+void SharedPagePinGuard::_unpin() {
+  for (const auto page_id : _pages.page_ids) {
+    _pages.buffer_manager->unpin_shared(page_id);
+  }
+}
+
+uint64_t OptimisticPageGuard::_begin_optimistic_read() const {
+  auto version_sum = uint64_t{0};
+  for (const auto page_id : _pages.page_ids) {
+    const auto state_and_version = _pages.buffer_manager->get_frame(page_id)->state_and_version();
+    const auto state = Frame::state(state_and_version);
+    if (state == Frame::LOCKED || state == Frame::EVICTED) {
+      return INVALID_VERSION_SUM;
+    }
+    version_sum += Frame::version(state_and_version);
+  }
+
+  // Resident pages have been unlocked exclusively at least once and thus have a version of at least one.
+  return version_sum;
+}
+
+bool OptimisticPageGuard::_validate_optimistic_read(const uint64_t version_sum) const {
+  return _begin_optimistic_read() == version_sum;
+}
+
+void OptimisticPageGuard::_pin_shared(const SegmentPages& pages) {
+  for (const auto page_id : pages.page_ids) {
+    pages.buffer_manager->pin_shared(page_id);
+  }
+}
+
+void OptimisticPageGuard::_unpin_shared(const SegmentPages& pages) {
+  for (const auto page_id : pages.page_ids) {
+    pages.buffer_manager->unpin_shared(page_id);
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/buffer/page_id.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BufferManager;
+
+/**
+ * The pages of a BufferManager that hold the data of a segment (see BufferPoolResource::migrate_segment). The page
+ * IDs are sorted so that all readers pin them in the same order. Segments that do not live in the buffer pool have no
+ * pages, and the guards below do not do anything for them.
+ */
+struct SegmentPages {
+  BufferManager* buffer_manager{nullptr};
+  std::vector<PageID> page_ids;
+};
+
+/**
+ * RAII guard that pins all pages of a segment in shared mode for its lifetime. The iterables use it for the duration of
+ * `with_iterators` so that a concurrent eviction cannot release the segment's memory while it is being scanned.
+ * Acquiring the latches costs one atomic operation per page, which is negligible compared to a scan.
+ */
+class SharedPagePinGuard final : public Noncopyable {
+ public:
+  explicit SharedPagePinGuard(const SegmentPages& pages) : _pages{pages} {
+    if (!_pages.page_ids.empty()) {
+      _pin();
+    }
+  }
+
+  ~SharedPagePinGuard() {
+    if (!_pages.page_ids.empty()) {
+      _unpin();
+    }
+  }
+
+ private:
+  void _pin();
+  void _unpin();
+
+  const SegmentPages& _pages;
+};
+
+/**
+ * Guard for short reads (e.g., single values read by segment accessors). For segments that span only a few pages,
+ * reads are executed optimistically without acquiring any latch: Before the read, we check that all pages are resident
+ * and remember their versions. Afterwards, we validate that no page has been locked exclusively, evicted, or modified
+ * in the meantime (each of these increments the page's version). If the validation fails, the read is repeated while
+ * the pages are pinned in shared mode. Optimistic reads do not write to the frames and thereby avoid cache line
+ * contention on frequently accessed pages. The read functor must be free of side effects as it might be executed
+ * twice. Furthermore, it must not follow pointers or positions that it reads from the pages, as these might be garbage
+ * if a page is concurrently evicted and reused. As the validation costs one atomic load per page, segments with more
+ * than MAX_OPTIMISTIC_PAGE_COUNT pages (or readers that do not permit optimistic reads) are instead pinned in shared
+ * mode for the guard's lifetime.
+ */
+class OptimisticPageGuard final : public Noncopyable {
+ public:
+  static constexpr auto MAX_OPTIMISTIC_PAGE_COUNT = size_t{8};
+
+  explicit OptimisticPageGuard(const SegmentPages& pages, const bool allow_optimistic_reads = true)
+      : _pages{pages},
+        _pinned{!_pages.page_ids.empty() &&
+                (!allow_optimistic_reads || _pages.page_ids.size() > MAX_OPTIMISTIC_PAGE_COUNT)} {
+    if (_pinned) {
+      _pin_shared(_pages);
+    }
+  }
+
+  ~OptimisticPageGuard() {
+    if (_pinned) {
+      _unpin_shared(_pages);
+    }
+  }
+
+  template <typename Functor>
+  auto read(const Functor& functor) const {
+    if (_pinned || _pages.page_ids.empty()) {
+      return functor();
+    }
+
+    const auto version_sum = _begin_optimistic_read();
+    if (version_sum != INVALID_VERSION_SUM) {
+      try {
+        auto result = functor();
+        if (_validate_optimistic_read(version_sum)) {
+          return result;
+        }
+      } catch (...) {
+        // The functor might fail when it reads data that is concurrently evicted. Only if the read was valid, the
+        // exception is genuine.
+        if (_validate_optimistic_read(version_sum)) {
+          throw;
+        }
+      }
+    }
+
+    // Fall back to shared latches.
+    _pin_shared(_pages);
+    try {
+      auto result = functor();
+      _unpin_shared(_pages);
+      return result;
+    } catch (...) {
+      _unpin_shared(_pages);
+      throw;
+    }
+  }
+
+ private:
+  static constexpr auto INVALID_VERSION_SUM = uint64_t{0};
+
+  // Returns the sum of all page versions or INVALID_VERSION_SUM if any page is not resident or locked exclusively.
+  // Since versions only increase, the sum changes whenever a single version changes.
+  uint64_t _begin_optimistic_read() const;
+
+  bool _validate_optimistic_read(const uint64_t version_sum) const;
+
+  static void _pin_shared(const SegmentPages& pages);
+  static void _unpin_shared(const SegmentPages& pages);
+
+  const SegmentPages& _pages;
+  const bool _pinned;
+};
+
+}  // namespace hyrise
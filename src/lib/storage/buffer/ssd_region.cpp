@@ -0,0 +1,81 @@
+#include "ssd_region.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include "magic_enum.hpp"
+
+#include "storage/buffer/page_id.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+SSDRegion::SSDRegion(const std::filesystem::path& directory) : _directory{directory} {
+  std::filesystem::create_directories(_directory);
+
+  for (auto size_type_index = uint64_t{0}; size_type_index < PAGE_SIZE_TYPES_COUNT; ++size_type_index) {
+    const auto size_type = magic_enum::enum_value<PageSizeType>(size_type_index);
+    const auto path = _file_path(size_type);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    const auto file_descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    Assert(file_descriptor >= 0,
+           "Failed to open SSDRegion file '" + path.string() + "': " + std::string{std::strerror(errno)});
+    _file_descriptors[size_type_index] = file_descriptor;
+  }
+}
+
+SSDRegion::~SSDRegion() {
+  for (auto size_type_index = uint64_t{0}; size_type_index < PAGE_SIZE_TYPES_COUNT; ++size_type_index) {
+    close(_file_descriptors[size_type_index]);
+    std::filesystem::remove(_file_path(magic_enum::enum_value<PageSizeType>(size_type_index)));
+  }
+}
+
+void SSDRegion::write_page(const PageID page_id, const std::byte* data) {
+  const auto byte_count = page_id.byte_count();
+  const auto file_descriptor = _file_descriptors[static_cast<uint64_t>(page_id.size_type())];
+  const auto offset = static_cast<off_t>(page_id.index() * byte_count);
+
+  auto bytes_written = uint64_t{0};
+  while (bytes_written < byte_count) {
+    const auto result = pwrite(file_descriptor, data + bytes_written, byte_count - bytes_written,
+                               offset + static_cast<off_t>(bytes_written));
+    Assert(result > 0, "Failed to write page to SSDRegion: " + std::string{std::strerror(errno)});
+    bytes_written += static_cast<uint64_t>(result);
+  }
+}
+
+void SSDRegion::read_page(const PageID page_id, std::byte* data) {
+  const auto byte_count = page_id.byte_count();
+  const auto file_descriptor = _file_descriptors[static_cast<uint64_t>(page_id.size_type())];
+  const auto offset = static_cast<off_t>(page_id.index() * byte_count);
+
+  auto bytes_read = uint64_t{0};
+  while (bytes_read < byte_count) {
+    const auto result =
+        pread(file_descriptor, data + bytes_read, byte_count - bytes_read, offset + static_cast<off_t>(bytes_read));
+    Assert(result >= 0, "Failed to read page from SSDRegion: " + std::string{std::strerror(errno)});
+    if (result == 0) {
+      // The page lies (partially) behind the end of the file, i.e., it has never been written.
+      std::memset(data + bytes_read, 0, byte_count - bytes_read);
+      break;
+    }
+    bytes_read += static_cast<uint64_t>(result);
+  }
+}
+
+const std::filesystem::path& SSDRegion::directory() const {
+  return _directory;
+}
+
+std::filesystem::path SSDRegion::_file_path(const PageSizeType size_type) const {
+  return _directory / ("hyrise_buffer_" + std::string{magic_enum::enum_name(size_type)} + ".bin");
+}
+
+}  // namespace hyrise
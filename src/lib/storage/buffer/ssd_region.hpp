@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+
+#include "storage/buffer/page_id.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * The SSDRegion is the disk-based backing store of the BufferManager. For each PageSizeType, it opens a separate file
+ * in the given directory. A page is stored at offset `index * page size` in the file of its size type, so that the
+ * location of a page on disk can be computed from its PageID without any additional mapping. Files are sparse, i.e.,
+ * pages that have never been written do not occupy disk space and are read back as zeros. As the buffer pool is not
+ * (yet) used for durability, the files are truncated when the region is created and deleted when it is destroyed.
+ */
+class SSDRegion final : public Noncopyable {
+ public:
+  explicit SSDRegion(const std::filesystem::path& directory);
+
+  ~SSDRegion();
+
+  // Writes the page at `data` to disk. The memory must be at least `page_id.byte_count()` bytes large.
+  void write_page(const PageID page_id, const std::byte* data);
+
+  // Reads the page from disk into `data`. Pages that have never been written are filled with zeros.
+  void read_page(const PageID page_id, std::byte* data);
+
+  // Returns the directory in which the page files are stored.
+  const std::filesystem::path& directory() const;
+
+ private:
+  std::filesystem::path _file_path(const PageSizeType size_type) const;
+
+  const std::filesystem::path _directory;
+  std::array<int, PAGE_SIZE_TYPES_COUNT> _file_descriptors{};
+};
+
+}  // namespace hyrise
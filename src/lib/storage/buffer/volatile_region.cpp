@@ -0,0 +1,78 @@
+#include "volatile_region.hpp"
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "magic_enum.hpp"
+
+#include "storage/buffer/frame.hpp"
+#include "storage/buffer/page_id.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+VolatileRegion::VolatileRegion(const PageSizeType size_type, const uint64_t reserved_bytes)
+    : _size_type{size_type},
+      _page_count{reserved_bytes / bytes_for_size_type(size_type)},
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+      _frames{std::make_unique<Frame[]>(_page_count)} {
+  Assert(_page_count > 0, "VolatileRegion must be able to hold at least one page of " +
+                              std::string{magic_enum::enum_name(size_type)} + ".");
+
+  // MAP_NORESERVE ensures that the OS does not reserve swap space for the (potentially huge) virtual memory range.
+  // Physical memory is only allocated when a page is touched.
+  const auto reserved_size = _page_count * bytes_for_size_type(size_type);
+  auto* const data = mmap(nullptr, reserved_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                          -1, 0);
+  Assert(data != MAP_FAILED,
+         std::string{"Failed to reserve virtual memory for VolatileRegion: "} + std::strerror(errno));
+  _data = static_cast<std::byte*>(data);
+}
+
+VolatileRegion::~VolatileRegion() {
+  munmap(_data, _page_count * bytes_for_size_type(_size_type));
+}
+
+PageSizeType VolatileRegion::size_type() const {
+  return _size_type;
+}
+
+uint64_t VolatileRegion::page_count() const {
+  return _page_count;
+}
+
+std::byte* VolatileRegion::get_page(const PageID page_id) const {
+  DebugAssert(page_id.valid() && page_id.size_type() == _size_type, "PageID does not belong to this region.");
+  DebugAssert(page_id.index() < _page_count, "PageID index is out of bounds for this region.");
+  return _data + page_id.index() * bytes_for_size_type(_size_type);
+}
+
+Frame* VolatileRegion::get_frame(const PageID page_id) {
+  DebugAssert(page_id.valid() && page_id.size_type() == _size_type, "PageID does not belong to this region.");
+  DebugAssert(page_id.index() < _page_count, "PageID index is out of bounds for this region.");
+  return &_frames[page_id.index()];
+}
+
+PageID VolatileRegion::find_page(const void* ptr) const {
+  const auto* const byte_ptr = static_cast<const std::byte*>(ptr);
+  const auto page_size = bytes_for_size_type(_size_type);
+  if (byte_ptr < _data || byte_ptr >= _data + _page_count * page_size) {
+    return INVALID_PAGE_ID;
+  }
+
+  return PageID{_size_type, static_cast<uint64_t>(byte_ptr - _data) / page_size};
+}
+
+void VolatileRegion::free(const PageID page_id) {
+  DebugAssert(Frame::state(get_frame(page_id)->state_and_version()) == Frame::LOCKED,
+              "Page must be locked exclusively to be freed.");
+  const auto result = madvise(get_page(page_id), bytes_for_size_type(_size_type), MADV_DONTNEED);
+  Assert(result == 0, std::string{"Failed to release memory of page with madvise: "} + std::strerror(errno));
+}
+
+}  // namespace hyrise
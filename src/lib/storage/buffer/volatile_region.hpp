@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "storage/buffer/frame.hpp"
+#include "storage/buffer/page_id.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * A VolatileRegion reserves a contiguous range of virtual memory for all pages of a single PageSizeType and holds the
+ * Frame for each of these pages. Following "Virtual-Memory Assisted Buffer Management" (Leis et al., SIGMOD'23), the
+ * virtual memory is reserved once with mmap and never unmapped during the lifetime of the region. Physical memory is
+ * only backed by the OS on first access (page fault) and is released again with madvise(MADV_DONTNEED) on eviction.
+ * Thereby, each PageID maps to a fixed virtual address (start + index * page size) and vice versa, which makes address
+ * translation a simple pointer computation instead of a hash table lookup.
+ */
+class VolatileRegion final : public Noncopyable {
+ public:
+  VolatileRegion(const PageSizeType size_type, const uint64_t reserved_bytes);
+
+  ~VolatileRegion();
+
+  // Returns the PageSizeType of all pages in the region.
+  PageSizeType size_type() const;
+
+  // Returns the number of pages that can be addressed in this region.
+  uint64_t page_count() const;
+
+  // Returns the virtual memory address of the page. The page does not need to be resident.
+  std::byte* get_page(const PageID page_id) const;
+
+  // Returns the frame (i.e., latch and version) of the page.
+  Frame* get_frame(const PageID page_id);
+
+  // Returns the PageID of the page that contains the given address or INVALID_PAGE_ID if the address is not part of
+  // the region.
+  PageID find_page(const void* ptr) const;
+
+  // Releases the physical memory of the page with madvise(MADV_DONTNEED). The page must be locked exclusively. After
+  // the call, the page reads as zeros.
+  void free(const PageID page_id);
+
+ private:
+  const PageSizeType _size_type;
+  const uint64_t _page_count;
+  std::byte* _data;
+  std::unique_ptr<Frame[]> _frames;  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+};
+
+}  // namespace hyrise
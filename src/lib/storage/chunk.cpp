@@ -14,7 +14,10 @@
 #include "all_type_variant.hpp"
 #include "base_value_segment.hpp"
 #include "index/abstract_chunk_index.hpp"
+#include "memory/buffer_pool_resource.hpp"
+#include "memory/numa_memory_resource.hpp"
 #include "reference_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/segment_iterate.hpp"
@@ -133,6 +136,13 @@ std::vector<std::shared_ptr<AbstractChunkIndex>> Chunk::get_indexes(const std::v
   return get_indexes(segments);
 }
 
+bool Chunk::is_indexed(const ColumnID column_id) const {
+  const auto segment = std::shared_ptr<const AbstractSegment>{get_segment(column_id)};
+  return std::any_of(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
+    return index->covers(segment);
+  });
+}
+
 std::shared_ptr<AbstractChunkIndex> Chunk::get_index(
     const ChunkIndexType index_type, const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
   auto index_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
@@ -190,11 +200,32 @@ void Chunk::migrate(MemoryResource& memory_resource) {
     Fail("Cannot migrate chunk with indexes.");
   }
 
+  // Segments that are migrated into the buffer pool are registered with their pages so that readers can pin them. The
+  // segment vector itself is accessed without pins and thus remains in the default memory resource.
+  if (auto* const buffer_pool_resource = dynamic_cast<BufferPoolResource*>(&memory_resource)) {
+    auto new_segments = Segments{};
+    new_segments.reserve(_segments.size());
+    for (const auto& segment : _segments) {
+      new_segments.push_back(buffer_pool_resource->migrate_segment(*segment));
+    }
+    _segments = std::move(new_segments);
+    _numa_node_id = INVALID_NODE_ID;
+    return;
+  }
+
   auto new_segments = Segments(&memory_resource);
   for (const auto& segment : _segments) {
+    const auto pin_guard = SharedPagePinGuard{segment->buffer_pages()};
     new_segments.push_back(segment->copy_using_memory_resource(memory_resource));
   }
   _segments = std::move(new_segments);
+
+  const auto* const numa_memory_resource = dynamic_cast<const NumaMemoryResource*>(&memory_resource);
+  _numa_node_id = numa_memory_resource ? numa_memory_resource->node_id() : INVALID_NODE_ID;
+}
+
+NodeID Chunk::numa_node_id() const {
+  return _numa_node_id;
 }
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const {
@@ -87,6 +87,10 @@ class Chunk : private Noncopyable {
       const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
   std::vector<std::shared_ptr<AbstractChunkIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
 
+  // Returns whether any index covers the column. Unlike get_indexes(), this includes multi-column indexes in which the
+  // column is not the first one.
+  bool is_indexed(const ColumnID column_id) const;
+
   std::shared_ptr<AbstractChunkIndex> get_index(
       const ChunkIndexType index_type, const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
   std::shared_ptr<AbstractChunkIndex> get_index(const ChunkIndexType index_type,
@@ -115,8 +119,16 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<AbstractChunkIndex>& index);
 
+  /**
+   * Copies the segments using the given memory resource. If the resource is a NumaMemoryResource, the chunk remembers
+   * the resource's node (see numa_node_id()).
+   */
   void migrate(MemoryResource& memory_resource);
 
+  // Node on which the segments have been placed by migrate(). INVALID_NODE_ID if the chunk has not been placed. Jobs
+  // that process the chunk should prefer this node (see AbstractTask::set_preferred_node_id).
+  NodeID numa_node_id() const;
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -204,6 +216,7 @@ class Chunk : private Noncopyable {
   std::atomic_bool _is_mutable{true};
   std::atomic_bool _reached_target_size{false};
   std::vector<SortColumnDefinition> _sorted_by;
+  NodeID _numa_node_id{INVALID_NODE_ID};
   mutable std::atomic<ChunkOffset::base_type> _invalid_row_count{ChunkOffset::base_type{0}};
 
   // Default value of zero (beginning of time) means "not set".
@@ -11,6 +11,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/segment_access_counter.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -40,6 +41,7 @@ template <typename T>
 AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Dictionary] += 1;
   const auto typed_value = get_typed_value(chunk_offset);
   if (!typed_value) {
@@ -74,6 +76,8 @@ size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode mode)
   const auto common_elements_size = sizeof(*this) + _attribute_vector->data_size();
 
   if constexpr (std::is_same_v<T, pmr_string>) {
+    // The sizes of the strings' heap buffers are read from the strings themselves.
+    const auto pin_guard = SharedPagePinGuard{buffer_pages()};
     return common_elements_size + string_vector_memory_usage(*_dictionary, mode);
   }
   return common_elements_size + _dictionary->size() * sizeof(typename decltype(_dictionary)::element_type::value_type);
@@ -92,6 +96,7 @@ EncodingType DictionarySegment<T>::encoding_type() const {
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
   DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Dictionary] +=
       static_cast<uint64_t>(std::ceil(std::log2(_dictionary->size())));
   const auto typed_value = boost::get<T>(value);
@@ -106,6 +111,7 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
   DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Dictionary] +=
       static_cast<uint64_t>(std::ceil(std::log2(_dictionary->size())));
   const auto typed_value = boost::get<T>(value);
@@ -120,6 +126,7 @@ ValueID DictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
 template <typename T>
 AllTypeVariant DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   DebugAssert(value_id < _dictionary->size(), "ValueID out of bounds");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Dictionary] += 1;
   return (*_dictionary)[value_id];
 }
@@ -15,10 +15,12 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
   explicit AttributeVectorIterable(const BaseDictionarySegment& segment, const ValueID null_value_id)
       : _attribute_vector{*segment.attribute_vector()},
         _null_value_id{null_value_id},
-        _access_counter(segment.access_counter) {}
+        _access_counter(segment.access_counter),
+        _buffer_pages{segment.buffer_pages()} {}
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_buffer_pages};
     resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
       using CompressedVectorIterator = decltype(vector.cbegin());
 
@@ -33,6 +35,7 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
 
   template <typename Functor, typename PosListType>
   void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_buffer_pages};
     resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
       using Decompressor = std::decay_t<decltype(vector.create_decompressor())>;
 
@@ -55,6 +58,7 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
   const BaseCompressedVector& _attribute_vector;
   const ValueID _null_value_id;
   SegmentAccessCounter& _access_counter;
+  const SegmentPages& _buffer_pages;
 
  private:
   template <typename CompressedVectorIterator>
@@ -3,11 +3,13 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include "storage/base_segment_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -95,6 +97,13 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
       auto fixed_string_dictionary =
           std::make_shared<FixedStringVector>(dictionary->cbegin(), dictionary->cend(), max_string_length, allocator);
       return std::make_shared<FixedStringDictionarySegment<T>>(fixed_string_dictionary, compressed_attribute_vector);
+    } else if constexpr (Encoding == EncodingType::FSSTDictionary) {
+      // Encode a segment with an FSSTStringVector as dictionary. pmr_string is the only supported type. The offsets of
+      // the compressed dictionary entries use the same vector compression as the attribute vector.
+      auto fsst_dictionary = std::make_shared<FSSTStringVector>(
+          std::vector<std::string_view>(dictionary->cbegin(), dictionary->cend()),
+          SegmentEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), allocator);
+      return std::make_shared<FSSTDictionarySegment<T>>(fsst_dictionary, compressed_attribute_vector);
     } else {
       // Encode a segment with a pmr_vector<T> as dictionary
       return std::make_shared<DictionarySegment<T>>(dictionary, compressed_attribute_vector);
@@ -14,6 +14,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -37,6 +38,7 @@ template <typename T>
 AllTypeVariant FixedStringDictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
 
   const auto typed_value = get_typed_value(chunk_offset);
   if (!typed_value) {
@@ -98,6 +100,7 @@ EncodingType FixedStringDictionarySegment<T>::encoding_type() const {
 template <typename T>
 ValueID FixedStringDictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
   DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
 
   const auto typed_value = boost::get<pmr_string>(value);
 
@@ -111,6 +114,7 @@ ValueID FixedStringDictionarySegment<T>::lower_bound(const AllTypeVariant& value
 template <typename T>
 ValueID FixedStringDictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
   DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
 
   const auto typed_value = boost::get<pmr_string>(value);
 
@@ -124,6 +128,7 @@ ValueID FixedStringDictionarySegment<T>::upper_bound(const AllTypeVariant& value
 template <typename T>
 AllTypeVariant FixedStringDictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   DebugAssert(value_id < _dictionary->size(), "ValueID out of bounds");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   return _dictionary->get_string_at(value_id);
 }
 
@@ -5,12 +5,14 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "types.hpp"
@@ -20,17 +22,30 @@
 namespace hyrise {
 
 template <typename T, typename U>
-FrameOfReferenceSegment<T, U>::FrameOfReferenceSegment(pmr_vector<T> block_minima,
+FrameOfReferenceSegment<T, U>::FrameOfReferenceSegment(pmr_vector<EncodedType> block_minima,
                                                        std::optional<pmr_vector<bool>> null_values,
-                                                       std::unique_ptr<const BaseCompressedVector> offset_values)
+                                                       std::unique_ptr<const BaseCompressedVector> offset_values,
+                                                       pmr_vector<EncodedType> block_steps,
+                                                       pmr_vector<ChunkOffset> exception_positions,
+                                                       pmr_vector<T> exception_values, const uint8_t decimal_exponent)
     : AbstractEncodedSegment{data_type_from_type<T>()},
       _block_minima{std::move(block_minima)},
       _null_values{std::move(null_values)},
       _offset_values{std::move(offset_values)},
-      _decompressor{_offset_values->create_base_decompressor()} {}
+      _block_steps{std::move(block_steps)},
+      _exception_positions{std::move(exception_positions)},
+      _exception_values{std::move(exception_values)},
+      _decimal_exponent{decimal_exponent},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  Assert(_block_steps.empty() || _block_steps.size() == _block_minima.size(), "Expected one step per block.");
+  Assert(_exception_positions.size() == _exception_values.size(), "Expected one value per exception.");
+  Assert(std::is_floating_point_v<T> || _decimal_exponent == 0, "Only floating-point values are encoded as decimals.");
+  Assert(_decimal_exponent <= max_decimal_exponent, "Decimal exponent is too large.");
+}
 
 template <typename T, typename U>
-const pmr_vector<T>& FrameOfReferenceSegment<T, U>::block_minima() const {
+const pmr_vector<typename FrameOfReferenceSegment<T, U>::EncodedType>& FrameOfReferenceSegment<T, U>::block_minima()
+    const {
   return _block_minima;
 }
 
@@ -44,10 +59,32 @@ const BaseCompressedVector& FrameOfReferenceSegment<T, U>::offset_values() const
   return *_offset_values;
 }
 
+template <typename T, typename U>
+const pmr_vector<typename FrameOfReferenceSegment<T, U>::EncodedType>& FrameOfReferenceSegment<T, U>::block_steps()
+    const {
+  return _block_steps;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& FrameOfReferenceSegment<T, U>::exception_positions() const {
+  return _exception_positions;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& FrameOfReferenceSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+uint8_t FrameOfReferenceSegment<T, U>::decimal_exponent() const {
+  return _decimal_exponent;
+}
+
 template <typename T, typename U>
 AllTypeVariant FrameOfReferenceSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
   DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
 
   const auto typed_value = get_typed_value(chunk_offset);
   if (!typed_value) {
@@ -64,14 +101,17 @@ ChunkOffset FrameOfReferenceSegment<T, U>::size() const {
 template <typename T, typename U>
 std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_memory_resource(
     MemoryResource& memory_resource) const {
-  auto new_block_minima = pmr_vector<T>(_block_minima, &memory_resource);
+  auto new_block_minima = pmr_vector<EncodedType>(_block_minima, &memory_resource);
   auto new_offset_values = _offset_values->copy_using_memory_resource(memory_resource);
 
   auto null_values = _null_values ? pmr_vector<bool>(*_null_values, &memory_resource) :
     std::optional<pmr_vector<bool>>{};
 
-  auto copy = std::make_shared<FrameOfReferenceSegment>(std::move(new_block_minima), std::move(null_values),
-                                                        std::move(new_offset_values));
+  auto copy = std::make_shared<FrameOfReferenceSegment>(
+      std::move(new_block_minima), std::move(null_values), std::move(new_offset_values),
+      pmr_vector<EncodedType>(_block_steps, &memory_resource),
+      pmr_vector<ChunkOffset>(_exception_positions, &memory_resource),
+      pmr_vector<T>(_exception_values, &memory_resource), _decimal_exponent);
   copy->access_counter = access_counter;
   return copy;
 }
@@ -79,8 +119,10 @@ std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_memor
 template <typename T, typename U>
 size_t FrameOfReferenceSegment<T, U>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
   // MemoryUsageCalculationMode ignored since full calculation is efficient.
-  size_t segment_size =
-      sizeof(*this) + sizeof(T) * _block_minima.capacity() + _offset_values->data_size() + sizeof(_null_values);
+  size_t segment_size = sizeof(*this) + sizeof(EncodedType) * (_block_minima.capacity() + _block_steps.capacity()) +
+                        _offset_values->data_size() + sizeof(_null_values) +
+                        sizeof(ChunkOffset) * _exception_positions.capacity() +
+                        sizeof(T) * _exception_values.capacity();
 
   if (_null_values) {
     segment_size += _null_values->capacity() / CHAR_BIT;
@@ -100,7 +142,8 @@ std::optional<CompressedVectorType> FrameOfReferenceSegment<T, U>::compressed_ve
 }
 
 template class FrameOfReferenceSegment<int32_t>;
-// int64_t disabled for now, as vector compression cannot handle 64 bit values - also in reference_segment_iterable.hpp
-// template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<float>;
+template class FrameOfReferenceSegment<double>;
 
 }  // namespace hyrise
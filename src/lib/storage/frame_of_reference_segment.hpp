@@ -1,7 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 #include <boost/hana/contains.hpp>
@@ -25,12 +30,22 @@ class BaseCompressedVector;
  *
  * FOR encoding on its own without vector compression does not add any benefit.
  *
- * Null values are stored in a separate vector. Note, for correct offset handling, the minimum of each frame is stored 
+ * Null values are stored in a separate vector. Note, for correct offset handling, the minimum of each frame is stored
  * in the offset_values vector at each position that is NULL.
  *
+ * Extensions for 64-bit integers, floating-point values, and sorted data:
+ *  - Delta-FoR: For (mostly) sorted blocks, the frame can be a line instead of a constant, i.e., the value at position
+ *    i of a block is block_minima[block] + block_steps[block] * i + offset. The step is the smallest difference
+ *    between neighboring values, so that the offsets are the accumulated excess deltas. Different from classic
+ *    delta encoding, values can still be accessed without a prefix sum. block_steps is empty if no block uses a step.
+ *  - Floating-point values are encoded as decimals (similar to ALP or Pseudodecimal Encoding): a value v is stored as
+ *    the integer v * 10^decimal_exponent if dividing that integer by 10^decimal_exponent yields exactly v again.
+ *  - Exceptions: Values that cannot be encoded (e.g., as the offset to the block's frame does not fit into 32 bits or
+ *    as a floating-point value has too many decimal digits) are stored as they are. Their offset is zero.
+ *
  * std::enable_if_t must be used here and cannot be replaced by a static_assert in order to prevent instantiation of
- * FrameOfReferenceSegment<T> with T other than int32_t. Otherwise, the compiler might instantiate
- * FrameOfReferenceSegment with other types even if they are never actually needed.
+ * FrameOfReferenceSegment<T> with T other than int32_t, int64_t, float, and double. Otherwise, the compiler might
+ * instantiate FrameOfReferenceSegment with other types even if they are never actually needed.
  * "If the function selected by overload resolution can be determined without instantiating a class template
  *  definition, it is unspecified whether that instantiation actually takes place." Draft Std. N4800 12.8.1.8
  */
@@ -38,6 +53,9 @@ template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
                           enum_c<EncodingType, EncodingType::FrameOfReference>, hana::type_c<T>)>>
 class FrameOfReferenceSegment : public AbstractEncodedSegment {
  public:
+  // Floating-point values are encoded as 64-bit integers (see decode_decimal).
+  using EncodedType = std::conditional_t<std::is_floating_point_v<T>, int64_t, T>;
+
   /**
    * The segment is divided into fixed-size blocks.
    * Each block has its own minimum from which the
@@ -48,12 +66,80 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
    */
   static constexpr auto block_size = 2048u;
 
-  explicit FrameOfReferenceSegment(pmr_vector<T> block_minima, std::optional<pmr_vector<bool>> null_values,
-                                   std::unique_ptr<const BaseCompressedVector> offset_values);
-
-  const pmr_vector<T>& block_minima() const;
+  // Largest decimal exponent used for floating-point values. Encoded values have at most 53 bits so that their
+  // conversion to double is exact.
+  static constexpr auto max_decimal_exponent = uint8_t{std::is_same_v<T, float> ? 10 : 18};
+  static constexpr auto max_decimal_magnitude = int64_t{1} << 53;
+  static constexpr auto powers_of_ten = std::array<double, 19>{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                                               1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                                               1e14, 1e15, 1e16, 1e17, 1e18};
+
+  explicit FrameOfReferenceSegment(pmr_vector<EncodedType> block_minima, std::optional<pmr_vector<bool>> null_values,
+                                   std::unique_ptr<const BaseCompressedVector> offset_values,
+                                   pmr_vector<EncodedType> block_steps = {},
+                                   pmr_vector<ChunkOffset> exception_positions = {},
+                                   pmr_vector<T> exception_values = {}, uint8_t decimal_exponent = 0);
+
+  const pmr_vector<EncodedType>& block_minima() const;
   const std::optional<pmr_vector<bool>>& null_values() const;
   const BaseCompressedVector& offset_values() const;
+  const pmr_vector<EncodedType>& block_steps() const;
+  const pmr_vector<ChunkOffset>& exception_positions() const;
+  const pmr_vector<T>& exception_values() const;
+  uint8_t decimal_exponent() const;
+
+  // Decodes the value at `chunk_offset` from its offset, ignoring NULLs and exceptions.
+  T decode(const ChunkOffset chunk_offset, const uint32_t offset_value) const {
+    using UnsignedEncodedType = std::make_unsigned_t<EncodedType>;
+    const auto block_index = static_cast<ChunkOffset::base_type>(chunk_offset) / block_size;
+    auto encoded_value = static_cast<UnsignedEncodedType>(_block_minima[block_index]) + offset_value;
+    if (!_block_steps.empty()) {
+      const auto index_in_block = static_cast<ChunkOffset::base_type>(chunk_offset) % block_size;
+      encoded_value += static_cast<UnsignedEncodedType>(_block_steps[block_index]) * index_in_block;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+      return decode_decimal(static_cast<EncodedType>(encoded_value), _decimal_exponent);
+    } else {
+      return static_cast<T>(encoded_value);
+    }
+  }
+
+  // Decodes the first `count` values of the block at `block_index` from their offsets, ignoring NULLs and exceptions.
+  // Unlike decode(), the frame is only looked up once, and the loop can be vectorized.
+  void decode_block(const size_t block_index, const uint32_t* offsets, const size_t count, T* output) const {
+    using UnsignedEncodedType = std::make_unsigned_t<EncodedType>;
+    const auto minimum = static_cast<UnsignedEncodedType>(_block_minima[block_index]);
+    const auto step = _block_steps.empty() ? UnsignedEncodedType{0}
+                                           : static_cast<UnsignedEncodedType>(_block_steps[block_index]);
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto encoded_value = minimum + step * index + offsets[index];
+      if constexpr (std::is_floating_point_v<T>) {
+        output[index] = decode_decimal(static_cast<EncodedType>(encoded_value), _decimal_exponent);
+      } else {
+        output[index] = static_cast<T>(encoded_value);
+      }
+    }
+  }
+
+  // Returns the value at `chunk_offset` if it is stored as an exception.
+  std::optional<T> exception_value(const ChunkOffset chunk_offset) const {
+    if (_exception_positions.empty()) {
+      return std::nullopt;
+    }
+    const auto exception_it =
+        std::lower_bound(_exception_positions.cbegin(), _exception_positions.cend(), chunk_offset);
+    if (exception_it == _exception_positions.cend() || *exception_it != chunk_offset) {
+      return std::nullopt;
+    }
+    return _exception_values[std::distance(_exception_positions.cbegin(), exception_it)];
+  }
+
+  static T decode_decimal(const EncodedType encoded_value, const uint8_t decimal_exponent) {
+    // Dividing by an exact power of ten (instead of multiplying with its imprecise inverse) yields the correctly
+    // rounded value, so that most decimals are encoded with the smallest possible exponent.
+    return static_cast<T>(static_cast<double>(encoded_value) / powers_of_ten[decimal_exponent]);
+  }
 
   /**
    * @defgroup AbstractSegment interface
@@ -67,9 +153,10 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
     if (_null_values && (*_null_values)[chunk_offset]) {
       return std::nullopt;
     }
-    const auto minimum = _block_minima[chunk_offset / block_size];
-    const auto value = static_cast<T>(_decompressor->get(chunk_offset)) + minimum;
-    return value;
+    if (const auto exception = exception_value(chunk_offset)) {
+      return exception;
+    }
+    return decode(chunk_offset, _decompressor->get(chunk_offset));
   }
 
   ChunkOffset size() const final;
@@ -91,12 +178,19 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
   /**@}*/
 
  private:
-  const pmr_vector<T> _block_minima;
+  const pmr_vector<EncodedType> _block_minima;
   const std::optional<pmr_vector<bool>> _null_values;
   const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<EncodedType> _block_steps;
+  const pmr_vector<ChunkOffset> _exception_positions;
+  const pmr_vector<T> _exception_values;
+  const uint8_t _decimal_exponent;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
 };
 
 extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
+extern template class FrameOfReferenceSegment<float>;
+extern template class FrameOfReferenceSegment<double>;
 
 }  // namespace hyrise
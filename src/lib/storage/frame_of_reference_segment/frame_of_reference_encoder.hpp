@@ -1,10 +1,17 @@
 #pragma once
 
 #include <algorithm>
-#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "storage/base_segment_encoder.hpp"
 #include "storage/frame_of_reference_segment.hpp"
@@ -24,99 +31,314 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
   template <typename T>
   std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
                                                      const PolymorphicAllocator<T>& allocator) {
+    using EncodedType = typename FrameOfReferenceSegment<T>::EncodedType;
     static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
 
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) {
-      return (x + y - 1u) / y;
-    };
-
-    // holds the minimum of each block
-    auto block_minima = pmr_vector<T>{allocator};
-
-    // holds the uncompressed offset values
-    auto offset_values = pmr_vector<uint32_t>{allocator};
-
     // holds whether a segment value is null
     auto null_values = pmr_vector<bool>{allocator};
 
-    // used as optional input for the compression of the offset values
-    auto max_offset = uint32_t{0u};
+    // holds the values before they are encoded as decimals (floating-point values) and split into frames and offsets
+    auto values = std::vector<T>{};
 
     auto segment_contains_null_values = false;
 
     segment_iterable.with_iterators([&](auto segment_it, auto segment_end) {
       const auto size = std::distance(segment_it, segment_end);
-      const auto num_blocks = div_ceil(size, block_size);
-
-      block_minima.reserve(num_blocks);
-      offset_values.reserve(size);
+      values.reserve(size);
       null_values.reserve(size);
 
-      // a temporary storage to hold the values of one block
-      auto current_value_block = std::array<T, block_size>{};
-
-      // store iterator to the null values written within this block
-      auto current_block_null_values_it = null_values.end();
-
-      while (segment_it != segment_end) {
-        auto min_value = std::numeric_limits<T>::max();
-        auto max_value = std::numeric_limits<T>::lowest();
-        auto block_contains_values = false;
-
-        auto value_block_it = current_value_block.begin();
-        for (; value_block_it != current_value_block.end() && segment_it != segment_end;
-             ++value_block_it, ++segment_it) {
-          const auto segment_value = *segment_it;
-
-          const auto value = segment_value.value();
-          const auto value_is_null = segment_value.is_null();
-          *value_block_it = value_is_null ? T{0u} : value;
-          null_values.push_back(value_is_null);
-          segment_contains_null_values |= value_is_null;
-
-          if (!value_is_null) {
-            min_value = std::min(min_value, value);
-            max_value = std::max(max_value, value);
-          }
-          block_contains_values |= !value_is_null;
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+        const auto value_is_null = segment_value.is_null();
+        values.push_back(value_is_null ? T{} : segment_value.value());
+        null_values.push_back(value_is_null);
+        segment_contains_null_values |= value_is_null;
+      }
+    });
+
+    const auto size = values.size();
+
+    // Values that cannot be encoded are stored as exceptions. For integers, this can only happen if the value range of
+    // a block does not fit into 32 bits. Floating-point values are exceptions if they are not decimals with at most
+    // decimal_exponent digits after the decimal point (e.g., NaN or -0.0).
+    auto is_exception = std::vector<bool>(size);
+    auto encoded_values = std::vector<EncodedType>(size);
+    auto decimal_exponent = uint8_t{0};
+    if constexpr (std::is_floating_point_v<T>) {
+      decimal_exponent = _choose_decimal_exponent(values, null_values);
+      for (auto index = size_t{0}; index < size; ++index) {
+        if (null_values[index]) {
+          continue;
         }
+        const auto encoded_value = _encode_decimal(values[index], decimal_exponent);
+        is_exception[index] = !encoded_value;
+        encoded_values[index] = encoded_value.value_or(EncodedType{0});
+      }
+    } else {
+      std::copy(values.cbegin(), values.cend(), encoded_values.begin());
+    }
+
+    // holds the minimum of each block
+    auto block_minima = pmr_vector<EncodedType>{allocator};
 
-        // The last value block might not be filled completely
-        const auto this_value_block_end = value_block_it;
+    // holds the step of each block's frame (zero for blocks with a constant frame)
+    auto block_steps = pmr_vector<EncodedType>{allocator};
+
+    // holds the uncompressed offset values
+    auto offset_values = pmr_vector<uint32_t>(size, allocator);
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
 
-        if (block_contains_values) {
-          // Make sure that the largest offset fits into uint32_t (required for vector compression).
-          Assert(static_cast<std::make_unsigned_t<T>>(max_value - min_value) <= std::numeric_limits<uint32_t>::max(),
-                 "Value range in block must fit into uint32_t.");
+    const auto block_count = (size + block_size - 1) / block_size;
+    block_minima.reserve(block_count);
+    block_steps.reserve(block_count);
+
+    for (auto block_begin = size_t{0}; block_begin < size; block_begin += block_size) {
+      const auto block_end = std::min(size, block_begin + block_size);
+
+      // Positions of the values that are neither NULL nor exceptions.
+      auto positions = std::vector<size_t>{};
+      positions.reserve(block_end - block_begin);
+      for (auto index = block_begin; index < block_end; ++index) {
+        if (!null_values[index] && !is_exception[index]) {
+          positions.push_back(index - block_begin);
         }
+      }
 
-        block_minima.push_back(min_value);
-
-        value_block_it = current_value_block.begin();
-        for (; value_block_it != this_value_block_end; ++value_block_it, ++current_block_null_values_it) {
-          auto value = *value_block_it;
-          if (*current_block_null_values_it) {
-            // To ensure NULL values do not interfere with the min/max calculation (needed to calculate (i) the frame
-            // offset and (ii) the required width of the compressed vector), we set them to the minimum value. As NULL
-            // values are stored as zeros, we might run in an overflow of the uint32_t when minimum > 0.
-            value = min_value;
-          }
-          const auto offset = static_cast<uint32_t>(value - min_value);
-          offset_values.push_back(offset);
-          max_offset = std::max(max_offset, offset);
+      const auto frame = _choose_frame(encoded_values.data() + block_begin, positions);
+      block_minima.push_back(frame.minimum);
+      block_steps.push_back(frame.step);
+
+      // To ensure NULL values and exceptions do not interfere with the min/max calculation (needed to calculate (i) the
+      // frame offset and (ii) the required width of the compressed vector), their offset is zero.
+      for (const auto position : positions) {
+        const auto offset = frame.offset(encoded_values[block_begin + position], position);
+        if (!offset) {
+          is_exception[block_begin + position] = true;
+          continue;
         }
+        offset_values[block_begin + position] = *offset;
+        max_offset = std::max(max_offset, *offset);
       }
-    });
+    }
+
+    auto exception_positions = pmr_vector<ChunkOffset>{allocator};
+    auto exception_values = pmr_vector<T>{allocator};
+    for (auto index = size_t{0}; index < size; ++index) {
+      if (is_exception[index]) {
+        exception_positions.emplace_back(static_cast<ChunkOffset::base_type>(index));
+        exception_values.push_back(values[index]);
+      }
+    }
+
+    // Only store the steps if any block uses them.
+    if (std::all_of(block_steps.cbegin(), block_steps.cend(), [](const auto step) {
+          return step == EncodedType{0};
+        })) {
+      block_steps.clear();
+      block_steps.shrink_to_fit();
+    }
 
     auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), allocator, {max_offset});
 
-    if (segment_contains_null_values) {
-      return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
-                                                          std::move(compressed_offset_values));
+    auto optional_null_values =
+        segment_contains_null_values ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+    return std::make_shared<FrameOfReferenceSegment<T>>(
+        std::move(block_minima), std::move(optional_null_values), std::move(compressed_offset_values),
+        std::move(block_steps), std::move(exception_positions), std::move(exception_values), decimal_exponent);
+  }
+
+ private:
+  template <typename EncodedType>
+  struct Frame {
+    using UnsignedEncodedType = std::make_unsigned_t<EncodedType>;
+
+    // Returns the offset of `value` at `position` in the block or std::nullopt if it does not fit into 32 bits.
+    std::optional<uint32_t> offset(const EncodedType value, const size_t position) const {
+      // Unsigned arithmetic, as the frame's values (minimum + step * position) might not be representable by
+      // EncodedType. The difference to the value is, though.
+      const auto offset = static_cast<UnsignedEncodedType>(static_cast<UnsignedEncodedType>(value) -
+                                                           static_cast<UnsignedEncodedType>(minimum) -
+                                                           static_cast<UnsignedEncodedType>(step) * position);
+      if constexpr (sizeof(UnsignedEncodedType) > sizeof(uint32_t)) {
+        if (offset > std::numeric_limits<uint32_t>::max()) {
+          return std::nullopt;
+        }
+      }
+      return static_cast<uint32_t>(offset);
+    }
+
+    EncodedType minimum;
+    EncodedType step;
+  };
+
+  struct FrameCandidate {
+    uint32_t bit_width;
+    size_t exception_count;
+  };
+
+  // Chooses the frame of a block. Usually, this is the block's minimum (i.e., a constant frame). For sorted blocks, we
+  // also consider a linear frame whose step is the smallest difference between neighboring values (delta-FoR). If the
+  // offsets to the frame do not fit into 32 bits, the frame's minimum is chosen so that the most values fit, and the
+  // others become exceptions.
+  template <typename EncodedType>
+  static Frame<EncodedType> _choose_frame(const EncodedType* values, const std::vector<size_t>& positions) {
+    using UnsignedEncodedType = std::make_unsigned_t<EncodedType>;
+
+    if (positions.empty()) {
+      return Frame<EncodedType>{std::numeric_limits<EncodedType>::max(), EncodedType{0}};
+    }
+
+    const auto [min_it, max_it] = std::minmax_element(positions.cbegin(), positions.cend(), [&](auto lhs, auto rhs) {
+      return values[lhs] < values[rhs];
+    });
+    auto constant_frame = Frame<EncodedType>{values[*min_it], EncodedType{0}};
+    const auto constant_candidate = _fit_frame(values, positions, constant_frame);
+
+    // Outliers that are exceptions of the constant frame would also be exceptions of a linear frame. Ignoring them
+    // allows us to use linear frames for blocks that are sorted apart from their outliers.
+    auto sorted_positions = std::vector<size_t>{};
+    if (constant_candidate.exception_count > 0) {
+      sorted_positions.reserve(positions.size() - constant_candidate.exception_count);
+      std::copy_if(positions.cbegin(), positions.cend(), std::back_inserter(sorted_positions),
+                   [&](const auto position) {
+                     return constant_frame.offset(values[position], position).has_value();
+                   });
+    }
+    const auto& linear_positions = constant_candidate.exception_count > 0 ? sorted_positions : positions;
+
+    // Linear frame: the step is the largest slope that all pairs of neighboring values are above.
+    auto step = std::numeric_limits<UnsignedEncodedType>::max();
+    for (auto index = size_t{1}; index < linear_positions.size() && step > 0; ++index) {
+      const auto previous_value = values[linear_positions[index - 1]];
+      const auto value = values[linear_positions[index]];
+      if (value < previous_value) {
+        step = 0;
+        break;
+      }
+      const auto difference = static_cast<UnsignedEncodedType>(static_cast<UnsignedEncodedType>(value) -
+                                                               static_cast<UnsignedEncodedType>(previous_value));
+      const auto distance = linear_positions[index] - linear_positions[index - 1];
+      step = std::min(step, static_cast<UnsignedEncodedType>(difference / distance));
+    }
+
+    if (linear_positions.size() < 2 || step == 0) {
+      return constant_frame;
+    }
+
+    // The frame passes through the first value. As the (remaining) values are sorted, they are on or above it.
+    const auto first_position = linear_positions.front();
+    auto linear_frame = Frame<EncodedType>{
+        static_cast<EncodedType>(static_cast<UnsignedEncodedType>(values[first_position]) - step * first_position),
+        static_cast<EncodedType>(step)};
+    const auto linear_candidate = _fit_frame(values, positions, linear_frame);
+
+    // Linear frames need to store the step and cause an addition for each access. We only use them if they reduce the
+    // number of exceptions or the offsets' bit width by at least a byte, which also benefits byte-aligned vector
+    // compression.
+    if (linear_candidate.exception_count < constant_candidate.exception_count ||
+        (linear_candidate.exception_count == constant_candidate.exception_count &&
+         linear_candidate.bit_width + 8 <= constant_candidate.bit_width)) {
+      return linear_frame;
+    }
+    return constant_frame;
+  }
+
+  // If the offsets of the values to the frame do not fit into 32 bits, moves the frame up so that the most offsets
+  // fit. Returns the bit width of the offsets and the number of values that do not fit.
+  template <typename EncodedType>
+  static FrameCandidate _fit_frame(const EncodedType* values, const std::vector<size_t>& positions,
+                                   Frame<EncodedType>& frame) {
+    using UnsignedEncodedType = std::make_unsigned_t<EncodedType>;
+    static constexpr auto max_offset = UnsignedEncodedType{std::numeric_limits<uint32_t>::max()};
+
+    auto offsets = std::vector<UnsignedEncodedType>(positions.size());
+    for (auto index = size_t{0}; index < positions.size(); ++index) {
+      const auto position = positions[index];
+      offsets[index] = static_cast<UnsignedEncodedType>(static_cast<UnsignedEncodedType>(values[position]) -
+                                                        static_cast<UnsignedEncodedType>(frame.minimum) -
+                                                        static_cast<UnsignedEncodedType>(frame.step) * position);
+    }
+
+    // For 32-bit integers, all offsets fit.
+    const auto largest_offset = *std::max_element(offsets.cbegin(), offsets.cend());
+    if (sizeof(UnsignedEncodedType) == sizeof(uint32_t) || largest_offset <= max_offset) {
+      return FrameCandidate{static_cast<uint32_t>(std::bit_width(largest_offset)), 0};
+    }
+
+    // Find the window [offsets[window_begin], offsets[window_begin] + max_offset] that contains the most offsets.
+    std::sort(offsets.begin(), offsets.end());
+    auto best_window_begin = size_t{0};
+    auto best_window_size = size_t{0};
+    auto window_end = size_t{0};
+    for (auto window_begin = size_t{0}; window_begin < offsets.size(); ++window_begin) {
+      while (window_end < offsets.size() && offsets[window_end] - offsets[window_begin] <= max_offset) {
+        ++window_end;
+      }
+      if (window_end - window_begin > best_window_size) {
+        best_window_begin = window_begin;
+        best_window_size = window_end - window_begin;
+      }
+    }
+
+    const auto shift = offsets[best_window_begin];
+    frame.minimum = static_cast<EncodedType>(static_cast<UnsignedEncodedType>(frame.minimum) + shift);
+    const auto window_largest_offset = offsets[best_window_begin + best_window_size - 1] - shift;
+    return FrameCandidate{static_cast<uint32_t>(std::bit_width(window_largest_offset)),
+                          offsets.size() - best_window_size};
+  }
+
+  // Returns the decimal encoding of `value` or std::nullopt if it cannot be restored exactly.
+  template <typename T>
+  static std::optional<int64_t> _encode_decimal(const T value, const uint8_t decimal_exponent) {
+    using Segment = FrameOfReferenceSegment<T>;
+
+    const auto scaled_value = static_cast<double>(value) * Segment::powers_of_ten[decimal_exponent];
+    // Also excludes NaN and infinity.
+    if (!(std::abs(scaled_value) < static_cast<double>(Segment::max_decimal_magnitude))) {
+      return std::nullopt;
+    }
+
+    const auto encoded_value = static_cast<int64_t>(std::llround(scaled_value));
+    const auto decoded_value = Segment::decode_decimal(encoded_value, decimal_exponent);
+    // Comparing the sign bits rejects -0.0, which would be decoded as 0.0.
+    if (decoded_value != value || std::signbit(decoded_value) != std::signbit(value)) {
+      return std::nullopt;
+    }
+    return encoded_value;
+  }
+
+  // Chooses the smallest decimal exponent that encodes the most values of a sample without exceptions. Similar to ALP,
+  // we use a single exponent per segment so that no exponents need to be stored or looked up per value.
+  template <typename T>
+  static uint8_t _choose_decimal_exponent(const std::vector<T>& values, const pmr_vector<bool>& null_values) {
+    static constexpr auto sample_size = size_t{1'024};
+
+    auto sample = std::vector<T>{};
+    const auto stride = std::max(size_t{1}, values.size() / sample_size);
+    for (auto index = size_t{0}; index < values.size() && sample.size() < sample_size; index += stride) {
+      if (!null_values[index]) {
+        sample.push_back(values[index]);
+      }
+    }
+
+    auto best_decimal_exponent = uint8_t{0};
+    auto best_encoded_count = size_t{0};
+    for (auto decimal_exponent = uint8_t{0}; decimal_exponent <= FrameOfReferenceSegment<T>::max_decimal_exponent;
+         ++decimal_exponent) {
+      const auto encoded_count = std::count_if(sample.cbegin(), sample.cend(), [&](const auto value) {
+        return _encode_decimal(value, decimal_exponent).has_value();
+      });
+      if (static_cast<size_t>(encoded_count) > best_encoded_count) {
+        best_decimal_exponent = decimal_exponent;
+        best_encoded_count = encoded_count;
+      }
+      if (best_encoded_count == sample.size()) {
+        break;
+      }
     }
-    return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::nullopt,
-                                                        std::move(compressed_offset_values));
+    return best_decimal_exponent;
   }
 };
 
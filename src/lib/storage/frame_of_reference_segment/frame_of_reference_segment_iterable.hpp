@@ -20,15 +20,14 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
     _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
       using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
 
-      auto begin = Iterator<OffsetValueDecompressor>{&_segment.block_minima(), &_segment.null_values(),
-                                                     offset_values.create_decompressor(), ChunkOffset{0}};
+      auto begin = Iterator<OffsetValueDecompressor>{&_segment, offset_values.create_decompressor(), ChunkOffset{0}};
 
-      auto end = Iterator<OffsetValueDecompressor>{&_segment.block_minima(), &_segment.null_values(),
-                                                   offset_values.create_decompressor(),
+      auto end = Iterator<OffsetValueDecompressor>{&_segment, offset_values.create_decompressor(),
                                                    static_cast<ChunkOffset>(_segment.size())};
 
       functor(begin, end);
@@ -37,18 +36,17 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
   template <typename Functor, typename PosListType>
   void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
     _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
       using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
       using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
 
       auto begin = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
-          &_segment.block_minima(), &_segment.null_values(), offset_values.create_decompressor(),
-          position_filter->cbegin(), position_filter->cbegin()};
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
 
       auto end = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
-          &_segment.block_minima(), &_segment.null_values(), offset_values.create_decompressor(),
-          position_filter->cbegin(), position_filter->cend()};
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
 
       functor(begin, end);
     });
@@ -69,10 +67,9 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     using IterableType = FrameOfReferenceSegmentIterable<T>;
 
    public:
-    explicit Iterator(const pmr_vector<T>* block_minima, const std::optional<pmr_vector<bool>>* null_values,
-                      OffsetValueDecompressor offset_value_decompressor, ChunkOffset chunk_offset)
-        : _block_minima{block_minima},
-          _null_values{null_values},
+    explicit Iterator(const FrameOfReferenceSegment<T>* segment, OffsetValueDecompressor offset_value_decompressor,
+                      ChunkOffset chunk_offset)
+        : _segment{segment},
           _offset_value_decompressor{std::move(offset_value_decompressor)},
           _chunk_offset{chunk_offset} {}
 
@@ -100,19 +97,17 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     }
 
     SegmentPosition<T> dereference() const {
-      static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
-
-      const auto is_null = *_null_values ? (**_null_values)[_chunk_offset] : false;
-      const auto block_minimum = (*_block_minima)[_chunk_offset / block_size];
-      const auto offset_value = _offset_value_decompressor.get(_chunk_offset);
-      const auto value = static_cast<T>(offset_value) + block_minimum;
+      const auto& null_values = _segment->null_values();
+      const auto is_null = null_values ? (*null_values)[_chunk_offset] : false;
+      const auto exception = _segment->exception_value(_chunk_offset);
+      const auto value =
+          exception ? *exception : _segment->decode(_chunk_offset, _offset_value_decompressor.get(_chunk_offset));
 
       return SegmentPosition<T>{value, is_null, _chunk_offset};
     }
 
    private:
-    const pmr_vector<T>* _block_minima;
-    const std::optional<pmr_vector<bool>>* _null_values;
+    const FrameOfReferenceSegment<T>* _segment;
     mutable OffsetValueDecompressor _offset_value_decompressor;
     ChunkOffset _chunk_offset;
   };
@@ -125,36 +120,32 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     using ValueType = T;
     using IterableType = FrameOfReferenceSegmentIterable<T>;
 
-    PointAccessIterator(const pmr_vector<T>* block_minima, const std::optional<pmr_vector<bool>>* null_values,
-                        OffsetValueDecompressor offset_value_decompressor, PosListIteratorType position_filter_begin,
-                        PosListIteratorType position_filter_it)
+    PointAccessIterator(const FrameOfReferenceSegment<T>* segment, OffsetValueDecompressor offset_value_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
         : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
                                              SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
                                                                                       std::move(position_filter_it)},
-          _block_minima{block_minima},
-          _null_values{null_values},
+          _segment{segment},
           _offset_value_decompressor{std::move(offset_value_decompressor)} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
     SegmentPosition<T> dereference() const {
-      static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
-
       const auto& chunk_offsets = this->chunk_offsets();
       const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
 
-      const auto is_null = *_null_values ? (**_null_values)[current_offset] : false;
-      const auto block_minimum = (*_block_minima)[current_offset / block_size];
-      const auto offset_value = _offset_value_decompressor.get(current_offset);
-      const auto value = static_cast<T>(offset_value) + block_minimum;
+      const auto& null_values = _segment->null_values();
+      const auto is_null = null_values ? (*null_values)[current_offset] : false;
+      const auto exception = _segment->exception_value(current_offset);
+      const auto value =
+          exception ? *exception : _segment->decode(current_offset, _offset_value_decompressor.get(current_offset));
 
       return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
     }
 
    private:
-    const pmr_vector<T>* _block_minima;
-    const std::optional<pmr_vector<bool>>* _null_values;
+    const FrameOfReferenceSegment<T>* _segment;
     mutable OffsetValueDecompressor _offset_value_decompressor;
   };
 };
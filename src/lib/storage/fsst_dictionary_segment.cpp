@@ -0,0 +1,151 @@
+#include "fsst_dictionary_segment.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <boost/variant/get.hpp>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/fsst_segment/fsst_string_vector.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+template <typename T>
+FSSTDictionarySegment<T>::FSSTDictionarySegment(const std::shared_ptr<const FSSTStringVector>& dictionary,
+                                                const std::shared_ptr<const BaseCompressedVector>& attribute_vector)
+    : BaseDictionarySegment(data_type_from_type<pmr_string>()),
+      _dictionary{dictionary},
+      _attribute_vector{attribute_vector},
+      _decompressor{_attribute_vector->create_base_decompressor()} {}
+
+template <typename T>
+AllTypeVariant FSSTDictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FSSTDictionarySegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "ChunkOffset out of bounds.");
+
+  const auto value_id = _decompressor->get(chunk_offset);
+  if (value_id == _dictionary->size()) {
+    return std::nullopt;
+  }
+  return _dictionary->get_string_at(value_id);
+}
+
+template <typename T>
+std::shared_ptr<const FSSTStringVector> FSSTDictionarySegment<T>::fsst_dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+ChunkOffset FSSTDictionarySegment<T>::size() const {
+  return static_cast<ChunkOffset>(_attribute_vector->size());
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> FSSTDictionarySegment<T>::copy_using_memory_resource(
+    MemoryResource& memory_resource) const {
+  auto new_dictionary = _dictionary->copy_using_memory_resource(memory_resource);
+  auto new_attribute_vector = _attribute_vector->copy_using_memory_resource(memory_resource);
+
+  auto copy = std::make_shared<FSSTDictionarySegment<T>>(new_dictionary, std::move(new_attribute_vector));
+
+  copy->access_counter = access_counter;
+
+  return copy;
+}
+
+template <typename T>
+size_t FSSTDictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // MemoryUsageCalculationMode ignored as full calculation is efficient.
+  return sizeof(*this) + _dictionary->data_size() + _attribute_vector->data_size();
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTDictionarySegment<T>::compressed_vector_type() const {
+  return _attribute_vector->type();
+}
+
+template <typename T>
+EncodingType FSSTDictionarySegment<T>::encoding_type() const {
+  return EncodingType::FSSTDictionary;
+}
+
+template <typename T>
+ValueID FSSTDictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
+
+  const auto typed_value = boost::get<pmr_string>(value);
+
+  auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), typed_value);
+  if (it == _dictionary->cend()) {
+    return INVALID_VALUE_ID;
+  }
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+ValueID FSSTDictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
+
+  const auto typed_value = boost::get<pmr_string>(value);
+
+  auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), typed_value);
+  if (it == _dictionary->cend()) {
+    return INVALID_VALUE_ID;
+  }
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+AllTypeVariant FSSTDictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
+  DebugAssert(value_id < _dictionary->size(), "ValueID out of bounds");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
+  return _dictionary->get_string_at(value_id);
+}
+
+template <typename T>
+ValueID::base_type FSSTDictionarySegment<T>::unique_values_count() const {
+  return static_cast<ValueID::base_type>(_dictionary->size());
+}
+
+template <typename T>
+std::shared_ptr<const BaseCompressedVector> FSSTDictionarySegment<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+ValueID FSSTDictionarySegment<T>::null_value_id() const {
+  return ValueID{static_cast<ValueID::base_type>(_dictionary->size())};
+}
+
+template class FSSTDictionarySegment<pmr_string>;
+
+}  // namespace hyrise
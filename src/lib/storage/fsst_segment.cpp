@@ -0,0 +1,93 @@
+#include "fsst_segment.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/fsst_segment/fsst_string_vector.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(const std::shared_ptr<const FSSTStringVector>& strings,
+                            std::optional<pmr_vector<bool>> null_values)
+    : AbstractEncodedSegment{data_type_from_type<pmr_string>()},
+      _strings{strings},
+      _null_values{std::move(null_values)} {
+  Assert(!_null_values || _null_values->size() == _strings->size(), "Expected one NULL flag per string.");
+}
+
+template <typename T>
+std::shared_ptr<const FSSTStringVector> FSSTSegment<T>::strings() const {
+  return _strings;
+}
+
+template <typename T>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_strings->size());
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> FSSTSegment<T>::copy_using_memory_resource(MemoryResource& memory_resource) const {
+  auto new_strings = _strings->copy_using_memory_resource(memory_resource);
+  auto new_null_values =
+      _null_values ? pmr_vector<bool>(*_null_values, &memory_resource) : std::optional<pmr_vector<bool>>{};
+
+  auto copy = std::make_shared<FSSTSegment<T>>(std::move(new_strings), std::move(new_null_values));
+  copy->access_counter = access_counter;
+  return copy;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  auto segment_size = sizeof(*this) + _strings->data_size() + sizeof(_null_values);
+  if (_null_values) {
+    segment_size += _null_values->capacity() / CHAR_BIT;
+  }
+  return segment_size;
+}
+
+template <typename T>
+EncodingType FSSTSegment<T>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTSegment<T>::compressed_vector_type() const {
+  return _strings->offsets().type();
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "abstract_encoded_segment.hpp"
+#include "fsst_segment/fsst_string_vector.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Segment implementing FSST (Fast Static Symbol Table) compression for strings
+ *
+ * The strings are compressed with an FSSTSymbolTable that replaces frequent substrings of up to eight bytes with
+ * one-byte codes (see fsst_symbol_table.hpp). Different from LZ4, each string can be decompressed on its own, so that
+ * point accesses are cheap. Different from dictionary encoding, the compression does not depend on repeated values and
+ * works well for strings with shared substrings, such as log messages, URLs, or e-mail addresses.
+ *
+ * As the compression is deterministic, equality predicates are evaluated on the compressed codes without
+ * decompressing the strings, and prefix predicates (LIKE 'abc%') decompress at most the prefix's last bytes (see
+ * ColumnVsValueTableScanImpl and ColumnLikeTableScanImpl).
+ *
+ * NULL values are stored in a separate vector. Their strings are empty.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  explicit FSSTSegment(const std::shared_ptr<const FSSTStringVector>& strings,
+                       std::optional<pmr_vector<bool>> null_values);
+
+  std::shared_ptr<const FSSTStringVector> strings() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+    return _strings->get_string_at(chunk_offset);
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_memory_resource(MemoryResource& memory_resource) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const FSSTStringVector> _strings;
+  const std::optional<pmr_vector<bool>> _null_values;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_string_vector.hpp"
+#include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Encodes a string segment using FSST and compresses the offsets of the compressed strings using vector
+ *        compression.
+ *
+ * The symbol table is built from a sample of the segment's values (see FSSTSymbolTable::build). NULL values are
+ * stored as empty strings and marked in a separate vector, which is only stored if the segment contains NULLs.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    auto values = std::vector<T>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+
+    segment_iterable.with_iterators([&](auto segment_it, const auto segment_end) {
+      const auto segment_size = static_cast<size_t>(std::distance(segment_it, segment_end));
+      values.resize(segment_size);
+      null_values.resize(segment_size);
+
+      for (auto current_position = size_t{0}; segment_it != segment_end; ++segment_it, ++current_position) {
+        const auto segment_item = *segment_it;
+        if (segment_item.is_null()) {
+          segment_contains_null = true;
+          null_values[current_position] = true;
+        } else {
+          values[current_position] = segment_item.value();
+        }
+      }
+    });
+
+    const auto string_views = std::vector<std::string_view>(values.cbegin(), values.cend());
+    auto strings = std::make_shared<FSSTStringVector>(string_views, vector_compression_type(), allocator);
+
+    auto optional_null_values = segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)}
+                                                      : std::optional<pmr_vector<bool>>{};
+    return std::make_shared<FSSTSegment<T>>(strings, std::move(optional_null_values));
+  }
+};
+
+}  // namespace hyrise
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.strings()->offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+
+      auto begin = Iterator<OffsetDecompressor>{&_segment, offsets.create_decompressor(), ChunkOffset{0}};
+      auto end = Iterator<OffsetDecompressor>{&_segment, offsets.create_decompressor(),
+                                              static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.strings()->offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment, offsets.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment, offsets.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const {
+    return _segment.size();
+  }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+ private:
+  // Decompresses the string at `chunk_offset`, whose codes are at [offsets[chunk_offset], offsets[chunk_offset + 1]).
+  template <typename OffsetDecompressor>
+  static SegmentPosition<T> _decompress(const FSSTSegment<T>& segment, OffsetDecompressor& offset_decompressor,
+                                        const ChunkOffset chunk_offset, const ChunkOffset position_chunk_offset) {
+    const auto& null_values = segment.null_values();
+    const auto is_null = null_values ? (*null_values)[chunk_offset] : false;
+
+    auto value = T{};
+    if (!is_null) {
+      const auto& strings = *segment.strings();
+      const auto* const compressed_data = strings.compressed_data().data();
+      const auto begin = offset_decompressor.get(chunk_offset);
+      const auto end = offset_decompressor.get(chunk_offset + 1);
+      strings.symbol_table().decompress(compressed_data + begin, compressed_data + end, value);
+    }
+
+    return SegmentPosition<T>{std::move(value), is_null, position_chunk_offset};
+  }
+
+  template <typename OffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetDecompressor>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const FSSTSegment<T>* segment, OffsetDecompressor offset_decompressor, ChunkOffset chunk_offset)
+        : _segment{segment}, _offset_decompressor{std::move(offset_decompressor)}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+    }
+
+    void decrement() {
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _chunk_offset += n;
+    }
+
+    bool equal(const Iterator& other) const {
+      return _chunk_offset == other._chunk_offset;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      return _decompress(*_segment, _offset_decompressor, _chunk_offset, _chunk_offset);
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable OffsetDecompressor _offset_decompressor;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+    PointAccessIterator(const FSSTSegment<T>* segment, OffsetDecompressor offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
+                                                                                      std::move(position_filter_it)},
+          _segment{segment},
+          _offset_decompressor{std::move(offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      return _decompress(*_segment, _offset_decompressor, chunk_offsets.offset_in_referenced_chunk,
+                         chunk_offsets.offset_in_poslist);
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable OffsetDecompressor _offset_decompressor;
+  };
+};
+
+}  // namespace hyrise
@@ -0,0 +1,96 @@
+#include "fsst_string_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+FSSTStringVector::FSSTStringVector(const std::vector<std::string_view>& strings,
+                                   const VectorCompressionType vector_compression_type,
+                                   const PolymorphicAllocator<char>& allocator)
+    : _symbol_table{FSSTSymbolTable::build(strings)}, _compressed_data{allocator} {
+  auto offsets = pmr_vector<uint32_t>{allocator};
+  offsets.reserve(strings.size() + 1);
+  for (const auto& string : strings) {
+    offsets.push_back(static_cast<uint32_t>(_compressed_data.size()));
+    _symbol_table.compress(string, _compressed_data);
+  }
+  Assert(_compressed_data.size() <= std::numeric_limits<uint32_t>::max(), "Compressed strings exceed 4 GB.");
+  const auto compressed_data_size = static_cast<uint32_t>(_compressed_data.size());
+  offsets.push_back(compressed_data_size);
+  _compressed_data.shrink_to_fit();
+
+  _offsets = compress_vector(offsets, vector_compression_type, allocator, {compressed_data_size});
+  _decompressor = _offsets->create_base_decompressor();
+}
+
+FSSTStringVector::FSSTStringVector(FSSTSymbolTable symbol_table, pmr_vector<char> compressed_data,
+                                   std::unique_ptr<const BaseCompressedVector> offsets)
+    : _symbol_table{std::move(symbol_table)},
+      _compressed_data{std::move(compressed_data)},
+      _offsets{std::move(offsets)},
+      _decompressor{_offsets->create_base_decompressor()} {
+  Assert(_offsets->size() > 0, "Expected one more offset than strings.");
+}
+
+const FSSTSymbolTable& FSSTStringVector::symbol_table() const {
+  return _symbol_table;
+}
+
+const pmr_vector<char>& FSSTStringVector::compressed_data() const {
+  return _compressed_data;
+}
+
+const BaseCompressedVector& FSSTStringVector::offsets() const {
+  return *_offsets;
+}
+
+pmr_string FSSTStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < size(), "Position out of bounds.");
+  const auto codes = compressed_string_at(pos);
+  auto string = pmr_string{};
+  _symbol_table.decompress(codes.data(), codes.data() + codes.size(), string);
+  return string;
+}
+
+FSSTStringVector::Iterator FSSTStringVector::begin() const {
+  return {this, 0};
+}
+
+FSSTStringVector::Iterator FSSTStringVector::end() const {
+  return {this, size()};
+}
+
+FSSTStringVector::Iterator FSSTStringVector::cbegin() const {
+  return begin();
+}
+
+FSSTStringVector::Iterator FSSTStringVector::cend() const {
+  return end();
+}
+
+size_t FSSTStringVector::size() const {
+  return _offsets->size() - 1;
+}
+
+std::shared_ptr<FSSTStringVector> FSSTStringVector::copy_using_memory_resource(MemoryResource& memory_resource) const {
+  return std::make_shared<FSSTStringVector>(_symbol_table, pmr_vector<char>{_compressed_data, &memory_resource},
+                                            _offsets->copy_using_memory_resource(memory_resource));
+}
+
+size_t FSSTStringVector::data_size() const {
+  return _symbol_table.data_size() + _compressed_data.capacity() + _offsets->data_size();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Vector of FSST-compressed strings
+ *
+ * The strings are compressed with a shared FSSTSymbolTable, and their codes are stored consecutively in
+ * compressed_data. The codes of string i are at [offsets[i], offsets[i + 1]), i.e., offsets has size() + 1 entries and
+ * is compressed with vector compression. Each string can be decompressed on its own.
+ */
+class FSSTStringVector {
+ public:
+  // Random-access iterator that returns the decompressed strings, e.g., for binary searches in sorted vectors.
+  class Iterator : public boost::iterator_facade<Iterator, pmr_string, std::random_access_iterator_tag, pmr_string> {
+   public:
+    Iterator(const FSSTStringVector* vector, const size_t index) : _vector{vector}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    // We have a couple of NOLINTs here because the facade expects these method names:
+
+    bool equal(const Iterator& other) const {  // NOLINT
+      return _vector == other._vector && _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {  // NOLINT
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    void advance(const std::ptrdiff_t n) {  // NOLINT
+      _index += n;
+    }
+
+    void increment() {  // NOLINT
+      ++_index;
+    }
+
+    void decrement() {  // NOLINT
+      --_index;
+    }
+
+    pmr_string dereference() const {  // NOLINT
+      return _vector->get_string_at(_index);
+    }
+
+    const FSSTStringVector* _vector;
+    size_t _index;
+  };
+
+  // Builds a symbol table for the given strings and compresses them.
+  FSSTStringVector(const std::vector<std::string_view>& strings, const VectorCompressionType vector_compression_type,
+                   const PolymorphicAllocator<char>& allocator = {});
+
+  // Create an FSSTStringVector from already compressed data (e.g., when importing a segment).
+  FSSTStringVector(FSSTSymbolTable symbol_table, pmr_vector<char> compressed_data,
+                   std::unique_ptr<const BaseCompressedVector> offsets);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_data() const;
+  const BaseCompressedVector& offsets() const;
+
+  // Returns the codes of the string at `pos`.
+  std::string_view compressed_string_at(const size_t pos) const {
+    const auto begin = _decompressor->get(pos);
+    const auto end = _decompressor->get(pos + 1);
+    return {_compressed_data.data() + begin, end - begin};
+  }
+
+  pmr_string get_string_at(const size_t pos) const;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  size_t size() const;
+
+  std::shared_ptr<FSSTStringVector> copy_using_memory_resource(MemoryResource& memory_resource) const;
+
+  // Return the calculated size of FSSTStringVector in main memory
+  size_t data_size() const;
+
+ protected:
+  FSSTSymbolTable _symbol_table;
+  pmr_vector<char> _compressed_data;
+  std::unique_ptr<const BaseCompressedVector> _offsets;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,245 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// The FSST paper builds the table from a sample of 16 KB in five generations.
+constexpr auto SAMPLE_SIZE = size_t{16'384};
+constexpr auto GENERATION_COUNT = 5;
+
+// While building the table, symbols are identified by their code and escaped bytes by ESCAPED_BYTE_TOKEN + byte.
+constexpr auto ESCAPED_BYTE_TOKEN = uint32_t{256};
+constexpr auto TOKEN_COUNT = uint32_t{512};
+
+}  // namespace
+
+namespace hyrise {
+
+FSSTSymbolTable::FSSTSymbolTable() {
+  _build_index();
+}
+
+FSSTSymbolTable::FSSTSymbolTable(const std::vector<std::string>& symbols) {
+  Assert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols for an FSST symbol table.");
+  for (const auto& symbol : symbols) {
+    _add_symbol(symbol);
+  }
+  _build_index();
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& strings) {
+  // Sample every n-th string so that the sample has roughly SAMPLE_SIZE bytes.
+  auto total_size = size_t{0};
+  for (const auto& string : strings) {
+    total_size += string.size();
+  }
+  const auto stride = std::max(size_t{1}, (total_size + SAMPLE_SIZE - 1) / SAMPLE_SIZE);
+  auto sample = std::vector<std::string_view>{};
+  sample.reserve(strings.size() / stride + 1);
+  for (auto index = size_t{0}; index < strings.size(); index += stride) {
+    sample.push_back(strings[index]);
+  }
+
+  auto symbol_table = FSSTSymbolTable{};
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    // Compress the sample with the current table and count the used symbols and pairs of consecutive symbols.
+    auto token_counts = std::vector<size_t>(TOKEN_COUNT);
+    auto pair_counts = std::unordered_map<uint32_t, size_t>{};
+    for (const auto& string : sample) {
+      auto previous_token = std::optional<uint32_t>{};
+      auto position = size_t{0};
+      while (position < string.size()) {
+        const auto [code, length] = symbol_table._find_longest_symbol(string.substr(position));
+        const auto token =
+            code == ESCAPE_CODE ? ESCAPED_BYTE_TOKEN + static_cast<uint8_t>(string[position]) : uint32_t{code};
+        ++token_counts[token];
+        if (previous_token) {
+          ++pair_counts[*previous_token * TOKEN_COUNT + token];
+        }
+        previous_token = token;
+        position += length;
+      }
+    }
+
+    const auto token_string = [&](const uint32_t token) {
+      if (token >= ESCAPED_BYTE_TOKEN) {
+        return std::string(1, static_cast<char>(token - ESCAPED_BYTE_TOKEN));
+      }
+      return std::string{symbol_table.symbol(static_cast<uint8_t>(token))};
+    };
+
+    // The gain of a candidate is the number of bytes it would have covered in the sample.
+    auto gains = std::unordered_map<std::string, size_t>{};
+    for (auto token = uint32_t{0}; token < TOKEN_COUNT; ++token) {
+      if (token_counts[token] > 0) {
+        auto candidate = token_string(token);
+        gains[candidate] += token_counts[token] * candidate.size();
+      }
+    }
+    for (const auto& [pair, count] : pair_counts) {
+      auto candidate = token_string(pair / TOKEN_COUNT) + token_string(pair % TOKEN_COUNT);
+      if (candidate.size() <= MAX_SYMBOL_LENGTH) {
+        gains[candidate] += count * candidate.size();
+      }
+    }
+
+    // Build the next generation's table from the candidates with the highest gains. Ties are broken by the candidates
+    // themselves so that the table does not depend on the iteration order of the hash map.
+    auto candidates = std::vector<std::pair<std::string, size_t>>(gains.begin(), gains.end());
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(symbol_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+                      });
+
+    symbol_table = FSSTSymbolTable{};
+    for (auto index = size_t{0}; index < symbol_count; ++index) {
+      symbol_table._add_symbol(candidates[index].first);
+    }
+    symbol_table._build_index();
+  }
+
+  return symbol_table;
+}
+
+size_t FSSTSymbolTable::symbol_count() const {
+  return _symbol_count;
+}
+
+std::vector<std::string> FSSTSymbolTable::symbols() const {
+  auto symbols = std::vector<std::string>{};
+  symbols.reserve(_symbol_count);
+  for (auto code = size_t{0}; code < _symbol_count; ++code) {
+    symbols.emplace_back(symbol(static_cast<uint8_t>(code)));
+  }
+  return symbols;
+}
+
+size_t FSSTSymbolTable::compress_prefix(const std::string_view prefix, std::string& output) const {
+  // The symbol chosen at a position depends on the following MAX_SYMBOL_LENGTH bytes. Only if these are part of the
+  // prefix, the symbol is the same for all strings starting with the prefix.
+  auto position = size_t{0};
+  while (position + MAX_SYMBOL_LENGTH <= prefix.size()) {
+    const auto [code, length] = _find_longest_symbol(prefix.substr(position));
+    output.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      output.push_back(prefix[position]);
+    }
+    position += length;
+  }
+  return position;
+}
+
+void FSSTSymbolTable::decompress(const char* begin, const char* end, pmr_string& output) const {
+  auto decompressed_size = size_t{0};
+  for (auto code_it = begin; code_it < end; ++code_it) {
+    const auto code = static_cast<uint8_t>(*code_it);
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      ++decompressed_size;
+    } else {
+      decompressed_size += _symbol_lengths[code];
+    }
+  }
+
+  output.resize(decompressed_size);
+  auto* target = output.data();
+  for (auto code_it = begin; code_it < end; ++code_it) {
+    const auto code = static_cast<uint8_t>(*code_it);
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      *target = *code_it;
+      ++target;
+    } else {
+      std::memcpy(target, &_symbols[code * MAX_SYMBOL_LENGTH], _symbol_lengths[code]);
+      target += _symbol_lengths[code];
+    }
+  }
+}
+
+bool FSSTSymbolTable::decompresses_with_prefix(const char* begin, const char* end,
+                                               const std::string_view prefix) const {
+  auto position = size_t{0};
+  for (auto code_it = begin; code_it < end && position < prefix.size(); ++code_it) {
+    const auto code = static_cast<uint8_t>(*code_it);
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      if (*code_it != prefix[position]) {
+        return false;
+      }
+      ++position;
+      continue;
+    }
+
+    const auto compared_length = std::min(size_t{_symbol_lengths[code]}, prefix.size() - position);
+    if (std::memcmp(&_symbols[code * MAX_SYMBOL_LENGTH], prefix.data() + position, compared_length) != 0) {
+      return false;
+    }
+    position += compared_length;
+  }
+  return position == prefix.size();
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  return sizeof(*this);
+}
+
+std::pair<uint8_t, size_t> FSSTSymbolTable::_find_longest_symbol(const std::string_view string) const {
+  const auto first_byte = static_cast<uint8_t>(string.front());
+  const auto codes_end = _first_byte_offsets[first_byte + 1];
+  for (auto index = _first_byte_offsets[first_byte]; index < codes_end; ++index) {
+    const auto code = _codes_by_first_byte[index];
+    const auto length = size_t{_symbol_lengths[code]};
+    if (length <= string.size() &&
+        std::memcmp(&_symbols[code * MAX_SYMBOL_LENGTH], string.data(), length) == 0) {
+      return {code, length};
+    }
+  }
+  return {ESCAPE_CODE, 1};
+}
+
+void FSSTSymbolTable::_add_symbol(const std::string_view symbol) {
+  Assert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid length of FSST symbol.");
+  Assert(_symbol_count < MAX_SYMBOL_COUNT, "Too many symbols for an FSST symbol table.");
+  std::memcpy(&_symbols[_symbol_count * MAX_SYMBOL_LENGTH], symbol.data(), symbol.size());
+  _symbol_lengths[_symbol_count] = static_cast<uint8_t>(symbol.size());
+  ++_symbol_count;
+}
+
+void FSSTSymbolTable::_build_index() {
+  const auto first_byte = [&](const uint8_t code) {
+    return static_cast<uint8_t>(_symbols[code * MAX_SYMBOL_LENGTH]);
+  };
+
+  auto codes = std::vector<uint8_t>(_symbol_count);
+  std::iota(codes.begin(), codes.end(), uint8_t{0});
+  std::sort(codes.begin(), codes.end(), [&](const auto lhs, const auto rhs) {
+    if (first_byte(lhs) != first_byte(rhs)) {
+      return first_byte(lhs) < first_byte(rhs);
+    }
+    return _symbol_lengths[lhs] > _symbol_lengths[rhs];
+  });
+  std::copy(codes.cbegin(), codes.cend(), _codes_by_first_byte.begin());
+
+  _first_byte_offsets.fill(0);
+  for (const auto code : codes) {
+    ++_first_byte_offsets[first_byte(code) + 1];
+  }
+  std::partial_sum(_first_byte_offsets.cbegin(), _first_byte_offsets.cend(), _first_byte_offsets.begin());
+}
+
+}  // namespace hyrise
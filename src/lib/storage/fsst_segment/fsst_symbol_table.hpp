@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Symbol table of the Fast Static Symbol Table (FSST) string compression
+ *
+ * FSST (Boncz et al., VLDB 2020) replaces frequent substrings ("symbols") of up to eight bytes with one-byte codes.
+ * Bytes that are not covered by a symbol are escaped, i.e., stored as ESCAPE_CODE followed by the byte itself. As the
+ * codes are independent from each other, each string can be decompressed on its own, which allows random access.
+ *
+ * The table is built from a sample of the strings to compress. Starting with an empty table, each generation compresses
+ * the sample with the current table, counts how often symbols and pairs of consecutive symbols are used, and builds a
+ * new table from the symbols and concatenated pairs with the highest gain (i.e., count * length). After a few
+ * generations, the symbols converge to frequent substrings of the sample.
+ *
+ * Compression is greedy (the longest matching symbol wins) and deterministic: which symbol is chosen at a position only
+ * depends on the next MAX_SYMBOL_LENGTH bytes. Thus, two strings are equal iff their compressed codes are equal, and
+ * all strings that start with the same prefix start with the same codes (except for the codes of the prefix's last
+ * MAX_SYMBOL_LENGTH bytes). Scans use these properties to evaluate equality and prefix predicates on compressed data.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Creates an empty table, which escapes all bytes.
+  FSSTSymbolTable();
+
+  // Creates a table with the given symbols (e.g., when importing a segment). A symbol's code is its index.
+  explicit FSSTSymbolTable(const std::vector<std::string>& symbols);
+
+  // Builds a table for the given strings from a sample of them.
+  static FSSTSymbolTable build(const std::vector<std::string_view>& strings);
+
+  size_t symbol_count() const;
+
+  std::string_view symbol(const uint8_t code) const {
+    return {&_symbols[code * MAX_SYMBOL_LENGTH], _symbol_lengths[code]};
+  }
+
+  std::vector<std::string> symbols() const;
+
+  // Appends the codes of `string` to `output`, which can be any container of chars (e.g., pmr_vector<char>).
+  template <typename Output>
+  void compress(const std::string_view string, Output& output) const {
+    auto position = size_t{0};
+    const auto string_length = string.size();
+    while (position < string_length) {
+      const auto [code, length] = _find_longest_symbol(string.substr(position));
+      output.push_back(static_cast<char>(code));
+      if (code == ESCAPE_CODE) {
+        output.push_back(string[position]);
+      }
+      position += length;
+    }
+  }
+
+  // Compresses the part of `prefix` that is compressed equally in all strings starting with `prefix` and appends its
+  // codes to `output`. Returns the number of compressed bytes of `prefix`. At most MAX_SYMBOL_LENGTH - 1 bytes of the
+  // prefix are not compressed.
+  size_t compress_prefix(const std::string_view prefix, std::string& output) const;
+
+  // Decompresses the codes in [begin, end) into `output`.
+  void decompress(const char* begin, const char* end, pmr_string& output) const;
+
+  // Returns whether the codes in [begin, end) decompress to a string that starts with `prefix`. Only the codes needed
+  // to compare the prefix are decompressed.
+  bool decompresses_with_prefix(const char* begin, const char* end, const std::string_view prefix) const;
+
+  size_t data_size() const;
+
+ private:
+  // Returns the code and length of the longest symbol that `string` starts with, or ESCAPE_CODE and 1 if there is no
+  // such symbol. `string` must not be empty.
+  std::pair<uint8_t, size_t> _find_longest_symbol(const std::string_view string) const;
+
+  void _add_symbol(const std::string_view symbol);
+
+  // Sorts the codes by the first byte of their symbols (and by length in descending order) for _find_longest_symbol.
+  void _build_index();
+
+  // The symbols are padded to MAX_SYMBOL_LENGTH bytes.
+  std::array<char, MAX_SYMBOL_COUNT * MAX_SYMBOL_LENGTH> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_lengths{};
+  size_t _symbol_count{0};
+
+  // The codes of the symbols starting with byte b are stored at [_first_byte_offsets[b], _first_byte_offsets[b + 1])
+  // in _codes_by_first_byte.
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _codes_by_first_byte{};
+  std::array<uint16_t, 257> _first_byte_offsets{};
+};
+
+}  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "abstract_chunk_index.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -44,6 +45,11 @@ bool AbstractChunkIndex::is_index_for(const std::vector<std::shared_ptr<const Ab
   return true;
 }
 
+bool AbstractChunkIndex::covers(const std::shared_ptr<const AbstractSegment>& segment) const {
+  const auto& indexed_segments = _get_indexed_segments();
+  return std::find(indexed_segments.cbegin(), indexed_segments.cend(), segment) != indexed_segments.cend();
+}
+
 AbstractChunkIndex::Iterator AbstractChunkIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
   DebugAssert(
       _get_indexed_segments().size() >= values.size(),
@@ -76,6 +76,12 @@ class AbstractChunkIndex : private Noncopyable {
    */
   bool is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
 
+  /**
+   * Checks whether the given segment is one of the indexed segments, irrespective of its position. An index on columns
+   * DAB covers the segments of D, A, and B.
+   */
+  bool covers(const std::shared_ptr<const AbstractSegment>& segment) const;
+
   /**
    * Searches for the first entry within the chunk that is equal or greater than the given values.
    * The number of given values has to be less or equal to the number of indexed segments. Additionally,
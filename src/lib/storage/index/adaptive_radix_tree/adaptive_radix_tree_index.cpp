@@ -13,6 +13,7 @@
 #include "adaptive_radix_tree_nodes.hpp"
 #include "all_type_variant.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
@@ -35,6 +36,9 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
   Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
   Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
 
+  // The attribute vector is read directly. Thus, the segment's pages are pinned while the index is built.
+  const auto pin_guard = SharedPagePinGuard{_indexed_segment->buffer_pages()};
+
   // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
   // this value ID and its ChunkOffset (needed for bulk-inserting).
   auto pairs_to_insert = std::vector<std::pair<BinaryComparable, ChunkOffset>>{};
@@ -13,6 +13,7 @@
 #include "all_type_variant.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/index/group_key/variable_length_key_base.hpp"
@@ -59,6 +60,13 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(
     _indexed_segments.emplace_back(dict_segment);
   }
 
+  // The attribute vectors are read directly. Thus, the segments' pages are pinned while the keys are built.
+  auto pin_guards = std::vector<std::unique_ptr<SharedPagePinGuard>>{};
+  pin_guards.reserve(_indexed_segments.size());
+  for (const auto& segment : _indexed_segments) {
+    pin_guards.emplace_back(std::make_unique<SharedPagePinGuard>(segment->buffer_pages()));
+  }
+
   // retrieve memory consumption by each concatenated key
   auto bytes_per_key =
       std::accumulate(_indexed_segments.begin(), _indexed_segments.end(), CompositeKeyLength{0u},
@@ -10,6 +10,7 @@
 
 #include "all_type_variant.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
@@ -31,6 +32,9 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSeg
   Assert(static_cast<bool>(_indexed_segment), "GroupKeyIndex only works with dictionary segments_to_index.");
   Assert((segments_to_index.size() == 1), "GroupKeyIndex only works with a single segment.");
 
+  // The attribute vector is read directly. Thus, the segment's pages are pinned while the index is built.
+  const auto pin_guard = SharedPagePinGuard{_indexed_segment->buffer_pages()};
+
   // 1) Creating a value histogram:
   //    Create a value histogram with a size of the dictionary + 1 (plus one to mark the ending position)
   //    and set all bins to 0.
@@ -20,6 +20,7 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
     using ValueIterator = typename std::vector<T>::const_iterator;
 
     auto decompressed_segment = _segment.decompress();
@@ -45,6 +46,7 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
    */
   template <typename Functor, typename PosListType>
   void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    const auto pin_guard = SharedPagePinGuard{_segment.buffer_pages()};
     const auto position_filter_size = position_filter->size();
     _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter_size;
 
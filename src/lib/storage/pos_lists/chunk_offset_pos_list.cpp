@@ -0,0 +1,59 @@
+#include "chunk_offset_pos_list.hpp"
+
+#include <cstddef>
+
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+bool ChunkOffsetPosList::references_single_chunk() const {
+  return true;
+}
+
+ChunkID ChunkOffsetPosList::common_chunk_id() const {
+  return _common_chunk_id;
+}
+
+const ChunkOffsetPosList::Vector& ChunkOffsetPosList::chunk_offsets() const {
+  return _chunk_offsets;
+}
+
+void ChunkOffsetPosList::reserve(const size_t size) {
+  _chunk_offsets.reserve(size);
+}
+
+void ChunkOffsetPosList::emplace_back(const ChunkOffset chunk_offset) {
+  _chunk_offsets.emplace_back(chunk_offset);
+}
+
+bool ChunkOffsetPosList::empty() const {
+  return _chunk_offsets.empty();
+}
+
+size_t ChunkOffsetPosList::size() const {
+  return _chunk_offsets.size();
+}
+
+size_t ChunkOffsetPosList::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // Ignoring MemoryUsageCalculationMode because accurate calculation is efficient.
+  return sizeof(*this) + _chunk_offsets.capacity() * sizeof(Vector::value_type);
+}
+
+AbstractPosList::PosListIterator<ChunkOffsetPosList, RowID> ChunkOffsetPosList::begin() const {
+  return {this, ChunkOffset{0}};
+}
+
+AbstractPosList::PosListIterator<ChunkOffsetPosList, RowID> ChunkOffsetPosList::end() const {
+  return {this, static_cast<ChunkOffset>(size())};
+}
+
+AbstractPosList::PosListIterator<ChunkOffsetPosList, RowID> ChunkOffsetPosList::cbegin() const {
+  return begin();
+}
+
+AbstractPosList::PosListIterator<ChunkOffsetPosList, RowID> ChunkOffsetPosList::cend() const {
+  return end();
+}
+
+}  // namespace hyrise
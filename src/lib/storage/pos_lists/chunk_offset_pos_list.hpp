@@ -0,0 +1,52 @@
+#pragma once
+
+#include <utility>
+
+#include "abstract_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+// The ChunkOffsetPosList is a selection vector for a single chunk: it stores the ChunkID once and only the 32-bit
+// ChunkOffsets of the referenced rows. Compared to a RowIDPosList that references a single chunk, it needs half of
+// the memory, which reduces the memory traffic of operators that write or read the positions of filtered chunks
+// (e.g., TableScan and Validate). As the ChunkID is shared, it cannot contain NULL positions.
+class ChunkOffsetPosList final : public AbstractPosList {
+ public:
+  using Vector = pmr_vector<ChunkOffset>;
+
+  explicit ChunkOffsetPosList(const ChunkID common_chunk_id, Vector&& chunk_offsets = {})
+      : _common_chunk_id(common_chunk_id), _chunk_offsets(std::move(chunk_offsets)) {
+    DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create ChunkOffsetPosList for INVALID_CHUNK_ID.");
+  }
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  // Implemented in hpp for performance reasons (to allow inlining).
+  RowID operator[](const size_t index) const final {
+    DebugAssert(index < _chunk_offsets.size(), "Invalid position accessed.");
+    return RowID{_common_chunk_id, _chunk_offsets[index]};
+  }
+
+  const Vector& chunk_offsets() const;
+
+  void reserve(const size_t size);
+  void emplace_back(const ChunkOffset chunk_offset);
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  PosListIterator<ChunkOffsetPosList, RowID> begin() const;
+  PosListIterator<ChunkOffsetPosList, RowID> end() const;
+  PosListIterator<ChunkOffsetPosList, RowID> cbegin() const;
+  PosListIterator<ChunkOffsetPosList, RowID> cend() const;
+
+ private:
+  const ChunkID _common_chunk_id;
+  Vector _chunk_offsets;
+};
+
+}  // namespace hyrise
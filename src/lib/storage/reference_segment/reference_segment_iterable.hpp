@@ -10,6 +10,8 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_accessor.hpp"
@@ -72,8 +74,21 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
           }
 #endif
 
+#ifdef HYRISE_ERASE_FSST
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) {
+            return;
+          }
+#endif
+
+#ifdef HYRISE_ERASE_FSSTDICTIONARY
+          if constexpr (std::is_same_v<SegmentType, FSSTDictionarySegment<T>>) {
+            return;
+          }
+#endif
+
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-          if constexpr (std::is_same_v<T, int32_t>) {
+          if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                    hana::type_c<T>)) {
             if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
               return;
             }
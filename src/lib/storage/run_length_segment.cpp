@@ -9,6 +9,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/encoding_type.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
@@ -43,6 +44,7 @@ std::shared_ptr<const pmr_vector<ChunkOffset>> RunLengthSegment<T>::end_position
 template <typename T>
 AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   const auto typed_value = get_typed_value(chunk_offset);
   if (!typed_value) {
     return NULL_VALUE;
@@ -79,6 +81,8 @@ size_t RunLengthSegment<T>::memory_usage(const MemoryUsageCalculationMode mode)
       _end_positions->capacity() * sizeof(typename decltype(_end_positions)::element_type::value_type);
 
   if constexpr (std::is_same_v<T, pmr_string>) {
+    // The sizes of the strings' heap buffers are read from the strings themselves.
+    const auto pin_guard = SharedPagePinGuard{buffer_pages()};
     return common_elements_size + string_vector_memory_usage(*_values, mode);
   }
   return common_elements_size + _values->capacity() * sizeof(typename decltype(_values)::element_type::value_type);
@@ -7,10 +7,36 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_segment_accessor.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+template <typename SegmentType>
+struct IsFrameOfReferenceSegment : std::false_type {};
+
+template <typename T, typename Enable>
+struct IsFrameOfReferenceSegment<FrameOfReferenceSegment<T, Enable>> : std::true_type {};
+
+// Optimistic reads might observe arbitrary data if a page is evicted and reused concurrently (see
+// OptimisticPageGuard). We only use them for segments whose reads neither follow pointers nor use positions that are
+// stored in the segment (e.g., value IDs of dictionary segments or the end positions that run-length segments search).
+template <typename T, typename SegmentType>
+constexpr bool supports_optimistic_reads() {
+  if constexpr (!std::is_arithmetic_v<T>) {
+    return false;
+  } else {
+    return std::is_same_v<SegmentType, ValueSegment<T>> || IsFrameOfReferenceSegment<SegmentType>::value;
+  }
+}
+
+}  // namespace
+
 namespace hyrise::detail {
 template <typename T>
 std::unique_ptr<AbstractSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
@@ -39,7 +65,7 @@ std::unique_ptr<AbstractSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
             using ReferencedSegment = std::decay_t<decltype(typed_referenced_segment)>;
             if constexpr (!std::is_same_v<ReferencedSegment, ReferenceSegment>) {
               accessor = std::make_unique<SingleChunkReferenceSegmentAccessor<T, ReferencedSegment>>(
-                  pos_list, chunk_id, typed_referenced_segment);
+                  pos_list, chunk_id, typed_referenced_segment, supports_optimistic_reads<T, ReferencedSegment>());
             } else {
               Fail("Encountered nested ReferenceSegments");
             }
@@ -49,7 +75,8 @@ std::unique_ptr<AbstractSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
         accessor = std::make_unique<MultipleChunkReferenceSegmentAccessor<T>>(typed_segment);
       }
     } else {
-      accessor = std::make_unique<SegmentAccessor<T, SegmentType>>(typed_segment);
+      accessor =
+          std::make_unique<SegmentAccessor<T, SegmentType>>(typed_segment, supports_optimistic_reads<T, SegmentType>());
     }
   });
   return accessor;
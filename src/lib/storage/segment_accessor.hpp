@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "storage/base_segment_accessor.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
@@ -43,15 +44,22 @@ std::unique_ptr<AbstractSegmentAccessor<T>> create_segment_accessor(
  *
  * Accessors are not guaranteed to be thread-safe. For multiple threads that access the same segment, create one
  * accessor each.
+ *
+ * If the segment lives in the buffer pool, values are read optimistically without pinning the segment's pages if
+ * `optimistic_reads` is set (see OptimisticPageGuard). Otherwise, the pages are pinned for the accessor's lifetime.
+ * `get_typed_value` does not pin the pages itself. Other callers have to hold a SharedPagePinGuard.
  */
 template <typename T, typename SegmentType>
 class SegmentAccessor final : public AbstractSegmentAccessor<T> {
  public:
-  explicit SegmentAccessor(const SegmentType& segment) : AbstractSegmentAccessor<T>{}, _segment{segment} {}
+  explicit SegmentAccessor(const SegmentType& segment, const bool optimistic_reads = false)
+      : AbstractSegmentAccessor<T>{}, _segment{segment}, _page_guard{segment.buffer_pages(), optimistic_reads} {}
 
   const std::optional<T> access(ChunkOffset offset) const final {
     ++_accesses;
-    return _segment.get_typed_value(offset);
+    return _page_guard.read([&]() {
+      return _segment.get_typed_value(offset);
+    });
   }
 
   ~SegmentAccessor() override {
@@ -61,6 +69,7 @@ class SegmentAccessor final : public AbstractSegmentAccessor<T> {
  protected:
   mutable uint64_t _accesses{0};
   const SegmentType& _segment;
+  const OptimisticPageGuard _page_guard;
 };
 
 /**
@@ -108,13 +117,18 @@ template <typename T, typename Segment>
 class SingleChunkReferenceSegmentAccessor final : public AbstractSegmentAccessor<T> {
  public:
   explicit SingleChunkReferenceSegmentAccessor(const AbstractPosList& pos_list, const ChunkID chunk_id,
-                                               const Segment& segment)
-      : _pos_list{pos_list}, _chunk_id(chunk_id), _segment(segment) {}
+                                               const Segment& segment, const bool optimistic_reads = false)
+      : _pos_list{pos_list},
+        _chunk_id(chunk_id),
+        _segment(segment),
+        _page_guard{segment.buffer_pages(), optimistic_reads} {}
 
   const std::optional<T> access(ChunkOffset offset) const final {
     ++_accesses;
     const auto referenced_chunk_offset = _pos_list[offset].chunk_offset;
-    return _segment.get_typed_value(referenced_chunk_offset);
+    return _page_guard.read([&]() {
+      return _segment.get_typed_value(referenced_chunk_offset);
+    });
   }
 
   ~SingleChunkReferenceSegmentAccessor() override {
@@ -126,6 +140,7 @@ class SingleChunkReferenceSegmentAccessor final : public AbstractSegmentAccessor
   const AbstractPosList& _pos_list;
   const ChunkID _chunk_id;
   const Segment& _segment;
+  const OptimisticPageGuard _page_guard;
 };
 
 // Accessor for ReferenceSegments that reference only NULL values
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -46,6 +48,10 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
   }
   generate_chunk_pruning_statistics(table);
 
+  {
+    const auto lock = std::unique_lock{_table_names_mutex};
+    _table_names.insert_or_assign(table.get(), name);
+  }
   _tables[name] = std::move(table);
 }
 
@@ -53,6 +59,11 @@ void StorageManager::drop_table(const std::string& name) {
   const auto table_iter = _tables.find(name);
   Assert(table_iter != _tables.end() && table_iter->second, "Error deleting table. No such table named '" + name + "'");
 
+  {
+    const auto lock = std::unique_lock{_table_names_mutex};
+    _table_names.erase(table_iter->second.get());
+  }
+
   // The concurrent_unordered_map does not support concurrency-safe erasure. Thus, we simply reset the table pointer.
   _tables[name] = nullptr;
 }
@@ -68,6 +79,13 @@ std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const
   return table;
 }
 
+std::string StorageManager::get_table_name(const std::shared_ptr<const Table>& table) const {
+  const auto lock = std::shared_lock{_table_names_mutex};
+  const auto name_iter = _table_names.find(table.get());
+  Assert(name_iter != _table_names.end(), "Table is not stored in the StorageManager.");
+  return name_iter->second;
+}
+
 bool StorageManager::has_table(const std::string& name) const {
   const auto table_iter = _tables.find(name);
   return table_iter != _tables.end() && table_iter->second;
@@ -32,6 +32,9 @@ class StorageManager : public Noncopyable {
   bool has_table(const std::string& name) const;
   std::vector<std::string> table_names() const;
   std::unordered_map<std::string, std::shared_ptr<Table>> tables() const;
+
+  // Returns the name under which the table is stored, e.g., for logging modifications, which identify tables by name.
+  std::string get_table_name(const std::shared_ptr<const Table>& table) const;
   /** @} */
 
   /**
@@ -69,6 +72,9 @@ class StorageManager : public Noncopyable {
   static constexpr size_t INITIAL_MAP_SIZE = 100;
 
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<Table>> _tables{INITIAL_MAP_SIZE};
+  // Reverse mapping of _tables. Unlike _tables, entries of dropped tables are erased, which requires a mutex.
+  std::unordered_map<const Table*, std::string> _table_names;
+  mutable std::shared_mutex _table_names_mutex;
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>> _views{INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans{INITIAL_MAP_SIZE};
 };
@@ -11,6 +11,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_value_segment.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/segment_access_counter.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -46,6 +47,7 @@ template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
   PerformanceWarning("operator[] used");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Point] += 1;
 
   // Segment supports null values and value is null
@@ -58,6 +60,7 @@ AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
   access_counter[SegmentAccessCounter::AccessType::Point] += 1;
   return is_nullable() && (*_null_values)[chunk_offset];
 }
@@ -65,6 +68,7 @@ bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
 template <typename T>
 T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+  const auto pin_guard = SharedPagePinGuard{buffer_pages()};
 
   Assert(!is_nullable() || !(*_null_values).at(chunk_offset), "Can’t return value of segment type because it is null.");
   access_counter[SegmentAccessCounter::AccessType::Point] += 1;
@@ -159,6 +163,8 @@ size_t ValueSegment<T>::memory_usage(const MemoryUsageCalculationMode mode) cons
   const auto common_elements_size = sizeof(*this) + null_value_vector_size;
 
   if constexpr (std::is_same_v<T, pmr_string>) {
+    // The sizes of the strings' heap buffers are read from the strings themselves.
+    const auto pin_guard = SharedPagePinGuard{buffer_pages()};
     return common_elements_size + string_vector_memory_usage(_values, mode);
   }
 
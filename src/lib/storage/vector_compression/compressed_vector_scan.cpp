@@ -0,0 +1,271 @@
+#include "compressed_vector_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "bitpacking/bitpacking_vector.hpp"
+#include "resolve_compressed_vector_type.hpp"
+#include "simd_bp128/simd_bp128_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+/**
+ * Unpacks values from the memory of a compact::vector, which stores its values back to back, starting at the least
+ * significant bit of each 64-bit word. As a value has at most 32 bits, it is always contained in the eight bytes that
+ * start at the byte of its first bit. The SIMD paths gather these eight bytes for multiple values at once. They may
+ * only be used for positions below `simd_size`, for which the eight bytes do not exceed the vector's memory.
+ */
+class BitUnpacker {
+ public:
+  explicit BitUnpacker(const pmr_compact_vector& data)
+      : _words{data.get()},
+        _bit_width{data.bits()},
+        _mask{(uint64_t{1} << _bit_width) - 1},
+        simd_size{data.bytes() < sizeof(uint64_t)
+                      ? size_t{0}
+                      : std::min(data.size(), ((data.bytes() - sizeof(uint64_t) + 1) * 8 - 1) / _bit_width + 1)} {}
+
+  uint32_t get(const size_t position) const {
+    const auto bit_offset = position * _bit_width;
+    const auto word_idx = bit_offset / BITS_PER_WORD;
+    const auto shift = bit_offset % BITS_PER_WORD;
+    auto value = _words[word_idx] >> shift;
+    if (shift + _bit_width > BITS_PER_WORD) {
+      value |= _words[word_idx + 1] << (BITS_PER_WORD - shift);
+    }
+    return static_cast<uint32_t>(value & _mask);
+  }
+
+#if defined(__AVX512F__)
+  static constexpr auto SIMD_WIDTH = size_t{8};
+
+  // Returns the values at [position, position + 8) in 64-bit lanes.
+  __m512i get_simd(const size_t position) const {
+    const auto first_bit_offset = static_cast<int64_t>(position * _bit_width);
+    const auto bit_width = static_cast<int64_t>(_bit_width);
+    const auto bit_offsets =
+        _mm512_add_epi64(_mm512_set1_epi64(first_bit_offset),
+                         _mm512_set_epi64(7 * bit_width, 6 * bit_width, 5 * bit_width, 4 * bit_width, 3 * bit_width,
+                                          2 * bit_width, bit_width, 0));
+    const auto bytes = _mm512_i64gather_epi64(_mm512_srli_epi64(bit_offsets, 3), _words, 1);
+    const auto values = _mm512_srlv_epi64(bytes, _mm512_and_si512(bit_offsets, _mm512_set1_epi64(7)));
+    return _mm512_and_si512(values, _mm512_set1_epi64(static_cast<int64_t>(_mask)));
+  }
+#elif defined(__AVX2__)
+  static constexpr auto SIMD_WIDTH = size_t{4};
+
+  // Returns the values at [position, position + 4) in 64-bit lanes.
+  __m256i get_simd(const size_t position) const {
+    const auto first_bit_offset = static_cast<int64_t>(position * _bit_width);
+    const auto bit_width = static_cast<int64_t>(_bit_width);
+    const auto bit_offsets = _mm256_add_epi64(_mm256_set1_epi64x(first_bit_offset),
+                                              _mm256_set_epi64x(3 * bit_width, 2 * bit_width, bit_width, 0));
+    const auto bytes = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(_words),  // NOLINT(runtime/int)
+                                              _mm256_srli_epi64(bit_offsets, 3), 1);
+    const auto values = _mm256_srlv_epi64(bytes, _mm256_and_si256(bit_offsets, _mm256_set1_epi64x(7)));
+    return _mm256_and_si256(values, _mm256_set1_epi64x(static_cast<int64_t>(_mask)));
+  }
+#endif
+
+ private:
+  const uint64_t* const _words;
+  const uint32_t _bit_width;
+  const uint64_t _mask;
+
+ public:
+  const size_t simd_size;
+};
+
+void decompress_bitpacking_block(const BitPackingVector& vector, const size_t begin, const size_t count,
+                                 uint32_t* output) {
+  const auto unpacker = BitUnpacker{vector.data()};
+  const auto end = begin + count;
+  auto position = begin;
+
+#if defined(__AVX512F__)
+  for (; position + BitUnpacker::SIMD_WIDTH <= std::min(end, unpacker.simd_size); position += BitUnpacker::SIMD_WIDTH) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + (position - begin)),
+                        _mm512_cvtepi64_epi32(unpacker.get_simd(position)));
+  }
+#elif defined(__AVX2__)
+  // Moves the lower 32 bits of the four 64-bit lanes to the first 128 bits.
+  const auto lower_halves = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+  for (; position + BitUnpacker::SIMD_WIDTH <= std::min(end, unpacker.simd_size); position += BitUnpacker::SIMD_WIDTH) {
+    const auto values = _mm256_permutevar8x32_epi32(unpacker.get_simd(position), lower_halves);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + (position - begin)), _mm256_castsi256_si128(values));
+  }
+#endif
+
+  for (; position < end; ++position) {
+    output[position - begin] = unpacker.get(position);
+  }
+}
+
+void scan_bitpacking_range(const BitPackingVector& vector, const uint32_t lower_bound, const uint32_t range_size,
+                           std::vector<uint64_t>& bitmap) {
+  const auto unpacker = BitUnpacker{vector.data()};
+  const auto size = vector.size();
+  const auto word_count = bitmap.size();
+
+  auto word_idx = size_t{0};
+#if defined(__AVX512F__)
+  const auto lower_bounds = _mm512_set1_epi64(lower_bound);
+  const auto range_sizes = _mm512_set1_epi64(range_size);
+  for (; (word_idx + 1) * BITS_PER_WORD <= unpacker.simd_size; ++word_idx) {
+    auto word = uint64_t{0};
+    for (auto lane_group = size_t{0}; lane_group < BITS_PER_WORD / BitUnpacker::SIMD_WIDTH; ++lane_group) {
+      const auto values = unpacker.get_simd(word_idx * BITS_PER_WORD + lane_group * BitUnpacker::SIMD_WIDTH);
+      // Values below the lower bound wrap around and become larger than the range size.
+      const auto mask = _mm512_cmplt_epu64_mask(_mm512_sub_epi64(values, lower_bounds), range_sizes);
+      word |= static_cast<uint64_t>(mask) << (lane_group * BitUnpacker::SIMD_WIDTH);
+    }
+    bitmap[word_idx] = word;
+  }
+#elif defined(__AVX2__)
+  // AVX2 only compares signed 64-bit integers, which is fine as the values and bounds fit into 33 bits.
+  const auto lower_bounds_minus_one = _mm256_set1_epi64x(static_cast<int64_t>(lower_bound) - 1);
+  const auto upper_bounds = _mm256_set1_epi64x(static_cast<int64_t>(lower_bound) + range_size);
+  for (; (word_idx + 1) * BITS_PER_WORD <= unpacker.simd_size; ++word_idx) {
+    auto word = uint64_t{0};
+    for (auto lane_group = size_t{0}; lane_group < BITS_PER_WORD / BitUnpacker::SIMD_WIDTH; ++lane_group) {
+      const auto values = unpacker.get_simd(word_idx * BITS_PER_WORD + lane_group * BitUnpacker::SIMD_WIDTH);
+      const auto matches = _mm256_and_si256(_mm256_cmpgt_epi64(values, lower_bounds_minus_one),
+                                            _mm256_cmpgt_epi64(upper_bounds, values));
+      const auto mask = _mm256_movemask_pd(_mm256_castsi256_pd(matches));
+      word |= static_cast<uint64_t>(mask) << (lane_group * BitUnpacker::SIMD_WIDTH);
+    }
+    bitmap[word_idx] = word;
+  }
+#endif
+
+  // Remainder (and all words if no SIMD instructions are available).
+  for (; word_idx < word_count; ++word_idx) {
+    const auto word_end = std::min(size, (word_idx + 1) * BITS_PER_WORD);
+    auto word = uint64_t{0};
+    for (auto position = word_idx * BITS_PER_WORD; position < word_end; ++position) {
+      word |= static_cast<uint64_t>(unpacker.get(position) - lower_bound < range_size)
+              << (position % BITS_PER_WORD);
+    }
+    bitmap[word_idx] = word;
+  }
+}
+
+// Compares `BITS_PER_WORD` values to the range. The loop is vectorized by the compiler.
+template <typename UnsignedIntType>
+uint64_t compare_word_to_range(const UnsignedIntType* values, const uint32_t lower_bound, const uint32_t range_size) {
+  auto word = uint64_t{0};
+
+  // This empty block is used to convince clang-format to keep the pragma indented.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(|:word) safelen(BITS_PER_WORD)
+  // clang-format on
+  for (auto index = size_t{0}; index < BITS_PER_WORD; ++index) {
+    word |= static_cast<uint64_t>(static_cast<uint32_t>(values[index]) - lower_bound < range_size) << index;
+  }
+  return word;
+}
+
+void scan_simd_bp128_range(const SimdBp128Vector& vector, const uint32_t lower_bound, const uint32_t range_size,
+                           std::vector<uint64_t>& bitmap) {
+  constexpr auto WORDS_PER_BLOCK = SimdBp128Vector::BLOCK_SIZE / BITS_PER_WORD;
+  auto block = std::array<uint32_t, SimdBp128Vector::BLOCK_SIZE>{};
+
+  const auto block_count = vector.block_count();
+  const auto word_count = bitmap.size();
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    vector.decode_block(block_index, block.data());
+    for (auto word_in_block = size_t{0}; word_in_block < WORDS_PER_BLOCK; ++word_in_block) {
+      const auto word_idx = block_index * WORDS_PER_BLOCK + word_in_block;
+      if (word_idx == word_count) {
+        break;
+      }
+      bitmap[word_idx] = compare_word_to_range(block.data() + word_in_block * BITS_PER_WORD, lower_bound, range_size);
+    }
+  }
+
+  // The last block is padded with zeros, which must not match.
+  const auto remainder = vector.size() % BITS_PER_WORD;
+  if (remainder != 0) {
+    bitmap.back() &= (uint64_t{1} << remainder) - 1;
+  }
+}
+
+template <typename UnsignedIntType>
+void scan_fixed_width_integer_range(const pmr_vector<UnsignedIntType>& data, const uint32_t lower_bound,
+                                    const uint32_t range_size, std::vector<uint64_t>& bitmap) {
+  const auto size = data.size();
+  const auto full_word_count = size / BITS_PER_WORD;
+  for (auto word_idx = size_t{0}; word_idx < full_word_count; ++word_idx) {
+    bitmap[word_idx] = compare_word_to_range(data.data() + word_idx * BITS_PER_WORD, lower_bound, range_size);
+  }
+
+  if (full_word_count < bitmap.size()) {
+    auto word = uint64_t{0};
+    for (auto position = full_word_count * BITS_PER_WORD; position < size; ++position) {
+      word |= static_cast<uint64_t>(static_cast<uint32_t>(data[position]) - lower_bound < range_size)
+              << (position % BITS_PER_WORD);
+    }
+    bitmap[full_word_count] = word;
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+void decompress_block(const BaseCompressedVector& vector, const size_t begin, const size_t count, uint32_t* output) {
+  DebugAssert(begin + count <= vector.size(), "Block exceeds the vector.");
+
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) {
+    using VectorType = std::decay_t<decltype(typed_vector)>;
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      decompress_bitpacking_block(typed_vector, begin, count, output);
+    } else if constexpr (std::is_same_v<VectorType, SimdBp128Vector>) {
+      typed_vector.decode(begin, count, output);
+    } else {
+      const auto& data = typed_vector.data();
+      std::copy(data.cbegin() + static_cast<std::ptrdiff_t>(begin),
+                data.cbegin() + static_cast<std::ptrdiff_t>(begin + count), output);
+    }
+  });
+}
+
+void scan_range_to_bitmap(const BaseCompressedVector& vector, const uint32_t lower_bound, const uint32_t upper_bound,
+                          std::vector<uint64_t>& bitmap) {
+  const auto size = vector.size();
+  bitmap.resize((size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  if (upper_bound <= lower_bound) {
+    std::fill(bitmap.begin(), bitmap.end(), uint64_t{0});
+    return;
+  }
+
+  // A value v is in [lower_bound, upper_bound) iff v - lower_bound < upper_bound - lower_bound (unsigned wrap-around).
+  const auto range_size = upper_bound - lower_bound;
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) {
+    using VectorType = std::decay_t<decltype(typed_vector)>;
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      scan_bitpacking_range(typed_vector, lower_bound, range_size, bitmap);
+    } else if constexpr (std::is_same_v<VectorType, SimdBp128Vector>) {
+      scan_simd_bp128_range(typed_vector, lower_bound, range_size, bitmap);
+    } else {
+      scan_fixed_width_integer_range(typed_vector.data(), lower_bound, range_size, bitmap);
+    }
+  });
+}
+
+}  // namespace hyrise
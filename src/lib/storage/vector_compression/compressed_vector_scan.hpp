@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base_compressed_vector.hpp"
+
+namespace hyrise {
+
+/**
+ * Block-wise access to compressed vectors that avoids decoding one value at a time through the vectors' iterators or
+ * decompressors.
+ *
+ * BitPackingVectors are unpacked by gathering the 64 bits around each value, shifting the value to the lowest bits, and
+ * masking it. We use AVX-512 (eight values per instruction) or AVX2 (four values per instruction) if the binary is
+ * built for a CPU that supports them (the release build uses -march=native) and fall back to unpacking one value at a
+ * time otherwise. FixedWidthIntegerVectors already store their values in SIMD lanes and are processed by loops that
+ * the compiler vectorizes. SimdBp128Vectors are decoded block by block, and each block is compared while it is in the
+ * L1 cache.
+ */
+
+// Writes the values at the positions [begin, begin + count) of the vector to `output`.
+void decompress_block(const BaseCompressedVector& vector, size_t begin, size_t count, uint32_t* output);
+
+// Scans the vector for values in [lower_bound, upper_bound) without materializing the decompressed values. Bit
+// (position % 64) of bitmap[position / 64] is set if the value at `position` matches and cleared otherwise. Similar to
+// BitWeaving, the values are compared where they are unpacked (i.e., in SIMD registers), and the comparison results
+// are written as a bitmap.
+void scan_range_to_bitmap(const BaseCompressedVector& vector, uint32_t lower_bound, uint32_t upper_bound,
+                          std::vector<uint64_t>& bitmap);
+
+}  // namespace hyrise
@@ -30,6 +30,7 @@ enum class CompressedVectorType : uint8_t {
   FixedWidthInteger1Byte,
   FixedWidthInteger2Byte,
   FixedWidthInteger4Byte,  // uncompressed
+  SimdBp128
 };
 
 std::ostream& operator<<(std::ostream& stream, const CompressedVectorType compressed_vector_type);
@@ -37,6 +38,7 @@ std::ostream& operator<<(std::ostream& stream, const CompressedVectorType compre
 template <typename T>
 class FixedWidthIntegerVector;
 class BitPackingVector;
+class SimdBp128Vector;
 
 /**
  * Mapping of compressed vector types to compressed vectors
@@ -50,7 +52,8 @@ constexpr auto compressed_vector_for_type = hana::make_map(
                     hana::type_c<FixedWidthIntegerVector<uint16_t>>),
     hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::FixedWidthInteger1Byte>,
                     hana::type_c<FixedWidthIntegerVector<uint8_t>>),
-    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::BitPacking>, hana::type_c<BitPackingVector>));
+    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::BitPacking>, hana::type_c<BitPackingVector>),
+    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::SimdBp128>, hana::type_c<SimdBp128Vector>));
 
 /**
  * @brief Returns the CompressedVectorType of a given compressed vector
@@ -0,0 +1,112 @@
+#include "simd_bp128_compressor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "simd_bp128_packing.hpp"
+#include "simd_bp128_vector.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_compressor.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto MAX_BIT_WIDTH = size_t{32};
+
+// Each exception stores its position in the block (one byte) and its value (four bytes).
+constexpr auto EXCEPTION_SIZE = sizeof(uint8_t) + sizeof(uint32_t);
+
+// Chooses the bit width that minimizes the size of the packed block plus its exceptions. On ties, we prefer fewer
+// exceptions, which are slower to decode.
+uint8_t choose_bit_width(const std::array<uint32_t, SimdBp128Packing::BLOCK_SIZE>& block) {
+  auto value_count_by_bit_width = std::array<size_t, MAX_BIT_WIDTH + 1>{};
+  for (const auto value : block) {
+    ++value_count_by_bit_width[std::bit_width(value)];
+  }
+
+  auto max_bit_width = MAX_BIT_WIDTH;
+  while (max_bit_width > 0 && value_count_by_bit_width[max_bit_width] == 0) {
+    --max_bit_width;
+  }
+
+  auto best_bit_width = max_bit_width;
+  auto best_size = SimdBp128Packing::packed_word_count(static_cast<uint8_t>(max_bit_width)) * sizeof(uint32_t);
+  auto exception_count = size_t{0};
+  for (auto bit_width = max_bit_width; bit_width > 0; --bit_width) {
+    // Values that need more than bit_width - 1 bits become exceptions.
+    exception_count += value_count_by_bit_width[bit_width];
+    const auto size = SimdBp128Packing::packed_word_count(static_cast<uint8_t>(bit_width - 1)) * sizeof(uint32_t) +
+                      exception_count * EXCEPTION_SIZE;
+    if (size < best_size) {
+      best_size = size;
+      best_bit_width = bit_width - 1;
+    }
+  }
+
+  return static_cast<uint8_t>(best_bit_width);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::unique_ptr<const BaseCompressedVector> SimdBp128Compressor::compress(
+    const pmr_vector<uint32_t>& vector, const PolymorphicAllocator<size_t>& alloc,
+    const UncompressedVectorInfo& /*meta_info*/) {
+  constexpr auto BLOCK_SIZE = SimdBp128Packing::BLOCK_SIZE;
+
+  const auto size = vector.size();
+  const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  auto data = pmr_vector<uint32_t>(alloc);
+  auto block_offsets = pmr_vector<uint32_t>(alloc);
+  auto exception_offsets = pmr_vector<uint32_t>(alloc);
+  auto exception_positions = pmr_vector<uint8_t>(alloc);
+  auto exception_values = pmr_vector<uint32_t>(alloc);
+
+  block_offsets.reserve(block_count + 1);
+  exception_offsets.reserve(block_count + 1);
+  block_offsets.push_back(0);
+  exception_offsets.push_back(0);
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    // The last block is padded with zeros.
+    auto block = std::array<uint32_t, BLOCK_SIZE>{};
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(size, block_begin + BLOCK_SIZE);
+    std::copy(vector.cbegin() + static_cast<std::ptrdiff_t>(block_begin),
+              vector.cbegin() + static_cast<std::ptrdiff_t>(block_end), block.begin());
+
+    const auto bit_width = choose_bit_width(block);
+    const auto packed_begin = data.size();
+    data.resize(packed_begin + SimdBp128Packing::packed_word_count(bit_width));
+    SimdBp128Packing::pack_block(block.data(), data.data() + packed_begin, bit_width);
+
+    for (auto index_in_block = size_t{0}; index_in_block < BLOCK_SIZE; ++index_in_block) {
+      if (std::bit_width(block[index_in_block]) > bit_width) {
+        exception_positions.push_back(static_cast<uint8_t>(index_in_block));
+        exception_values.push_back(block[index_in_block]);
+      }
+    }
+
+    block_offsets.push_back(static_cast<uint32_t>(data.size()));
+    exception_offsets.push_back(static_cast<uint32_t>(exception_positions.size()));
+  }
+
+  return std::make_unique<SimdBp128Vector>(std::move(data), std::move(block_offsets), std::move(exception_offsets),
+                                           std::move(exception_positions), std::move(exception_values), size);
+}
+
+std::unique_ptr<BaseVectorCompressor> SimdBp128Compressor::create_new() const {
+  return std::make_unique<SimdBp128Compressor>();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+class SimdBp128Vector;
+
+/**
+ * Point access into a SimdBp128Vector. Single values are unpacked directly from their block. If the accesses move on
+ * to the next block (e.g., for sorted position lists), the whole block is decoded at once and cached.
+ *
+ * Segments keep a base decompressor for get_typed_value(), which may be called concurrently. These decompressors do
+ * not cache blocks, so that get() does not modify them.
+ *
+ * The methods that access the vector are defined in simd_bp128_vector.hpp.
+ */
+class SimdBp128Decompressor : public BaseVectorDecompressor {
+ public:
+  explicit SimdBp128Decompressor(const SimdBp128Vector& vector, const bool cache_blocks = true)
+      : _vector{vector}, _cache_blocks{cache_blocks} {}
+
+  SimdBp128Decompressor(const SimdBp128Decompressor& other) = default;
+  SimdBp128Decompressor(SimdBp128Decompressor&& other) = default;
+
+  SimdBp128Decompressor& operator=(const SimdBp128Decompressor& other) {
+    DebugAssert(&_vector == &other._vector, "Cannot reassign SimdBp128Decompressor.");
+    return *this;
+  }
+
+  SimdBp128Decompressor& operator=(SimdBp128Decompressor&& other) {
+    DebugAssert(&_vector == &other._vector, "Cannot reassign SimdBp128Decompressor.");
+    return *this;
+  }
+
+  ~SimdBp128Decompressor() override = default;
+
+  uint32_t get(size_t i) final;
+
+  size_t size() const final;
+
+ private:
+  static constexpr auto NO_BLOCK = std::numeric_limits<size_t>::max();
+
+  const SimdBp128Vector& _vector;
+  const bool _cache_blocks;
+  size_t _last_block_index{NO_BLOCK};
+  size_t _cached_block_index{NO_BLOCK};
+  std::array<uint32_t, SimdBp128Packing::BLOCK_SIZE> _cached_block{};
+};
+
+}  // namespace hyrise
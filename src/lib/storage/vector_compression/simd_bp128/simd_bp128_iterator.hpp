@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+
+namespace hyrise {
+
+class SimdBp128Vector;
+
+/**
+ * Sequential access to a SimdBp128Vector. Whenever the iterator enters a new block, it decodes all values of that block
+ * at once into a buffer.
+ *
+ * dereference() is defined in simd_bp128_vector.hpp.
+ */
+class SimdBp128Iterator : public BaseCompressedVectorIterator<SimdBp128Iterator> {
+ public:
+  explicit SimdBp128Iterator(const SimdBp128Vector& vector, const size_t absolute_index = 0)
+      : _vector{&vector}, _absolute_index{absolute_index} {}
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  void increment() {
+    ++_absolute_index;
+  }
+
+  void decrement() {
+    --_absolute_index;
+  }
+
+  void advance(std::ptrdiff_t n) {
+    _absolute_index += n;
+  }
+
+  bool equal(const SimdBp128Iterator& other) const {
+    return _absolute_index == other._absolute_index;
+  }
+
+  std::ptrdiff_t distance_to(const SimdBp128Iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._absolute_index) - static_cast<std::ptrdiff_t>(_absolute_index);
+  }
+
+  uint32_t dereference() const;
+
+ private:
+  static constexpr auto NO_BLOCK = std::numeric_limits<size_t>::max();
+
+  const SimdBp128Vector* _vector;
+  size_t _absolute_index = 0;
+
+  // Decoding happens lazily when dereferencing, which boost::iterator_facade requires to be const.
+  mutable size_t _cached_block_index{NO_BLOCK};
+  mutable std::array<uint32_t, SimdBp128Packing::BLOCK_SIZE> _cached_block{};
+};
+
+}  // namespace hyrise
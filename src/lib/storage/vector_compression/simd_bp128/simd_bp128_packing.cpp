@@ -0,0 +1,104 @@
+#include "simd_bp128_packing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr auto BITS_PER_WORD = uint32_t{32};
+
+uint32_t value_mask(const uint8_t bit_width) {
+  return static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+void SimdBp128Packing::pack_block(const uint32_t* input, uint32_t* output, const uint8_t bit_width) {
+  std::fill_n(output, packed_word_count(bit_width), uint32_t{0});
+  if (bit_width == 0) {
+    return;
+  }
+
+  const auto mask = value_mask(bit_width);
+  for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+    const auto lane = index % LANE_COUNT;
+    const auto bit_offset = static_cast<uint32_t>(index / LANE_COUNT) * bit_width;
+    const auto word = bit_offset / BITS_PER_WORD;
+    const auto shift = bit_offset % BITS_PER_WORD;
+    const auto value = input[index] & mask;
+
+    output[LANE_COUNT * word + lane] |= value << shift;
+    if (shift + bit_width > BITS_PER_WORD) {
+      output[LANE_COUNT * (word + 1) + lane] |= value >> (BITS_PER_WORD - shift);
+    }
+  }
+}
+
+void SimdBp128Packing::unpack_block(const uint32_t* input, uint32_t* output, const uint8_t bit_width) {
+  if (bit_width == 0) {
+    std::fill_n(output, BLOCK_SIZE, uint32_t{0});
+    return;
+  }
+
+  const auto mask = value_mask(bit_width);
+  constexpr auto SLOT_COUNT = BLOCK_SIZE / LANE_COUNT;
+
+#if defined(__SSE2__)
+  const auto masks = _mm_set1_epi32(static_cast<int32_t>(mask));
+  for (auto slot = uint32_t{0}; slot < SLOT_COUNT; ++slot) {
+    const auto bit_offset = slot * bit_width;
+    const auto word = bit_offset / BITS_PER_WORD;
+    const auto shift = bit_offset % BITS_PER_WORD;
+
+    const auto* const words = reinterpret_cast<const __m128i*>(input + LANE_COUNT * word);
+    auto values = _mm_srl_epi32(_mm_loadu_si128(words), _mm_cvtsi32_si128(static_cast<int32_t>(shift)));
+    if (shift + bit_width > BITS_PER_WORD) {
+      const auto high_bits = _mm_sll_epi32(_mm_loadu_si128(words + 1),
+                                           _mm_cvtsi32_si128(static_cast<int32_t>(BITS_PER_WORD - shift)));
+      values = _mm_or_si128(values, high_bits);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + LANE_COUNT * slot), _mm_and_si128(values, masks));
+  }
+#else
+  for (auto slot = uint32_t{0}; slot < SLOT_COUNT; ++slot) {
+    const auto bit_offset = slot * bit_width;
+    const auto word = bit_offset / BITS_PER_WORD;
+    const auto shift = bit_offset % BITS_PER_WORD;
+    const auto spills = shift + bit_width > BITS_PER_WORD;
+
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      auto value = input[LANE_COUNT * word + lane] >> shift;
+      if (spills) {
+        value |= input[LANE_COUNT * (word + 1) + lane] << (BITS_PER_WORD - shift);
+      }
+      output[LANE_COUNT * slot + lane] = value & mask;
+    }
+  }
+#endif
+}
+
+uint32_t SimdBp128Packing::unpack_value(const uint32_t* input, const uint8_t bit_width, const size_t index) {
+  if (bit_width == 0) {
+    return 0;
+  }
+
+  const auto lane = index % LANE_COUNT;
+  const auto bit_offset = static_cast<uint32_t>(index / LANE_COUNT) * bit_width;
+  const auto word = bit_offset / BITS_PER_WORD;
+  const auto shift = bit_offset % BITS_PER_WORD;
+
+  auto value = input[LANE_COUNT * word + lane] >> shift;
+  if (shift + bit_width > BITS_PER_WORD) {
+    value |= input[LANE_COUNT * (word + 1) + lane] << (BITS_PER_WORD - shift);
+  }
+  return value & value_mask(bit_width);
+}
+
+}  // namespace hyrise
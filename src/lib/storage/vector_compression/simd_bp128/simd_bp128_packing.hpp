@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hyrise {
+
+/**
+ * @brief Packs and unpacks blocks of 128 integers that share one bit width
+ *
+ * The values of a block are distributed over four 32-bit lanes (value i goes to lane i % 4), and each lane is
+ * bit-packed on its own. Word k of lane l is stored at index 4 * k + l so that four consecutive words form one 128-bit
+ * SIMD register. A block with bit width b thus occupies 4 * b words. With this vertical layout, four values are
+ * unpacked at once using shifts and masks that are the same for all lanes (see Lemire and Boytsov: "Decoding billions
+ * of integers per second through vectorization").
+ */
+class SimdBp128Packing {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{128};
+  static constexpr auto LANE_COUNT = size_t{4};
+
+  // Number of 32-bit words of a packed block.
+  static size_t packed_word_count(const uint8_t bit_width) {
+    return LANE_COUNT * bit_width;
+  }
+
+  // Packs BLOCK_SIZE values of `input` into packed_word_count(bit_width) words of `output`. Only the lowest
+  // `bit_width` bits of each value are stored.
+  static void pack_block(const uint32_t* input, uint32_t* output, const uint8_t bit_width);
+
+  // Unpacks BLOCK_SIZE values from `input` into `output`.
+  static void unpack_block(const uint32_t* input, uint32_t* output, const uint8_t bit_width);
+
+  // Unpacks the value at `index` (< BLOCK_SIZE) of a packed block.
+  static uint32_t unpack_value(const uint32_t* input, const uint8_t bit_width, const size_t index);
+};
+
+}  // namespace hyrise
@@ -0,0 +1,120 @@
+#include "simd_bp128_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "simd_bp128_decompressor.hpp"
+#include "simd_bp128_iterator.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+SimdBp128Vector::SimdBp128Vector(pmr_vector<uint32_t> data, pmr_vector<uint32_t> block_offsets,
+                                 pmr_vector<uint32_t> exception_offsets, pmr_vector<uint8_t> exception_positions,
+                                 pmr_vector<uint32_t> exception_values, size_t size)
+    : _data{std::move(data)},
+      _block_offsets{std::move(block_offsets)},
+      _exception_offsets{std::move(exception_offsets)},
+      _exception_positions{std::move(exception_positions)},
+      _exception_values{std::move(exception_values)},
+      _size{size} {
+  Assert(_block_offsets.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE + 1, "Unexpected number of block offsets.");
+  Assert(_exception_offsets.size() == _block_offsets.size(), "Expected one exception offset per block.");
+  Assert(_block_offsets.back() == _data.size(), "Block offsets do not match the packed data.");
+  Assert(_exception_offsets.back() == _exception_positions.size() &&
+             _exception_positions.size() == _exception_values.size(),
+         "Exception offsets do not match the exceptions.");
+}
+
+const pmr_vector<uint32_t>& SimdBp128Vector::data() const {
+  return _data;
+}
+
+const pmr_vector<uint32_t>& SimdBp128Vector::block_offsets() const {
+  return _block_offsets;
+}
+
+const pmr_vector<uint32_t>& SimdBp128Vector::exception_offsets() const {
+  return _exception_offsets;
+}
+
+const pmr_vector<uint8_t>& SimdBp128Vector::exception_positions() const {
+  return _exception_positions;
+}
+
+const pmr_vector<uint32_t>& SimdBp128Vector::exception_values() const {
+  return _exception_values;
+}
+
+size_t SimdBp128Vector::block_count() const {
+  return _block_offsets.size() - 1;
+}
+
+void SimdBp128Vector::decode(const size_t begin, const size_t count, uint32_t* output) const {
+  DebugAssert(begin + count <= _size, "Cannot decode values beyond the end of the vector.");
+
+  auto block_buffer = std::array<uint32_t, BLOCK_SIZE>{};
+  const auto end = begin + count;
+  auto position = begin;
+  while (position < end) {
+    const auto block_index = position / BLOCK_SIZE;
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = block_begin + BLOCK_SIZE;
+
+    if (position == block_begin && block_end <= end) {
+      decode_block(block_index, output + (position - begin));
+      position = block_end;
+      continue;
+    }
+
+    decode_block(block_index, block_buffer.data());
+    const auto copy_end = std::min(end, block_end);
+    std::copy(block_buffer.cbegin() + static_cast<std::ptrdiff_t>(position - block_begin),
+              block_buffer.cbegin() + static_cast<std::ptrdiff_t>(copy_end - block_begin), output + (position - begin));
+    position = copy_end;
+  }
+}
+
+size_t SimdBp128Vector::on_size() const {
+  return _size;
+}
+
+size_t SimdBp128Vector::on_data_size() const {
+  return sizeof(uint32_t) * (_data.size() + _block_offsets.size() + _exception_offsets.size() +
+                             _exception_values.size()) +
+         sizeof(uint8_t) * _exception_positions.size();
+}
+
+std::unique_ptr<BaseVectorDecompressor> SimdBp128Vector::on_create_base_decompressor() const {
+  return std::make_unique<SimdBp128Decompressor>(*this, false);
+}
+
+SimdBp128Decompressor SimdBp128Vector::on_create_decompressor() const {
+  return SimdBp128Decompressor(*this);
+}
+
+SimdBp128Iterator SimdBp128Vector::on_begin() const {
+  return SimdBp128Iterator(*this, 0u);
+}
+
+SimdBp128Iterator SimdBp128Vector::on_end() const {
+  return SimdBp128Iterator(*this, _size);
+}
+
+std::unique_ptr<const BaseCompressedVector> SimdBp128Vector::on_copy_using_memory_resource(
+    MemoryResource& memory_resource) const {
+  return std::make_unique<SimdBp128Vector>(
+      pmr_vector<uint32_t>{_data, &memory_resource}, pmr_vector<uint32_t>{_block_offsets, &memory_resource},
+      pmr_vector<uint32_t>{_exception_offsets, &memory_resource},
+      pmr_vector<uint8_t>{_exception_positions, &memory_resource},
+      pmr_vector<uint32_t>{_exception_values, &memory_resource}, _size);
+}
+
+}  // namespace hyrise
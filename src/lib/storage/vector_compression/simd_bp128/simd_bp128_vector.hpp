@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include "simd_bp128_decompressor.hpp"
+#include "simd_bp128_iterator.hpp"
+#include "simd_bp128_packing.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Blocked SIMD bit-packing with patched exceptions
+ *
+ * The vector is divided into blocks of 128 values. Each block is bit-packed with its own bit width in the SIMD-friendly
+ * layout of SimdBp128Packing, which decodes four values per instruction. The last block is padded with zeros.
+ *
+ * Similar to (Fast)PFOR, the bit width of a block does not have to cover its largest values: a few large values are
+ * stored as exceptions, which overwrite (patch) the values at their positions after the block has been unpacked. The
+ * compressor picks the bit width that minimizes the size of the block including its exceptions. Thus, outliers do not
+ * inflate the bit width of the entire block (as for BitPacking) or vector (as for FixedWidthInteger).
+ *
+ * Layout:
+ *  - data: the packed blocks, block i starts at word block_offsets[i]. As a block with bit width b occupies 4 * b
+ *    words, the bit width is derived from the offsets.
+ *  - block_offsets: block_count + 1 entries.
+ *  - exception_offsets: block_count + 1 entries, the exceptions of block i are at [exception_offsets[i],
+ *    exception_offsets[i + 1]) in the exception vectors.
+ *  - exception_positions: the positions of the exceptions within their block, sorted per block.
+ *  - exception_values: the full values of the exceptions.
+ */
+class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
+ public:
+  static constexpr auto BLOCK_SIZE = SimdBp128Packing::BLOCK_SIZE;
+
+  SimdBp128Vector(pmr_vector<uint32_t> data, pmr_vector<uint32_t> block_offsets, pmr_vector<uint32_t> exception_offsets,
+                  pmr_vector<uint8_t> exception_positions, pmr_vector<uint32_t> exception_values, size_t size);
+
+  const pmr_vector<uint32_t>& data() const;
+  const pmr_vector<uint32_t>& block_offsets() const;
+  const pmr_vector<uint32_t>& exception_offsets() const;
+  const pmr_vector<uint8_t>& exception_positions() const;
+  const pmr_vector<uint32_t>& exception_values() const;
+
+  size_t block_count() const;
+
+  uint8_t block_bit_width(const size_t block_index) const {
+    return static_cast<uint8_t>((_block_offsets[block_index + 1] - _block_offsets[block_index]) /
+                                SimdBp128Packing::LANE_COUNT);
+  }
+
+  // Returns the value at `index` without decoding its block.
+  uint32_t get(const size_t index) const {
+    const auto block_index = index / BLOCK_SIZE;
+    const auto index_in_block = static_cast<uint8_t>(index % BLOCK_SIZE);
+
+    const auto exceptions_begin = _exception_positions.cbegin() + _exception_offsets[block_index];
+    const auto exceptions_end = _exception_positions.cbegin() + _exception_offsets[block_index + 1];
+    const auto exception_it = std::lower_bound(exceptions_begin, exceptions_end, index_in_block);
+    if (exception_it != exceptions_end && *exception_it == index_in_block) {
+      return _exception_values[std::distance(_exception_positions.cbegin(), exception_it)];
+    }
+
+    return SimdBp128Packing::unpack_value(_data.data() + _block_offsets[block_index], block_bit_width(block_index),
+                                          index_in_block);
+  }
+
+  // Decodes all BLOCK_SIZE values of a block (including the padding of the last block) into `output`.
+  void decode_block(const size_t block_index, uint32_t* output) const {
+    SimdBp128Packing::unpack_block(_data.data() + _block_offsets[block_index], output, block_bit_width(block_index));
+
+    const auto exceptions_end = _exception_offsets[block_index + 1];
+    for (auto exception_idx = _exception_offsets[block_index]; exception_idx < exceptions_end; ++exception_idx) {
+      output[_exception_positions[exception_idx]] = _exception_values[exception_idx];
+    }
+  }
+
+  // Bulk decoding of the values at [begin, begin + count) into `output`. Blocks that are entirely covered are decoded
+  // directly into `output`.
+  void decode(const size_t begin, const size_t count, uint32_t* output) const;
+
+  size_t on_size() const;
+  size_t on_data_size() const;
+
+  std::unique_ptr<BaseVectorDecompressor> on_create_base_decompressor() const;
+  SimdBp128Decompressor on_create_decompressor() const;
+
+  SimdBp128Iterator on_begin() const;
+  SimdBp128Iterator on_end() const;
+
+  std::unique_ptr<const BaseCompressedVector> on_copy_using_memory_resource(MemoryResource& memory_resource) const;
+
+ private:
+  const pmr_vector<uint32_t> _data;
+  const pmr_vector<uint32_t> _block_offsets;
+  const pmr_vector<uint32_t> _exception_offsets;
+  const pmr_vector<uint8_t> _exception_positions;
+  const pmr_vector<uint32_t> _exception_values;
+  const size_t _size;
+};
+
+inline uint32_t SimdBp128Decompressor::get(size_t i) {
+  if (!_cache_blocks) {
+    return _vector.get(i);
+  }
+
+  const auto block_index = i / SimdBp128Packing::BLOCK_SIZE;
+  if (block_index == _cached_block_index) {
+    return _cached_block[i % SimdBp128Packing::BLOCK_SIZE];
+  }
+
+  // Only decode the entire block if the accesses appear to be sequential. Otherwise, unpacking the single value is
+  // cheaper.
+  const auto is_next_block = _last_block_index != NO_BLOCK && block_index == _last_block_index + 1;
+  _last_block_index = block_index;
+  if (!is_next_block) {
+    return _vector.get(i);
+  }
+
+  _vector.decode_block(block_index, _cached_block.data());
+  _cached_block_index = block_index;
+  return _cached_block[i % SimdBp128Packing::BLOCK_SIZE];
+}
+
+inline size_t SimdBp128Decompressor::size() const {
+  return _vector.size();
+}
+
+inline uint32_t SimdBp128Iterator::dereference() const {
+  const auto block_index = _absolute_index / SimdBp128Packing::BLOCK_SIZE;
+  if (block_index != _cached_block_index) {
+    _vector->decode_block(block_index, _cached_block.data());
+    _cached_block_index = block_index;
+  }
+  return _cached_block[_absolute_index % SimdBp128Packing::BLOCK_SIZE];
+}
+
+}  // namespace hyrise
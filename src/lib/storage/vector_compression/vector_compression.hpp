@@ -17,11 +17,12 @@ namespace hyrise {
  * Also known as null suppression and
  * zero suppression in the literature.
  */
-enum class VectorCompressionType : uint8_t { FixedWidthInteger, BitPacking };
+enum class VectorCompressionType : uint8_t { FixedWidthInteger, BitPacking, SimdBp128 };
 
 const auto vector_compression_type_to_string = make_bimap<VectorCompressionType, std::string>({
     {VectorCompressionType::FixedWidthInteger, "Fixed-width integer"},
     {VectorCompressionType::BitPacking, "Bit-packing"},
+    {VectorCompressionType::SimdBp128, "SIMD-BP128"},
 });
 
 std::ostream& operator<<(std::ostream& stream, const VectorCompressionType vector_compression_type);
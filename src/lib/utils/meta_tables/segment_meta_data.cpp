@@ -17,6 +17,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
 #include "storage/segment_access_counter.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -106,6 +107,12 @@ size_t get_distinct_value_count(const std::shared_ptr<AbstractSegment>& segment)
       return;
     }
 
+    if (const auto fsst_dictionary_segment =
+            std::dynamic_pointer_cast<const FSSTDictionarySegment<pmr_string>>(segment)) {
+      distinct_value_count = fsst_dictionary_segment->fsst_dictionary()->size();
+      return;
+    }
+
     auto distinct_values = std::unordered_set<ColumnDataType>{};
     auto iterable = create_any_segment_iterable<ColumnDataType>(*segment);
     iterable.with_iterators([&](auto it, const auto end) {
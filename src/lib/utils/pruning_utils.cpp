@@ -35,38 +35,6 @@ namespace {
 
 using namespace hyrise;  // NOLINT(build/namespaces)
 
-// Check whether any of the statistics objects available for this Segment identify the predicate as prunable.
-bool can_prune(const BaseAttributeStatistics& base_segment_statistics, const PredicateCondition predicate_condition,
-               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
-
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
-
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
-
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
-    }
-
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
-    }
-  });
-
-  return can_prune;
-}
-
 template <typename T>
 std::vector<T> pruned_items_mapping(const size_t initial_item_count, const std::vector<T>& pruned_item_ids) {
   // This function assumes to be used solely for column and chunk pruning.
@@ -108,6 +76,37 @@ namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
 
+bool can_prune(const BaseAttributeStatistics& base_segment_statistics, const PredicateCondition predicate_condition,
+               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2) {
+  auto can_prune = false;
+
+  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+
+    // Range filters are only available for arithmetic (non-string) types.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (segment_statistics.range_filter) {
+        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+          can_prune = true;
+        }
+      }
+      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
+      DebugAssert(!segment_statistics.min_max_filter,
+                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+    }
+
+    if (segment_statistics.min_max_filter) {
+      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+        can_prune = true;
+      }
+    }
+  });
+
+  return can_prune;
+}
+
 std::set<ChunkID> compute_chunk_exclude_list(const PredicatePruningChain& predicate_pruning_chain,
                                              const std::shared_ptr<StoredTableNode>& stored_table_node) {
   auto pruned_chunk_ids_by_predicate_node_cache =
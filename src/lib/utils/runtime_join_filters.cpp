@@ -0,0 +1,184 @@
+#include "runtime_join_filters.hpp"
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/projection.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/pruning_utils.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Follows the join column from the join input down to a GetTable operator and returns the GetTable and the column's
+// ColumnID in the stored table. Returns nullopt if any operator on the way could add rows, changes the column, or has
+// other consumers that would miss the pruned chunks.
+std::optional<std::pair<std::shared_ptr<GetTable>, ColumnID>> find_filterable_get_table(
+    std::shared_ptr<AbstractOperator> op, ColumnID column_id) {
+  while (op->consumer_count() == 1) {
+    switch (op->type()) {
+      case OperatorType::GetTable: {
+        const auto get_table = std::static_pointer_cast<GetTable>(op);
+        return std::make_pair(get_table, column_id_before_pruning(column_id, get_table->pruned_column_ids()));
+      }
+
+      case OperatorType::TableScan:
+      case OperatorType::Validate:
+        break;
+
+      case OperatorType::Projection: {
+        const auto& expression = *static_cast<const Projection&>(*op).expressions[column_id];
+        if (expression.type != ExpressionType::PQPColumn) {
+          return std::nullopt;
+        }
+        column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      } break;
+
+      default:
+        return std::nullopt;
+    }
+
+    op = op->mutable_left_input();
+  }
+
+  return std::nullopt;
+}
+
+// Checks whether executing @param op requires @param get_table to be executed first, i.e., whether @param get_table is
+// an input, a subquery, or a pruning dependency (see link_tasks_for_subquery_pruning in operator_task.cpp) of @param op
+// or of any of its transitive inputs.
+bool depends_on(const std::shared_ptr<const AbstractOperator>& op, const std::shared_ptr<const GetTable>& get_table) {
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto pending_operators = std::vector<std::shared_ptr<const AbstractOperator>>{op};
+  while (!pending_operators.empty()) {
+    const auto current_op = pending_operators.back();
+    pending_operators.pop_back();
+    if (current_op == get_table) {
+      return true;
+    }
+    if (!visited_operators.emplace(current_op).second) {
+      continue;
+    }
+
+    if (current_op->left_input()) {
+      pending_operators.emplace_back(current_op->left_input());
+    }
+    if (current_op->right_input()) {
+      pending_operators.emplace_back(current_op->right_input());
+    }
+    for (const auto& subquery : current_op->uncorrelated_subqueries()) {
+      pending_operators.emplace_back(subquery);
+    }
+    if (current_op->type() == OperatorType::GetTable) {
+      const auto& current_get_table = static_cast<const GetTable&>(*current_op);
+      for (const auto& runtime_join_filter : current_get_table.runtime_join_filters()) {
+        pending_operators.emplace_back(runtime_join_filter.source.lock());
+      }
+      for (const auto& table_scan : current_get_table.prunable_subquery_predicates()) {
+        for (const auto& subquery : table_scan->uncorrelated_subqueries()) {
+          pending_operators.emplace_back(subquery);
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+void add_runtime_join_filter(const JoinHash& join, const CardinalityEstimator& estimator) {
+  const auto mode = join.mode();
+  const auto& primary_predicate = join.primary_predicate();
+  if ((mode != JoinMode::Inner && mode != JoinMode::Semi) ||
+      primary_predicate.predicate_condition != PredicateCondition::Equals) {
+    return;
+  }
+
+  const auto& left_lqp_node = join.left_input()->lqp_node;
+  const auto& right_lqp_node = join.right_input()->lqp_node;
+  if (!left_lqp_node || !right_lqp_node) {
+    return;
+  }
+
+  // The smaller input filters the larger one. This matches the choice of the build side for inner joins. Semi joins
+  // only drop rows of the left input.
+  const auto left_cardinality = estimator.estimate_cardinality(left_lqp_node);
+  const auto right_cardinality = estimator.estimate_cardinality(right_lqp_node);
+  const auto filter_left_input = right_cardinality < left_cardinality;
+  if (!filter_left_input && (mode == JoinMode::Semi || left_cardinality == right_cardinality)) {
+    return;
+  }
+
+  const auto& [target_column_id, source_column_id] =
+      filter_left_input ? primary_predicate.column_ids
+                        : std::make_pair(primary_predicate.column_ids.second, primary_predicate.column_ids.first);
+  const auto& target = filter_left_input ? join.mutable_left_input() : join.mutable_right_input();
+  const auto& source = filter_left_input ? join.mutable_right_input() : join.mutable_left_input();
+  if (target->lqp_node->output_expressions()[target_column_id]->data_type() !=
+      source->lqp_node->output_expressions()[source_column_id]->data_type()) {
+    return;
+  }
+
+  const auto filterable_get_table = find_filterable_get_table(target, target_column_id);
+  if (!filterable_get_table || depends_on(source, filterable_get_table->first)) {
+    return;
+  }
+
+  const auto& [get_table, column_id] = *filterable_get_table;
+  auto runtime_join_filters = get_table->runtime_join_filters();
+  runtime_join_filters.emplace_back(RuntimeJoinFilter{source, source_column_id, column_id});
+  get_table->set_runtime_join_filters(runtime_join_filters);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+void add_runtime_join_filters(const std::shared_ptr<AbstractOperator>& pqp) {
+  const auto estimator = CardinalityEstimator::new_instance();
+  visit_pqp(pqp, [&](const auto& op) {
+    if (op->type() == OperatorType::JoinHash) {
+      add_runtime_join_filter(static_cast<JoinHash&>(*op), *estimator);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+}
+
+void map_runtime_join_filters(
+    const std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) {
+  for (const auto& [op, copied_op] : copied_ops) {
+    if (op->type() != OperatorType::GetTable) {
+      continue;
+    }
+
+    const auto& runtime_join_filters = static_cast<const GetTable&>(*op).runtime_join_filters();
+    if (runtime_join_filters.empty()) {
+      continue;
+    }
+
+    auto copied_runtime_join_filters = std::vector<RuntimeJoinFilter>{};
+    copied_runtime_join_filters.reserve(runtime_join_filters.size());
+    for (const auto& runtime_join_filter : runtime_join_filters) {
+      const auto source = runtime_join_filter.source.lock();
+      DebugAssert(source && copied_ops.contains(source.get()), "Could not find source operator. PQP is invalid.");
+      copied_runtime_join_filters.emplace_back(RuntimeJoinFilter{
+          copied_ops.at(source.get()), runtime_join_filter.source_column_id, runtime_join_filter.column_id});
+    }
+
+    static_cast<const GetTable&>(*copied_op).set_runtime_join_filters(copied_runtime_join_filters);
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+namespace hyrise {
+
+class AbstractOperator;
+
+/**
+ * Adds runtime join filters (see GetTable::set_runtime_join_filters()) for the JoinHash operators of a PQP. A filter is
+ * added for inner and semi equi-joins if
+ *  - one join input reaches a GetTable operator only through TableScans, Validates, and Projections that forward the
+ *    join column, none of which (including the GetTable) has another consumer,
+ *  - the other input (the source) is estimated to be smaller (for semi joins, the source is the right input),
+ *  - both join columns have the same data type, and
+ *  - the GetTable operator is not part of the source's subtree, which would lead to a cycle in the task graph.
+ * Called by the LQPTranslator after the entire LQP has been translated, because the cardinalities are estimated from
+ * the operators' LQP nodes.
+ */
+void add_runtime_join_filters(const std::shared_ptr<AbstractOperator>& pqp);
+
+/**
+ * The sources of runtime join filters are operators of the same PQP. Similar to prunable subquery predicates (see
+ * map_prunable_subquery_predicates.hpp), we can only assign the copied sources after the entire PQP has been copied.
+ */
+void map_runtime_join_filters(
+    const std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops);
+
+}  // namespace hyrise
@@ -0,0 +1,640 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "magic_enum.hpp"
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/assert.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Returns the estimated size of a compressed vector with `count` values that are at most `max_value`.
+size_t compressed_vector_size(const size_t count, const uint64_t max_value,
+                              const VectorCompressionType vector_compression_type) {
+  if (vector_compression_type == VectorCompressionType::FixedWidthInteger) {
+    auto value_size = size_t{4};
+    if (max_value <= std::numeric_limits<uint8_t>::max()) {
+      value_size = 1;
+    } else if (max_value <= std::numeric_limits<uint16_t>::max()) {
+      value_size = 2;
+    }
+    return count * value_size;
+  }
+
+  // Bit-packing and SIMD-BP128 store the values with as many bits as the largest value needs.
+  const auto bit_width = std::max(size_t{1}, static_cast<size_t>(std::bit_width(max_value)));
+  return (count * bit_width + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+// Returns the number of bits per offset of a FrameOfReferenceSegment with the sampled values, or nullopt if the values
+// would be stored as exceptions.
+template <typename T>
+std::optional<uint32_t> frame_of_reference_bit_width(const std::vector<T>& values, const std::vector<bool>& null_flags,
+                                                     const bool is_sorted, const size_t row_count) {
+  using Segment = FrameOfReferenceSegment<T>;
+
+  auto non_null_values = std::vector<T>{};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    if (!null_flags[index]) {
+      non_null_values.push_back(values[index]);
+    }
+  }
+  if (non_null_values.empty()) {
+    return 0;
+  }
+
+  auto encoded_values = std::vector<int64_t>{};
+  if constexpr (std::is_floating_point_v<T>) {
+    // Floating-point values are stored as decimals. Use the smallest exponent that encodes all sampled values.
+    for (auto decimal_exponent = uint8_t{0}; decimal_exponent <= Segment::max_decimal_exponent; ++decimal_exponent) {
+      encoded_values.clear();
+      for (const auto value : non_null_values) {
+        const auto scaled_value = static_cast<double>(value) * Segment::powers_of_ten[decimal_exponent];
+        if (!(std::abs(scaled_value) < static_cast<double>(Segment::max_decimal_magnitude))) {
+          break;
+        }
+        const auto encoded_value = static_cast<int64_t>(std::llround(scaled_value));
+        if (Segment::decode_decimal(encoded_value, decimal_exponent) != value) {
+          break;
+        }
+        encoded_values.push_back(encoded_value);
+      }
+
+      if (encoded_values.size() == non_null_values.size()) {
+        break;
+      }
+    }
+
+    if (encoded_values.size() != non_null_values.size()) {
+      return std::nullopt;
+    }
+  } else {
+    encoded_values.assign(non_null_values.cbegin(), non_null_values.cend());
+  }
+
+  const auto [minimum, maximum] = std::minmax_element(encoded_values.cbegin(), encoded_values.cend());
+  auto range = static_cast<uint64_t>(*maximum) - static_cast<uint64_t>(*minimum);
+  if (is_sorted) {
+    // The values of a block of sorted values only span a part of the range.
+    const auto block_share = std::min(1.0, static_cast<double>(Segment::block_size) / static_cast<double>(row_count));
+    range = static_cast<uint64_t>(std::ceil(static_cast<double>(range) * block_share));
+  }
+
+  const auto bit_width = static_cast<uint32_t>(std::bit_width(range));
+  if (bit_width > 32) {
+    return std::nullopt;
+  }
+  return bit_width;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string EncodingAdvisorPlugin::description() const {
+  return "Encoding advisor plugin";
+}
+
+void EncodingAdvisorPlugin::start() {
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>(_memory_budget);
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_REENCODING, [&](size_t /*unused*/) {
+    _reencode_segments();
+  });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  _memory_budget_setting->unregister_at_settings_manager();
+  _memory_budget_setting.reset();
+  _segment_states.clear();
+}
+
+void EncodingAdvisorPlugin::_reencode_segments() {
+  struct SegmentToEncode {
+    SegmentKey key;
+    std::shared_ptr<Chunk> chunk;
+    DataType data_type;
+    std::shared_ptr<AbstractSegment> segment;
+  };
+
+  auto segment_states = std::map<SegmentKey, SegmentState>{};
+  auto segments = std::vector<SegmentToEncode>{};
+  auto candidates = std::vector<std::vector<EncodingCandidate>>{};
+  auto memory_usage = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto chunk_count = table->chunk_count();
+    const auto column_count = table->column_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      // Only immutable chunks can be encoded.
+      if (!chunk || chunk->is_mutable() || chunk->size() == 0) {
+        continue;
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        if (chunk->is_indexed(column_id)) {
+          continue;
+        }
+
+        const auto segment = chunk->get_segment(column_id);
+        const auto data_type = table->column_data_type(column_id);
+        const auto access_counters = _read_access_counters(*segment);
+        auto key = SegmentKey{table_name, chunk_id, column_id};
+
+        // States of segments that no longer exist are not moved to the new map and thus dropped.
+        auto state = SegmentState{};
+        const auto state_it = _segment_states.find(key);
+        if (state_it != _segment_states.end() && state_it->second.segment == segment) {
+          state = std::move(state_it->second);
+        } else {
+          // As the values of immutable chunks do not change, the characteristics are determined only once. The
+          // accesses of the sampling are not counted (see below).
+          state.segment = segment;
+          state.characteristics = _sample_segment(*segment, data_type);
+        }
+
+        auto sequential_accesses = 0.0;
+        auto random_accesses = 0.0;
+        for (auto type_index = size_t{0}; type_index < access_counters.size(); ++type_index) {
+          const auto previous_count = state.counters_at_last_round[type_index];
+          const auto new_accesses = access_counters[type_index] >= previous_count
+                                        ? access_counters[type_index] - previous_count
+                                        : access_counters[type_index];
+          if (static_cast<SegmentAccessCounter::AccessType>(type_index) ==
+              SegmentAccessCounter::AccessType::Sequential) {
+            sequential_accesses += static_cast<double>(new_accesses);
+          } else {
+            random_accesses += static_cast<double>(new_accesses);
+          }
+        }
+        state.access_counts.sequential = (state.access_counts.sequential * ACCESS_DECAY) + sequential_accesses;
+        state.access_counts.random = (state.access_counts.random * ACCESS_DECAY) + random_accesses;
+        state.counters_at_last_round = _read_access_counters(*segment);
+
+        candidates.emplace_back(_encoding_candidates(data_type, state.characteristics, state.access_counts));
+        memory_usage += segment->memory_usage(MemoryUsageCalculationMode::Sampled);
+        segments.push_back({key, chunk, data_type, segment});
+        segment_states.emplace(std::move(key), std::move(state));
+      }
+    }
+  }
+  _segment_states = std::move(segment_states);
+
+  const auto configured_memory_budget = static_cast<size_t>(_memory_budget.load());
+  const auto memory_budget = configured_memory_budget > 0 ? configured_memory_budget : memory_usage;
+  const auto selected_candidates = _select_encodings(candidates, memory_budget);
+
+  const auto segment_count = segments.size();
+  for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+    const auto& [key, chunk, data_type, segment] = segments[segment_index];
+    const auto& segment_candidates = candidates[segment_index];
+    const auto& selected_candidate = segment_candidates[selected_candidates[segment_index]];
+
+    const auto current_encoding_spec = get_segment_encoding_spec(segment);
+    const auto current_candidate =
+        std::find_if(segment_candidates.cbegin(), segment_candidates.cend(), [&](const auto& candidate) {
+          return candidate.encoding_spec == current_encoding_spec;
+        });
+    if (current_candidate != segment_candidates.cend() &&
+        static_cast<double>(current_candidate->memory_usage) <=
+            static_cast<double>(selected_candidate.memory_usage) * REENCODING_THRESHOLD &&
+        current_candidate->access_cost <= selected_candidate.access_cost * REENCODING_THRESHOLD) {
+      continue;
+    }
+
+    const auto& [table_name, chunk_id, column_id] = key;
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, data_type, selected_candidate.encoding_spec);
+    encoded_segment->access_counter = segment->access_counter;
+    chunk->replace_segment(column_id, encoded_segment);
+    // The accesses of the encoding are not counted.
+    auto& state = _segment_states[key];
+    state.segment = encoded_segment;
+    state.counters_at_last_round = _read_access_counters(*encoded_segment);
+
+    auto message = std::stringstream{};
+    message << "Encoded segment of column " << column_id << " of chunk " << chunk_id << " of table '" << table_name
+            << "' with " << selected_candidate.encoding_spec << ".";
+    Hyrise::get().log_manager.add_message("EncodingAdvisorPlugin", message.str(), LogLevel::Debug);
+  }
+}
+
+EncodingAdvisorPlugin::SegmentCharacteristics EncodingAdvisorPlugin::_sample_segment(const AbstractSegment& segment,
+                                                                                     const DataType data_type) {
+  auto characteristics = SegmentCharacteristics{};
+  const auto row_count = static_cast<size_t>(segment.size());
+  characteristics.row_count = segment.size();
+  if (row_count == 0) {
+    return characteristics;
+  }
+
+  // The sample consists of windows of consecutive rows that are evenly distributed over the segment.
+  auto window_begins = std::vector<size_t>{};
+  if (row_count <= SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE) {
+    for (auto window_begin = size_t{0}; window_begin < row_count; window_begin += SAMPLE_WINDOW_SIZE) {
+      window_begins.push_back(window_begin);
+    }
+  } else {
+    for (auto window_index = size_t{0}; window_index < SAMPLE_WINDOW_COUNT; ++window_index) {
+      window_begins.push_back(window_index * (row_count - SAMPLE_WINDOW_SIZE) / (SAMPLE_WINDOW_COUNT - 1));
+    }
+  }
+
+  auto positions = std::make_shared<RowIDPosList>();
+  auto window_begins_in_sample = std::vector<size_t>{};
+  for (const auto window_begin : window_begins) {
+    window_begins_in_sample.push_back(positions->size());
+    const auto window_end = std::min(window_begin + SAMPLE_WINDOW_SIZE, row_count);
+    for (auto chunk_offset = window_begin; chunk_offset < window_end; ++chunk_offset) {
+      positions->emplace_back(ChunkID{0}, ChunkOffset{static_cast<ChunkOffset::base_type>(chunk_offset)});
+    }
+  }
+  positions->guarantee_single_chunk();
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto values = std::vector<ColumnDataType>{};
+    auto null_flags = std::vector<bool>{};
+    segment_iterate_filtered<ColumnDataType>(segment, positions, [&](const auto& position) {
+      null_flags.push_back(position.is_null());
+      values.push_back(position.is_null() ? ColumnDataType{} : position.value());
+    });
+
+    const auto sample_size = values.size();
+    auto null_count = size_t{0};
+    auto run_count = size_t{0};
+    auto is_sorted = true;
+    auto previous_value = std::optional<ColumnDataType>{};
+    auto value_counts = std::unordered_map<ColumnDataType, size_t>{};
+    auto next_window_begin = window_begins_in_sample.cbegin();
+    for (auto index = size_t{0}; index < sample_size; ++index) {
+      const auto begins_window = next_window_begin != window_begins_in_sample.cend() && *next_window_begin == index;
+      if (begins_window) {
+        ++next_window_begin;
+      }
+      if (begins_window || null_flags[index] != null_flags[index - 1] ||
+          (!null_flags[index] && values[index] != values[index - 1])) {
+        ++run_count;
+      }
+
+      if (null_flags[index]) {
+        ++null_count;
+        continue;
+      }
+      if (previous_value && values[index] < *previous_value) {
+        is_sorted = false;
+      }
+      previous_value = values[index];
+      ++value_counts[values[index]];
+    }
+
+    characteristics.null_ratio = static_cast<double>(null_count) / static_cast<double>(sample_size);
+    characteristics.average_run_length = static_cast<double>(sample_size) / static_cast<double>(run_count);
+    characteristics.is_sorted = is_sorted;
+
+    // Estimate the number of distinct values with the Guaranteed-Error Estimator (GEE, Charikar et al., PODS 2000):
+    // values that occur more than once in the sample are assumed to be frequent, values that occur once are scaled up.
+    const auto non_null_sample_size = sample_size - null_count;
+    if (non_null_sample_size > 0) {
+      const auto non_null_row_count = static_cast<double>(row_count) * (1.0 - characteristics.null_ratio);
+      const auto singleton_count = static_cast<size_t>(std::count_if(value_counts.cbegin(), value_counts.cend(),
+                                                                     [](const auto& value_count) {
+                                                                       return value_count.second == 1;
+                                                                     }));
+      const auto estimated_distinct_count =
+          (std::sqrt(non_null_row_count / static_cast<double>(non_null_sample_size)) *
+           static_cast<double>(singleton_count)) +
+          static_cast<double>(value_counts.size() - singleton_count);
+      characteristics.estimated_distinct_count = std::max(
+          value_counts.size(), static_cast<size_t>(std::min(estimated_distinct_count, std::ceil(non_null_row_count))));
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      auto strings = std::vector<std::string_view>{};
+      auto string_length_sum = size_t{0};
+      auto string_heap_size_sum = size_t{0};
+      for (auto index = size_t{0}; index < sample_size; ++index) {
+        if (!null_flags[index]) {
+          strings.emplace_back(values[index]);
+          string_length_sum += values[index].size();
+          characteristics.max_string_length = std::max(characteristics.max_string_length, values[index].size());
+        }
+        string_heap_size_sum += string_heap_size(values[index]);
+      }
+
+      characteristics.value_size = static_cast<double>(sizeof(pmr_string)) +
+                                   (static_cast<double>(string_heap_size_sum) / static_cast<double>(sample_size));
+      if (!strings.empty()) {
+        characteristics.average_string_length =
+            static_cast<double>(string_length_sum) / static_cast<double>(strings.size());
+      }
+
+      // Compress the sample to estimate the compression ratio of FSST.
+      const auto symbol_table = FSSTSymbolTable::build(strings);
+      auto compressed_strings = std::string{};
+      for (const auto string : strings) {
+        symbol_table.compress(string, compressed_strings);
+      }
+      if (!compressed_strings.empty()) {
+        characteristics.fsst_compression_ratio =
+            static_cast<double>(string_length_sum) / static_cast<double>(compressed_strings.size());
+      }
+    } else {
+      characteristics.value_size = static_cast<double>(sizeof(ColumnDataType));
+    }
+
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<ColumnDataType>)) {
+      characteristics.frame_of_reference_bit_width =
+          frame_of_reference_bit_width(values, null_flags, is_sorted, row_count);
+    }
+  });
+
+  return characteristics;
+}
+
+std::vector<EncodingAdvisorPlugin::EncodingCandidate> EncodingAdvisorPlugin::_encoding_candidates(
+    const DataType data_type, const SegmentCharacteristics& characteristics, const AccessCounts& access_counts) {
+  auto candidates = std::vector<EncodingCandidate>{};
+
+  for (const auto encoding_type : encoding_types) {
+    // LZ4 is not considered: its compression ratio cannot be estimated from the sample, and random accesses have to
+    // decompress entire blocks.
+    if (encoding_type == EncodingType::LZ4 || !encoding_supports_data_type(encoding_type, data_type) ||
+        (encoding_type == EncodingType::FrameOfReference && !characteristics.frame_of_reference_bit_width)) {
+      continue;
+    }
+
+    auto encoding_specs = std::vector<SegmentEncodingSpec>{};
+    if (encoding_type != EncodingType::Unencoded && create_encoder(encoding_type)->uses_vector_compression()) {
+      for (const auto vector_compression_type : magic_enum::enum_values<VectorCompressionType>()) {
+        encoding_specs.emplace_back(encoding_type, vector_compression_type);
+      }
+    } else {
+      encoding_specs.emplace_back(encoding_type);
+    }
+
+    for (const auto& encoding_spec : encoding_specs) {
+      const auto [sequential_cost, random_cost] = _access_costs(encoding_spec);
+      const auto access_cost =
+          (sequential_cost * access_counts.sequential) + (random_cost * access_counts.random);
+      candidates.push_back({encoding_spec, _estimate_memory_usage(encoding_spec, data_type, characteristics),
+                            access_cost});
+    }
+  }
+
+  return candidates;
+}
+
+std::vector<size_t> EncodingAdvisorPlugin::_select_encodings(
+    const std::vector<std::vector<EncodingCandidate>>& candidates, const size_t memory_budget) {
+  const auto segment_count = candidates.size();
+
+  // For each segment, only keep the candidates for which no other candidate is both cheaper and smaller. Ordered by
+  // access cost, the memory usage of these candidates decreases.
+  auto frontiers = std::vector<std::vector<size_t>>(segment_count);
+  auto memory_usage = size_t{0};
+  for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+    const auto& segment_candidates = candidates[segment_index];
+    Assert(!segment_candidates.empty(), "Expected at least one encoding candidate per segment.");
+
+    auto candidate_indexes = std::vector<size_t>(segment_candidates.size());
+    std::iota(candidate_indexes.begin(), candidate_indexes.end(), size_t{0});
+    std::stable_sort(candidate_indexes.begin(), candidate_indexes.end(), [&](const auto lhs, const auto rhs) {
+      return std::tie(segment_candidates[lhs].access_cost, segment_candidates[lhs].memory_usage) <
+             std::tie(segment_candidates[rhs].access_cost, segment_candidates[rhs].memory_usage);
+    });
+
+    auto& frontier = frontiers[segment_index];
+    for (const auto candidate_index : candidate_indexes) {
+      if (frontier.empty() ||
+          segment_candidates[candidate_index].memory_usage < segment_candidates[frontier.back()].memory_usage) {
+        frontier.push_back(candidate_index);
+      }
+    }
+    memory_usage += segment_candidates[frontier.front()].memory_usage;
+  }
+
+  // Starting with the cheapest candidates, move the segments to their next smaller candidate until the memory budget
+  // is met. The steps that save the most memory per additional access cost are taken first.
+  auto frontier_positions = std::vector<size_t>(segment_count, 0);
+  auto steps = std::priority_queue<std::pair<double, size_t>>{};
+  const auto add_next_step = [&](const size_t segment_index) {
+    const auto& frontier = frontiers[segment_index];
+    const auto frontier_position = frontier_positions[segment_index];
+    if (frontier_position + 1 >= frontier.size()) {
+      return;
+    }
+
+    const auto& current_candidate = candidates[segment_index][frontier[frontier_position]];
+    const auto& next_candidate = candidates[segment_index][frontier[frontier_position + 1]];
+    const auto saved_memory = static_cast<double>(current_candidate.memory_usage - next_candidate.memory_usage);
+    const auto additional_cost = next_candidate.access_cost - current_candidate.access_cost;
+    steps.emplace(saved_memory / std::max(additional_cost, std::numeric_limits<double>::min()), segment_index);
+  };
+
+  for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+    add_next_step(segment_index);
+  }
+
+  while (memory_usage > memory_budget && !steps.empty()) {
+    const auto segment_index = steps.top().second;
+    steps.pop();
+
+    const auto& frontier = frontiers[segment_index];
+    auto& frontier_position = frontier_positions[segment_index];
+    memory_usage -= candidates[segment_index][frontier[frontier_position]].memory_usage -
+                    candidates[segment_index][frontier[frontier_position + 1]].memory_usage;
+    ++frontier_position;
+    add_next_step(segment_index);
+  }
+
+  auto selected_candidates = std::vector<size_t>(segment_count);
+  for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+    selected_candidates[segment_index] = frontiers[segment_index][frontier_positions[segment_index]];
+  }
+  return selected_candidates;
+}
+
+size_t EncodingAdvisorPlugin::_estimate_memory_usage(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                                                     const SegmentCharacteristics& characteristics) {
+  const auto row_count = static_cast<size_t>(characteristics.row_count);
+  const auto distinct_count = characteristics.estimated_distinct_count;
+  const auto vector_compression_type =
+      encoding_spec.vector_compression_type.value_or(VectorCompressionType::FixedWidthInteger);
+  const auto null_values_size = characteristics.null_ratio > 0.0 ? row_count / CHAR_BIT : size_t{0};
+  const auto compressed_string_length =
+      characteristics.average_string_length / characteristics.fsst_compression_ratio;
+
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return static_cast<size_t>(static_cast<double>(row_count) * characteristics.value_size) + null_values_size;
+
+    case EncodingType::Dictionary:
+      // NULLs are represented by the value ID after the last one.
+      return static_cast<size_t>(static_cast<double>(distinct_count) * characteristics.value_size) +
+             compressed_vector_size(row_count, distinct_count, vector_compression_type);
+
+    case EncodingType::FixedStringDictionary:
+      return (distinct_count * characteristics.max_string_length) +
+             compressed_vector_size(row_count, distinct_count, vector_compression_type);
+
+    case EncodingType::RunLength: {
+      const auto run_count =
+          static_cast<size_t>(std::ceil(static_cast<double>(row_count) / characteristics.average_run_length));
+      const auto run_size = characteristics.value_size + static_cast<double>(sizeof(ChunkOffset));
+      return static_cast<size_t>(static_cast<double>(run_count) * run_size) + (run_count / CHAR_BIT);
+    }
+
+    case EncodingType::FrameOfReference: {
+      DebugAssert(characteristics.frame_of_reference_bit_width, "Expected frame-of-reference bit width.");
+      // Each block stores its minimum and, for sorted values, its step.
+      const auto block_count = (row_count + FrameOfReferenceSegment<int32_t>::block_size - 1) /
+                               FrameOfReferenceSegment<int32_t>::block_size;
+      const auto max_offset = (uint64_t{1} << *characteristics.frame_of_reference_bit_width) - 1;
+      return (block_count * 2 * sizeof(int64_t)) +
+             compressed_vector_size(row_count, max_offset, vector_compression_type) + null_values_size;
+    }
+
+    case EncodingType::LZ4:
+      Fail("LZ4 is not considered by the encoding advisor.");
+
+    case EncodingType::FSST: {
+      const auto non_null_row_count = static_cast<double>(row_count) * (1.0 - characteristics.null_ratio);
+      const auto data_size = static_cast<size_t>(non_null_row_count * compressed_string_length);
+      return sizeof(FSSTSymbolTable) + data_size +
+             compressed_vector_size(row_count + 1, data_size, vector_compression_type) + null_values_size;
+    }
+
+    case EncodingType::FSSTDictionary: {
+      const auto data_size = static_cast<size_t>(static_cast<double>(distinct_count) * compressed_string_length);
+      return sizeof(FSSTSymbolTable) + data_size +
+             compressed_vector_size(distinct_count + 1, data_size, vector_compression_type) +
+             compressed_vector_size(row_count, distinct_count, vector_compression_type);
+    }
+  }
+
+  Fail("Unknown encoding type of " + std::string{magic_enum::enum_name(data_type)} + " segment.");
+}
+
+std::pair<double, double> EncodingAdvisorPlugin::_access_costs(const SegmentEncodingSpec& encoding_spec) {
+  // Relative costs of accessing a row sequentially and randomly. Dictionary and frame-of-reference segments are
+  // scanned block-wise in the compressed domain and are about as cheap to scan as unencoded segments. Random accesses
+  // to run-length encoded segments require a binary search, and FSST has to decompress each accessed string.
+  auto costs = std::pair<double, double>{};
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      costs = {1.0, 1.0};
+      break;
+    case EncodingType::Dictionary:
+      costs = {1.0, 2.0};
+      break;
+    case EncodingType::FixedStringDictionary:
+      costs = {1.2, 2.5};
+      break;
+    case EncodingType::RunLength:
+      costs = {1.0, 6.0};
+      break;
+    case EncodingType::FrameOfReference:
+      costs = {1.0, 1.5};
+      break;
+    case EncodingType::LZ4:
+      costs = {8.0, 20.0};
+      break;
+    case EncodingType::FSST:
+      costs = {3.0, 4.0};
+      break;
+    case EncodingType::FSSTDictionary:
+      costs = {1.2, 6.0};
+      break;
+  }
+
+  // Bit-packed values are unpacked one at a time. SIMD-BP128 unpacks entire blocks, which is fast for scans but slow
+  // for random accesses.
+  if (encoding_spec.vector_compression_type == VectorCompressionType::BitPacking) {
+    costs.first += 0.5;
+    costs.second += 1.0;
+  } else if (encoding_spec.vector_compression_type == VectorCompressionType::SimdBp128) {
+    costs.first += 0.2;
+    costs.second += 4.0;
+  }
+  return costs;
+}
+
+EncodingAdvisorPlugin::AccessCounters EncodingAdvisorPlugin::_read_access_counters(const AbstractSegment& segment) {
+  auto access_counters = AccessCounters{};
+  for (auto type_index = size_t{0}; type_index < access_counters.size(); ++type_index) {
+    access_counters[type_index] = segment.access_counter[static_cast<SegmentAccessCounter::AccessType>(type_index)];
+  }
+  return access_counters;
+}
+
+EncodingAdvisorPlugin::MemoryBudgetSetting::MemoryBudgetSetting(std::atomic_uint64_t& memory_budget)
+    : AbstractSetting{"EncodingAdvisorPlugin.MemoryBudget"},
+      _memory_budget{memory_budget},
+      _value{std::to_string(memory_budget.load())} {}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::description() const {
+  static const auto description =
+      std::string{"Memory budget of the segments of immutable chunks in bytes (0: keep the current memory usage)"};
+  return description;
+}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::get() {
+  return _value;
+}
+
+void EncodingAdvisorPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  Assert(!value.empty() && value.find_first_not_of("0123456789") == std::string::npos,
+         "Memory budget must be a number of bytes.");
+  _memory_budget = std::stoull(value);
+  _value = value;
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin);
+
+}  // namespace hyrise
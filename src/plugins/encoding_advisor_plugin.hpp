@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+/**
+ * Encodings are usually chosen statically (e.g., Dictionary by default). This plugin chooses the encoding and vector
+ * compression of each segment of immutable chunks instead and re-encodes the segments in the background.
+ *
+ * The plugin determines the characteristics of a segment's values (e.g., distinct values, run lengths, value range,
+ * sortedness) once from a sample. From these, it estimates the memory usage of each encoding that supports the
+ * column's data type. From the segment's SegmentAccessCounter, it estimates the access costs of each encoding, where
+ * sequential accesses (i.e., scans) and random accesses (e.g., after a join) are weighted differently. Starting with
+ * the cheapest encoding of each segment, the plugin greedily moves segments to smaller encodings until the estimated
+ * memory usage fits the memory budget, preferring segments that save the most memory per additional access cost.
+ * Segments that have not been accessed are thus stored with their smallest encoding.
+ *
+ * The access counts of earlier rounds decay, so that segments are re-encoded when their access patterns shift. The
+ * memory budget (in bytes) is set via the setting "EncodingAdvisorPlugin.MemoryBudget". If it is zero (default), the
+ * budget is the current memory usage of the considered segments, i.e., memory is only moved from cold to hot segments.
+ * Segments that are indexed are not re-encoded, as the indexes reference them.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin {
+ public:
+  // Characteristics of a segment's values, determined from a sample.
+  struct SegmentCharacteristics {
+    ChunkOffset row_count{0};
+    double null_ratio{0.0};
+    size_t estimated_distinct_count{0};
+    double average_run_length{1.0};
+    bool is_sorted{false};
+
+    // Memory usage of a value in a ValueSegment, including the heap-allocated part of strings.
+    double value_size{0.0};
+
+    // Bits per offset of a FrameOfReferenceSegment. Unset if the data type is not supported or if most values would
+    // have to be stored as exceptions.
+    std::optional<uint32_t> frame_of_reference_bit_width;
+
+    // Only set for strings.
+    double average_string_length{0.0};
+    size_t max_string_length{0};
+    double fsst_compression_ratio{1.0};
+  };
+
+  // Decayed counts of accessed rows.
+  struct AccessCounts {
+    double sequential{0.0};
+    double random{0.0};
+  };
+
+  struct EncodingCandidate {
+    SegmentEncodingSpec encoding_spec;
+    size_t memory_usage;
+    double access_cost;
+  };
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY_REENCODING: sleep between two rounds of re-encoding.
+   * SAMPLE_WINDOW_COUNT, SAMPLE_WINDOW_SIZE: the sample of a segment consists of evenly distributed windows of
+   * consecutive rows, so that run lengths and sortedness can be determined.
+   * ACCESS_DECAY: factor by which the access counts of earlier rounds are multiplied in each round.
+   * REENCODING_THRESHOLD: a segment is only re-encoded if the estimated memory usage or access cost of its current
+   * encoding exceeds the one of the chosen encoding by this factor. This avoids re-encoding back and forth between
+   * similar encodings.
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_REENCODING = std::chrono::milliseconds(10'000);
+  constexpr static size_t SAMPLE_WINDOW_COUNT = 16;
+  constexpr static size_t SAMPLE_WINDOW_SIZE = 64;
+  constexpr static double ACCESS_DECAY = 0.5;
+  constexpr static double REENCODING_THRESHOLD = 1.1;
+
+ protected:
+  friend class EncodingAdvisorPluginTest;
+
+  using SegmentKey = std::tuple<std::string, ChunkID, ColumnID>;
+  using AccessCounters = std::array<uint64_t, static_cast<size_t>(SegmentAccessCounter::AccessType::Count)>;
+
+  struct SegmentState {
+    // Used to detect segments that were replaced by others (e.g., because the table was replaced).
+    std::shared_ptr<const AbstractSegment> segment;
+    SegmentCharacteristics characteristics;
+    AccessCounters counters_at_last_round{};
+    AccessCounts access_counts;
+  };
+
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    explicit MemoryBudgetSetting(std::atomic_uint64_t& memory_budget);
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+   private:
+    std::atomic_uint64_t& _memory_budget;
+    std::string _value;
+  };
+
+  // Chooses the encodings of all segments of immutable chunks and re-encodes the segments whose encoding changes.
+  void _reencode_segments();
+
+  static SegmentCharacteristics _sample_segment(const AbstractSegment& segment, const DataType data_type);
+
+  static std::vector<EncodingCandidate> _encoding_candidates(const DataType data_type,
+                                                             const SegmentCharacteristics& characteristics,
+                                                             const AccessCounts& access_counts);
+
+  // Returns the index of the chosen candidate for each segment.
+  static std::vector<size_t> _select_encodings(const std::vector<std::vector<EncodingCandidate>>& candidates,
+                                               const size_t memory_budget);
+
+  static size_t _estimate_memory_usage(const SegmentEncodingSpec& encoding_spec, const DataType data_type,
+                                       const SegmentCharacteristics& characteristics);
+
+  // Returns the relative costs of accessing a row sequentially and randomly.
+  static std::pair<double, double> _access_costs(const SegmentEncodingSpec& encoding_spec);
+
+  static AccessCounters _read_access_counters(const AbstractSegment& segment);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+  std::atomic_uint64_t _memory_budget{0};
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+  std::map<SegmentKey, SegmentState> _segment_states;
+};
+
+}  // namespace hyrise
@@ -28,6 +28,7 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "resolve_type.hpp"
+#include "storage/buffer/pin_guard.hpp"
 #include "storage/constraints/table_key_constraint.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
@@ -223,6 +224,8 @@ bool UccDiscoveryPlugin::_uniqueness_holds_across_segments(const std::shared_ptr
 
     const auto expected_distinct_value_count = distinct_values.size() + source_segment->size();
 
+    // Values and dictionaries are read directly. Thus, the segment's pages have to be pinned.
+    const auto pin_guard = SharedPagePinGuard{source_segment->buffer_pages()};
     if (const auto& value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(source_segment)) {
       // Directly insert all values.
       const auto& values = value_segment->values();
@@ -102,11 +102,15 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::Unencoded},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
+    SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
     SegmentEncodingSpec{EncodingType::LZ4},
-    SegmentEncodingSpec{EncodingType::RunLength}};
+    SegmentEncodingSpec{EncodingType::RunLength},
+    SegmentEncodingSpec{EncodingType::FSST},
+    SegmentEncodingSpec{EncodingType::FSSTDictionary, VectorCompressionType::FixedWidthInteger},
+    SegmentEncodingSpec{EncodingType::FSSTDictionary, VectorCompressionType::BitPacking}};
 
 template <typename EnumType>
 inline auto enum_formatter = [](const ::testing::TestParamInfo<EnumType>& info) {
@@ -0,0 +1,176 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "concurrency/checkpointer.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class CheckpointerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_path);
+
+    Hyrise::get().storage_manager.add_table("table_a",
+                                            load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2}));
+    const auto table_b = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", ChunkOffset{3});
+    ChunkEncoder::encode_all_chunks(table_b, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("table_b", table_b);
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_path);
+  }
+
+  static std::shared_ptr<const Table> visible_rows(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    execute_all({get_table, validate});
+    return validate->get_output();
+  }
+
+  static void insert(const std::string& table_name, const std::string& file_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_wrapper = std::make_shared<TableWrapper>(load_table(file_name));
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    execute_all({table_wrapper, insert});
+    transaction_context->commit();
+  }
+
+  static void delete_where_equals(const std::string& table_name, const AllTypeVariant& value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, value);
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    validate->set_transaction_context(transaction_context);
+    delete_operator->set_transaction_context(transaction_context);
+    execute_all({get_table, validate, table_scan, delete_operator});
+    transaction_context->commit();
+  }
+
+  const std::string checkpoint_directory = test_data_path + "checkpoint";
+  const std::string log_path = test_data_path + "checkpoint_write_ahead_log.bin";
+};
+
+TEST_F(CheckpointerTest, WritesAndLoadsConsistentSnapshot) {
+  insert("table_a", "resources/test_data/tbl/int_float.tbl");
+  delete_where_equals("table_a", 123);
+  delete_where_equals("table_b", 104);
+
+  const auto expected_table_a = visible_rows("table_a");
+  const auto expected_table_b = visible_rows("table_b");
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  const auto metrics = Checkpointer{checkpoint_directory}.write_checkpoint();
+  EXPECT_EQ(metrics.snapshot_commit_id, last_commit_id);
+  EXPECT_EQ(metrics.skipped_chunk_count, 0);
+
+  Hyrise::reset();
+  EXPECT_EQ(Checkpointer{checkpoint_directory}.load(), last_commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_b"), expected_table_b);
+
+  // Encodings, ChunkIDs, and mutability are kept.
+  const auto table_a = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table_a->chunk_count(), 4);
+  EXPECT_FALSE(table_a->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TRUE(table_a->get_chunk(ChunkID{3})->is_mutable());
+  const auto table_b = Hyrise::get().storage_manager.get_table("table_b");
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      table_b->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+
+  // The loaded tables can be modified.
+  insert("table_a", "resources/test_data/tbl/int_float.tbl");
+  EXPECT_EQ(visible_rows("table_a")->row_count(), expected_table_a->row_count() + 3);
+}
+
+TEST_F(CheckpointerTest, IncrementalCheckpoints) {
+  auto checkpointer = Checkpointer{checkpoint_directory};
+  const auto initial_chunk_count = size_t{2 + 3};
+
+  auto metrics = checkpointer.write_checkpoint();
+  EXPECT_EQ(metrics.written_chunk_count, initial_chunk_count);
+  EXPECT_EQ(metrics.skipped_chunk_count, 0);
+
+  metrics = checkpointer.write_checkpoint();
+  EXPECT_EQ(metrics.written_chunk_count, 0);
+  EXPECT_EQ(metrics.skipped_chunk_count, initial_chunk_count);
+  EXPECT_EQ(metrics.bytes_written, 0);
+
+  // Deletes in immutable chunks do not require rewriting them. The Insert fills a new immutable chunk and starts a
+  // mutable one. Mutable chunks are written in every checkpoint.
+  delete_where_equals("table_a", 12345);
+  insert("table_a", "resources/test_data/tbl/int_float.tbl");
+  metrics = checkpointer.write_checkpoint();
+  EXPECT_EQ(metrics.written_chunk_count, 2);
+  EXPECT_EQ(metrics.skipped_chunk_count, initial_chunk_count);
+
+  metrics = checkpointer.write_checkpoint();
+  EXPECT_EQ(metrics.written_chunk_count, 1);
+  EXPECT_EQ(metrics.skipped_chunk_count, initial_chunk_count + 1);
+
+  const auto expected_table_a = visible_rows("table_a");
+  Hyrise::reset();
+  auto loading_checkpointer = Checkpointer{checkpoint_directory};
+  loading_checkpointer.load();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+
+  // Loaded chunks are not written again and files of previous checkpoints have been removed.
+  metrics = loading_checkpointer.write_checkpoint();
+  EXPECT_EQ(metrics.written_chunk_count, 1);
+  EXPECT_EQ(metrics.skipped_chunk_count, initial_chunk_count + 1);
+  auto chunk_file_count = size_t{0};
+  for (const auto& entry : std::filesystem::recursive_directory_iterator{checkpoint_directory}) {
+    chunk_file_count += entry.is_regular_file() && entry.path().extension() == ".bin" ? 1 : 0;
+  }
+  EXPECT_EQ(chunk_file_count, initial_chunk_count + 2);
+}
+
+TEST_F(CheckpointerTest, RecoveryReplaysLogTail) {
+  auto config = WriteAheadLog::Config{};
+  config.path = log_path;
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(config);
+
+  insert("table_a", "resources/test_data/tbl/int_float.tbl");
+  const auto checkpoint_commit_id = Checkpointer{checkpoint_directory}.write_checkpoint().snapshot_commit_id;
+  delete_where_equals("table_a", 1234);
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl");
+  const auto expected_table_a = visible_rows("table_a");
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  ASSERT_GT(last_commit_id, checkpoint_commit_id);
+
+  // Only the log tail is replayed. Replaying the first Insert again would add its rows twice.
+  Hyrise::reset();
+  EXPECT_EQ(Checkpointer{checkpoint_directory}.load(), checkpoint_commit_id);
+  EXPECT_EQ(WriteAheadLog::recover(log_path), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_b"), load_table("resources/test_data/tbl/all_data_types_sorted.tbl"));
+}
+
+TEST_F(CheckpointerTest, LoadWithoutCheckpoint) {
+  Hyrise::reset();
+  EXPECT_EQ(Checkpointer{checkpoint_directory}.load(), UNSET_COMMIT_ID);
+  EXPECT_TRUE(Hyrise::get().storage_manager.tables().empty());
+}
+
+}  // namespace hyrise
@@ -0,0 +1,203 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove(log_path);
+    load_tables();
+    enable_log(LogSyncMode::GroupCommit);
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::filesystem::remove(log_path);
+  }
+
+  static void load_tables() {
+    Hyrise::get().storage_manager.add_table("table_a",
+                                            load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2}));
+    Hyrise::get().storage_manager.add_table(
+        "table_b", load_table("resources/test_data/tbl/all_data_types_sorted.tbl", ChunkOffset{3}));
+  }
+
+  void enable_log(const LogSyncMode sync_mode) {
+    auto config = WriteAheadLog::Config{};
+    config.path = log_path;
+    config.sync_mode = sync_mode;
+    config.buffer_size = 4096;
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(config);
+  }
+
+  // Simulates a restart: All state is lost, the initial data is loaded again, and the log is replayed.
+  CommitID restart() {
+    Hyrise::reset();
+    load_tables();
+    return WriteAheadLog::recover(log_path);
+  }
+
+  static std::shared_ptr<const Table> visible_rows(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    execute_all({get_table, validate});
+    return validate->get_output();
+  }
+
+  static void insert(const std::string& table_name, const std::string& file_name, const bool commit = true) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_wrapper = std::make_shared<TableWrapper>(load_table(file_name));
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    execute_all({table_wrapper, insert});
+    if (commit) {
+      transaction_context->commit();
+    } else {
+      transaction_context->rollback(RollbackReason::User);
+    }
+  }
+
+  static void delete_where_equals(const std::string& table_name, const AllTypeVariant& value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, value);
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    validate->set_transaction_context(transaction_context);
+    delete_operator->set_transaction_context(transaction_context);
+    execute_all({get_table, validate, table_scan, delete_operator});
+    transaction_context->commit();
+  }
+
+  // Appends a record that deletes a single row of table_a without a corresponding transaction.
+  static void append_delete_record(const CommitID commit_id, const ChunkOffset chunk_offset) {
+    auto record = CommitLogRecord{commit_id, TransactionID{100}};
+    record.add_delete("table_a", RowIDPosList{RowID{ChunkID{0}, chunk_offset}});
+    auto& write_ahead_log = *Hyrise::get().write_ahead_log;
+    write_ahead_log.wait_for_durability(write_ahead_log.append(record));
+  }
+
+  const std::string log_path = test_data_path + "write_ahead_log.bin";
+};
+
+TEST_F(WriteAheadLogTest, ReplaysInsertsAndDeletes) {
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl");
+  delete_where_equals("table_a", 12345);
+  insert("table_b", "resources/test_data/tbl/all_data_types_sorted.tbl");
+  delete_where_equals("table_b", 104);
+
+  const auto expected_table_a = visible_rows("table_a");
+  const auto expected_table_b = visible_rows("table_b");
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  EXPECT_EQ(Hyrise::get().write_ahead_log->metrics().record_count, 4);
+
+  EXPECT_EQ(restart(), last_commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_b"), expected_table_b);
+
+  // Full chunks are immutable again.
+  const auto table_b = Hyrise::get().storage_manager.get_table("table_b");
+  EXPECT_EQ(table_b->chunk_count(), 6);
+  EXPECT_FALSE(table_b->get_chunk(ChunkID{3})->is_mutable());
+  EXPECT_TRUE(table_b->get_chunk(ChunkID{5})->is_mutable());
+}
+
+TEST_F(WriteAheadLogTest, RecoveredLogIsContinued) {
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl");
+  restart();
+
+  enable_log(LogSyncMode::Asynchronous);
+  delete_where_equals("table_a", 12);
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl");
+  const auto expected_table_a = visible_rows("table_a");
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+}
+
+TEST_F(WriteAheadLogTest, RolledBackTransactionsAreNotReplayed) {
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl", false);
+  insert("table_a", "resources/test_data/tbl/int_float.tbl");
+  const auto expected_table_a = visible_rows("table_a");
+  EXPECT_EQ(Hyrise::get().write_ahead_log->metrics().record_count, 1);
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+}
+
+TEST_F(WriteAheadLogTest, RecordsAfterMissingCommitIDAreIgnored) {
+  const auto first_commit_id = CommitID{Hyrise::get().transaction_manager.last_commit_id() + 1};
+  append_delete_record(first_commit_id, ChunkOffset{0});
+  append_delete_record(CommitID{first_commit_id + 2}, ChunkOffset{1});
+
+  EXPECT_EQ(restart(), first_commit_id);
+  const auto table_a = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table_a->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{0}), first_commit_id);
+  EXPECT_EQ(table_a->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{1}), MAX_COMMIT_ID);
+  EXPECT_EQ(visible_rows("table_a")->row_count(), 2);
+}
+
+TEST_F(WriteAheadLogTest, TornRecordsAreTruncated) {
+  insert("table_a", "resources/test_data/tbl/int_float2.tbl");
+  const auto expected_table_a = visible_rows("table_a");
+  Hyrise::get().write_ahead_log = nullptr;
+
+  const auto log_size = std::filesystem::file_size(log_path);
+  {
+    auto file = std::ofstream{log_path, std::ios::binary | std::ios::app};
+    file << "incomplete record";
+  }
+
+  restart();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows("table_a"), expected_table_a);
+  EXPECT_EQ(std::filesystem::file_size(log_path), log_size);
+}
+
+TEST_F(WriteAheadLogTest, ConcurrentGroupCommits) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto INSERTS_PER_THREAD = 50;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto index = 0; index < INSERTS_PER_THREAD; ++index) {
+        insert("table_a", "resources/test_data/tbl/int_float.tbl");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto metrics = Hyrise::get().write_ahead_log->metrics();
+  EXPECT_EQ(metrics.record_count, THREAD_COUNT * INSERTS_PER_THREAD);
+  EXPECT_LE(metrics.flush_count, metrics.record_count);
+  // The records do not fit into a single log buffer.
+  EXPECT_GT(metrics.bytes_written, 4096);
+
+  restart();
+  EXPECT_EQ(visible_rows("table_a")->row_count(), 3 + 3 * THREAD_COUNT * INSERTS_PER_THREAD);
+}
+
+}  // namespace hyrise
@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,6 +6,8 @@
 #include "base_test.hpp"
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -361,6 +364,16 @@ TEST_F(BinaryParserTest, FileDoesNotExist) {
   EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception);
 }
 
+TEST_F(BinaryParserTest, TruncatedFile) {
+  const auto source_filename = _reference_filepath + "AllTypesSegmentSorted/Dictionary.bin";
+  const auto filename = test_data_path + "truncated.bin";
+  std::filesystem::copy_file(source_filename, filename, std::filesystem::copy_options::overwrite_existing);
+  std::filesystem::resize_file(filename, std::filesystem::file_size(source_filename) - 10);
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+  std::filesystem::remove(filename);
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
@@ -412,4 +425,139 @@ TEST_F(BinaryParserTest, SortColumnDefinitions) {
   EXPECT_TRUE(table->get_chunk(ChunkID{2})->individually_sorted_by().empty());
 }
 
+TEST_F(BinaryParserTest, WithoutChunkDirectory) {
+  // The file was written before the chunk directory was added to the format. Such files are parsed sequentially.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, false);
+
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+  expected_table->append({"This"});
+  expected_table->append({"is"});
+  expected_table->append({"a"});
+  expected_table->append({"test"});
+
+  auto table = BinaryParser::parse(_reference_filepath +
+                                   ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin");
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), 2);
+}
+
+TEST_F(BinaryParserTest, SimdBp128CompressedVectors) {
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data,
+      ChunkOffset{1'000});
+  // The outliers are stored as exceptions of their blocks.
+  for (auto row = int32_t{0}; row < 1'300; ++row) {
+    expected_table->append({row % 37, row % 101 == 0 ? 1'000'000 + row : row % 13});
+  }
+  ChunkEncoder::encode_all_chunks(
+      expected_table, {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
+                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128}});
+  const auto filename = test_data_path + "simd_bp128.bin";
+  BinaryWriter::write(*expected_table, filename);
+
+  const auto table = BinaryParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(dictionary_segment->compressed_vector_type(), CompressedVectorType::SimdBp128);
+  const auto frame_of_reference_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int32_t>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(frame_of_reference_segment);
+  EXPECT_EQ(frame_of_reference_segment->compressed_vector_type(), CompressedVectorType::SimdBp128);
+  std::filesystem::remove(filename);
+}
+
+TEST_F(BinaryParserTest, FrameOfReferenceSegmentsWithStepsAndExceptions) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Long, true);
+  column_definitions.emplace_back("b", DataType::Float, false);
+  column_definitions.emplace_back("c", DataType::Double, false);
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2'500});
+  // Column a is sorted apart from its outliers and uses linear frames. The 23 non-NULL outliers of a in the first chunk
+  // and the values of c with many decimal digits are stored as exceptions.
+  for (auto row = int64_t{0}; row < 3'000; ++row) {
+    const auto a = row % 100 == 0 ? AllTypeVariant{int64_t{1} << 40}
+                                  : AllTypeVariant{int64_t{1'600'000'000'000} + row * 1'000 + row % 3};
+    const auto c = row % 50 == 0 ? static_cast<double>(row) / 3.0 : static_cast<double>(row) * 0.25;
+    expected_table->append({row % 17 == 3 ? AllTypeVariant{NullValue{}} : a, static_cast<float>(row) / 10.0f, c});
+  }
+  ChunkEncoder::encode_all_chunks(expected_table, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  const auto filename = test_data_path + "frame_of_reference.bin";
+  BinaryWriter::write(*expected_table, filename);
+
+  const auto table = BinaryParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  const auto long_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(long_segment);
+  EXPECT_TRUE(long_segment->null_values());
+  EXPECT_EQ(long_segment->block_steps().size(), 2);
+  EXPECT_EQ(long_segment->exception_positions().size(), 23);
+  const auto float_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<float>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(float_segment);
+  EXPECT_EQ(float_segment->decimal_exponent(), 1);
+  const auto double_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<double>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{2}));
+  ASSERT_TRUE(double_segment);
+  EXPECT_EQ(double_segment->decimal_exponent(), 2);
+  EXPECT_FALSE(double_segment->exception_positions().empty());
+  std::filesystem::remove(filename);
+}
+
+TEST_F(BinaryParserTest, FSSTSegments) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::String, true);
+  column_definitions.emplace_back("b", DataType::String, false);
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row = size_t{0}; row < 1'500; ++row) {
+    const auto message = pmr_string{"GET /api/v2/orders/" + std::to_string(row * 31) + " HTTP/1.1 200"};
+    expected_table->append({row % 13 == 4 ? AllTypeVariant{NullValue{}} : AllTypeVariant{message},
+                            pmr_string{"user" + std::to_string(row % 20) + "@example.com"}});
+  }
+  ChunkEncoder::encode_all_chunks(expected_table, ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::FSST},
+                                                                    SegmentEncodingSpec{EncodingType::FSSTDictionary}});
+  const auto filename = test_data_path + "fsst.bin";
+  BinaryWriter::write(*expected_table, filename);
+
+  const auto table = BinaryParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  const auto fsst_segment = std::dynamic_pointer_cast<const FSSTSegment<pmr_string>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_TRUE(fsst_segment->null_values());
+  const auto fsst_dictionary_segment = std::dynamic_pointer_cast<const FSSTDictionarySegment<pmr_string>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(fsst_dictionary_segment);
+  EXPECT_EQ(fsst_dictionary_segment->unique_values_count(), 20);
+  std::filesystem::remove(filename);
+}
+
+TEST_F(BinaryParserTest, WithScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  auto scheduler = Hyrise::get().scheduler();
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto expected_table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", ChunkOffset{2});
+  ChunkEncoder::encode_chunks(expected_table, {ChunkID{0}, ChunkID{2}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto filename = test_data_path + "with_scheduler.bin";
+  BinaryWriter::write(*expected_table, filename);
+
+  const auto table = BinaryParser::parse(filename);
+
+  Hyrise::get().scheduler()->finish();
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})));
+  Hyrise::get().set_scheduler(scheduler);
+  std::filesystem::remove(filename);
+}
+
 }  // namespace hyrise
@@ -48,8 +48,10 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/window_function_evaluator.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -775,6 +777,57 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, LimitOnSortIsTopK) {
+  /**
+   * Build LQP and translate to PQP.
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 3
+   */
+  const auto sort_modes = std::vector<SortMode>{SortMode::Descending, SortMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(int64_t{3}),
+    SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP.
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{3}));
+  EXPECT_EQ(top_k->sort_definitions(),
+            std::vector<SortColumnDefinition>({SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                                               SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->left_input());
+  ASSERT_TRUE(get_table);
+  EXPECT_EQ(get_table->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, LimitWithPlaceholderOnSortIsNotTopK) {
+  // The TopK is only used for constant row counts.
+  const auto sort_modes = std::vector<SortMode>{SortMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(placeholder_(ParameterID{0}),
+    SortNode::make(expression_vector(int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<Limit>(pqp);
+  ASSERT_TRUE(limit);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->left_input()));
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -1204,7 +1257,29 @@ TEST_F(LQPTranslatorTest, WindowNode) {
       rank_(window_(expression_vector(), expression_vector(), std::vector<SortMode>{}, std::move(frame)));
   const auto lqp = WindowNode::make(window_function, int_float_node);
 
-  EXPECT_THROW(LQPTranslator{}.translate_node(lqp), InvalidInputException);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto window_function_evaluator = std::dynamic_pointer_cast<const WindowFunctionEvaluator>(pqp);
+  ASSERT_TRUE(window_function_evaluator);
+  EXPECT_EQ(window_function_evaluator->window_function_expression()->window_function, WindowFunction::Rank);
+  EXPECT_TRUE(window_function_evaluator->partition_by_column_ids().empty());
+  EXPECT_TRUE(window_function_evaluator->order_by_column_ids().empty());
+  EXPECT_EQ(window_function_evaluator->argument_column_id(), INVALID_COLUMN_ID);
+  EXPECT_EQ(pqp->left_input()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, WindowNodeWithArgumentAndWindow) {
+  auto frame = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Preceding, false},
+                                FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto window_function = sum_(int_float_b, window_(expression_vector(int_float_a), expression_vector(int_float_b),
+                                                         std::vector<SortMode>{SortMode::Descending}, std::move(frame)));
+  const auto lqp = WindowNode::make(window_function, int_float_node);
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto window_function_evaluator = std::dynamic_pointer_cast<const WindowFunctionEvaluator>(pqp);
+  ASSERT_TRUE(window_function_evaluator);
+  EXPECT_EQ(window_function_evaluator->partition_by_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(window_function_evaluator->order_by_column_ids(), std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(window_function_evaluator->argument_column_id(), ColumnID{1});
 }
 
 }  // namespace hyrise
@@ -0,0 +1,213 @@
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "base_test.hpp"
+#include "memory/buffer_pool_resource.hpp"
+#include "storage/buffer/buffer_manager.hpp"
+#include "storage/buffer/pin_guard.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+
+namespace hyrise {
+
+class BufferPoolResourceTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto config = BufferManager::Config{};
+    config.dram_buffer_pool_size = 4 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.reserved_virtual_memory_per_size_type = 64 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.ssd_path = test_data_path + "buffer_pool_resource";
+    buffer_manager = std::make_unique<BufferManager>(config);
+    resource = std::make_unique<BufferPoolResource>(*buffer_manager);
+  }
+
+  // Loads enough other pages to evict every evictable page from the buffer pool.
+  void evict_all_pages() {
+    for (auto index = uint64_t{0}; index < 16; ++index) {
+      const auto page_id = PageID{MAX_PAGE_SIZE_TYPE, buffer_manager->page_count(MAX_PAGE_SIZE_TYPE) - 1 - index};
+      buffer_manager->pin_exclusive(page_id);
+      buffer_manager->unpin_exclusive(page_id);
+    }
+  }
+
+ protected:
+  std::unique_ptr<BufferManager> buffer_manager;
+  std::unique_ptr<BufferPoolResource> resource;
+};
+
+TEST_F(BufferPoolResourceTest, AllocateFittingPages) {
+  auto* const pointer = resource->allocate(bytes_for_size_type(PageSizeType::KiB16) + 1, 8);
+  const auto page_id = buffer_manager->find_page(pointer);
+  EXPECT_EQ(page_id, PageID(PageSizeType::KiB32, 0));
+  EXPECT_EQ(buffer_manager->get_page(page_id), pointer);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, bytes_for_size_type(PageSizeType::KiB32));
+
+  resource->deallocate(pointer, bytes_for_size_type(PageSizeType::KiB16) + 1, 8);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, 0);
+
+  // Freed pages are reused.
+  auto* const other_pointer = resource->allocate(bytes_for_size_type(PageSizeType::KiB32), 8);
+  EXPECT_EQ(buffer_manager->find_page(other_pointer), PageID(PageSizeType::KiB32, 0));
+  resource->deallocate(other_pointer, bytes_for_size_type(PageSizeType::KiB32), 8);
+}
+
+TEST_F(BufferPoolResourceTest, LargeAllocationsUseUpstreamResource) {
+  const auto bytes = BufferPoolResource::MAX_PAGE_ALLOCATION_SIZE + 1;
+  auto* const pointer = resource->allocate(bytes, 8);
+  EXPECT_FALSE(buffer_manager->find_page(pointer).valid());
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, 0);
+  resource->deallocate(pointer, bytes, 8);
+}
+
+TEST_F(BufferPoolResourceTest, SmallAllocationsSharePages) {
+  auto* const first = resource->allocate(24, 8);
+  auto* const second = resource->allocate(100, 8);
+  auto* const third = resource->allocate(8, 64);
+
+  const auto page_id = buffer_manager->find_page(first);
+  EXPECT_EQ(page_id.size_type(), MIN_PAGE_SIZE_TYPE);
+  EXPECT_EQ(buffer_manager->find_page(second), page_id);
+  EXPECT_EQ(buffer_manager->find_page(third), page_id);
+  EXPECT_EQ(static_cast<std::byte*>(second) - static_cast<std::byte*>(first), 24);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(third) % 64, 0);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, bytes_for_size_type(MIN_PAGE_SIZE_TYPE));
+
+  // Fill the page so that a new one is started.
+  const auto allocation_count =
+      bytes_for_size_type(MIN_PAGE_SIZE_TYPE) / BufferPoolResource::MAX_SMALL_ALLOCATION_SIZE;
+  auto pointers = std::vector<void*>{};
+  for (auto index = uint64_t{0}; index < allocation_count; ++index) {
+    pointers.emplace_back(resource->allocate(BufferPoolResource::MAX_SMALL_ALLOCATION_SIZE, 8));
+  }
+  EXPECT_NE(buffer_manager->find_page(pointers.back()), page_id);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, 2 * bytes_for_size_type(MIN_PAGE_SIZE_TYPE));
+
+  // The first page is freed once all of its allocations are gone.
+  resource->deallocate(first, 24, 8);
+  resource->deallocate(second, 100, 8);
+  resource->deallocate(third, 8, 64);
+  for (const auto pointer : pointers) {
+    resource->deallocate(pointer, BufferPoolResource::MAX_SMALL_ALLOCATION_SIZE, 8);
+  }
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, bytes_for_size_type(MIN_PAGE_SIZE_TYPE));
+}
+
+TEST_F(BufferPoolResourceTest, PagesAreOnlyEvictedAfterMakeEvictable) {
+  auto vector = pmr_vector<int32_t>(100'000, PolymorphicAllocator<int32_t>{resource.get()});
+  std::iota(vector.begin(), vector.end(), 0);
+  const auto page_id = buffer_manager->find_page(vector.data());
+  ASSERT_TRUE(page_id.valid());
+
+  evict_all_pages();
+  EXPECT_NE(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::EVICTED);
+
+  resource->make_evictable();
+  evict_all_pages();
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::EVICTED);
+
+  // The data is read back from the SSD when the page is pinned.
+  buffer_manager->pin_shared(page_id);
+  for (auto index = int32_t{0}; index < 100'000; ++index) {
+    ASSERT_EQ(vector[index], index);
+  }
+  buffer_manager->unpin_shared(page_id);
+}
+
+TEST_F(BufferPoolResourceTest, MigrateSegment) {
+  auto segment = std::make_shared<ValueSegment<pmr_string>>(false, ChunkOffset{2});
+  segment->append(pmr_string{"HereIsAReallyLongStringToGuaranteeThatWeNeedExternalMemory"});
+  segment->append(pmr_string{"short"});
+
+  const auto copied_segment =
+      std::dynamic_pointer_cast<ValueSegment<pmr_string>>(segment->copy_using_memory_resource(*resource));
+  const auto values_page_id = buffer_manager->find_page(copied_segment->values().data());
+  const auto string_page_id = buffer_manager->find_page(copied_segment->values()[0].data());
+  EXPECT_TRUE(values_page_id.valid());
+  EXPECT_TRUE(string_page_id.valid());
+
+  resource->make_evictable();
+  evict_all_pages();
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(values_page_id)->state_and_version()), Frame::EVICTED);
+
+  buffer_manager->pin_shared(values_page_id);
+  buffer_manager->pin_shared(string_page_id);
+  EXPECT_EQ(copied_segment->values()[0], "HereIsAReallyLongStringToGuaranteeThatWeNeedExternalMemory");
+  EXPECT_EQ(copied_segment->values()[1], "short");
+  buffer_manager->unpin_shared(string_page_id);
+  buffer_manager->unpin_shared(values_page_id);
+}
+
+TEST_F(BufferPoolResourceTest, MigrateSegmentRegistersPages) {
+  auto segment = std::make_shared<ValueSegment<pmr_string>>(false, ChunkOffset{2});
+  segment->append(pmr_string{"HereIsAReallyLongStringToGuaranteeThatWeNeedExternalMemory"});
+  segment->append(pmr_string{"short"});
+
+  auto migrated_segment = resource->migrate_segment(*segment);
+  const auto& typed_segment = static_cast<const ValueSegment<pmr_string>&>(*migrated_segment);
+  const auto values_page_id = buffer_manager->find_page(typed_segment.values().data());
+  const auto string_page_id = buffer_manager->find_page(typed_segment.values()[0].data());
+
+  // The small allocations of the segment share a page that is not used by other allocations.
+  const auto& buffer_pages = migrated_segment->buffer_pages();
+  EXPECT_EQ(values_page_id, string_page_id);
+  EXPECT_EQ(buffer_pages.buffer_manager, buffer_manager.get());
+  EXPECT_EQ(buffer_pages.page_ids, std::vector<PageID>{values_page_id});
+  EXPECT_TRUE(segment->buffer_pages().page_ids.empty());
+
+  auto* const other_allocation = resource->allocate(8, 8);
+  EXPECT_NE(buffer_manager->find_page(other_allocation), values_page_id);
+  resource->deallocate(other_allocation, 8, 8);
+
+  // The pages are evictable without calling make_evictable.
+  evict_all_pages();
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(values_page_id)->state_and_version()), Frame::EVICTED);
+
+  {
+    const auto pin_guard = SharedPagePinGuard{buffer_pages};
+    EXPECT_EQ(typed_segment.values()[0], "HereIsAReallyLongStringToGuaranteeThatWeNeedExternalMemory");
+    EXPECT_EQ(typed_segment.values()[1], "short");
+  }
+
+  // Destroying the segment frees all of its pages, even if they have been evicted before. The freed page is reused.
+  evict_all_pages();
+  migrated_segment = nullptr;
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(values_page_id)->state_and_version()), Frame::EVICTED);
+
+  migrated_segment = resource->migrate_segment(*segment);
+  EXPECT_EQ(migrated_segment->buffer_pages().page_ids, std::vector<PageID>{values_page_id});
+}
+
+TEST_F(BufferPoolResourceTest, IterablesAndAccessorsReadEvictedSegments) {
+  auto values = pmr_vector<int32_t>(100'000);
+  std::iota(values.begin(), values.end(), 0);
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  const auto migrated_segment = resource->migrate_segment(*segment);
+  const auto& typed_segment = static_cast<const ValueSegment<int32_t>&>(*migrated_segment);
+  const auto page_id = migrated_segment->buffer_pages().page_ids.front();
+
+  evict_all_pages();
+  ASSERT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::EVICTED);
+
+  auto sum = int64_t{0};
+  ValueSegmentIterable<int32_t>{typed_segment}.with_iterators([&](auto iter, const auto end) {
+    EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::SINGLE_LOCKED_SHARED);
+    for (; iter != end; ++iter) {
+      sum += iter->value();
+    }
+  });
+  EXPECT_EQ(sum, int64_t{99'999} * 100'000 / 2);
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::UNLOCKED);
+
+  evict_all_pages();
+  ASSERT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::EVICTED);
+
+  // Accessors read optimistically after the page has been loaded.
+  const auto accessor = SegmentAccessor<int32_t, ValueSegment<int32_t>>{typed_segment, true};
+  EXPECT_EQ(accessor.access(ChunkOffset{4711}), 4711);
+  EXPECT_EQ(accessor.access(ChunkOffset{99'999}), 99'999);
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::UNLOCKED);
+}
+
+}  // namespace hyrise
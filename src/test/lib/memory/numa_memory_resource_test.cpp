@@ -0,0 +1,72 @@
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "memory/numa_memory_resource.hpp"
+#include "storage/chunk.hpp"
+#include "storage/value_segment.hpp"
+
+namespace hyrise {
+
+class NumaMemoryResourceTest : public BaseTest {};
+
+TEST_F(NumaMemoryResourceTest, OneResourcePerNode) {
+  Hyrise::get().topology.use_fake_numa_topology({1, 1});
+
+  auto& resource_0 = Hyrise::get().topology.memory_resource(NodeID{0});
+  auto& resource_1 = Hyrise::get().topology.memory_resource(NodeID{1});
+  EXPECT_EQ(resource_0.node_id(), NodeID{0});
+  EXPECT_EQ(resource_1.node_id(), NodeID{1});
+  EXPECT_NE(&resource_0, &resource_1);
+  EXPECT_FALSE(resource_0.is_equal(resource_1));
+
+  // Resources outlive the Topology.
+  Hyrise::reset();
+  Hyrise::get().topology.use_fake_numa_topology({1, 1});
+  EXPECT_EQ(&Hyrise::get().topology.memory_resource(NodeID{1}), &resource_1);
+
+  EXPECT_THROW(Hyrise::get().topology.memory_resource(NodeID{2}), std::logic_error);
+}
+
+TEST_F(NumaMemoryResourceTest, Allocate) {
+  auto& resource = NumaMemoryResource::get(NodeID{0});
+
+  // Small, page-sized, and over-aligned allocations.
+  const auto allocations = std::vector<std::pair<size_t, size_t>>{
+      {16, 8}, {NumaMemoryResource::NUMA_PAGE_ALLOCATION_SIZE * 3, 64}, {100, 256}};
+  for (const auto& [bytes, alignment] : allocations) {
+    auto* const pointer = resource.allocate(bytes, alignment);
+    ASSERT_NE(pointer, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % alignment, 0);
+    std::memset(pointer, 1, bytes);
+    resource.deallocate(pointer, bytes, alignment);
+  }
+
+  auto values = pmr_vector<int32_t>(100'000, &resource);
+  std::iota(values.begin(), values.end(), 0);
+  EXPECT_EQ(values.back(), 99'999);
+}
+
+TEST_F(NumaMemoryResourceTest, MigrateChunk) {
+  Hyrise::get().topology.use_fake_numa_topology({1, 1});
+
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{1, 2, 3});
+  const auto chunk = std::make_shared<Chunk>(Segments{segment});
+  EXPECT_EQ(chunk->numa_node_id(), INVALID_NODE_ID);
+
+  chunk->migrate(Hyrise::get().topology.memory_resource(NodeID{1}));
+  EXPECT_EQ(chunk->numa_node_id(), NodeID{1});
+  EXPECT_NE(chunk->get_segment(ColumnID{0}), segment);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[ChunkOffset{2}], AllTypeVariant{3});
+
+  // Other memory resources do not place the chunk on a node.
+  chunk->migrate(*std::pmr::get_default_resource());
+  EXPECT_EQ(chunk->numa_node_id(), INVALID_NODE_ID);
+}
+
+}  // namespace hyrise
@@ -9,6 +9,7 @@
 
 #include "base_test.hpp"
 #include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
@@ -17,6 +18,8 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -33,6 +36,76 @@ TEST_F(OperatorsAggregateHashTest, EmptyHash) {
   EXPECT_EQ(std::hash<AggregateKeySmallVector>()(AggregateKeySmallVector{}), 0);
 }
 
+TEST_F(OperatorsAggregateHashTest, ParallelAggregation) {
+  // Large inputs are aggregated in parallel when a multi-threaded scheduler is used. The groups of the chunk ranges
+  // are merged and must yield the same result as the single-threaded aggregation.
+  const auto row_count = AggregateHash::PARALLEL_AGGREGATION_THRESHOLD + 20'000;
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += chunk_size) {
+    auto a_values = pmr_vector<int32_t>{};
+    auto a_nulls = pmr_vector<bool>{};
+    auto b_values = pmr_vector<pmr_string>{};
+    auto c_values = pmr_vector<double>{};
+    auto c_nulls = pmr_vector<bool>{};
+    for (auto row = chunk_begin; row < chunk_begin + chunk_size; ++row) {
+      // The values of `a` are too sparse for the immediate key shortcut.
+      a_values.emplace_back(static_cast<int32_t>(row % 30'000) * 7);
+      a_nulls.emplace_back(row % 1'000 == 0);
+      b_values.emplace_back(row % 3 == 0 ? "short" : "longer string");
+      c_values.emplace_back(static_cast<double>(row % 101));
+      c_nulls.emplace_back(row % 13 == 0);
+    }
+    table->append_chunk(Segments{
+        std::make_shared<ValueSegment<int32_t>>(std::move(a_values), std::move(a_nulls)),
+        std::make_shared<ValueSegment<pmr_string>>(std::move(b_values)),
+        std::make_shared<ValueSegment<double>>(std::move(c_values), std::move(c_nulls))});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto b = pqp_column_(ColumnID{1}, DataType::String, false, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::Double, true, "c");
+  const auto aggregate = [](const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& column) {
+    return std::make_shared<WindowFunctionExpression>(window_function, column);
+  };
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      aggregate(WindowFunction::Min, c),
+      aggregate(WindowFunction::Max, b),
+      aggregate(WindowFunction::Sum, c),
+      aggregate(WindowFunction::Avg, c),
+      aggregate(WindowFunction::Count, c),
+      aggregate(WindowFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")),
+      aggregate(WindowFunction::CountDistinct, c),
+      aggregate(WindowFunction::StandardDeviationSample, c)};
+
+  const auto groupby_column_id_sets = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{0}, ColumnID{1}}, {ColumnID{1}, ColumnID{0}, ColumnID{2}}};
+  for (const auto& groupby_column_ids : groupby_column_id_sets) {
+    for (const auto& used_aggregates : {aggregates, std::vector<std::shared_ptr<WindowFunctionExpression>>{}}) {
+      const auto sequential_aggregate = std::make_shared<AggregateHash>(table_wrapper, used_aggregates,
+                                                                        groupby_column_ids);
+      sequential_aggregate->execute();
+
+      Hyrise::get().topology.use_fake_numa_topology(8, 4);
+      Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+      const auto parallel_aggregate = std::make_shared<AggregateHash>(table_wrapper, used_aggregates,
+                                                                      groupby_column_ids);
+      parallel_aggregate->execute();
+      Hyrise::get().scheduler()->finish();
+      Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+
+      EXPECT_GT(parallel_aggregate->get_output()->row_count(), 2);
+      EXPECT_TABLE_EQ_UNORDERED(parallel_aggregate->get_output(), sequential_aggregate->get_output());
+    }
+  }
+}
+
 template <typename T>
 void test_output(const std::shared_ptr<AbstractOperator> in,
                  const std::vector<std::pair<ColumnID, WindowFunction>>& aggregate_definitions,
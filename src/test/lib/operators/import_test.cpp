@@ -45,7 +45,7 @@ std::string file_types_and_encodings_name_generator(
   return std::string{magic_enum::enum_name(file_type)} + "_" + encoding_type_str;
 }
 
-// `FixedString` only works on `DataType::String` (`pmr_string`) , `FoR` only on `DataType::Int` (`int32_t`).
+// `FixedString` only works on `DataType::String` (`pmr_string`), `FoR` only on numeric data types.
 INSTANTIATE_TEST_SUITE_P(FileTypesAndEncodings, OperatorsImportMultiFileTypeAndEncodingTest,
                          ::testing::Combine(::testing::Values(FileType::Csv, FileType::Tbl, FileType::Binary),
                                             ::testing::Values(std::nullopt, EncodingType::Unencoded,
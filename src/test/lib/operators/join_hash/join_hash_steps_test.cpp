@@ -280,6 +280,40 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, TwoPassRadixClustering) {
+  // Partitioning by two bits and refining the partitions by three more bits yields the same partitions as partitioning
+  // by five bits in a single pass.
+  BloomFilter bloom_filter;  // Ignored in this test
+
+  auto two_pass_histograms = std::vector<std::vector<size_t>>{};
+  const auto materialized_for_two_passes = materialize_input<int, int, true>(
+      _table_int_with_nulls->get_output(), ColumnID{0}, two_pass_histograms, 2, bloom_filter);
+  auto first_pass_result = partition_by_radix<int, int, true>(materialized_for_two_passes, two_pass_histograms, 2);
+  const auto two_pass_result = refine_radix_partitions<int, int, true>(std::move(first_pass_result), 2, 3);
+
+  bloom_filter.clear();
+  auto single_pass_histograms = std::vector<std::vector<size_t>>{};
+  const auto materialized_for_single_pass = materialize_input<int, int, true>(
+      _table_int_with_nulls->get_output(), ColumnID{0}, single_pass_histograms, 5, bloom_filter);
+  const auto single_pass_result =
+      partition_by_radix<int, int, true>(materialized_for_single_pass, single_pass_histograms, 5);
+
+  ASSERT_EQ(two_pass_result.size(), 32);
+  ASSERT_EQ(single_pass_result.size(), 32);
+  for (auto partition_idx = size_t{0}; partition_idx < 32; ++partition_idx) {
+    const auto& two_pass_partition = two_pass_result[partition_idx];
+    const auto& single_pass_partition = single_pass_result[partition_idx];
+    ASSERT_EQ(two_pass_partition.elements.size(), single_pass_partition.elements.size());
+    ASSERT_EQ(two_pass_partition.null_values, single_pass_partition.null_values);
+
+    // Both passes are stable, so the elements are stored in the same order.
+    for (auto element_idx = size_t{0}; element_idx < two_pass_partition.elements.size(); ++element_idx) {
+      EXPECT_EQ(two_pass_partition.elements[element_idx].row_id, single_pass_partition.elements[element_idx].row_id);
+      EXPECT_EQ(two_pass_partition.elements[element_idx].value, single_pass_partition.elements[element_idx].value);
+    }
+  }
+}
+
 TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   std::vector<std::vector<size_t>> histograms;  // Ignored in this test
   BloomFilter output_bloom_filter;              // Ignored in this test
@@ -328,4 +362,61 @@ TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
                std::logic_error);
 }
 
+TEST_F(JoinHashStepsTest, PlanCompositeKey) {
+  const auto packed = plan_composite_key({DataType::Int, DataType::Int}, {DataType::Int, DataType::Int});
+  ASSERT_TRUE(packed);
+  EXPECT_EQ(packed->type, CompositeKeyType::Packed);
+  EXPECT_EQ(packed->bit_widths, (std::vector<uint8_t>{32, 32}));
+
+  // An Int joined with a Long needs 64 bits, which leaves no room for a second column.
+  const auto hashed = plan_composite_key({DataType::Int, DataType::Int}, {DataType::Long, DataType::Int});
+  ASSERT_TRUE(hashed);
+  EXPECT_EQ(hashed->type, CompositeKeyType::Hashed);
+
+  EXPECT_EQ(plan_composite_key({DataType::Int, DataType::String}, {DataType::Int, DataType::String})->type,
+            CompositeKeyType::Hashed);
+  EXPECT_FALSE(plan_composite_key({DataType::Int, DataType::Int}, {DataType::Int, DataType::Double}));
+}
+
+TEST_F(JoinHashStepsTest, MaterializePackedCompositeKeys) {
+  const auto& table = *_table_with_nulls_and_zeros->get_output();
+  const auto composite_key = CompositeKey{CompositeKeyType::Packed, {32, 32}};
+  const auto key_table = materialize_composite_keys(table, {ColumnID{0}, ColumnID{1}}, composite_key);
+
+  ASSERT_EQ(key_table->chunk_count(), table.chunk_count());
+  EXPECT_EQ(key_table->row_count(), table.row_count());
+  EXPECT_EQ(key_table->get_value<int64_t>(ColumnID{0}, 0),
+            static_cast<int64_t>(finalize_composite_key((uint64_t{18} << 32) | 2)));
+  // Rows with a NULL in any key column have a NULL key.
+  EXPECT_FALSE(key_table->get_value<int64_t>(ColumnID{0}, 1));
+  EXPECT_FALSE(key_table->get_value<int64_t>(ColumnID{0}, 5));
+}
+
+TEST_F(JoinHashStepsTest, RadixPartitionsOfCompositeKeysWithLowCardinalityLastColumn) {
+  // The last key column only has two distinct values. Still, the rows are spread evenly across all partitions.
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data);
+  const auto row_count = 4'096;
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    table->append({row, row % 2});
+  }
+
+  const auto composite_key = CompositeKey{CompositeKeyType::Packed, {32, 32}};
+  const auto key_table = materialize_composite_keys(*table, {ColumnID{0}, ColumnID{1}}, composite_key);
+
+  const auto radix_bits = size_t{6};
+  auto histograms = std::vector<std::vector<size_t>>{};
+  BloomFilter bloom_filter;  // Ignored in this test
+  const auto materialized = materialize_input<int64_t, int64_t, false>(key_table, ColumnID{0}, histograms, radix_bits,
+                                                                       bloom_filter);
+  const auto partitions = partition_by_radix<int64_t, int64_t, false>(materialized, histograms, radix_bits);
+
+  ASSERT_EQ(partitions.size(), size_t{1} << radix_bits);
+  const auto average_partition_size = row_count >> radix_bits;
+  for (const auto& partition : partitions) {
+    EXPECT_GT(partition.elements.size(), average_partition_size / 2);
+    EXPECT_LT(partition.elements.size(), average_partition_size * 2);
+  }
+}
+
 }  // namespace hyrise
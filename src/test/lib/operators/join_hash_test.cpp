@@ -1,5 +1,10 @@
+#include <string>
+#include <vector>
+
 #include "base_test.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
 
@@ -41,6 +46,39 @@ class OperatorsJoinHashTest : public BaseTest {
     dummy_input = std::make_shared<TableWrapper>(dummy_table);
   }
 
+  // Joins two tables with a low-cardinality column a, an int column b, and a string column c using JoinHash and
+  // JoinNestedLoop, compares the results, and checks that JoinHash used the expected composite key.
+  void _test_composite_key(const JoinMode mode, const std::vector<OperatorJoinPredicate>& predicates,
+                           const size_t expected_key_column_count, const bool expected_packed) {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::String, false}};
+    const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{7});
+    const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5});
+    for (auto row = int32_t{0}; row < 40; ++row) {
+      const auto b = row % 9 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row % 6 - 3};
+      left_table->append({row % 2, b, pmr_string{"s" + std::to_string(row % 4)}});
+      right_table->append({row % 3, AllTypeVariant{row % 5 - 3}, pmr_string{"s" + std::to_string(row % 3)}});
+    }
+
+    const auto left = std::make_shared<TableWrapper>(left_table);
+    const auto right = std::make_shared<TableWrapper>(right_table);
+    left->execute();
+    right->execute();
+
+    const auto secondary_predicates = std::vector<OperatorJoinPredicate>{predicates.begin() + 1, predicates.end()};
+    const auto join_hash = std::make_shared<JoinHash>(left, right, mode, predicates.front(), secondary_predicates);
+    join_hash->execute();
+    const auto join_nested_loop =
+        std::make_shared<JoinNestedLoop>(left, right, mode, predicates.front(), secondary_predicates);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_hash->get_output(), join_nested_loop->get_output());
+
+    const auto& performance_data = dynamic_cast<JoinHash::PerformanceData&>(*join_hash->performance_data);
+    EXPECT_EQ(performance_data.composite_key_column_count, expected_key_column_count);
+    EXPECT_EQ(performance_data.composite_key_is_packed, expected_packed);
+  }
+
   std::shared_ptr<AbstractOperator> dummy_input;
   inline static std::shared_ptr<TableWrapper> _table_wrapper_small, _table_tpch_orders, _table_tpch_lineitems,
       _table_with_nulls;
@@ -108,6 +146,61 @@ TEST_F(OperatorsJoinHashTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinHashTest, PackedCompositeKey) {
+  const auto a_equals_a = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto b_equals_b = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto c_not_equals_c = OperatorJoinPredicate{{ColumnID{2}, ColumnID{2}}, PredicateCondition::NotEquals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    _test_composite_key(mode, {a_equals_a, b_equals_b, c_not_equals_c}, 2, true);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, HashedCompositeKey) {
+  const auto a_equals_a = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto b_equals_b = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto c_equals_c = OperatorJoinPredicate{{ColumnID{2}, ColumnID{2}}, PredicateCondition::Equals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    _test_composite_key(mode, {a_equals_a, c_equals_c, b_equals_b}, 3, false);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SecondaryPredicatesWithFrequentKey) {
+  // Each probe row has more candidates than fit into one batch of the multi-predicate join evaluator. Only some of them
+  // satisfy the secondary predicate, so that the matches of a probe row are spread across batches.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{16});
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row = int32_t{0}; row < 40; ++row) {
+    left_table->append({row % 2, row * 100});
+  }
+  const auto right_row_count = static_cast<int32_t>(MultiPredicateJoinEvaluator::BATCH_SIZE * 3 / 2);
+  for (auto row = int32_t{0}; row < right_row_count; ++row) {
+    right_table->append({0, row * 2});
+  }
+
+  const auto left = std::make_shared<TableWrapper>(left_table);
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  left->execute();
+  right->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan}};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    const auto join_hash = std::make_shared<JoinHash>(left, right, mode, primary_predicate, secondary_predicates);
+    join_hash->execute();
+    const auto join_nested_loop =
+        std::make_shared<JoinNestedLoop>(left, right, mode, primary_predicate, secondary_predicates);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_hash->get_output(), join_nested_loop->get_output());
+  }
+}
+
 TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   // Simple tests to check that side switching and zero-sizes work.
   EXPECT_EQ(JoinHash::calculate_radix_bits(1, 0), 0);
@@ -115,6 +208,38 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   EXPECT_EQ(JoinHash::calculate_radix_bits(0, 0), 0);
   EXPECT_EQ(JoinHash::calculate_radix_bits(1, 1), 0);
   EXPECT_GT(JoinHash::calculate_radix_bits(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()), 0);
+
+  // Build sides whose hash table fits into the cache are not partitioned. Smaller caches require more partitions. More
+  // than MAX_RADIX_BITS_PER_PASS bits are partitioned in two passes, and the number of bits is capped.
+  EXPECT_EQ(JoinHash::calculate_radix_bits(100'000, 100'000, 1'024'000), 0);
+  EXPECT_EQ(JoinHash::calculate_radix_bits(1'000'000, 1'000'000, 1'024'000), 3);
+  EXPECT_EQ(JoinHash::calculate_radix_bits(1'000'000, 1'000'000, 131'072), 6);
+  EXPECT_EQ(JoinHash::calculate_radix_bits(100'000'000, 100'000'000, 131'072), 13);
+  EXPECT_EQ(JoinHash::calculate_radix_bits(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), 0),
+            JoinHash::MAX_RADIX_BITS_PER_PASS * JoinHash::MAX_RADIX_PASS_COUNT);
+}
+
+TEST_F(OperatorsJoinHashTest, TwoPassRadixPartitioning) {
+  const auto radix_bits = JoinHash::MAX_RADIX_BITS_PER_PASS + 2;
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::AntiNullAsTrue}) {
+    const auto& probe_input = mode == JoinMode::Inner ? _table_tpch_lineitems : _table_with_nulls;
+    const auto& build_input = mode == JoinMode::Inner ? _table_tpch_orders : _table_with_nulls;
+
+    const auto two_pass_join = std::make_shared<JoinHash>(probe_input, build_input, mode, primary_predicate,
+                                                          std::vector<OperatorJoinPredicate>{}, radix_bits);
+    two_pass_join->execute();
+    const auto& performance_data = dynamic_cast<JoinHash::PerformanceData&>(*two_pass_join->performance_data);
+    EXPECT_EQ(performance_data.radix_bits, radix_bits);
+    EXPECT_EQ(performance_data.radix_pass_count, 2);
+
+    const auto unpartitioned_join = std::make_shared<JoinHash>(probe_input, build_input, mode, primary_predicate,
+                                                               std::vector<OperatorJoinPredicate>{}, 0);
+    unpartitioned_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(two_pass_join->get_output(), unpartitioned_join->get_output());
+  }
 }
 
 }  // namespace hyrise
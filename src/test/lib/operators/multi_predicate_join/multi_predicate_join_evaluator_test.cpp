@@ -0,0 +1,81 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class MultiPredicateJoinEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data,
+        ChunkOffset{2});
+    _left->append({1, "x"});
+    _left->append({2, NULL_VALUE});
+    _left->append({3, "z"});
+
+    _right = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Double, true}, {"b", DataType::String, false}}, TableType::Data,
+        ChunkOffset{2});
+    _right->append({1.0, "x"});
+    _right->append({NULL_VALUE, "y"});
+    _right->append({2.5, "z"});
+
+    // All pairs of left and right rows.
+    for (const auto& left_row_id : {RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                    RowID{ChunkID{1}, ChunkOffset{0}}}) {
+      for (const auto& right_row_id : {RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                       RowID{ChunkID{1}, ChunkOffset{0}}}) {
+        _left_row_ids.emplace_back(left_row_id);
+        _right_row_ids.emplace_back(right_row_id);
+      }
+    }
+  }
+
+  // Checks that the batched evaluation matches the evaluation of single candidates.
+  std::vector<uint8_t> _evaluate(const JoinMode join_mode, const std::vector<OperatorJoinPredicate>& predicates) {
+    auto evaluator = MultiPredicateJoinEvaluator{*_left, *_right, join_mode, predicates};
+    auto matches = std::vector<uint8_t>{};
+    evaluator.satisfies_all_predicates(_left_row_ids, _right_row_ids, matches);
+
+    EXPECT_EQ(matches.size(), _left_row_ids.size());
+    for (auto candidate_idx = size_t{0}; candidate_idx < matches.size(); ++candidate_idx) {
+      EXPECT_EQ(static_cast<bool>(matches[candidate_idx]),
+                evaluator.satisfies_all_predicates(_left_row_ids[candidate_idx], _right_row_ids[candidate_idx]));
+    }
+    return matches;
+  }
+
+  std::shared_ptr<Table> _left;
+  std::shared_ptr<Table> _right;
+  RowIDPosList _left_row_ids;
+  RowIDPosList _right_row_ids;
+};
+
+TEST_F(MultiPredicateJoinEvaluatorTest, NumericPredicate) {
+  const auto predicates =
+      std::vector<OperatorJoinPredicate>{{ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan}};
+  EXPECT_EQ(_evaluate(JoinMode::Inner, predicates), (std::vector<uint8_t>{0, 0, 1, 0, 0, 1, 0, 0, 0}));
+}
+
+TEST_F(MultiPredicateJoinEvaluatorTest, Conjunction) {
+  const auto predicates =
+      std::vector<OperatorJoinPredicate>{{ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThan},
+                                         {ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}};
+  EXPECT_EQ(_evaluate(JoinMode::Inner, predicates), (std::vector<uint8_t>{0, 0, 0, 0, 0, 0, 0, 0, 1}));
+}
+
+TEST_F(MultiPredicateJoinEvaluatorTest, NullsAreTrueForAntiNullAsTrue) {
+  const auto predicates =
+      std::vector<OperatorJoinPredicate>{{ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::NotEquals}};
+  EXPECT_EQ(_evaluate(JoinMode::Inner, predicates), (std::vector<uint8_t>{0, 1, 1, 0, 0, 0, 1, 1, 0}));
+  EXPECT_EQ(_evaluate(JoinMode::AntiNullAsTrue, predicates), (std::vector<uint8_t>{0, 1, 1, 1, 1, 1, 1, 1, 0}));
+}
+
+}  // namespace hyrise
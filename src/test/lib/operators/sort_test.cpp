@@ -1,7 +1,14 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "base_test.hpp"
+#include "hyrise.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace hyrise {
 
@@ -234,4 +241,102 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, ParallelMultiColumnSort) {
+  // Large inputs are sorted in multiple runs that are merged. The result must match a stable sort of the input rows,
+  // including NULLs first for both sort modes and strings that only differ after their encoded prefix.
+  const auto row_count = size_t{200'000};
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  const auto a_value = [](const size_t row) {
+    return static_cast<int32_t>(row % 97) - 48;
+  };
+  const auto a_is_null = [](const size_t row) {
+    return row % 89 == 0;
+  };
+  const auto b_value = [](const size_t row) {
+    auto value = pmr_string{"a long shared string prefix "};
+    value += std::to_string(row % 23);
+    return value;
+  };
+  const auto c_value = [](const size_t row) {
+    return static_cast<double>(row % 5) - 2.5;
+  };
+  const auto c_is_null = [](const size_t row) {
+    return row % 7 == 0;
+  };
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += chunk_size) {
+    auto a_values = pmr_vector<int32_t>{};
+    auto a_nulls = pmr_vector<bool>{};
+    auto b_values = pmr_vector<pmr_string>{};
+    auto c_values = pmr_vector<double>{};
+    auto c_nulls = pmr_vector<bool>{};
+    for (auto row = chunk_begin; row < chunk_begin + chunk_size; ++row) {
+      a_values.emplace_back(a_value(row));
+      a_nulls.emplace_back(a_is_null(row));
+      b_values.emplace_back(b_value(row));
+      c_values.emplace_back(c_value(row));
+      c_nulls.emplace_back(c_is_null(row));
+    }
+    table->append_chunk(Segments{
+        std::make_shared<ValueSegment<int32_t>>(std::move(a_values), std::move(a_nulls)),
+        std::make_shared<ValueSegment<pmr_string>>(std::move(b_values)),
+        std::make_shared<ValueSegment<double>>(std::move(c_values), std::move(c_nulls))});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  // ORDER BY a DESC, b ASC, c DESC with NULLs first.
+  auto expected_rows = std::vector<size_t>(row_count);
+  std::iota(expected_rows.begin(), expected_rows.end(), size_t{0});
+  std::stable_sort(expected_rows.begin(), expected_rows.end(), [&](const size_t lhs, const size_t rhs) {
+    if (a_is_null(lhs) != a_is_null(rhs)) {
+      return a_is_null(lhs);
+    }
+    if (!a_is_null(lhs) && a_value(lhs) != a_value(rhs)) {
+      return a_value(lhs) > a_value(rhs);
+    }
+    if (b_value(lhs) != b_value(rhs)) {
+      return b_value(lhs) < b_value(rhs);
+    }
+    if (c_is_null(lhs) != c_is_null(rhs)) {
+      return c_is_null(lhs);
+    }
+    return !c_is_null(lhs) && c_value(lhs) > c_value(rhs);
+  });
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}, SortMode::Descending}, SortColumnDefinition{ColumnID{1}, SortMode::Ascending},
+      SortColumnDefinition{ColumnID{2}, SortMode::Descending}};
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  const auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, chunk_size);
+  sort->execute();
+  const auto materializing_sort =
+      std::make_shared<Sort>(table_wrapper, sort_definitions, chunk_size, Sort::ForceMaterialization::Yes);
+  materializing_sort->execute();
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+
+  const auto& result = sort->get_output();
+  ASSERT_EQ(result->type(), TableType::References);
+  ASSERT_EQ(result->row_count(), row_count);
+  auto output_row_index = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto& segment = static_cast<const ReferenceSegment&>(*result->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    for (const auto& row_id : *segment.pos_list()) {
+      const auto expected_row = expected_rows[output_row_index];
+      ASSERT_EQ(row_id, RowID(ChunkID{expected_row / chunk_size}, ChunkOffset{expected_row % chunk_size}));
+      ++output_row_index;
+    }
+  }
+
+  EXPECT_EQ(materializing_sort->get_output()->type(), TableType::Data);
+  EXPECT_TABLE_EQ_ORDERED(materializing_sort->get_output(), result);
+}
+
 }  // namespace hyrise
@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -20,9 +21,11 @@
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
+#include "operators/table_scan/multi_predicate_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -291,6 +294,35 @@ TEST_P(OperatorsTableScanTest, SingleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ChunkOffsetPosLists) {
+  // Partially matched chunks of data tables and of single-chunk references are referenced by selection vectors that
+  // only store ChunkOffsets.
+  const auto scan_1 = create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  scan_1->execute();
+  const auto& output_1 = scan_1->get_output();
+  ASSERT_EQ(output_1->chunk_count(), 2);
+  const auto pos_list_1 = std::dynamic_pointer_cast<const ChunkOffsetPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(output_1->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+          ->pos_list());
+  ASSERT_TRUE(pos_list_1);
+  EXPECT_EQ(pos_list_1->common_chunk_id(), ChunkID{0});
+  EXPECT_EQ(pos_list_1->chunk_offsets(), ChunkOffsetPosList::Vector{ChunkOffset{0}});
+
+  const auto scan_2 = create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::NotEquals, 1234);
+  scan_2->execute();
+  const auto scan_3 = create_table_scan(scan_2, ColumnID{0}, PredicateCondition::LessThan, 1234);
+  scan_3->execute();
+  const auto& output_3 = scan_3->get_output();
+  ASSERT_EQ(output_3->chunk_count(), 1);
+  const auto pos_list_3 = std::dynamic_pointer_cast<const ChunkOffsetPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(output_3->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))
+          ->pos_list());
+  ASSERT_TRUE(pos_list_3);
+  EXPECT_EQ(pos_list_3->common_chunk_id(), ChunkID{0});
+  EXPECT_EQ(pos_list_3->chunk_offsets(), ChunkOffsetPosList::Vector{ChunkOffset{1}});
+  EXPECT_EQ(output_3->get_value<int32_t>(ColumnID{0}, 0), 123);
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithSortedSegmentEquals) {
   const auto expected_result = load_table("resources/test_data/tbl/int_sorted_filtered.tbl", ChunkOffset{1});
 
@@ -972,7 +1004,9 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<MultiPredicateTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<MultiPredicateTableScanImpl*>(TableScan{get_int_float_op(), or_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), in_(column_a, list_(1, 2, 3)))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, 5.5f)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_b, 1e40)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, int64_t{3'000'000'000})}.create_impl().get()));  // NOLINT
@@ -1090,6 +1124,58 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   // clang-format on
 }
 
+TEST_P(OperatorsTableScanTest, MultiPredicateScans) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+
+  const auto tests = std::vector<std::pair<std::shared_ptr<AbstractExpression>, std::vector<AllTypeVariant>>>{
+      {and_(greater_than_(column_a, 200), less_than_(column_b, 458.0f)), {1234}},
+      {or_(less_than_(column_a, 200), greater_than_(column_b, 458.0f)), {12345, 123}},
+      {and_(greater_than_(column_a, 200), or_(less_than_(column_b, 457.0f), greater_than_(column_b, 458.0f))), {12345}},
+      {and_(greater_than_(column_a, 200), less_than_(column_a, 1'000)), {}},
+      {or_(or_(greater_than_(column_a, 0), less_than_(column_a, 0)), equals_(column_b, 1.0f)), {12345, 123, 1234}}};
+
+  for (const auto& [predicate, expected] : tests) {
+    const auto scan = std::make_shared<TableScan>(get_int_float_op(), predicate);
+    scan->execute();
+    EXPECT_TRUE(dynamic_cast<const MultiPredicateTableScanImpl*>(scan->create_impl().get()));
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, expected);
+
+    // Scanning the output of the first scan exercises the reference segments.
+    const auto scan_on_references = std::make_shared<TableScan>(scan, predicate);
+    scan_on_references->execute();
+    ASSERT_COLUMN_EQ(scan_on_references->get_output(), ColumnID{0}, expected);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, MultiPredicateScanOrdersPredicatesBySelectivity) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_wrapper = get_int_float_op();
+
+  {
+    // The first predicate matches all rows, the second one only 123. After the chunks are scanned, the second
+    // predicate comes first.
+    auto abstract_impl =
+        TableScan{table_wrapper, and_(greater_than_(column_a, 0), less_than_(column_a, 200))}.create_impl();
+    auto& impl = dynamic_cast<MultiPredicateTableScanImpl&>(*abstract_impl);
+    EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(impl.scan_chunk(table_wrapper->get_output(), ChunkID{0})->size(), 1);
+    EXPECT_EQ(impl.scan_chunk(table_wrapper->get_output(), ChunkID{1})->size(), 0);
+    EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{1, 0}));
+  }
+
+  {
+    // For disjunctions, the predicate that matches the most rows comes first.
+    auto abstract_impl =
+        TableScan{table_wrapper, or_(less_than_(column_a, 200), greater_than_(column_a, 0))}.create_impl();
+    auto& impl = dynamic_cast<MultiPredicateTableScanImpl&>(*abstract_impl);
+    EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(impl.scan_chunk(table_wrapper->get_output(), ChunkID{0})->size(), 2);
+    EXPECT_EQ(impl.scan_chunk(table_wrapper->get_output(), ChunkID{1})->size(), 1);
+    EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{1, 0}));
+  }
+}
+
 TEST_P(OperatorsTableScanTest, TwoBigScans) {
   // To stress-test the SIMD scan, which only operates on bigger tables, the generated table holds 1'000 rows.
   // For each fifth row, column a is NULL. Otherwise, a is 100'000 + i, b is the index in the list of non-NULL values.
@@ -1140,6 +1226,56 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnLongAndDoubleColumnsWithOutliers) {
+  // Every 100th value of column a is far outside the range of the other values, and every 50th value of column b has
+  // more decimal digits than the others. Frame-of-reference encoding stores these values as exceptions. Each of the two
+  // chunks spans multiple blocks of frame-of-reference segments.
+  constexpr auto row_count = int64_t{5'000};
+  constexpr auto outlier = int64_t{1} << 40;
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Long, true}, {"b", DataType::Double, true}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2'500});
+
+  auto expected_small_a_count = size_t{0};
+  auto expected_large_a_count = size_t{0};
+  auto expected_large_b_count = size_t{0};
+  auto expected_equal_b_count = size_t{0};
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    const auto a = index % 100 == 0 ? outlier + index : index;
+    const auto b = index % 50 == 0 ? static_cast<double>(index) / 3.0 : static_cast<double>(index) * 0.5;
+    const auto a_is_null = index % 11 == 5;
+    const auto b_is_null = index % 13 == 7;
+    data_table->append({a_is_null ? AllTypeVariant{NullValue{}} : AllTypeVariant{a},
+                        b_is_null ? AllTypeVariant{NullValue{}} : AllTypeVariant{b}});
+
+    expected_small_a_count += !a_is_null && a < 2'000;
+    expected_large_a_count += !a_is_null && a >= outlier;
+    expected_large_b_count += !b_is_null && b > 1'000.0;
+    expected_equal_b_count += !b_is_null && b == 123.5;
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    ChunkEncoder::encode_chunk(data_table->get_chunk(chunk_id), {DataType::Long, DataType::Double},
+                               {SegmentEncodingSpec{_encoding_type}, SegmentEncodingSpec{_encoding_type}});
+  }
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->never_clear_output();
+  data_table_wrapper->execute();
+
+  const auto tests = std::vector<std::tuple<ColumnID, PredicateCondition, AllTypeVariant, size_t>>{
+      {ColumnID{0}, PredicateCondition::LessThan, int64_t{2'000}, expected_small_a_count},
+      {ColumnID{0}, PredicateCondition::GreaterThanEquals, outlier, expected_large_a_count},
+      {ColumnID{1}, PredicateCondition::GreaterThan, 1'000.0, expected_large_b_count},
+      {ColumnID{1}, PredicateCondition::Equals, 123.5, expected_equal_b_count}};
+
+  for (const auto& [column_id, predicate_condition, value, expected_count] : tests) {
+    const auto scan = create_table_scan(data_table_wrapper, column_id, predicate_condition, value);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_count);
+  }
+}
+
 /**
  * Tests for sorted_by flag forwarding.
  */
@@ -0,0 +1,128 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/sort/input.tbl", ChunkOffset{7});
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+
+    const auto a = ColumnID{0};
+    const auto b = ColumnID{1};
+    const auto c = ColumnID{2};
+    _sort_definitions_variants = {
+        {SortColumnDefinition{a, SortMode::Ascending}},
+        {SortColumnDefinition{a, SortMode::Descending}},
+        {SortColumnDefinition{b, SortMode::Descending}, SortColumnDefinition{c, SortMode::Ascending}},
+        {SortColumnDefinition{c, SortMode::Descending}, SortColumnDefinition{b, SortMode::Ascending},
+         SortColumnDefinition{a, SortMode::Descending}}};
+  }
+
+  // TopK must yield the same rows in the same order as a Sort followed by a Limit.
+  void test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input) {
+    for (const auto& sort_definitions : _sort_definitions_variants) {
+      for (const auto row_count : {int64_t{0}, int64_t{1}, int64_t{5}, int64_t{23}, int64_t{1000}}) {
+        const auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(row_count));
+        top_k->execute();
+
+        const auto sort = std::make_shared<Sort>(input, sort_definitions);
+        sort->execute();
+        const auto limit = std::make_shared<Limit>(sort, value_(row_count));
+        limit->execute();
+
+        EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::vector<std::vector<SortColumnDefinition>> _sort_definitions_variants;
+};
+
+TEST_F(OperatorsTopKTest, DataInput) {
+  test_against_sort_and_limit(_table_wrapper);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(a, 3));
+  table_scan->never_clear_output();
+  table_scan->execute();
+
+  test_against_sort_and_limit(table_scan);
+}
+
+TEST_F(OperatorsTopKTest, MultiThreaded) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  test_against_sort_and_limit(_table_wrapper);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksByPruningStatistics) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{4, 2, 3, 1})});
+  table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{0, 5})});
+
+  // The statistics of the second chunk pretend that all of its values are larger than the ones of the first chunk.
+  // Thus, the second chunk is skipped once the first chunk has filled the heap.
+  const auto attribute_statistics = std::make_shared<AttributeStatistics<int32_t>>();
+  attribute_statistics->set_statistics_object(std::make_shared<MinMaxFilter<int32_t>>(10, 20));
+  table->get_chunk(ChunkID{1})->set_pruning_statistics(ChunkPruningStatistics{attribute_statistics});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_k = std::make_shared<TopK>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{3}));
+  top_k->execute();
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                      TableType::Data);
+  expected_table->append({1});
+  expected_table->append({2});
+  expected_table->append({3});
+  EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), expected_table);
+
+  // Without statistics that could skip the second chunk, its values are considered.
+  table->get_chunk(ChunkID{1})->set_pruning_statistics(std::nullopt);
+  const auto unpruned_top_k = std::make_shared<TopK>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{3}));
+  unpruned_top_k->execute();
+  EXPECT_EQ(*unpruned_top_k->get_output()->get_value<int32_t>(ColumnID{0}, 0), 0);
+}
+
+TEST_F(OperatorsTopKTest, DeepCopy) {
+  const auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      value_(int64_t{2}));
+  const auto copy = std::dynamic_pointer_cast<TopK>(top_k->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->sort_definitions(), top_k->sort_definitions());
+  EXPECT_EQ(*copy->row_count_expression(), *top_k->row_count_expression());
+}
+
+}  // namespace hyrise
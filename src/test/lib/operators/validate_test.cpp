@@ -14,6 +14,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -91,6 +93,23 @@ TEST_F(OperatorsValidateTest, SimpleValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ChunkOffsetPosList) {
+  // The second chunk contains an invalidated row. Its remaining row is referenced by a selection vector.
+  const auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+  const auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto& output = validate->get_output();
+  ASSERT_EQ(output->chunk_count(), _test_table->chunk_count());
+  const auto pos_list = std::dynamic_pointer_cast<const ChunkOffsetPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{1})->get_segment(ColumnID{0}))
+          ->pos_list());
+  ASSERT_TRUE(pos_list);
+  EXPECT_EQ(pos_list->common_chunk_id(), ChunkID{1});
+  EXPECT_EQ(pos_list->chunk_offsets(), ChunkOffsetPosList::Vector{ChunkOffset{1}});
+}
+
 TEST_F(OperatorsValidateTest, ScanValidate) {
   auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
 
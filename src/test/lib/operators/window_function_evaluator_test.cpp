@@ -0,0 +1,194 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window_function_evaluator.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsWindowFunctionEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Partition a, order b, argument c. Partition 1 is ordered as rows 0, 3 (peers), 5, 2. Partition 2 is ordered as
+    // rows 4, 1, 6 (1 and 6 are peers).
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, true}},
+        TableType::Data, ChunkOffset{3});
+    table->append({1, 10, 5});
+    table->append({2, 20, 1});
+    table->append({1, 30, NULL_VALUE});
+    table->append({1, 10, 7});
+    table->append({2, 10, 2});
+    table->append({1, 20, 3});
+    table->append({2, 20, 4});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<WindowExpression> _window(const FrameDescription& frame = _default_frame()) {
+    return window_(expression_vector(_a), expression_vector(_b), std::vector<SortMode>{SortMode::Ascending},
+                   FrameDescription{frame});
+  }
+
+  static FrameDescription _default_frame() {
+    return FrameDescription{FrameType::Range, FrameBound{0, FrameBoundType::Preceding, true},
+                            FrameBound{0, FrameBoundType::CurrentRow, false}};
+  }
+
+  // Evaluates the window function and returns the values of the result column in the order of the input rows.
+  template <typename T>
+  std::vector<std::optional<T>> _evaluate(const std::shared_ptr<AbstractExpression>& window_function,
+                                          const std::shared_ptr<AbstractOperator>& input = nullptr) {
+    const auto evaluator = std::make_shared<WindowFunctionEvaluator>(
+        input ? input : _table_wrapper, std::static_pointer_cast<WindowFunctionExpression>(window_function));
+    evaluator->execute();
+
+    const auto& output = evaluator->get_output();
+    const auto result_column_id = ColumnID{static_cast<ColumnID::base_type>(output->column_count() - 1)};
+    auto values = std::vector<std::optional<T>>{};
+    for (auto row = uint64_t{0}; row < output->row_count(); ++row) {
+      values.emplace_back(output->get_value<T>(result_column_id, row));
+    }
+    return values;
+  }
+
+  inline static const auto _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  inline static const auto _b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  inline static const auto _c = pqp_column_(ColumnID{2}, DataType::Int, true, "c");
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RankFunctions) {
+  using Values = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(_evaluate<int64_t>(row_number_(_window())), (Values{1, 2, 4, 2, 1, 3, 3}));
+  EXPECT_EQ(_evaluate<int64_t>(rank_(_window())), (Values{1, 2, 4, 1, 1, 3, 2}));
+  EXPECT_EQ(_evaluate<int64_t>(dense_rank_(_window())), (Values{1, 2, 3, 1, 1, 2, 2}));
+
+  const auto percent_ranks = _evaluate<double>(percent_rank_(_window()));
+  const auto expected_percent_ranks = std::vector<double>{0.0, 0.5, 1.0, 0.0, 0.0, 2.0 / 3.0, 0.5};
+  ASSERT_EQ(percent_ranks.size(), expected_percent_ranks.size());
+  for (auto row = size_t{0}; row < percent_ranks.size(); ++row) {
+    EXPECT_DOUBLE_EQ(*percent_ranks[row], expected_percent_ranks[row]);
+  }
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RunningAggregate) {
+  // The default frame ends with the last peer of the current row.
+  using Values = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(_evaluate<int64_t>(sum_(_c, _window())), (Values{12, 7, 15, 12, 2, 15, 7}));
+  EXPECT_EQ(_evaluate<int64_t>(count_(_c, _window())), (Values{2, 3, 3, 2, 1, 3, 3}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RowsFrames) {
+  const auto one_preceding = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Preceding, false},
+                                              FrameBound{0, FrameBoundType::CurrentRow, false}};
+  EXPECT_EQ(_evaluate<int64_t>(sum_(_c, _window(one_preceding))),
+            (std::vector<std::optional<int64_t>>{5, 3, 3, 12, 2, 10, 5}));
+
+  // Empty frames and frames with only NULLs yield NULL.
+  const auto following = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Following, false},
+                                          FrameBound{2, FrameBoundType::Following, false}};
+  EXPECT_EQ(_evaluate<int32_t>(min_(_c, _window(following))),
+            (std::vector<std::optional<int32_t>>{3, 4, std::nullopt, 3, 1, std::nullopt, std::nullopt}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RangeFrameWithOffset) {
+  const auto range = FrameDescription{FrameType::Range, FrameBound{10, FrameBoundType::Preceding, false},
+                                      FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto averages = _evaluate<double>(avg_(_c, _window(range)));
+  const auto expected_averages = std::vector<double>{6.0, 7.0 / 3.0, 3.0, 6.0, 2.0, 5.0, 7.0 / 3.0};
+  ASSERT_EQ(averages.size(), expected_averages.size());
+  for (auto row = size_t{0}; row < averages.size(); ++row) {
+    EXPECT_DOUBLE_EQ(*averages[row], expected_averages[row]);
+  }
+
+  // RANGE frames with offsets need a single ORDER BY column.
+  const auto window = window_(expression_vector(), expression_vector(_a, _b),
+                              std::vector<SortMode>{SortMode::Ascending, SortMode::Ascending}, FrameDescription{range});
+  EXPECT_THROW(_evaluate<double>(avg_(_c, window)), InvalidInputException);
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, WithoutPartitionAndOrder) {
+  // Without ORDER BY, all rows of a partition are peers.
+  const auto window =
+      window_(expression_vector(), expression_vector(), std::vector<SortMode>{}, FrameDescription{_default_frame()});
+  const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  EXPECT_EQ(_evaluate<int64_t>(count_(star, window)), std::vector<std::optional<int64_t>>(7, 7));
+  EXPECT_EQ(_evaluate<int64_t>(rank_(window)), std::vector<std::optional<int64_t>>(7, 1));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, ReferenceInput) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_b, 10));
+  table_scan->execute();
+
+  // Remaining rows: 1 (partition 2), 2 (partition 1), 5 (partition 1), 6 (partition 2).
+  const auto evaluator = std::make_shared<WindowFunctionEvaluator>(
+      table_scan, std::static_pointer_cast<WindowFunctionExpression>(row_number_(_window())));
+  evaluator->execute();
+  const auto& output = evaluator->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  EXPECT_EQ(output->column_count(), 4);
+  EXPECT_EQ(_evaluate<int64_t>(row_number_(_window()), table_scan),
+            (std::vector<std::optional<int64_t>>{1, 2, 1, 2}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, MultiThreaded) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Large enough to be evaluated in multiple buckets.
+  const auto row_count = int32_t{50'000};
+  const auto partition_count = int32_t{7};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false},
+                                                                    {"b", DataType::Int, false}},
+                                             TableType::Data, ChunkOffset{1'000});
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    table->append({row % partition_count, row_count - row});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Rows are ordered by descending row within each partition.
+  const auto row_numbers = _evaluate<int64_t>(row_number_(_window()), table_wrapper);
+  ASSERT_EQ(row_numbers.size(), static_cast<size_t>(row_count));
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    const auto partition_size = row_count / partition_count + (row % partition_count < row_count % partition_count);
+    EXPECT_EQ(*row_numbers[row], partition_size - row / partition_count);
+  }
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, UnsupportedFunctions) {
+  EXPECT_THROW(_evaluate<int64_t>(count_distinct_(_c, _window())), InvalidInputException);
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, DeepCopy) {
+  const auto evaluator = std::make_shared<WindowFunctionEvaluator>(
+      _table_wrapper, std::static_pointer_cast<WindowFunctionExpression>(sum_(_c, _window())));
+  const auto copy = std::dynamic_pointer_cast<WindowFunctionEvaluator>(evaluator->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(*copy->window_function_expression(), *evaluator->window_function_expression());
+  EXPECT_EQ(copy->partition_by_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(copy->order_by_column_ids(), std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(copy->argument_column_id(), ColumnID{2});
+}
+
+}  // namespace hyrise
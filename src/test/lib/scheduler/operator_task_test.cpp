@@ -1,5 +1,6 @@
 #include <future>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,8 +16,11 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/value_segment.hpp"
 
 namespace hyrise {
 
@@ -317,6 +321,94 @@ TEST_F(OperatorTaskTest, PrunableSubqueriesWithCycles) {
   }
 }
 
+TEST_F(OperatorTaskTest, FusePipelines) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Chunks are large enough to be processed by individual jobs. Every tenth row has been deleted.
+  const auto chunk_size = ChunkOffset{1'000};
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             chunk_size, UseMvcc::Yes);
+  for (auto first_value = int32_t{0}; first_value < 4'000; first_value += 1'000) {
+    auto values = pmr_vector<int32_t>(chunk_size);
+    std::iota(values.begin(), values.end(), first_value);
+    const auto mvcc_data = std::make_shared<MvccData>(chunk_size, CommitID{0});
+    for (auto chunk_offset = uint32_t{0}; chunk_offset < chunk_size; chunk_offset += 10) {
+      mvcc_data->set_end_cid(ChunkOffset{chunk_offset}, CommitID{0});
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))}, mvcc_data);
+    table->last_chunk()->set_immutable();
+  }
+  Hyrise::get().storage_manager.add_table("table_c", table);
+
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto make_pqp = [&]() {
+    const auto get_table = std::make_shared<GetTable>("table_c");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto scan_a = std::make_shared<TableScan>(validate, greater_than_(a, 500));
+    const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(a, 3'500));
+    const auto projection = std::make_shared<Projection>(scan_b, expression_vector(a, add_(a, 1)));
+    projection->set_transaction_context_recursively(
+        Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes));
+    return std::vector<std::shared_ptr<AbstractOperator>>{get_table, validate, scan_a, scan_b, projection};
+  };
+
+  // Executing the operators one by one does not fuse them.
+  const auto expected_pqp = make_pqp();
+  for (const auto& op : expected_pqp) {
+    op->execute();
+  }
+
+  const auto pqp = make_pqp();
+  const auto& projection = pqp.back();
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(projection);
+
+  // The Validate and the TableScans are executed by the Projection's task.
+  ASSERT_EQ(tasks.size(), 2);
+  EXPECT_EQ(projection->fused_inputs(), (std::vector<std::shared_ptr<AbstractOperator>>{pqp[1], pqp[2], pqp[3]}));
+  EXPECT_EQ(get_task(pqp[1]), nullptr);
+  EXPECT_EQ(pqp[0]->get_or_create_operator_task()->successors(), TaskVector{root_operator_task});
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  for (auto op_id = size_t{0}; op_id < 4; ++op_id) {
+    EXPECT_EQ(pqp[op_id]->state(), OperatorState::ExecutedAndCleared);
+  }
+
+  // The fused inputs report the rows and chunks that they passed on.
+  for (auto op_id = size_t{1}; op_id < 4; ++op_id) {
+    const auto& performance_data = *pqp[op_id]->performance_data;
+    EXPECT_TRUE(performance_data.has_output);
+    EXPECT_EQ(performance_data.output_row_count, expected_pqp[op_id]->performance_data->output_row_count);
+    EXPECT_EQ(performance_data.output_chunk_count, expected_pqp[op_id]->performance_data->output_chunk_count);
+  }
+
+  EXPECT_EQ(projection->get_output()->row_count(), 2'700);
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_pqp.back()->get_output());
+}
+
+TEST_F(OperatorTaskTest, DoNotFuseSharedInputs) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto gt_a = std::make_shared<GetTable>("table_a");
+  const auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  const auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  const auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 1000));
+  const auto scan_c = std::make_shared<TableScan>(scan_a, greater_than_(b, 2000));
+  const auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  // scan_a has two consumers and its output must be materialized.
+  const auto& [tasks, _] = OperatorTask::make_tasks_from_operator(union_positions);
+  EXPECT_EQ(tasks.size(), 5);
+  EXPECT_TRUE(scan_b->fused_inputs().empty());
+  EXPECT_TRUE(scan_c->fused_inputs().empty());
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_TRUE(union_positions->executed());
+}
+
 TEST_F(OperatorTaskTest, SkipOperatorTask) {
   const auto table = std::make_shared<GetTable>("table_a");
   table->execute();
@@ -346,6 +346,10 @@ TEST_F(SchedulerTest, DetermineQueueIDForTask) {
   // For the case of no load on node ID 0 (which is the case here), tasks are always scheduled on this node.
   EXPECT_EQ(node_queue_scheduler->determine_queue_id(CURRENT_NODE_ID), NodeID{0});
 
+  // Preferred nodes without workers are ignored.
+  EXPECT_EQ(node_queue_scheduler->determine_queue_id(NodeID{2}), NodeID{0});
+  EXPECT_EQ(node_queue_scheduler->determine_queue_id(INVALID_NODE_ID), NodeID{0});
+
   // The distribution of tasks under high load is tested in the concurrency stress tests.
 }
 
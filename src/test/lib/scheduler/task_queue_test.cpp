@@ -47,4 +47,33 @@ TEST_F(TaskQueueTest, EstimateLoad) {
   EXPECT_EQ(task_queue.estimate_load(), size_t{3});
 }
 
+TEST_F(TaskQueueTest, WorkerDeques) {
+  auto task_queue = TaskQueue{NodeID{0}, 2};
+
+  const auto local_task_a = std::make_shared<JobTask>([]() {});
+  const auto local_task_b = std::make_shared<JobTask>([]() {});
+  const auto shared_task = std::make_shared<JobTask>([]() {});
+  const auto high_priority_task = std::make_shared<JobTask>([]() {}, SchedulePriority::High);
+  task_queue.push_local(local_task_a, 0);
+  task_queue.push_local(local_task_b, 0);
+  task_queue.push(shared_task, SchedulePriority::Default);
+  task_queue.push(high_priority_task, SchedulePriority::High);
+  EXPECT_EQ(task_queue.estimate_load(), size_t{5});
+
+  // Worker 0 first pulls high-priority tasks, then its own tasks (most recent first), then tasks of the shared queues.
+  EXPECT_EQ(task_queue.pull(0), high_priority_task);
+  EXPECT_EQ(task_queue.pull(0), local_task_b);
+  EXPECT_EQ(task_queue.pull(0), shared_task);
+
+  // Worker 1 steals the remaining task from the deque of worker 0.
+  EXPECT_EQ(task_queue.pull(1), local_task_a);
+  EXPECT_TRUE(task_queue.empty());
+  EXPECT_EQ(task_queue.pull(1), nullptr);
+
+  // Tasks in the deques can be stolen by workers of other nodes.
+  task_queue.push_local(std::make_shared<JobTask>([]() {}), 1);
+  EXPECT_TRUE(task_queue.steal());
+  EXPECT_TRUE(task_queue.empty());
+}
+
 }  // namespace hyrise
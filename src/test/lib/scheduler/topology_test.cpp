@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <thread>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/topology.hpp"
+
+namespace hyrise {
+
+class TopologyTest : public BaseTest {};
+
+TEST_F(TopologyTest, Caches) {
+  const auto& topology = Hyrise::get().topology;
+  const auto& caches = topology.caches();
+
+  EXPECT_TRUE(std::is_sorted(caches.cbegin(), caches.cend(), [](const auto& lhs, const auto& rhs) {
+    return lhs.level < rhs.level;
+  }));
+
+  auto largest_cache_size = size_t{0};
+  for (const auto& cache : caches) {
+    EXPECT_GT(cache.size, 0);
+    EXPECT_GE(cache.shared_cpu_count, 1);
+    EXPECT_GT(topology.cache_size(cache.level), 0);
+    largest_cache_size = std::max(largest_cache_size, cache.size);
+  }
+
+  // Cache sizes might not be available (e.g., in containers). If they are, at least the L1 cache is private.
+  EXPECT_LE(topology.private_cache_size(), largest_cache_size);
+  if (!caches.empty() && caches.front().level == 1) {
+    EXPECT_GT(topology.private_cache_size(), 0);
+  }
+  EXPECT_EQ(topology.cache_size(0), 0);
+}
+
+TEST_F(TopologyTest, CachesAndPhysicalCoresSurviveTopologyChanges) {
+  auto& topology = Hyrise::get().topology;
+  const auto private_cache_size = topology.private_cache_size();
+  const auto num_physical_cores = topology.num_physical_cores();
+
+  EXPECT_GE(num_physical_cores, 1);
+  EXPECT_LE(num_physical_cores, std::max(std::thread::hardware_concurrency(), 1u));
+
+  topology.use_fake_numa_topology(8, 4);
+  EXPECT_EQ(topology.private_cache_size(), private_cache_size);
+  EXPECT_EQ(topology.num_physical_cores(), num_physical_cores);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,104 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace hyrise {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::shared_ptr<AbstractTask> _create_task() {
+    return std::make_shared<JobTask>([]() {});
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  const auto task_a = _create_task();
+  const auto task_b = _create_task();
+  const auto task_c = _create_task();
+  deque.push(task_a);
+  deque.push(task_b);
+  deque.push(task_c);
+  EXPECT_EQ(deque.estimate_size(), 3);
+
+  EXPECT_EQ(deque.pop(), task_c);
+  EXPECT_EQ(deque.steal(), task_a);
+  EXPECT_EQ(deque.pop(), task_b);
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+  EXPECT_EQ(deque.estimate_size(), 0);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{4};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = size_t{0}; index < 100; ++index) {
+    tasks.emplace_back(_create_task());
+    deque.push(tasks.back());
+  }
+  EXPECT_EQ(deque.estimate_size(), 100);
+
+  EXPECT_EQ(deque.steal(), tasks.front());
+  for (auto index = size_t{99}; index > 0; --index) {
+    EXPECT_EQ(deque.pop(), tasks[index]);
+  }
+  EXPECT_EQ(deque.pop(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  const auto task = _create_task();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealers) {
+  constexpr auto TASK_COUNT = size_t{100'000};
+  constexpr auto THIEF_COUNT = size_t{4};
+
+  auto deque = WorkStealingDeque{16};
+  auto taken_task_count = std::atomic_size_t{0};
+  auto owner_done = std::atomic_bool{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || deque.estimate_size() > 0) {
+        if (deque.steal()) {
+          ++taken_task_count;
+        }
+      }
+    });
+  }
+
+  // The owner pushes all tasks and pops some of them, while the thieves steal the others.
+  for (auto index = size_t{0}; index < TASK_COUNT; ++index) {
+    deque.push(_create_task());
+    if (index % 3 == 0 && deque.pop()) {
+      ++taken_task_count;
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  // Every task is taken exactly once.
+  EXPECT_EQ(taken_task_count, TASK_COUNT);
+  EXPECT_EQ(deque.estimate_size(), 0);
+}
+
+}  // namespace hyrise
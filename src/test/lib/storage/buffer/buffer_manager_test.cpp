@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/buffer/buffer_manager.hpp"
+
+namespace hyrise {
+
+class BufferManagerTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto config = BufferManager::Config{};
+    // The buffer pool can hold exactly four pages of the largest size type.
+    config.dram_buffer_pool_size = 4 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.reserved_virtual_memory_per_size_type = 64 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.ssd_path = test_data_path + "buffer_manager";
+    buffer_manager = std::make_unique<BufferManager>(config);
+  }
+
+  void write_page(const PageID page_id, const std::byte value) {
+    buffer_manager->pin_exclusive(page_id);
+    auto* data = buffer_manager->get_page(page_id);
+    std::fill(data, data + page_id.byte_count(), value);
+    buffer_manager->set_dirty(page_id);
+    buffer_manager->unpin_exclusive(page_id);
+  }
+
+  bool page_contains(const PageID page_id, const std::byte value) {
+    buffer_manager->pin_shared(page_id);
+    const auto* data = buffer_manager->get_page(page_id);
+    const auto result =
+        std::all_of(data, data + page_id.byte_count(), [&](const auto byte) { return byte == value; });
+    buffer_manager->unpin_shared(page_id);
+    return result;
+  }
+
+ protected:
+  std::unique_ptr<BufferManager> buffer_manager;
+};
+
+TEST_F(BufferManagerTest, PinAndUnpin) {
+  const auto page_id = PageID{PageSizeType::KiB64, 5};
+  auto* frame = buffer_manager->get_frame(page_id);
+  EXPECT_EQ(Frame::state(frame->state_and_version()), Frame::EVICTED);
+
+  buffer_manager->pin_exclusive(page_id);
+  EXPECT_EQ(Frame::state(frame->state_and_version()), Frame::LOCKED);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, bytes_for_size_type(PageSizeType::KiB64));
+  buffer_manager->unpin_exclusive(page_id);
+  EXPECT_EQ(Frame::state(frame->state_and_version()), Frame::UNLOCKED);
+
+  buffer_manager->pin_shared(page_id);
+  buffer_manager->pin_shared(page_id);
+  EXPECT_EQ(Frame::state(frame->state_and_version()), 2);
+  buffer_manager->unpin_shared(page_id);
+  buffer_manager->unpin_shared(page_id);
+  EXPECT_EQ(Frame::state(frame->state_and_version()), Frame::UNLOCKED);
+
+  // Pinning a page that is not resident in shared mode loads it.
+  const auto other_page_id = PageID{PageSizeType::KiB16, 7};
+  buffer_manager->pin_shared(other_page_id);
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(other_page_id)->state_and_version()), 1);
+  buffer_manager->unpin_shared(other_page_id);
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used,
+            bytes_for_size_type(PageSizeType::KiB64) + bytes_for_size_type(PageSizeType::KiB16));
+
+  // Pages that have never been written are not read from disk.
+  EXPECT_EQ(buffer_manager->metrics().total_bytes_read_from_ssd, 0);
+}
+
+TEST_F(BufferManagerTest, FindPage) {
+  const auto page_id = PageID{PageSizeType::KiB32, 3};
+  const auto* data = buffer_manager->get_page(page_id);
+  EXPECT_EQ(buffer_manager->find_page(data), page_id);
+  EXPECT_EQ(buffer_manager->find_page(data + 100), page_id);
+
+  const auto value = 17;
+  EXPECT_EQ(buffer_manager->find_page(&value), INVALID_PAGE_ID);
+}
+
+TEST_F(BufferManagerTest, EvictAndReload) {
+  // Write more pages than the buffer pool can hold. Older pages have to be evicted and written to the SSD.
+  constexpr auto PAGE_COUNT = uint64_t{12};
+  for (auto index = uint64_t{0}; index < PAGE_COUNT; ++index) {
+    write_page(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte(index + 1));
+    EXPECT_LE(buffer_manager->metrics().current_bytes_used, buffer_manager->dram_buffer_pool_size());
+  }
+
+  const auto metrics_after_write = buffer_manager->metrics();
+  EXPECT_GE(metrics_after_write.total_evictions, PAGE_COUNT - 4);
+  EXPECT_EQ(metrics_after_write.total_bytes_evicted,
+            metrics_after_write.total_evictions * bytes_for_size_type(MAX_PAGE_SIZE_TYPE));
+  EXPECT_EQ(metrics_after_write.total_bytes_written_to_ssd, metrics_after_write.total_bytes_evicted);
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(PageID{MAX_PAGE_SIZE_TYPE, 0})->state_and_version()),
+            Frame::EVICTED);
+
+  // All pages must still contain their content, i.e., evicted pages are read back from the SSD.
+  for (auto index = uint64_t{0}; index < PAGE_COUNT; ++index) {
+    EXPECT_TRUE(page_contains(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte(index + 1)));
+  }
+  EXPECT_GT(buffer_manager->metrics().total_bytes_read_from_ssd, 0);
+
+  // Clean pages are evicted without writing them again.
+  const auto bytes_written = buffer_manager->metrics().total_bytes_written_to_ssd;
+  for (auto index = uint64_t{0}; index < PAGE_COUNT; ++index) {
+    EXPECT_TRUE(page_contains(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte(index + 1)));
+  }
+  EXPECT_EQ(buffer_manager->metrics().total_bytes_written_to_ssd, bytes_written);
+}
+
+TEST_F(BufferManagerTest, SecondChanceKeepsRecentlyUsedPages) {
+  const auto state = [&](const uint64_t index) {
+    return Frame::state(buffer_manager->get_frame(PageID{MAX_PAGE_SIZE_TYPE, index})->state_and_version());
+  };
+
+  // Fill the buffer pool with pages 0 to 3. Loading page 4 marks all pages and evicts page 0, which was enqueued first.
+  for (auto index = uint64_t{0}; index < 5; ++index) {
+    write_page(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte{1});
+  }
+  EXPECT_EQ(state(0), Frame::EVICTED);
+  EXPECT_EQ(state(1), Frame::MARKED);
+  EXPECT_EQ(state(2), Frame::MARKED);
+
+  // Accessing page 1 resets its MARKED state. Thus, it gets a second chance, and page 2 is evicted instead.
+  EXPECT_TRUE(page_contains(PageID{MAX_PAGE_SIZE_TYPE, 1}, std::byte{1}));
+  EXPECT_EQ(state(1), Frame::UNLOCKED);
+  write_page(PageID{MAX_PAGE_SIZE_TYPE, 5}, std::byte{1});
+  EXPECT_EQ(state(1), Frame::MARKED);
+  EXPECT_EQ(state(2), Frame::EVICTED);
+}
+
+TEST_F(BufferManagerTest, FailIfAllPagesArePinned) {
+  for (auto index = uint64_t{0}; index < 4; ++index) {
+    buffer_manager->pin_exclusive(PageID{MAX_PAGE_SIZE_TYPE, index});
+  }
+
+  EXPECT_THROW(buffer_manager->pin_exclusive(PageID{MAX_PAGE_SIZE_TYPE, 4}), std::logic_error);
+  EXPECT_THROW(buffer_manager->allocate_page(PageSizeType::KiB64), std::logic_error);
+
+  // The frames of the pages that could not be loaded or allocated are not left locked.
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(PageID{MAX_PAGE_SIZE_TYPE, 4})->state_and_version()),
+            Frame::EVICTED);
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(PageID{PageSizeType::KiB64, 0})->state_and_version()),
+            Frame::EVICTED);
+
+  for (auto index = uint64_t{0}; index < 4; ++index) {
+    buffer_manager->unpin_exclusive(PageID{MAX_PAGE_SIZE_TYPE, index});
+  }
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, 4 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE));
+
+  // Once pages are unpinned, the pages can be loaded and allocated.
+  write_page(PageID{MAX_PAGE_SIZE_TYPE, 4}, std::byte{1});
+  EXPECT_TRUE(page_contains(PageID{MAX_PAGE_SIZE_TYPE, 4}, std::byte{1}));
+  EXPECT_EQ(buffer_manager->allocate_page(PageSizeType::KiB64), PageID(PageSizeType::KiB64, 0));
+}
+
+TEST_F(BufferManagerTest, AllocateAndFreePages) {
+  const auto page_id = buffer_manager->allocate_page(MAX_PAGE_SIZE_TYPE);
+  EXPECT_EQ(page_id, PageID(MAX_PAGE_SIZE_TYPE, 0));
+  EXPECT_EQ(buffer_manager->allocate_page(MAX_PAGE_SIZE_TYPE), PageID(MAX_PAGE_SIZE_TYPE, 1));
+  EXPECT_TRUE(buffer_manager->get_frame(page_id)->is_dirty());
+  EXPECT_EQ(buffer_manager->metrics().current_bytes_used, 2 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE));
+
+  // Allocated pages are not evicted before they are made evictable.
+  for (auto index = uint64_t{10}; index < 20; ++index) {
+    write_page(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte{1});
+  }
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::UNLOCKED);
+
+  buffer_manager->make_evictable(page_id);
+  for (auto index = uint64_t{20}; index < 30; ++index) {
+    write_page(PageID{MAX_PAGE_SIZE_TYPE, index}, std::byte{1});
+  }
+  EXPECT_EQ(Frame::state(buffer_manager->get_frame(page_id)->state_and_version()), Frame::EVICTED);
+
+  // Freed pages are reused.
+  buffer_manager->free_page(page_id);
+  EXPECT_EQ(buffer_manager->allocate_page(MAX_PAGE_SIZE_TYPE), page_id);
+  EXPECT_EQ(buffer_manager->allocate_page(MAX_PAGE_SIZE_TYPE), PageID(MAX_PAGE_SIZE_TYPE, 2));
+}
+
+TEST_F(BufferManagerTest, ConcurrentPinning) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto PAGE_COUNT = uint64_t{32};
+  constexpr auto ITERATIONS = uint64_t{200};
+
+  for (auto index = uint64_t{0}; index < PAGE_COUNT; ++index) {
+    write_page(PageID{PageSizeType::MiB1, index}, std::byte(index));
+  }
+
+  auto errors = std::atomic<uint64_t>{0};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = uint64_t{0}; iteration < ITERATIONS; ++iteration) {
+        const auto index = (iteration * 7 + thread_id) % PAGE_COUNT;
+        if (!page_contains(PageID{PageSizeType::MiB1, index}, std::byte(index))) {
+          ++errors;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_GT(buffer_manager->metrics().total_evictions, 0);
+  EXPECT_LE(buffer_manager->metrics().current_bytes_used, buffer_manager->dram_buffer_pool_size());
+}
+
+}  // namespace hyrise
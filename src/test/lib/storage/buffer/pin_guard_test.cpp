@@ -0,0 +1,135 @@
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/buffer/buffer_manager.hpp"
+#include "storage/buffer/pin_guard.hpp"
+
+namespace hyrise {
+
+class PinGuardTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto config = BufferManager::Config{};
+    config.dram_buffer_pool_size = 4 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.reserved_virtual_memory_per_size_type = 64 * bytes_for_size_type(MAX_PAGE_SIZE_TYPE);
+    config.ssd_path = test_data_path + "pin_guard";
+    buffer_manager = std::make_unique<BufferManager>(config);
+
+    pages.buffer_manager = buffer_manager.get();
+    for (auto index = uint64_t{0}; index < 2; ++index) {
+      const auto page_id = buffer_manager->allocate_page(PageSizeType::KiB64);
+      buffer_manager->make_evictable(page_id);
+      pages.page_ids.push_back(page_id);
+    }
+  }
+
+  Frame::StateVersionType state(const PageID page_id) {
+    return Frame::state(buffer_manager->get_frame(page_id)->state_and_version());
+  }
+
+ protected:
+  std::unique_ptr<BufferManager> buffer_manager;
+  SegmentPages pages;
+};
+
+TEST_F(PinGuardTest, SharedPagePinGuard) {
+  {
+    const auto pin_guard = SharedPagePinGuard{pages};
+    EXPECT_EQ(state(pages.page_ids[0]), Frame::SINGLE_LOCKED_SHARED);
+    EXPECT_EQ(state(pages.page_ids[1]), Frame::SINGLE_LOCKED_SHARED);
+  }
+  EXPECT_EQ(state(pages.page_ids[0]), Frame::UNLOCKED);
+  EXPECT_EQ(state(pages.page_ids[1]), Frame::UNLOCKED);
+
+  // Guards for segments without pages do nothing.
+  const auto empty_pages = SegmentPages{};
+  const auto pin_guard = SharedPagePinGuard{empty_pages};
+}
+
+TEST_F(PinGuardTest, OptimisticReadDoesNotPin) {
+  const auto page_guard = OptimisticPageGuard{pages};
+  auto read_count = 0;
+  const auto result = page_guard.read([&]() {
+    ++read_count;
+    EXPECT_EQ(state(pages.page_ids[0]), Frame::UNLOCKED);
+    return 17;
+  });
+  EXPECT_EQ(result, 17);
+  EXPECT_EQ(read_count, 1);
+}
+
+TEST_F(PinGuardTest, OptimisticReadIsRepeatedAfterConcurrentModification) {
+  const auto page_guard = OptimisticPageGuard{pages};
+  auto read_count = 0;
+  const auto result = page_guard.read([&]() {
+    ++read_count;
+    if (read_count == 1) {
+      // Simulate a concurrent writer, which increments the page's version.
+      buffer_manager->pin_exclusive(pages.page_ids[1]);
+      buffer_manager->unpin_exclusive(pages.page_ids[1]);
+      return 1;
+    }
+    EXPECT_EQ(state(pages.page_ids[1]), Frame::SINGLE_LOCKED_SHARED);
+    return 2;
+  });
+  EXPECT_EQ(result, 2);
+  EXPECT_EQ(read_count, 2);
+  EXPECT_EQ(state(pages.page_ids[1]), Frame::UNLOCKED);
+}
+
+TEST_F(PinGuardTest, OptimisticReadLoadsEvictedPages) {
+  // Evict the pages by loading other pages.
+  for (auto index = uint64_t{0}; index < 8; ++index) {
+    const auto page_id = PageID{MAX_PAGE_SIZE_TYPE, index};
+    buffer_manager->pin_exclusive(page_id);
+    buffer_manager->unpin_exclusive(page_id);
+  }
+  ASSERT_EQ(state(pages.page_ids[0]), Frame::EVICTED);
+
+  const auto page_guard = OptimisticPageGuard{pages};
+  auto read_count = 0;
+  page_guard.read([&]() {
+    ++read_count;
+    return 0;
+  });
+  EXPECT_EQ(read_count, 1);
+  EXPECT_NE(state(pages.page_ids[0]), Frame::EVICTED);
+}
+
+TEST_F(PinGuardTest, OptimisticReadForwardsExceptions) {
+  const auto page_guard = OptimisticPageGuard{pages};
+  const auto failing_read = []() -> int {
+    throw std::logic_error("Invalid read");
+  };
+  EXPECT_THROW(page_guard.read(failing_read), std::logic_error);
+  EXPECT_EQ(state(pages.page_ids[0]), Frame::UNLOCKED);
+}
+
+TEST_F(PinGuardTest, PinnedForLifetimeIfOptimisticReadsAreNotAllowed) {
+  {
+    const auto page_guard = OptimisticPageGuard{pages, false};
+    EXPECT_EQ(state(pages.page_ids[0]), Frame::SINGLE_LOCKED_SHARED);
+    page_guard.read([&]() {
+      EXPECT_EQ(state(pages.page_ids[0]), Frame::SINGLE_LOCKED_SHARED);
+      return 0;
+    });
+  }
+  EXPECT_EQ(state(pages.page_ids[0]), Frame::UNLOCKED);
+}
+
+TEST_F(PinGuardTest, PinnedForLifetimeIfSegmentSpansManyPages) {
+  auto many_pages = SegmentPages{buffer_manager.get(), {}};
+  for (auto index = uint64_t{0}; index <= OptimisticPageGuard::MAX_OPTIMISTIC_PAGE_COUNT; ++index) {
+    many_pages.page_ids.push_back(buffer_manager->allocate_page(MIN_PAGE_SIZE_TYPE));
+  }
+
+  {
+    const auto page_guard = OptimisticPageGuard{many_pages};
+    EXPECT_EQ(state(many_pages.page_ids[0]), Frame::SINGLE_LOCKED_SHARED);
+  }
+  EXPECT_EQ(state(many_pages.page_ids[0]), Frame::UNLOCKED);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,64 @@
+#include "base_test.hpp"
+#include "storage/buffer/volatile_region.hpp"
+
+namespace hyrise {
+
+class VolatileRegionTest : public BaseTest {
+ protected:
+  // 16 pages of the smallest size type.
+  VolatileRegion region{MIN_PAGE_SIZE_TYPE, 16 * bytes_for_size_type(MIN_PAGE_SIZE_TYPE)};
+};
+
+TEST_F(VolatileRegionTest, TestPageCount) {
+  EXPECT_EQ(region.size_type(), MIN_PAGE_SIZE_TYPE);
+  EXPECT_EQ(region.page_count(), 16);
+
+  // Reserved memory that does not fill a whole page is not used.
+  const auto other_region = VolatileRegion{MAX_PAGE_SIZE_TYPE, bytes_for_size_type(MAX_PAGE_SIZE_TYPE) * 3 / 2};
+  EXPECT_EQ(other_region.page_count(), 1);
+}
+
+TEST_F(VolatileRegionTest, TestGetPageAndFindPage) {
+  const auto page_size = bytes_for_size_type(MIN_PAGE_SIZE_TYPE);
+  const auto first_page = region.get_page(PageID{MIN_PAGE_SIZE_TYPE, 0});
+  const auto last_page = region.get_page(PageID{MIN_PAGE_SIZE_TYPE, 15});
+  EXPECT_EQ(last_page - first_page, 15 * page_size);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(first_page) % OS_PAGE_SIZE, 0);
+
+  EXPECT_EQ(region.find_page(first_page), PageID(MIN_PAGE_SIZE_TYPE, 0));
+  EXPECT_EQ(region.find_page(first_page + page_size - 1), PageID(MIN_PAGE_SIZE_TYPE, 0));
+  EXPECT_EQ(region.find_page(first_page + page_size), PageID(MIN_PAGE_SIZE_TYPE, 1));
+  EXPECT_EQ(region.find_page(last_page + page_size - 1), PageID(MIN_PAGE_SIZE_TYPE, 15));
+  EXPECT_EQ(region.find_page(last_page + page_size), INVALID_PAGE_ID);
+  EXPECT_EQ(region.find_page(first_page - 1), INVALID_PAGE_ID);
+
+  const auto value = 17;
+  EXPECT_EQ(region.find_page(&value), INVALID_PAGE_ID);
+}
+
+TEST_F(VolatileRegionTest, TestFramesAreInitiallyEvicted) {
+  for (auto index = uint64_t{0}; index < region.page_count(); ++index) {
+    const auto* frame = region.get_frame(PageID{MIN_PAGE_SIZE_TYPE, index});
+    EXPECT_EQ(Frame::state(frame->state_and_version()), Frame::EVICTED);
+  }
+  EXPECT_NE(region.get_frame(PageID{MIN_PAGE_SIZE_TYPE, 0}), region.get_frame(PageID{MIN_PAGE_SIZE_TYPE, 1}));
+}
+
+TEST_F(VolatileRegionTest, TestFreeReleasesMemory) {
+  const auto page_id = PageID{MIN_PAGE_SIZE_TYPE, 3};
+  auto* frame = region.get_frame(page_id);
+  auto* page = region.get_page(page_id);
+
+  page[0] = std::byte{42};
+  page[bytes_for_size_type(MIN_PAGE_SIZE_TYPE) - 1] = std::byte{13};
+
+  ASSERT_TRUE(frame->try_lock_exclusive(frame->state_and_version()));
+  region.free(page_id);
+  frame->unlock_exclusive_and_set_evicted();
+
+  // After releasing the memory, anonymous pages read as zeros.
+  EXPECT_EQ(page[0], std::byte{0});
+  EXPECT_EQ(page[bytes_for_size_type(MIN_PAGE_SIZE_TYPE) - 1], std::byte{0});
+}
+
+}  // namespace hyrise
@@ -202,6 +202,18 @@ TEST_F(StorageChunkTest, GetIndexesBySegmentPointers) {
             indexes_for_segment_1.cend());
 }
 
+TEST_F(StorageChunkTest, IsIndexed) {
+  chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+  EXPECT_FALSE(chunk->is_indexed(ColumnID{0}));
+  EXPECT_FALSE(chunk->is_indexed(ColumnID{1}));
+
+  // The multi-column index also covers its second column.
+  chunk->create_index<CompositeGroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{ds_int, ds_str});
+  EXPECT_TRUE(chunk->is_indexed(ColumnID{0}));
+  EXPECT_TRUE(chunk->is_indexed(ColumnID{1}));
+  EXPECT_TRUE(chunk->get_indexes(std::vector<ColumnID>{ColumnID{1}}).empty());
+}
+
 TEST_F(StorageChunkTest, RemoveIndex) {
   chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
   const auto index_int =
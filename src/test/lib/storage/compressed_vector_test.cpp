@@ -1,10 +1,15 @@
 #include <bitset>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/vector_compression/compressed_vector_scan.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "types.hpp"
 
@@ -73,7 +78,8 @@ class CompressedVectorTest : public BaseTestWithParam<VectorCompressionType> {
 };
 
 INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, CompressedVectorTest,
-                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking),
+                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking,
+                                           VectorCompressionType::SimdBp128),
                          enum_formatter<VectorCompressionType>);
 
 TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIterators) {
@@ -122,4 +128,80 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+TEST_P(CompressedVectorTest, DecompressBlocks) {
+  // The maximum values lead to different bit widths (BitPacking) and integer types (FixedWidthInteger).
+  for (const auto max_value : {uint32_t{1}, uint32_t{200}, uint32_t{40'000}, uint32_t{3'000'000'000}}) {
+    auto sequence = pmr_vector<uint32_t>(1'031);
+    for (auto index = size_t{0}; index < sequence.size(); ++index) {
+      sequence[index] = static_cast<uint32_t>((index * 7'919) % (uint64_t{max_value} + 1));
+    }
+    const auto encoded_sequence = compress_vector(sequence, GetParam(), {}, {max_value});
+
+    // Blocks of all sizes and alignments, including the tail of the vector.
+    for (const auto& [begin, count] : {std::pair{size_t{0}, size_t{1'031}}, std::pair{size_t{3}, size_t{64}},
+                                       std::pair{size_t{1'000}, size_t{31}}, std::pair{size_t{17}, size_t{0}}}) {
+      auto block = std::vector<uint32_t>(count);
+      decompress_block(*encoded_sequence, begin, count, block.data());
+      for (auto index = size_t{0}; index < count; ++index) {
+        EXPECT_EQ(block[index], sequence[begin + index]);
+      }
+    }
+  }
+}
+
+TEST_P(CompressedVectorTest, ScanRangeToBitmap) {
+  const auto sequence = this->generate_sequence(4'201, 8u);
+  const auto encoded_sequence = this->encode(sequence);
+
+  for (const auto& [lower_bound, upper_bound] :
+       {std::pair{uint32_t{0}, uint32_t{2'000}}, std::pair{uint32_t{1'024}, uint32_t{1'025}},
+        std::pair{uint32_t{5'000}, uint32_t{30'000}}, std::pair{uint32_t{30'000}, uint32_t{5'000}},
+        std::pair{uint32_t{0}, std::numeric_limits<uint32_t>::max()}}) {
+    auto bitmap = std::vector<uint64_t>{};
+    scan_range_to_bitmap(*encoded_sequence, lower_bound, upper_bound, bitmap);
+    ASSERT_EQ(bitmap.size(), (sequence.size() + 63) / 64);
+    for (auto index = size_t{0}; index < sequence.size(); ++index) {
+      const auto expected = sequence[index] >= lower_bound && sequence[index] < upper_bound;
+      EXPECT_EQ(static_cast<bool>((bitmap[index / 64] >> (index % 64)) & 1), expected);
+    }
+    // Bits beyond the last value are cleared.
+    EXPECT_EQ(bitmap.back() >> (sequence.size() % 64), uint64_t{0});
+  }
+}
+
+TEST_F(CompressedVectorTest, SimdBp128PatchesOutliers) {
+  // Mostly small values with a few outliers per block, which BitPacking has to store with 32 bits each.
+  auto sequence = pmr_vector<uint32_t>(1'000);
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    sequence[index] = index % 61 == 0 ? std::numeric_limits<uint32_t>::max() - static_cast<uint32_t>(index)
+                                      : static_cast<uint32_t>(index % 7);
+  }
+  const auto max_value = std::numeric_limits<uint32_t>::max();
+  const auto encoded_sequence = compress_vector(sequence, VectorCompressionType::SimdBp128, {}, {max_value});
+  ASSERT_EQ(encoded_sequence->type(), CompressedVectorType::SimdBp128);
+
+  const auto& simd_bp128_vector = dynamic_cast<const SimdBp128Vector&>(*encoded_sequence);
+  EXPECT_EQ(simd_bp128_vector.block_count(), 8);
+  EXPECT_EQ(simd_bp128_vector.exception_values().size(), 17);
+  for (auto block_index = size_t{0}; block_index < simd_bp128_vector.block_count(); ++block_index) {
+    EXPECT_EQ(simd_bp128_vector.block_bit_width(block_index), 3);
+  }
+
+  auto decompressor = encoded_sequence->create_base_decompressor();
+  auto iterator_values = pmr_vector<uint32_t>{};
+  resolve_compressed_vector_type(*encoded_sequence, [&](const auto& vector) {
+    iterator_values.assign(vector.cbegin(), vector.cend());
+  });
+  auto decoded_values = std::vector<uint32_t>(sequence.size());
+  simd_bp128_vector.decode(0, sequence.size(), decoded_values.data());
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    EXPECT_EQ(decompressor->get(index), sequence[index]);
+    EXPECT_EQ(iterator_values[index], sequence[index]);
+    EXPECT_EQ(decoded_values[index], sequence[index]);
+  }
+
+  const auto bitpacking_sequence = compress_vector(sequence, VectorCompressionType::BitPacking, {}, {max_value});
+  EXPECT_LT(encoded_sequence->data_size(), bitpacking_sequence->data_size() / 4);
+}
+
 }  // namespace hyrise
@@ -1,4 +1,6 @@
 #include <cctype>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <sstream>
 
@@ -717,4 +719,104 @@ TEST_F(EncodedSegmentTest, FrameOfReference) {
   EXPECT_FALSE(for_segment_no_nulls->null_values());
 }
 
+// Values of 64-bit segments whose offset to the block's frame does not fit into 32 bits are stored as exceptions. The
+// frame is chosen so that most values fit.
+TEST_F(EncodedSegmentTest, FrameOfReferenceInt64Exceptions) {
+  auto values = pmr_vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 98; ++value) {
+    values.push_back(value);
+  }
+  values.push_back(int64_t{1'000'000'000'000'000});
+  values.push_back(int64_t{-1'000'000'000'000'000});
+
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(std::move(values));
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+
+  EXPECT_EQ(for_segment->block_minima(), (pmr_vector<int64_t>{0}));
+  EXPECT_TRUE(for_segment->block_steps().empty());
+  EXPECT_EQ(for_segment->exception_positions(), (pmr_vector<ChunkOffset>{ChunkOffset{98}, ChunkOffset{99}}));
+  EXPECT_EQ(for_segment->exception_values(),
+            (pmr_vector<int64_t>{1'000'000'000'000'000, -1'000'000'000'000'000}));
+  EXPECT_SEGMENT_EQ_ORDERED(value_segment, encoded_segment);
+}
+
+// Sorted blocks (e.g., timestamps) use a linear frame whose step is the smallest difference between neighboring values.
+TEST_F(EncodedSegmentTest, FrameOfReferenceLinearFrames) {
+  constexpr auto row_count = int64_t{3'000};
+  auto values = pmr_vector<int64_t>(row_count);
+  auto null_values = pmr_vector<bool>(row_count);
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    values[index] = int64_t{1'600'000'000'000} + index * 1'000 + index % 3;
+  }
+  null_values[1] = true;
+  null_values[2'500] = true;
+
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(std::move(values), std::move(null_values));
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+
+  EXPECT_EQ(for_segment->block_minima().size(), 2);
+  EXPECT_EQ(for_segment->block_steps(), (pmr_vector<int64_t>{998, 998}));
+  EXPECT_TRUE(for_segment->exception_positions().empty());
+  EXPECT_EQ(for_segment->compressed_vector_type(), CompressedVectorType::FixedWidthInteger2Byte);
+  EXPECT_SEGMENT_EQ_ORDERED(value_segment, encoded_segment);
+}
+
+// Floating-point values are encoded as decimals with a common exponent. NaN, -0.0, and values with too many digits are
+// stored as exceptions.
+TEST_F(EncodedSegmentTest, FrameOfReferenceDecimals) {
+  constexpr auto row_count = int32_t{100};
+  auto values = pmr_vector<double>(row_count);
+  for (auto index = int32_t{0}; index < row_count; ++index) {
+    values[index] = index * 0.25;
+  }
+  values[5] = std::numeric_limits<double>::quiet_NaN();
+  values[6] = -0.0;
+  values[7] = 1.0 / 3.0;
+
+  const auto value_segment = std::make_shared<ValueSegment<double>>(std::move(values));
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Double, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<double>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+
+  EXPECT_EQ(for_segment->decimal_exponent(), 2);
+  EXPECT_EQ(for_segment->exception_positions(),
+            (pmr_vector<ChunkOffset>{ChunkOffset{5}, ChunkOffset{6}, ChunkOffset{7}}));
+
+  for (auto index = ChunkOffset::base_type{0}; index < row_count; ++index) {
+    const auto value = for_segment->get_typed_value(ChunkOffset{index});
+    ASSERT_TRUE(value);
+    if (index == 5) {
+      EXPECT_TRUE(std::isnan(*value));
+    } else if (index == 6) {
+      EXPECT_EQ(*value, 0.0);
+      EXPECT_TRUE(std::signbit(*value));
+    } else if (index == 7) {
+      EXPECT_EQ(*value, 1.0 / 3.0);
+    } else {
+      EXPECT_EQ(*value, index * 0.25);
+    }
+  }
+
+  // Floats with a single decimal digit do not need exceptions.
+  auto float_values = pmr_vector<float>(3'000);
+  for (auto index = size_t{0}; index < float_values.size(); ++index) {
+    float_values[index] = static_cast<float>(index) / 10.0f;
+  }
+  const auto float_value_segment = std::make_shared<ValueSegment<float>>(std::move(float_values));
+  const auto encoded_float_segment = this->_encode_segment(float_value_segment, DataType::Float,
+                                                           SegmentEncodingSpec{EncodingType::FrameOfReference});
+  const auto float_for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<float>>(encoded_float_segment);
+  ASSERT_TRUE(float_for_segment);
+  EXPECT_EQ(float_for_segment->decimal_exponent(), 1);
+  EXPECT_TRUE(float_for_segment->exception_positions().empty());
+  EXPECT_SEGMENT_EQ_ORDERED(float_value_segment, encoded_float_segment);
+}
+
 }  // namespace hyrise
@@ -0,0 +1,123 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class FSSTSymbolTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = size_t{0}; index < 500; ++index) {
+      strings.push_back("2024-01-0" + std::to_string(index % 9 + 1) + " INFO [worker-" + std::to_string(index % 7) +
+                        "] request " + std::to_string(index * 7919) + " handled in " + std::to_string(index % 97) +
+                        " ms");
+    }
+    string_views = std::vector<std::string_view>(strings.cbegin(), strings.cend());
+    symbol_table = FSSTSymbolTable::build(string_views);
+  }
+
+  std::vector<std::string> strings;
+  std::vector<std::string_view> string_views;
+  FSSTSymbolTable symbol_table;
+};
+
+TEST_F(FSSTSymbolTableTest, EmptyTableEscapesAllBytes) {
+  const auto empty_table = FSSTSymbolTable{};
+  EXPECT_EQ(empty_table.symbol_count(), 0);
+
+  auto compressed = std::string{};
+  empty_table.compress("abc", compressed);
+  EXPECT_EQ(compressed.size(), 6);
+  EXPECT_EQ(static_cast<uint8_t>(compressed[0]), FSSTSymbolTable::ESCAPE_CODE);
+  EXPECT_EQ(compressed[1], 'a');
+
+  auto decompressed = pmr_string{};
+  empty_table.decompress(compressed.data(), compressed.data() + compressed.size(), decompressed);
+  EXPECT_EQ(decompressed, "abc");
+}
+
+TEST_F(FSSTSymbolTableTest, BuildFindsFrequentSubstrings) {
+  EXPECT_GT(symbol_table.symbol_count(), 0);
+  EXPECT_LE(symbol_table.symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  auto compressed_size = size_t{0};
+  auto uncompressed_size = size_t{0};
+  for (const auto& string : strings) {
+    auto compressed = std::string{};
+    symbol_table.compress(string, compressed);
+    compressed_size += compressed.size();
+    uncompressed_size += string.size();
+  }
+  EXPECT_LT(compressed_size * 3, uncompressed_size);
+}
+
+TEST_F(FSSTSymbolTableTest, BuildFromEmptyStrings) {
+  const auto empty_strings = std::vector<std::string_view>{"", ""};
+  const auto table = FSSTSymbolTable::build(empty_strings);
+  EXPECT_EQ(table.symbol_count(), 0);
+}
+
+TEST_F(FSSTSymbolTableTest, CompressAndDecompress) {
+  for (const auto string : {std::string_view{strings[0]}, std::string_view{strings[42]}, std::string_view{""},
+                            std::string_view{"bytes \xff\x01 not in the sample"}}) {
+    auto compressed = std::string{};
+    symbol_table.compress(string, compressed);
+    auto decompressed = pmr_string{};
+    symbol_table.decompress(compressed.data(), compressed.data() + compressed.size(), decompressed);
+    EXPECT_EQ(decompressed, string);
+  }
+}
+
+TEST_F(FSSTSymbolTableTest, RecreateFromSymbols) {
+  const auto recreated_table = FSSTSymbolTable{symbol_table.symbols()};
+  ASSERT_EQ(recreated_table.symbol_count(), symbol_table.symbol_count());
+  for (auto code = size_t{0}; code < symbol_table.symbol_count(); ++code) {
+    EXPECT_EQ(recreated_table.symbol(static_cast<uint8_t>(code)), symbol_table.symbol(static_cast<uint8_t>(code)));
+  }
+
+  auto compressed = std::string{};
+  auto recreated_compressed = std::string{};
+  symbol_table.compress(strings[3], compressed);
+  recreated_table.compress(strings[3], recreated_compressed);
+  EXPECT_EQ(compressed, recreated_compressed);
+}
+
+TEST_F(FSSTSymbolTableTest, CompressPrefix) {
+  const auto& string = strings[10];
+  auto compressed_string = std::string{};
+  symbol_table.compress(string, compressed_string);
+
+  for (const auto prefix_length : {size_t{0}, size_t{3}, size_t{8}, size_t{15}, size_t{27}, string.size()}) {
+    const auto prefix = std::string_view{string}.substr(0, prefix_length);
+    auto compressed_prefix = std::string{};
+    const auto compressed_length = symbol_table.compress_prefix(prefix, compressed_prefix);
+
+    EXPECT_LE(compressed_length, prefix_length);
+    EXPECT_LT(prefix_length - compressed_length, FSSTSymbolTable::MAX_SYMBOL_LENGTH);
+    EXPECT_EQ(std::string_view{compressed_string}.substr(0, compressed_prefix.size()), compressed_prefix);
+
+    const auto* const remainder_begin = compressed_string.data() + compressed_prefix.size();
+    const auto* const remainder_end = compressed_string.data() + compressed_string.size();
+    const auto prefix_remainder = prefix.substr(compressed_length);
+    EXPECT_TRUE(symbol_table.decompresses_with_prefix(remainder_begin, remainder_end, prefix_remainder));
+  }
+}
+
+TEST_F(FSSTSymbolTableTest, DecompressesWithPrefix) {
+  auto compressed = std::string{};
+  symbol_table.compress("2024-01-03 INFO", compressed);
+  const auto* const begin = compressed.data();
+  const auto* const end = compressed.data() + compressed.size();
+
+  EXPECT_TRUE(symbol_table.decompresses_with_prefix(begin, end, ""));
+  EXPECT_TRUE(symbol_table.decompresses_with_prefix(begin, end, "2024-01-03"));
+  EXPECT_TRUE(symbol_table.decompresses_with_prefix(begin, end, "2024-01-03 INFO"));
+  EXPECT_FALSE(symbol_table.decompresses_with_prefix(begin, end, "2024-01-04"));
+  EXPECT_FALSE(symbol_table.decompresses_with_prefix(begin, end, "2024-01-03 INFO "));
+}
+
+}  // namespace hyrise
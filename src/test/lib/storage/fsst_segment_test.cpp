@@ -0,0 +1,127 @@
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = size_t{0}; index < 2'000; ++index) {
+      if (index % 101 == 7) {
+        vs_str->append(NULL_VALUE);
+        continue;
+      }
+      vs_str->append(pmr_string{"2024-03-1" + std::to_string(index % 10) + " WARN [service-" +
+                                std::to_string(index % 5) + "] connection " + std::to_string(index * 104'729) +
+                                " closed by peer"});
+    }
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+TEST_F(StorageFSSTSegmentTest, CompressAndDecompress) {
+  const auto segment = ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+  const auto fsst_segment = std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(segment);
+  ASSERT_TRUE(fsst_segment);
+
+  EXPECT_EQ(fsst_segment->encoding_type(), EncodingType::FSST);
+  ASSERT_EQ(fsst_segment->size(), vs_str->size());
+  ASSERT_TRUE(fsst_segment->null_values());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vs_str->size(); ++chunk_offset) {
+    EXPECT_EQ((*fsst_segment)[chunk_offset], (*vs_str)[chunk_offset]);
+    EXPECT_EQ(fsst_segment->get_typed_value(chunk_offset), vs_str->get_typed_value(chunk_offset));
+  }
+
+  auto chunk_offset = ChunkOffset{0};
+  create_iterable_from_segment(*fsst_segment).for_each([&](const auto& position) {
+    EXPECT_EQ(position.is_null(), vs_str->is_null(chunk_offset));
+    if (!position.is_null()) {
+      EXPECT_EQ(position.value(), vs_str->values()[chunk_offset]);
+    }
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, vs_str->size());
+}
+
+TEST_F(StorageFSSTSegmentTest, NoNullValues) {
+  const auto segment = std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"a", "", "abc"});
+  const auto encoded_segment =
+      ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+  const auto fsst_segment = std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  ASSERT_TRUE(fsst_segment);
+
+  EXPECT_FALSE(fsst_segment->null_values());
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), pmr_string{});
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{2}), pmr_string{"abc"});
+}
+
+TEST_F(StorageFSSTSegmentTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<pmr_string>>(true);
+  const auto encoded_segment =
+      ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+  const auto fsst_segment = std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_EQ(fsst_segment->size(), 0);
+}
+
+TEST_F(StorageFSSTSegmentTest, MemoryUsage) {
+  const auto fsst_segment =
+      ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+  const auto dictionary_segment =
+      ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto fsst_dictionary_segment =
+      ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::FSSTDictionary});
+
+  // The log lines are (almost) unique, so that dictionary encoding does not reduce their size.
+  const auto dictionary_size = dictionary_segment->memory_usage(MemoryUsageCalculationMode::Full);
+  EXPECT_LT(fsst_segment->memory_usage(MemoryUsageCalculationMode::Full) * 3, dictionary_size);
+  EXPECT_LT(fsst_dictionary_segment->memory_usage(MemoryUsageCalculationMode::Full) * 2, dictionary_size);
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingMemoryResource) {
+  const auto segment = ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+  auto& memory_resource = *std::pmr::get_default_resource();
+  const auto copy = segment->copy_using_memory_resource(memory_resource);
+  ASSERT_EQ(copy->size(), segment->size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); chunk_offset += 97) {
+    EXPECT_EQ((*copy)[chunk_offset], (*segment)[chunk_offset]);
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, FSSTDictionarySegment) {
+  const auto segment =
+      ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::FSSTDictionary});
+  const auto dictionary_segment = std::dynamic_pointer_cast<FSSTDictionarySegment<pmr_string>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+
+  EXPECT_EQ(dictionary_segment->encoding_type(), EncodingType::FSSTDictionary);
+  const auto& dictionary = *dictionary_segment->fsst_dictionary();
+  EXPECT_EQ(dictionary_segment->unique_values_count(), dictionary.size());
+  for (auto index = size_t{1}; index < dictionary.size(); ++index) {
+    EXPECT_LT(dictionary.get_string_at(index - 1), dictionary.get_string_at(index));
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vs_str->size(); ++chunk_offset) {
+    EXPECT_EQ((*dictionary_segment)[chunk_offset], (*vs_str)[chunk_offset]);
+  }
+
+  const auto search_value = vs_str->values()[42];
+  const auto value_id = dictionary_segment->lower_bound(search_value);
+  ASSERT_NE(value_id, INVALID_VALUE_ID);
+  EXPECT_EQ(dictionary_segment->value_of_value_id(value_id), AllTypeVariant{search_value});
+  EXPECT_EQ(dictionary_segment->upper_bound(search_value), ValueID{value_id + 1});
+}
+
+}  // namespace hyrise
@@ -0,0 +1,61 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "resolve_type.hpp"
+#include "storage/pos_lists/chunk_offset_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class ChunkOffsetPosListTest : public BaseTest {};
+
+TEST_F(ChunkOffsetPosListTest, Positions) {
+  const auto pos_list = ChunkOffsetPosList{ChunkID{3}, ChunkOffsetPosList::Vector{ChunkOffset{1}, ChunkOffset{4}}};
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.size(), 2);
+  EXPECT_FALSE(pos_list.empty());
+  EXPECT_EQ(pos_list[1], (RowID{ChunkID{3}, ChunkOffset{4}}));
+  EXPECT_EQ(pos_list.begin().distance_to(pos_list.end()), 2);
+  EXPECT_EQ(pos_list, (RowIDPosList{RowID{ChunkID{3}, ChunkOffset{1}}, RowID{ChunkID{3}, ChunkOffset{4}}}));
+
+  // Each position needs half of the memory of a RowID.
+  EXPECT_EQ(pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            sizeof(ChunkOffsetPosList) + 2 * sizeof(ChunkOffset));
+
+  auto empty_pos_list = ChunkOffsetPosList{ChunkID{0}};
+  EXPECT_TRUE(empty_pos_list.empty());
+  empty_pos_list.emplace_back(ChunkOffset{2});
+  EXPECT_EQ(empty_pos_list.chunk_offsets(), ChunkOffsetPosList::Vector{ChunkOffset{2}});
+}
+
+TEST_F(ChunkOffsetPosListTest, ResolvePosListType) {
+  const auto pos_list = std::make_shared<const ChunkOffsetPosList>(ChunkID{0});
+  resolve_pos_list_type(pos_list, [&](const auto& resolved_pos_list) {
+    EXPECT_EQ(resolved_pos_list, pos_list);
+  });
+}
+
+TEST_F(ChunkOffsetPosListTest, IterateReferenceSegment) {
+  const auto table = Table::create_dummy_table({{"a", DataType::Int, false}});
+  table->append({int32_t{1}});
+  table->append({int32_t{2}});
+  table->append({int32_t{3}});
+
+  const auto pos_list = std::make_shared<const ChunkOffsetPosList>(
+      ChunkID{0}, ChunkOffsetPosList::Vector{ChunkOffset{2}, ChunkOffset{0}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_EQ(reference_segment[ChunkOffset{0}], AllTypeVariant{3});
+
+  auto values = std::vector<int32_t>{};
+  segment_iterate<int32_t>(reference_segment, [&](const auto& position) {
+    values.emplace_back(position.value());
+  });
+  EXPECT_EQ(values, (std::vector<int32_t>{3, 1}));
+}
+
+}  // namespace hyrise
@@ -106,6 +106,36 @@ TEST_F(StorageManagerTest, DropTable) {
   EXPECT_TRUE(sm.has_table("first_table"));
 }
 
+TEST_F(StorageManagerTest, GetTableName) {
+  auto& sm = Hyrise::get().storage_manager;
+  const auto table = sm.get_table("first_table");
+  EXPECT_EQ(sm.get_table_name(table), "first_table");
+  EXPECT_THROW(sm.get_table_name(std::make_shared<Table>(TableColumnDefinitions{}, TableType::Data)),
+               std::logic_error);
+
+  sm.drop_table("first_table");
+  EXPECT_THROW(sm.get_table_name(table), std::logic_error);
+
+  sm.add_table("third_table", table);
+  EXPECT_EQ(sm.get_table_name(table), "third_table");
+}
+
+TEST_F(StorageManagerTest, GetTableNameAfterReAddingTable) {
+  auto& sm = Hyrise::get().storage_manager;
+  const auto dropped_table = sm.get_table("first_table");
+  sm.drop_table("first_table");
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{}, TableType::Data);
+  sm.add_table("first_table", table);
+  EXPECT_EQ(sm.get_table_name(table), "first_table");
+  EXPECT_THROW(sm.get_table_name(dropped_table), std::logic_error);
+
+  sm.drop_table("first_table");
+  EXPECT_THROW(sm.get_table_name(table), std::logic_error);
+  sm.add_table("first_table", dropped_table);
+  EXPECT_EQ(sm.get_table_name(dropped_table), "first_table");
+}
+
 TEST_F(StorageManagerTest, DoesNotHaveTable) {
   auto& sm = Hyrise::get().storage_manager;
   EXPECT_FALSE(sm.has_table("third_table"));
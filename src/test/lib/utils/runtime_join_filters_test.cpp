@@ -0,0 +1,127 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/runtime_join_filters.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class RuntimeJoinFiltersTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Column a holds 9, 10, 11, 9 in four dictionary-encoded chunks.
+    const auto table = load_table("resources/test_data/tbl/int_int_float.tbl", ChunkOffset{1});
+    ChunkEncoder::encode_all_chunks(table);
+    Hyrise::get().storage_manager.add_table("int_int_float", table);
+
+    const auto keys = std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, false}}, TableType::Data,
+                                              ChunkOffset{10}, UseMvcc::Yes);
+    keys->append({10});
+    keys->append({12});
+    Hyrise::get().storage_manager.add_table("keys", keys);
+
+    _stored_table_node = StoredTableNode::make("int_int_float");
+    _keys_node = StoredTableNode::make("keys");
+    _a = _stored_table_node->get_column("a");
+    _x = _keys_node->get_column("x");
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractOperator>& pqp) {
+    const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    return root_operator_task->get_operator()->get_output();
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node, _keys_node;
+  std::shared_ptr<LQPColumnExpression> _a, _x;
+};
+
+TEST_F(RuntimeJoinFiltersTest, SemiJoinFiltersLeftInput) {
+  const auto lqp = JoinNode::make(JoinMode::Semi, equals_(_a, _x), PredicateNode::make(greater_than_(_a, 0),
+                                                                                       _stored_table_node),
+                                  _keys_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::JoinHash);
+  const auto table_scan = pqp->left_input();
+  ASSERT_EQ(table_scan->type(), OperatorType::TableScan);
+  const auto get_table = std::static_pointer_cast<const GetTable>(table_scan->left_input());
+
+  const auto& runtime_join_filters = get_table->runtime_join_filters();
+  ASSERT_EQ(runtime_join_filters.size(), 1);
+  EXPECT_EQ(runtime_join_filters.front().source.lock(), pqp->right_input());
+  EXPECT_EQ(runtime_join_filters.front().source_column_id, ColumnID{0});
+  EXPECT_EQ(runtime_join_filters.front().column_id, ColumnID{0});
+
+  // The chunks with 9 are pruned by the MinMaxFilter, the chunk with 11 by the dictionary check.
+  const auto result = _execute(pqp);
+  EXPECT_EQ(result->row_count(), 1);
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1);
+  EXPECT_EQ(get_table->get_output()->get_value<int32_t>(ColumnID{0}, 0), 10);
+}
+
+TEST_F(RuntimeJoinFiltersTest, InnerJoinFiltersLargerInput) {
+  const auto lqp = JoinNode::make(JoinMode::Inner, equals_(_x, _a), _keys_node, _stored_table_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::JoinHash);
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(pqp->left_input())->runtime_join_filters().empty());
+
+  const auto get_table = std::static_pointer_cast<const GetTable>(pqp->right_input());
+  const auto& runtime_join_filters = get_table->runtime_join_filters();
+  ASSERT_EQ(runtime_join_filters.size(), 1);
+  EXPECT_EQ(runtime_join_filters.front().source.lock(), pqp->left_input());
+
+  const auto result = _execute(pqp);
+  EXPECT_EQ(result->row_count(), 1);
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1);
+}
+
+TEST_F(RuntimeJoinFiltersTest, NoFilterForOuterJoins) {
+  const auto lqp = JoinNode::make(JoinMode::Left, equals_(_a, _x), _stored_table_node, _keys_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::JoinHash);
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(pqp->left_input())->runtime_join_filters().empty());
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(pqp->right_input())->runtime_join_filters().empty());
+}
+
+TEST_F(RuntimeJoinFiltersTest, NoFilterForSharedInputs) {
+  // The GetTable operator is consumed by both join inputs. Pruning its chunks would drop rows of the source as well.
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->lqp_node = _stored_table_node;
+  const auto predicate_node = PredicateNode::make(less_than_(_a, 10), _stored_table_node);
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table, less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 10));
+  table_scan->lqp_node = predicate_node;
+  const auto join = std::make_shared<JoinHash>(
+      get_table, table_scan, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+
+  add_runtime_join_filters(join);
+  EXPECT_TRUE(get_table->runtime_join_filters().empty());
+}
+
+TEST_F(RuntimeJoinFiltersTest, DeepCopy) {
+  const auto lqp = JoinNode::make(JoinMode::Semi, equals_(_a, _x), _stored_table_node, _keys_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto copy = pqp->deep_copy();
+
+  const auto& runtime_join_filters =
+      std::static_pointer_cast<const GetTable>(copy->left_input())->runtime_join_filters();
+  ASSERT_EQ(runtime_join_filters.size(), 1);
+  EXPECT_EQ(runtime_join_filters.front().source.lock(), copy->right_input());
+  EXPECT_EQ(_execute(copy)->row_count(), 1);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,174 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../plugins/encoding_advisor_plugin.hpp"
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // The first chunk is set immutable when the rows of the second chunk are appended.
+    const auto column_definitions =
+        TableColumnDefinitions{{"run_values", DataType::Int, false}, {"log_lines", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size);
+    for (auto row_id = int32_t{0}; row_id < static_cast<int32_t>(_chunk_size) + 10; ++row_id) {
+      _table->append({row_id / 100, pmr_string{"GET /index.html?id=" + std::to_string(row_id) + " HTTP/1.1 200"}});
+    }
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+ protected:
+  static void _reencode_segments(EncodingAdvisorPlugin& plugin, const uint64_t memory_budget = 0) {
+    plugin._memory_budget = memory_budget;
+    plugin._reencode_segments();
+  }
+
+  static EncodingAdvisorPlugin::SegmentCharacteristics _sample_segment(const AbstractSegment& segment,
+                                                                       const DataType data_type) {
+    return EncodingAdvisorPlugin::_sample_segment(segment, data_type);
+  }
+
+  static std::vector<size_t> _select_encodings(
+      const std::vector<std::vector<EncodingAdvisorPlugin::EncodingCandidate>>& candidates,
+      const size_t memory_budget) {
+    return EncodingAdvisorPlugin::_select_encodings(candidates, memory_budget);
+  }
+
+  std::shared_ptr<AbstractSegment> _segment(const ChunkID chunk_id, const ColumnID column_id) const {
+    return _table->get_chunk(chunk_id)->get_segment(column_id);
+  }
+
+  const std::string _table_name{"advised_table"};
+  const ChunkOffset _chunk_size{10'000};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseEncodingAdvisorPlugin")));
+  EXPECT_TRUE(settings_manager.has_setting("EncodingAdvisorPlugin.MemoryBudget"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseEncodingAdvisorPlugin"));
+  EXPECT_FALSE(settings_manager.has_setting("EncodingAdvisorPlugin.MemoryBudget"));
+}
+
+TEST_F(EncodingAdvisorPluginTest, Description) {
+  EXPECT_EQ(EncodingAdvisorPlugin{}.description(), "Encoding advisor plugin");
+}
+
+TEST_F(EncodingAdvisorPluginTest, SampleSortedRuns) {
+  const auto characteristics = _sample_segment(*_segment(ChunkID{0}, ColumnID{0}), DataType::Int);
+  EXPECT_EQ(characteristics.row_count, _chunk_size);
+  EXPECT_EQ(characteristics.null_ratio, 0.0);
+  EXPECT_TRUE(characteristics.is_sorted);
+  EXPECT_EQ(characteristics.value_size, static_cast<double>(sizeof(int32_t)));
+
+  // Each sampled window of 64 rows contains at most two runs of 100 values.
+  EXPECT_GE(characteristics.average_run_length, 32.0);
+
+  // The 100 distinct values are estimated from the 16 to 32 distinct values of the sample.
+  EXPECT_GE(characteristics.estimated_distinct_count, 16);
+  EXPECT_LE(characteristics.estimated_distinct_count, 100);
+
+  // The sorted values of a block of 2048 rows span about 20 values.
+  ASSERT_TRUE(characteristics.frame_of_reference_bit_width);
+  EXPECT_LE(*characteristics.frame_of_reference_bit_width, 7);
+}
+
+TEST_F(EncodingAdvisorPluginTest, SampleStrings) {
+  const auto characteristics = _sample_segment(*_segment(ChunkID{0}, ColumnID{1}), DataType::String);
+  EXPECT_FALSE(characteristics.is_sorted);
+  EXPECT_EQ(characteristics.average_run_length, 1.0);
+  EXPECT_FALSE(characteristics.frame_of_reference_bit_width);
+  EXPECT_GE(characteristics.average_string_length, 33.0);
+  EXPECT_EQ(characteristics.max_string_length, std::string{"GET /index.html?id=9999 HTTP/1.1 200"}.size());
+
+  // The log lines share most of their characters.
+  EXPECT_GT(characteristics.fsst_compression_ratio, 2.0);
+}
+
+TEST_F(EncodingAdvisorPluginTest, SelectEncodings) {
+  const auto spec = SegmentEncodingSpec{EncodingType::Unencoded};
+  // The third candidate of the first segment is dominated by the second one.
+  const auto candidates = std::vector<std::vector<EncodingAdvisorPlugin::EncodingCandidate>>{
+      {{spec, 100, 1.0}, {spec, 50, 2.0}, {spec, 60, 3.0}, {spec, 10, 10.0}}, {{spec, 100, 1.0}, {spec, 20, 1.5}}};
+
+  EXPECT_EQ(_select_encodings(candidates, 1'000), std::vector<size_t>({0, 0}));
+
+  // Moving the second segment saves more memory per additional access cost.
+  EXPECT_EQ(_select_encodings(candidates, 160), std::vector<size_t>({0, 1}));
+  EXPECT_EQ(_select_encodings(candidates, 100), std::vector<size_t>({1, 1}));
+
+  // If the budget cannot be met, the smallest candidates are chosen.
+  EXPECT_EQ(_select_encodings(candidates, 0), std::vector<size_t>({3, 1}));
+}
+
+TEST_F(EncodingAdvisorPluginTest, CompressColdSegments) {
+  auto plugin = EncodingAdvisorPlugin{};
+  const auto string_memory_usage = _segment(ChunkID{0}, ColumnID{1})->memory_usage(MemoryUsageCalculationMode::Full);
+
+  _reencode_segments(plugin);
+  const auto run_segment = _segment(ChunkID{0}, ColumnID{0});
+  const auto string_segment = _segment(ChunkID{0}, ColumnID{1});
+  EXPECT_EQ(get_segment_encoding_spec(run_segment).encoding_type, EncodingType::RunLength);
+  EXPECT_NE(get_segment_encoding_spec(string_segment).encoding_type, EncodingType::Unencoded);
+  EXPECT_LT(string_segment->memory_usage(MemoryUsageCalculationMode::Full), string_memory_usage / 2);
+
+  // The segments of the mutable chunk are not encoded.
+  EXPECT_EQ(get_segment_encoding_spec(_segment(ChunkID{1}, ColumnID{0})).encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(get_segment_encoding_spec(_segment(ChunkID{1}, ColumnID{1})).encoding_type, EncodingType::Unencoded);
+
+  // Without new accesses, the segments are not re-encoded.
+  _reencode_segments(plugin);
+  EXPECT_EQ(_segment(ChunkID{0}, ColumnID{0}), run_segment);
+  EXPECT_EQ(_segment(ChunkID{0}, ColumnID{1}), string_segment);
+}
+
+TEST_F(EncodingAdvisorPluginTest, SkipIndexedSegments) {
+  // Re-encoding a segment would invalidate the indexes on it, including multi-column indexes in which it is not the
+  // first column.
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(),
+                             SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger});
+  chunk->create_index<CompositeGroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  const auto run_segment = _segment(ChunkID{0}, ColumnID{0});
+  const auto string_segment = _segment(ChunkID{0}, ColumnID{1});
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _reencode_segments(plugin);
+  EXPECT_EQ(_segment(ChunkID{0}, ColumnID{0}), run_segment);
+  EXPECT_EQ(_segment(ChunkID{0}, ColumnID{1}), string_segment);
+}
+
+TEST_F(EncodingAdvisorPluginTest, AdaptToAccessPattern) {
+  auto plugin = EncodingAdvisorPlugin{};
+  _reencode_segments(plugin);
+  EXPECT_EQ(get_segment_encoding_spec(_segment(ChunkID{0}, ColumnID{0})).encoding_type, EncodingType::RunLength);
+
+  // Random accesses to run-length encoded segments are expensive. With enough memory, the segment is not compressed.
+  _segment(ChunkID{0}, ColumnID{0})->access_counter[SegmentAccessCounter::AccessType::Random] += 100'000;
+  _reencode_segments(plugin, uint64_t{1} << 40);
+  const auto hot_segment = _segment(ChunkID{0}, ColumnID{0});
+  EXPECT_EQ(get_segment_encoding_spec(hot_segment).encoding_type, EncodingType::Unencoded);
+  EXPECT_GE(hot_segment->access_counter[SegmentAccessCounter::AccessType::Random].load(), 100'000);
+
+  // If the budget is exceeded, the segment is compressed again.
+  _reencode_segments(plugin, 1);
+  EXPECT_EQ(get_segment_encoding_spec(_segment(ChunkID{0}, ColumnID{0})).encoding_type, EncodingType::RunLength);
+}
+
+}  // namespace hyrise